@@ -70,6 +70,24 @@ hipsparseStatus_t hipsparse_record_timing(double msec, double gflops, double gbs
     }
 }
 
+hipsparseStatus_t hipsparse_record_latency(int streams, double msec)
+{
+    auto* s_bench_app = hipsparse_bench_app::instance();
+    if(s_bench_app == nullptr || false == s_bench_app->is_stdout_disabled())
+    {
+        std::cout << "streams " << streams << ", latency " << msec << " msec" << std::endl;
+    }
+
+    if(s_bench_app)
+    {
+        return s_bench_app->record_latency(streams, msec);
+    }
+    else
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
 bool display_timing_info_is_stdout_disabled()
 {
     auto* s_bench_app = hipsparse_bench_app::instance();
@@ -108,6 +126,15 @@ int main(int argc, char* argv[])
                 return status;
             }
 
+            //
+            // EXPORT TUNING DATABASE.
+            //
+            status = s_bench_app->export_tuning();
+            if(status != HIPSPARSE_STATUS_SUCCESS)
+            {
+                return status;
+            }
+
             return status;
         }
         catch(const hipsparseStatus_t& status)
@@ -226,9 +226,9 @@ void hipsparse_arguments_config::set_description(options_description& desc)
      value<std::string>(&this->function_name)->default_value("axpyi"),
      "SPARSE function to test. Options:\n"
      "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-     "  Level2: bsrsv2, coomv, csrmv, csrsv, gemvi, hybmv\n"
+     "  Level2: bsrsv2, coomv, csrmv, csrmv_plan, csrsv, csrsv_update, gemvi, hybmv\n"
      "  Level3: bsrmm, bsrsm2, coomm, cscmm, csrmm, coosm, csrsm, gemmi\n"
-     "  Extra: csrgeam, csrgemm\n"
+     "  Extra: csrgeam, csrgemm, csrgemm2_numeric\n"
      "  Preconditioner: bsric02, bsrilu02, csric02, csrilu02, gtsv2, gtsv2_nopivot, gtsv2_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
      "  Conversion: bsr2csr, csr2coo, csr2csc, csr2hyb, csr2bsr, csr2gebsr, csr2csr_compress, coo2csr, hyb2csr, csr2dense, csc2dense, coo2dense\n"
      "              dense2csr, dense2csc, dense2coo, gebsr2csr, gebsr2gebsc, gebsr2gebsr\n")
@@ -248,6 +248,18 @@ void hipsparse_arguments_config::set_description(options_description& desc)
      value<int>(&this->iters)->default_value(10),
      "Iterations to run inside timing loop")
 
+    ("cold",
+     value<int>(&this->cold)->default_value(0),
+     "Cold cache timing: flush the caches before each call of the timing loop, the flush is not timed. 0 = No, 1 = Yes (default: No)")
+
+    ("cold_flush_size",
+     value<int>(&this->cold_flush_size)->default_value(0),
+     "Size in MB of the buffer used to flush the caches, 0 = based on the device cache size (default: 0)")
+
+    ("streams",
+     value<int>(&this->streams)->default_value(1),
+     "Concurrent timing: dispatch the calls of the timing loop round-robin to this number of handles, each with its own stream. Reports the aggregate throughput and the latency per call (default: 1)")
+
     ("device,d",
      value<int>(&this->device_id)->default_value(0),
      "Set default device to be used for subsequent program runs")
@@ -24,8 +24,12 @@
 
 #include "hipsparse_bench_app.hpp"
 #include "hipsparse_bench.hpp"
+#include "hipsparse_bench_tuner.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "utility.hpp"
 
 #include <fstream>
+#include <iomanip>
 #include <random>
 
 hipsparse_bench_app* hipsparse_bench_app::s_instance = nullptr;
@@ -34,13 +38,111 @@ hipsparse_bench_app_base::hipsparse_bench_app_base(int argc, char** argv)
     : m_initial_argc(hipsparse_bench_app_base::save_initial_cmdline(argc, argv, &m_initial_argv))
     , m_bench_cmdlines(argc, argv)
     , m_bench_timing(m_bench_cmdlines.get_nsamples(), m_bench_cmdlines.get_nruns())
+{
+    const char* peak_filename = this->m_bench_cmdlines.get_peak_filename();
+    if(peak_filename != nullptr)
+    {
+        if(false == this->m_peak.load(peak_filename))
+        {
+            exit(1);
+        }
+        this->m_has_peak = true;
+    }
+    else
+    {
+        //
+        // !!! To fix, not necessarily the gpu used from hipsparse_bench.
+        //
+        hipDeviceProp_t prop;
+        if(hipGetDeviceProperties(&prop, 0) == hipSuccess)
+        {
+            this->m_peak.estimate(prop);
+            this->m_has_peak = (this->m_peak.bandwidth > 0.0);
+        }
+    }
+};
 
-          {};
+double hipsparse_bench_app_base::median(std::vector<double> v)
+{
+    const size_t n = v.size();
+    if(n == 0)
+    {
+        return 0.0;
+    }
+    std::sort(v.begin(), v.end());
+    return (n % 2 == 0) ? (v[n / 2 - 1] + v[n / 2]) * 0.5 : v[n / 2];
+}
+
+void hipsparse_bench_app_base::print_roofline(std::ostream& out) const
+{
+    const int nsamples = this->m_bench_cmdlines.get_nsamples();
+    out << "// roofline, peak " << this->m_peak.bandwidth << " GB/s";
+    if(this->m_peak.get_gflops('s') > 0.0)
+    {
+        out << ", " << this->m_peak.get_gflops('s') << " GFlop/s (s)";
+    }
+    out << " (" << this->m_peak.name << ")" << std::endl;
+    out << "// sample       intensity    bound(GFlop/s)    %bound    %bandwidth    regime"
+        << std::endl;
+    for(int isample = 0; isample < nsamples; ++isample)
+    {
+        const auto&                    item = this->m_bench_timing[isample];
+        const hipsparse_bench_roofline r(this->m_peak,
+                                         this->m_bench_cmdlines.get_precision(isample),
+                                         median(item.gflops),
+                                         median(item.gbs));
+        out << "// " << std::setw(6) << isample << std::setw(16) << r.intensity << std::setw(18)
+            << r.bound_gflops << std::setw(10) << r.bound_percent << std::setw(14)
+            << r.bandwidth_percent << "    " << (r.memory_bound ? "memory" : "compute")
+            << std::endl;
+    }
+}
 
 hipsparseStatus_t hipsparse_bench_app_base::run_case(int isample, int irun, int argc, char** argv)
 {
     hipsparse_bench bench(argc, argv);
-    return bench.run();
+
+    //
+    // Cases of a suite share one handle, created once the device is set.
+    //
+    if(this->m_bench_cmdlines.is_suite() && hipsparse_test::handle_struct::shared() == nullptr)
+    {
+        hipsparseStatus_t status = hipsparseCreate(&hipsparse_test::handle_struct::shared());
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    //
+    // Memory footprint of the case.
+    //
+    hipsparse_test::device_memory::reset_peak();
+    hipsparseStatus_t status = hipsparseResetInternalMemoryUsage();
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = bench.run();
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    size_t internal = 0;
+    status          = hipsparseGetInternalMemoryUsage(nullptr, &internal);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    this->m_bench_timing[isample].record_memory(
+        hipsparse_test::device_memory::get_peak(hipsparse_test::device_memory::data),
+        hipsparse_test::device_memory::get_peak(hipsparse_test::device_memory::buffer),
+        internal,
+        hipsparse_test::device_memory::get_peak() + internal);
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparse_bench_app_base::run_cases()
@@ -57,9 +159,35 @@ hipsparseStatus_t hipsparse_bench_app_base::run_cases()
         printf("// start benchmarking ... (nsamples = %d, nruns = %d)\n", nsamples, nruns);
     }
 
+    //
+    // Matrices of a suite are read once, samples are ordered by matrix.
+    //
+    const bool is_suite                = this->m_bench_cmdlines.is_suite();
+    hipsparse_matrix_cache_enabled()   = is_suite;
+    const std::string* previous_matrix = nullptr;
+
     for(int isample = 0; isample < nsamples; ++isample)
     {
         this->m_isample = isample;
+        if(is_suite)
+        {
+            const std::string& matrix = this->m_bench_cmdlines.get_matrix(isample);
+            if(previous_matrix != nullptr && *previous_matrix != matrix)
+            {
+                hipsparse_matrix_cache_clear();
+            }
+            previous_matrix = &matrix;
+        }
+
+        //
+        // The number of arguments may differ between samples of a suite or of a tuning.
+        //
+        if((is_suite || this->m_bench_cmdlines.is_tuning()) && sample_argv != nullptr)
+        {
+            delete[] sample_argv;
+            sample_argv = nullptr;
+        }
+
         //
         // Add an item to collect data through hipsparse_record_timing
         //
@@ -105,6 +233,22 @@ hipsparseStatus_t hipsparse_bench_app_base::run_cases()
         printf("\r// benchmarking done.\n");
     }
 
+    if(this->m_has_peak)
+    {
+        this->print_roofline(std::cout);
+    }
+
+    if(is_suite)
+    {
+        hipsparse_matrix_cache_clear();
+        hipsparse_matrix_cache_enabled() = false;
+        if(hipsparse_test::handle_struct::shared() != nullptr)
+        {
+            hipsparseDestroy(hipsparse_test::handle_struct::shared());
+            hipsparse_test::handle_struct::shared() = nullptr;
+        }
+    }
+
     if(sample_argv != nullptr)
     {
         delete[] sample_argv;
@@ -153,7 +297,80 @@ void hipsparse_bench_app::confidence_interval(const double               alpha,
 #undef median_value
 }
 
-void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_t::item_t& item)
+//
+// @brief Export the time of every run, so that two result files can be compared with a statistical test.
+//
+void hipsparse_bench_app::export_samples(std::ostream&                           out,
+                                         const hipsparse_bench_timing_t::item_t& item)
+{
+    out << "," << std::endl << "    \"time_samples\": [";
+    for(int irun = 0; irun < item.m_nruns; ++irun)
+    {
+        if(irun > 0)
+            out << ", ";
+        out << "\"" << item.msec[irun] << "\"";
+    }
+    out << "]";
+}
+
+//
+// @brief Export the concurrent mode of a sample, the time is then the inverse of the throughput
+// and the latency is the median over the runs of the mean latency of a call.
+//
+void hipsparse_bench_app::export_concurrency(std::ostream&                           out,
+                                             const hipsparse_bench_timing_t::item_t& item)
+{
+    if(item.streams <= 1)
+    {
+        return;
+    }
+
+    out << "," << std::endl
+        << "    \"concurrency\": { \"streams\": \"" << item.streams << "\", \"latency\": \""
+        << median(item.latency) << "\" }";
+}
+
+//
+// @brief Export the peak device memory of a sample in bytes.
+// @details
+// data is matrices, vectors and output arrays allocated by the client, buffer is external
+// buffers, internal is the memory allocated by hipSPARSE itself. peak is an upper bound
+// of the footprint, internal memory may not be allocated at the time of the client peak.
+//
+void hipsparse_bench_app::export_memory(std::ostream&                           out,
+                                        const hipsparse_bench_timing_t::item_t& item)
+{
+    out << "," << std::endl
+        << "    \"memory\": { \"data\": \"" << item.memory_data << "\", \"buffer\": \""
+        << item.memory_buffer << "\", \"internal\": \"" << item.memory_internal
+        << "\", \"peak\": \"" << item.memory_peak << "\" }";
+}
+
+//
+// @brief Export the roofline of a sample from its median GFlop/s and GB/s.
+//
+void hipsparse_bench_app::export_roofline(std::ostream& out,
+                                          char          precision,
+                                          double        gflops,
+                                          double        gbs)
+{
+    if(false == this->m_has_peak)
+    {
+        return;
+    }
+
+    const hipsparse_bench_roofline r(this->m_peak, precision, gflops, gbs);
+    out << "," << std::endl
+        << "    \"roofline\": { \"intensity\": \"" << r.intensity << "\", \"bound\": \""
+        << r.bound_gflops << "\", \"bound_percent\": \"" << r.bound_percent
+        << "\", \"bandwidth_percent\": \"" << r.bandwidth_percent
+        << "\", \"gflops_percent\": \"" << r.gflops_percent << "\", \"regime\": \""
+        << (r.memory_bound ? "memory" : "compute") << "\" }";
+}
+
+void hipsparse_bench_app::export_item(std::ostream&                           out,
+                                      const hipsparse_bench_timing_t::item_t& item,
+                                      const hipsparse_bench_record&           record)
 {
     //
     //
@@ -161,29 +378,17 @@ void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_
     auto N = item.m_nruns;
     if(N > 1)
     {
-        const double alpha = 0.95;
-        std::sort(item.msec.begin(), item.msec.end());
-        std::sort(item.gflops.begin(), item.gflops.end());
-        std::sort(item.gbs.begin(), item.gbs.end());
-        double msec
-            = (N % 2 == 0) ? (item.msec[N / 2 - 1] + item.msec[N / 2]) * 0.5 : item.msec[N / 2];
-        double gflops = (N % 2 == 0) ? (item.gflops[N / 2 - 1] + item.gflops[N / 2]) * 0.5
-                                     : item.gflops[N / 2];
-        double gbs = (N % 2 == 0) ? (item.gbs[N / 2 - 1] + item.gbs[N / 2]) * 0.5 : item.gbs[N / 2];
-
-        double interval_msec[2], interval_gflops[2], interval_gbs[2];
-        int    nboots = 200;
-        confidence_interval(alpha, 10, nboots, item.msec, interval_msec);
-        confidence_interval(alpha, 10, nboots, item.gflops, interval_gflops);
-        confidence_interval(alpha, 10, nboots, item.gbs, interval_gbs);
-
         out << std::endl
-            << "    \"time\": [\"" << msec << "\", \"" << interval_msec[0] << "\", \""
-            << interval_msec[1] << "\"]," << std::endl;
-        out << "    \"flops\": [\"" << gflops << "\", \"" << interval_gflops[0] << "\", \""
-            << interval_gflops[1] << "\"]," << std::endl;
-        out << "    \"bandwidth\": [\"" << gbs << "\", \"" << interval_gbs[0] << "\", \""
-            << interval_gbs[1] << "\"]";
+            << "    \"time\": [\"" << record.time[0] << "\", \"" << record.time[1] << "\", \""
+            << record.time[2] << "\"]," << std::endl;
+        out << "    \"flops\": [\"" << record.gflops[0] << "\", \"" << record.gflops[1] << "\", \""
+            << record.gflops[2] << "\"]," << std::endl;
+        out << "    \"bandwidth\": [\"" << record.gbs[0] << "\", \"" << record.gbs[1] << "\", \""
+            << record.gbs[2] << "\"]";
+        this->export_samples(out, item);
+        this->export_memory(out, item);
+        this->export_concurrency(out, item);
+        this->export_roofline(out, record.precision, record.gflops[0], record.gbs[0]);
 
         if(!no_rawdata())
         {
@@ -202,6 +407,10 @@ void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_
             << item.gflops[0] << "\"]," << std::endl;
         out << "\"bandwidth\": [\"" << item.gbs[0] << "\", \"" << item.gbs[0] << "\", \""
             << item.gbs[0] << "\"]";
+        this->export_samples(out, item);
+        this->export_memory(out, item);
+        this->export_concurrency(out, item);
+        this->export_roofline(out, record.precision, item.gflops[0], item.gbs[0]);
         if(!no_rawdata())
         {
             out << ",";
@@ -214,6 +423,93 @@ void hipsparse_bench_app::export_item(std::ostream& out, hipsparse_bench_timing_
     }
 }
 
+//
+// @brief Summarize a sample, medians and confidence intervals are computed once for all formats.
+//
+hipsparse_bench_record hipsparse_bench_app::make_record(int isample)
+{
+    const auto&            item = this->m_bench_timing[isample];
+    hipsparse_bench_record r;
+
+    int                sample_argc;
+    std::vector<char*> sample_argv;
+    this->m_bench_cmdlines.get_argc(isample, sample_argc);
+    sample_argv.resize(sample_argc);
+    this->m_bench_cmdlines.get(isample, sample_argc, sample_argv.data());
+    for(int i = 0; i < sample_argc; ++i)
+    {
+        if(i > 0)
+            r.cmdline += " ";
+        r.cmdline += sample_argv[i];
+    }
+
+    r.function  = this->m_bench_cmdlines.get_function(isample);
+    r.precision = this->m_bench_cmdlines.get_precision(isample);
+    r.indextype = this->m_bench_cmdlines.get_indextype(isample);
+    r.matrix    = this->m_bench_cmdlines.get_matrix(isample);
+    r.nruns     = item.m_nruns;
+
+    const std::vector<double>* values[3]    = {&item.msec, &item.gflops, &item.gbs};
+    double*                    summaries[3] = {r.time, r.gflops, r.gbs};
+    for(int k = 0; k < 3; ++k)
+    {
+        summaries[k][0] = median(*values[k]);
+        if(item.m_nruns > 1)
+        {
+            confidence_interval(0.95, 10, 200, *values[k], summaries[k] + 1);
+        }
+        else
+        {
+            summaries[k][1] = summaries[k][0];
+            summaries[k][2] = summaries[k][0];
+        }
+    }
+
+    r.memory_data     = item.memory_data;
+    r.memory_buffer   = item.memory_buffer;
+    r.memory_internal = item.memory_internal;
+    r.memory_peak     = item.memory_peak;
+    r.streams         = item.streams;
+    r.latency         = median(item.latency);
+
+    if(this->m_has_peak)
+    {
+        const hipsparse_bench_roofline roofline(this->m_peak, r.precision, r.gflops[0], r.gbs[0]);
+        r.has_roofline      = true;
+        r.intensity         = roofline.intensity;
+        r.bound_percent     = roofline.bound_percent;
+        r.bandwidth_percent = roofline.bandwidth_percent;
+        r.memory_bound      = roofline.memory_bound;
+    }
+    return r;
+}
+
+//
+// @brief Return the date of the results, without the trailing new line of ctime.
+//
+static std::string get_date()
+{
+    auto        end      = std::chrono::system_clock::now();
+    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
+    std::string str(std::ctime(&end_time));
+    if(false == str.empty() && str.back() == '\n')
+    {
+        str.pop_back();
+    }
+    return str;
+}
+
+//
+// @brief Return the date of the results in ISO 8601, as expected by JUnit reports.
+//
+static std::string get_iso_date()
+{
+    std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    char        str[32];
+    std::strftime(str, sizeof(str), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    return str;
+}
+
 hipsparseStatus_t hipsparse_bench_app::export_file()
 {
     const char* ofilename = this->m_bench_cmdlines.get_ofilename();
@@ -227,10 +523,109 @@ hipsparseStatus_t hipsparse_bench_app::export_file()
         ofilename = "a.json";
     }
 
+    const size_t nsamples = m_bench_cmdlines.get_nsamples();
+    if(nsamples != m_bench_timing.size())
+    {
+        std::cerr << "incompatible sizes at line " << __LINE__ << " "
+                  << m_bench_cmdlines.get_nsamples() << " " << m_bench_timing.size() << std::endl;
+        if(m_bench_timing.size() == 0)
+        {
+            std::cerr << "No data has been harvested from running case" << std::endl;
+        }
+        exit(1);
+    }
+
+    std::vector<hipsparse_bench_record> records(nsamples);
+    for(int isample = 0; isample < nsamples; ++isample)
+    {
+        records[isample] = this->make_record(isample);
+    }
+
+    for(const auto& format : this->m_bench_cmdlines.get_formats())
+    {
+        hipsparseStatus_t status = (format == "json")
+                                       ? this->export_json(ofilename, records)
+                                       : this->export_writer(format, ofilename, records);
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// @brief Write the results with a writer of hipsparse_bench_writer, the file is the output
+// filename with the extension of the format.
+//
+hipsparseStatus_t
+    hipsparse_bench_app::export_writer(const std::string&                         format,
+                                       const char*                                ofilename,
+                                       const std::vector<hipsparse_bench_record>& records)
+{
+    auto writer = hipsparse_bench_writer::create(format);
+    if(writer == nullptr)
+    {
+        std::cerr << "unknown result format '" << format << "'" << std::endl;
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::string filename(ofilename);
+    const auto  dot   = filename.find_last_of('.');
+    const auto  slash = filename.find_last_of('/');
+    if(dot != std::string::npos && (slash == std::string::npos || dot > slash))
+    {
+        filename.resize(dot);
+    }
+    filename += writer->extension();
+
+    std::ofstream out(filename);
+    if(!out)
+    {
+        std::cerr << "cannot open file '" << filename << "'" << std::endl;
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    hipsparse_bench_report report;
+    report.date    = get_iso_date();
+    report.version = hipsparse_get_version();
+    report.cmdline = this->m_initial_argv[0];
+    for(int i = 1; i < this->m_initial_argc; ++i)
+    {
+        report.cmdline += std::string(" ") + this->m_initial_argv[i];
+    }
+    if(this->m_bench_cmdlines.is_suite())
+    {
+        report.suite = this->m_bench_cmdlines.get_suite_name();
+    }
+
+    //
+    // !!! To fix, not necessarily the gpu used from hipsparse_bench.
+    //
+    hipDeviceProp_t prop;
+    if(hipGetDeviceProperties(&prop, 0) == hipSuccess)
+    {
+        report.device = prop.name;
+    }
+
+    writer->begin(out, report);
+    for(const auto& record : records)
+    {
+        writer->write(out, record);
+    }
+    writer->end(out);
+    out.close();
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparse_bench_app::export_json(const char*                                ofilename,
+                                     const std::vector<hipsparse_bench_record>& records)
+{
     std::ofstream out(ofilename);
 
-    int   sample_argc;
-    char* sample_argv[64];
+    int                sample_argc;
+    std::vector<char*> sample_argv;
 
     hipsparseStatus_t status;
 
@@ -247,29 +642,20 @@ hipsparseStatus_t hipsparse_bench_app::export_file()
     //
     // Loop over cases.
     //
-    const size_t nsamples = m_bench_cmdlines.get_nsamples();
-    if(nsamples != m_bench_timing.size())
-    {
-        std::cerr << "incompatible sizes at line " << __LINE__ << " "
-                  << m_bench_cmdlines.get_nsamples() << " " << m_bench_timing.size() << std::endl;
-        if(m_bench_timing.size() == 0)
-        {
-            std::cerr << "No data has been harvested from running case" << std::endl;
-        }
-        exit(1);
-    }
-
+    const size_t nsamples = records.size();
     for(int isample = 0; isample < nsamples; ++isample)
     {
-        this->m_bench_cmdlines.get(isample, sample_argc, sample_argv);
+        this->m_bench_cmdlines.get_argc(isample, sample_argc);
+        sample_argv.resize(sample_argc);
+        this->m_bench_cmdlines.get(isample, sample_argc, sample_argv.data());
 
-        this->define_case_json(out, isample, sample_argc, sample_argv);
+        this->define_case_json(out, isample, sample_argc, sample_argv.data());
         out << "{ ";
         {
-            this->export_item(out, this->m_bench_timing[isample]);
+            this->export_item(out, this->m_bench_timing[isample], records[isample]);
         }
         out << " }";
-        this->close_case_json(out, isample, sample_argc, sample_argv);
+        this->close_case_json(out, isample, sample_argc, sample_argv.data());
     }
 
     //
@@ -285,6 +671,57 @@ hipsparseStatus_t hipsparse_bench_app::export_file()
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+//
+// @brief Merge the fastest algorithm of every tuned sample into the tuning database.
+//
+hipsparseStatus_t hipsparse_bench_app::export_tuning()
+{
+    const char* filename = this->m_bench_cmdlines.get_tune_filename();
+    if(filename == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    std::vector<hipsparse_bench_tuner::record> records;
+    const int                                  nsamples = this->m_bench_cmdlines.get_nsamples();
+    for(int isample = 0; isample < nsamples; ++isample)
+    {
+        const char* option = this->m_bench_cmdlines.get_tune_option(isample);
+        if(option == nullptr)
+        {
+            continue;
+        }
+
+        //
+        // Candidates of a base sample are consecutive, the first one is the default.
+        //
+        const auto& item = this->m_bench_timing[isample];
+        if(isample == 0
+           || this->m_bench_cmdlines.get_tune_base(isample)
+                  != this->m_bench_cmdlines.get_tune_base(isample - 1))
+        {
+            hipsparse_bench_tuner::record r;
+            r.routine   = this->m_bench_cmdlines.get_function(isample);
+            r.precision = this->m_bench_cmdlines.get_precision(isample);
+            r.indextype = this->m_bench_cmdlines.get_indextype(isample);
+            r.option    = option;
+            hipsparse_bench_tuner::get_features(item.outputs_legend, item.outputs[0], r);
+            records.push_back(r);
+        }
+
+        hipsparse_bench_tuner::candidate c;
+        c.value = this->m_bench_cmdlines.get_tune_value(isample);
+        c.msec  = item.msec;
+        records.back().candidates.push_back(c);
+    }
+
+    if(false == hipsparse_bench_tuner::export_db(filename, records, std::cout))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t
     hipsparse_bench_app::define_case_json(std::ostream& out, int isample, int argc, char** argv)
 {
@@ -296,6 +733,11 @@ hipsparseStatus_t
     for(int i = 1; i < argc; ++i)
         out << " " << argv[i];
     out << " \"," << std::endl;
+    if(this->m_bench_cmdlines.is_suite())
+    {
+        out << "  \"matrix\": \"" << this->m_bench_cmdlines.get_matrix(isample) << "\","
+            << std::endl;
+    }
     out << "  \"timing\": ";
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -310,16 +752,7 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparse_bench_app::define_results_json(std::ostream& out)
 {
     out << "{" << std::endl;
-    auto        end      = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
-    char*       str      = std::ctime(&end_time);
-    for(int i = 0; i >= 0; ++i)
-        if(str[i] == '\n')
-        {
-            str[i] = '\0';
-            break;
-        }
-    out << "\"date\": \"" << str << "\"," << std::endl;
+    out << "\"date\": \"" << get_date() << "\"," << std::endl;
     out << "\"hipSPARSE version\": \"" << hipsparse_get_version() << "\"," << std::endl;
 
     //
@@ -330,6 +763,15 @@ hipsparseStatus_t hipsparse_bench_app::define_results_json(std::ostream& out)
     gpu_config g(prop);
     g.print_json(out);
 
+    if(this->m_has_peak)
+    {
+        out << std::endl
+            << "\"config peak\": { \"name\": \"" << this->m_peak.name << "\", \"bandwidth\": \""
+            << this->m_peak.bandwidth << "\", \"gflops\": [\"" << this->m_peak.get_gflops('s')
+            << "\", \"" << this->m_peak.get_gflops('d') << "\", \"" << this->m_peak.get_gflops('c')
+            << "\", \"" << this->m_peak.get_gflops('z') << "\"] }," << std::endl;
+    }
+
     out << std::endl << "\"cmdline\": \"" << this->m_initial_argv[0];
 
     for(int i = 1; i < this->m_initial_argc; ++i)
@@ -338,6 +780,31 @@ hipsparseStatus_t hipsparse_bench_app::define_results_json(std::ostream& out)
     }
     out << "\"," << std::endl;
 
+    //
+    // A suite or a tuning has no x/y expansion to plot.
+    //
+    if(this->m_bench_cmdlines.is_suite() || this->m_bench_cmdlines.is_tuning())
+    {
+        if(this->m_bench_cmdlines.is_suite())
+        {
+            out << std::endl
+                << "\"suite\": \"" << this->m_bench_cmdlines.get_suite_name() << "\","
+                << std::endl;
+        }
+        if(this->m_bench_cmdlines.is_tuning())
+        {
+            out << std::endl
+                << "\"tune\": \"" << this->m_bench_cmdlines.get_tune_filename() << "\","
+                << std::endl;
+        }
+        out << std::endl << "\"xargs\": []," << std::endl;
+        out << std::endl << "\"yargs\": []," << std::endl << std::endl;
+        out << "\""
+            << "results"
+            << "\": [";
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     size_t option_index_x = this->m_bench_cmdlines.get_option_index_x();
     out << std::endl << "\"xargs\": \[";
     for(int j = 0; j < this->m_bench_cmdlines.get_option_nargs(option_index_x); ++j)
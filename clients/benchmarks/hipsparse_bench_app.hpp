@@ -25,6 +25,9 @@
 
 #include "hipsparse.h"
 #include "hipsparse_bench_cmdlines.hpp"
+#include "hipsparse_bench_roofline.hpp"
+#include "hipsparse_bench_writer.hpp"
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -44,6 +47,20 @@ struct hipsparse_bench_timing_t
         std::vector<double>      gbs{};
         std::vector<std::string> outputs{};
         std::string              outputs_legend{};
+
+        //
+        // Peak device memory in bytes over the runs, see hipsparse_test::device_memory.
+        //
+        size_t memory_data{};
+        size_t memory_buffer{};
+        size_t memory_internal{};
+        size_t memory_peak{};
+
+        //
+        // Concurrent mode, number of streams and mean latency of a call per run.
+        //
+        int                 streams{1};
+        std::vector<double> latency{};
         item_t(){};
 
         explicit item_t(int nruns_)
@@ -51,7 +68,8 @@ struct hipsparse_bench_timing_t
             , msec(nruns_)
             , gflops(nruns_)
             , gbs(nruns_)
-            , outputs(nruns_){};
+            , outputs(nruns_)
+            , latency(nruns_){};
 
         item_t& operator()(int nruns_)
         {
@@ -60,6 +78,7 @@ struct hipsparse_bench_timing_t
             this->gflops.resize(nruns_);
             this->gbs.resize(nruns_);
             this->outputs.resize(nruns_);
+            this->latency.resize(nruns_);
             return *this;
         };
 
@@ -95,6 +114,28 @@ struct hipsparse_bench_timing_t
             this->outputs_legend = s;
             return HIPSPARSE_STATUS_SUCCESS;
         }
+
+        hipsparseStatus_t record_latency(int irun, int streams_, double msec_)
+        {
+            if(irun >= 0 && irun < m_nruns)
+            {
+                this->streams       = streams_;
+                this->latency[irun] = msec_;
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            else
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        void record_memory(size_t data_, size_t buffer_, size_t internal_, size_t peak_)
+        {
+            this->memory_data     = std::max(this->memory_data, data_);
+            this->memory_buffer   = std::max(this->memory_buffer, buffer_);
+            this->memory_internal = std::max(this->memory_internal, internal_);
+            this->memory_peak     = std::max(this->memory_peak, peak_);
+        }
     };
 
     size_t size() const
@@ -140,6 +181,12 @@ protected:
     //
     hipsparse_bench_timing_t m_bench_timing;
 
+    //
+    // Peak performance for the roofline, m_has_peak is false if it is unknown.
+    //
+    hipsparse_bench_peak m_peak{};
+    bool                 m_has_peak{};
+
     bool m_stdout_disabled{true};
 
     static int save_initial_cmdline(int argc, char** argv, char*** argv_)
@@ -161,6 +208,13 @@ protected:
     //
     hipsparseStatus_t run_case(int isample, int irun, int argc, char** argv);
 
+    //
+    // @brief Print the roofline of every sample.
+    //
+    void print_roofline(std::ostream& out) const;
+
+    static double median(std::vector<double> v);
+
     //
     // For internal use, to get the current isample and irun.
     //
@@ -219,10 +273,15 @@ public:
     hipsparse_bench_app(int argc, char** argv);
     ~hipsparse_bench_app();
     hipsparseStatus_t export_file();
+    hipsparseStatus_t export_tuning();
     hipsparseStatus_t record_timing(double msec, double gflops, double bandwidth)
     {
         return this->m_bench_timing[this->m_isample].record(this->m_irun, msec, gflops, bandwidth);
     }
+    hipsparseStatus_t record_latency(int streams, double msec)
+    {
+        return this->m_bench_timing[this->m_isample].record_latency(this->m_irun, streams, msec);
+    }
     hipsparseStatus_t record_output(const std::string& s)
     {
         return this->m_bench_timing[this->m_isample].record(this->m_irun, s);
@@ -233,7 +292,22 @@ public:
     }
 
 protected:
-    void              export_item(std::ostream& out, hipsparse_bench_timing_t::item_t& item);
+    void              export_item(std::ostream&                           out,
+                                  const hipsparse_bench_timing_t::item_t& item,
+                                  const hipsparse_bench_record&           record);
+    hipsparse_bench_record make_record(int isample);
+    hipsparseStatus_t      export_json(const char*                                ofilename,
+                                       const std::vector<hipsparse_bench_record>& records);
+    hipsparseStatus_t      export_writer(const std::string&                         format,
+                                         const char*                                ofilename,
+                                         const std::vector<hipsparse_bench_record>& records);
+    void              export_roofline(std::ostream& out, char precision, double gflops, double gbs);
+    void              export_samples(std::ostream&                           out,
+                                     const hipsparse_bench_timing_t::item_t& item);
+    void              export_memory(std::ostream&                           out,
+                                    const hipsparse_bench_timing_t::item_t& item);
+    void              export_concurrency(std::ostream&                           out,
+                                         const hipsparse_bench_timing_t::item_t& item);
     hipsparseStatus_t define_case_json(std::ostream& out, int isample, int argc, char** argv);
     hipsparseStatus_t close_case_json(std::ostream& out, int isample, int argc, char** argv);
     hipsparseStatus_t define_results_json(std::ostream& out);
@@ -1,10 +1,19 @@
 #include "hipsparse_bench_cmdlines.hpp"
+#include "hipsparse_bench_tuner.hpp"
+#include "hipsparse_bench_writer.hpp"
+
+#include <algorithm>
 
 //
 // @brief Get the output filename.
 //
 const char* hipsparse_bench_cmdlines::get_ofilename() const
 {
+    if(this->is_suite() && this->m_cmd.get_ofilename() == nullptr
+       && false == this->m_suite.get_ofilename().empty())
+    {
+        return this->m_suite.get_ofilename().c_str();
+    }
     return this->m_cmd.get_ofilename();
 }
 
@@ -13,7 +22,7 @@ const char* hipsparse_bench_cmdlines::get_ofilename() const
 //
 int hipsparse_bench_cmdlines::get_nsamples() const
 {
-    return this->m_cmd.get_nsamples();
+    return this->m_nsamples;
 };
 size_t hipsparse_bench_cmdlines::get_option_index_x() const
 {
@@ -54,9 +63,98 @@ bool hipsparse_bench_cmdlines::no_rawdata() const
 //
 int hipsparse_bench_cmdlines::get_nruns() const
 {
+    if(this->is_suite() && false == this->m_cmd.has_bench_nruns() && this->m_suite.get_nruns() > 0)
+    {
+        return this->m_suite.get_nruns();
+    }
     return this->m_cmd.get_nruns();
 };
 
+const std::vector<std::string>& hipsparse_bench_cmdlines::get_formats() const
+{
+    return this->m_formats;
+}
+
+const char* hipsparse_bench_cmdlines::get_peak_filename() const
+{
+    return this->m_cmd.get_peak_filename();
+}
+
+const char* hipsparse_bench_cmdlines::get_option_value(int         isample,
+                                                       const char* name,
+                                                       const char* short_name) const
+{
+    const auto& cmdsample = this->m_cmdset[isample];
+    for(int j = 1; j + 1 < cmdsample.argc; ++j)
+    {
+        if(!strcmp(cmdsample.argv[j], name)
+           || (short_name != nullptr && !strcmp(cmdsample.argv[j], short_name)))
+        {
+            return cmdsample.argv[j + 1];
+        }
+    }
+    return nullptr;
+}
+
+char hipsparse_bench_cmdlines::get_precision(int isample) const
+{
+    const char* precision = this->get_option_value(isample, "--precision", "-r");
+    return (precision != nullptr) ? precision[0] : 's';
+}
+
+char hipsparse_bench_cmdlines::get_indextype(int isample) const
+{
+    const char* indextype = this->get_option_value(isample, "--indextype", nullptr);
+    return (indextype != nullptr) ? indextype[0] : 's';
+}
+
+const char* hipsparse_bench_cmdlines::get_function(int isample) const
+{
+    const char* function = this->get_option_value(isample, "--function", "-f");
+    return (function != nullptr) ? function : "axpyi";
+}
+
+bool hipsparse_bench_cmdlines::is_tuning() const
+{
+    return this->m_cmd.get_tune_filename() != nullptr;
+}
+
+const char* hipsparse_bench_cmdlines::get_tune_filename() const
+{
+    return this->m_cmd.get_tune_filename();
+}
+
+int hipsparse_bench_cmdlines::get_tune_base(int isample) const
+{
+    return this->is_tuning() ? this->m_tune_base[isample] : isample;
+}
+
+const char* hipsparse_bench_cmdlines::get_tune_option(int isample) const
+{
+    return this->is_tuning() ? this->m_tune_option[isample] : nullptr;
+}
+
+int hipsparse_bench_cmdlines::get_tune_value(int isample) const
+{
+    return this->is_tuning() ? this->m_tune_value[isample] : 0;
+}
+
+bool hipsparse_bench_cmdlines::is_suite() const
+{
+    return this->m_cmd.get_suite_filename() != nullptr;
+}
+
+const char* hipsparse_bench_cmdlines::get_suite_name() const
+{
+    return this->is_suite() ? this->m_suite.get_name().c_str() : nullptr;
+}
+
+const std::string& hipsparse_bench_cmdlines::get_matrix(int isample) const
+{
+    static const std::string none{};
+    return this->is_suite() ? this->m_suite.get_matrix(this->get_tune_base(isample)) : none;
+}
+
 //
 // @brief Copy the command line arguments corresponding to a given sample.
 //
@@ -90,18 +188,182 @@ hipsparse_bench_cmdlines::~hipsparse_bench_cmdlines()
 hipsparse_bench_cmdlines::hipsparse_bench_cmdlines(int argc, char** argv)
     : m_cmd(argc, argv)
 {
+    if(this->is_suite())
+    {
+        this->expand_suite(argc, argv);
+    }
+    else
+    {
+        //
+        // Expand the command line .
+        //
+        this->m_nsamples = this->m_cmd.get_nsamples();
+        this->m_cmdset   = new val[this->m_nsamples];
+        this->m_cmd.expand(this->m_cmdset);
+    }
+
+    if(this->is_tuning())
+    {
+        this->expand_tune();
+    }
+
     //
-    // Expand the command line .
+    // Result formats, duplicates are ignored.
     //
-    this->m_cmdset = new val[this->m_cmd.get_nsamples()];
-    this->m_cmd.expand(this->m_cmdset);
+    const char* formats = this->m_cmd.get_formats();
+    if(formats == nullptr)
+    {
+        formats = "json";
+    }
+
+    std::istringstream iss(formats);
+    std::string        format;
+    while(std::getline(iss, format, ','))
+    {
+        if(false == hipsparse_bench_writer::is_format(format))
+        {
+            std::cerr << "unknown result format '" << format
+                      << "', expecting json, csv, md or junit" << std::endl;
+            exit(1);
+        }
+        if(std::find(this->m_formats.begin(), this->m_formats.end(), format)
+           == this->m_formats.end())
+        {
+            this->m_formats.push_back(format);
+        }
+    }
+}
+
+//
+// @brief Expand every sample of a tunable function into one sample per candidate algorithm.
+//
+void hipsparse_bench_cmdlines::expand_tune()
+{
+    const int nbase = this->m_nsamples;
+
+    std::vector<const char*>      options(nbase, nullptr);
+    std::vector<std::vector<int>> values(nbase);
+    int                           nsamples = 0;
+    for(int ibase = 0; ibase < nbase; ++ibase)
+    {
+        const char* function = this->get_function(ibase);
+        if(false == hipsparse_bench_tuner::get_candidates(function, options[ibase], values[ibase]))
+        {
+            options[ibase] = nullptr;
+            values[ibase].assign(1, 0);
+        }
+        nsamples += values[ibase].size();
+    }
+
+    val* cmdset  = new val[nsamples];
+    int  isample = 0;
+    for(int ibase = 0; ibase < nbase; ++ibase)
+    {
+        //
+        // Strings are kept in a deque, appending does not move them.
+        //
+        const auto& base        = this->m_cmdset[ibase];
+        char*       option_name = nullptr;
+        if(options[ibase] != nullptr)
+        {
+            this->m_tune_strings.push_back(std::string("--") + options[ibase]);
+            option_name = &this->m_tune_strings.back()[0];
+        }
+
+        for(auto value : values[ibase])
+        {
+            auto& p = cmdset[isample];
+            p(base.argc + 2);
+            p.argc = 0;
+            for(int iarg = 0; iarg < base.argc; ++iarg)
+            {
+                //
+                // Drop the tuned option, options cannot be repeated.
+                //
+                if(option_name != nullptr && iarg + 1 < base.argc
+                   && !strcmp(option_name, base.argv[iarg]))
+                {
+                    ++iarg;
+                    continue;
+                }
+                p.argv[p.argc++] = base.argv[iarg];
+            }
+
+            if(option_name != nullptr)
+            {
+                this->m_tune_strings.push_back(std::to_string(value));
+                p.argv[p.argc++] = option_name;
+                p.argv[p.argc++] = &this->m_tune_strings.back()[0];
+            }
+
+            this->m_tune_base.push_back(ibase);
+            this->m_tune_option.push_back(options[ibase]);
+            this->m_tune_value.push_back(value);
+            ++isample;
+        }
+    }
+
+    delete[] this->m_cmdset;
+    this->m_cmdset   = cmdset;
+    this->m_nsamples = nsamples;
+}
+
+//
+// @brief Expand the suite file, options of the command line are appended to every sample.
+//
+void hipsparse_bench_cmdlines::expand_suite(int argc, char** argv)
+{
+    if(false == this->m_suite.load(this->m_cmd.get_suite_filename(), argv[0]))
+    {
+        exit(1);
+    }
+
+    const int noptions = this->m_cmd.get_noptions();
+    for(int i = 0; i < noptions; ++i)
+    {
+        if(this->m_cmd.get_option_nargs(i) > 1)
+        {
+            std::cerr << "option " << this->m_cmd.get_option_name(i)
+                      << " cannot be expanded with --bench-suite, use the suite file instead"
+                      << std::endl;
+            exit(1);
+        }
+    }
+
+    this->m_nsamples = this->m_suite.get_nsamples();
+    this->m_cmdset   = new val[this->m_nsamples];
+    for(int isample = 0; isample < this->m_nsamples; ++isample)
+    {
+        const int suite_argc = this->m_suite.get_argc(isample);
+        auto&     p          = this->m_cmdset[isample];
+        p(suite_argc + 2 * noptions);
+        p.argc = 0;
+
+        //
+        // The suite owns the strings and outlives the command lines.
+        //
+        for(int iarg = 0; iarg < suite_argc; ++iarg)
+        {
+            p.argv[p.argc++] = const_cast<char*>(this->m_suite.get_arg(isample, iarg).c_str());
+        }
+
+        for(int i = 0; i < noptions; ++i)
+        {
+            p.argv[p.argc++] = const_cast<char*>(this->m_cmd.get_option_name(i));
+            if(this->m_cmd.get_option_nargs(i) == 1)
+            {
+                p.argv[p.argc++] = const_cast<char*>(this->m_cmd.get_option_arg(i, 0));
+            }
+        }
+    }
 }
 
 bool hipsparse_bench_cmdlines::applies(int argc, char** argv)
 {
     for(int i = 1; i < argc; ++i)
     {
-        if(!strcmp(argv[i], "--bench-x"))
+        if(!strcmp(argv[i], "--bench-x") || !strcmp(argv[i], "--bench-suite")
+           || !strcmp(argv[i], "--bench-tune"))
         {
             return true;
         }
@@ -111,7 +373,7 @@ bool hipsparse_bench_cmdlines::applies(int argc, char** argv)
 
 void hipsparse_bench_cmdlines::info() const
 {
-    int nsamples = this->m_cmd.get_nsamples();
+    int nsamples = this->m_nsamples;
     for(int isample = 0; isample < nsamples; ++isample)
     {
         const auto& cmdsample = this->m_cmdset[isample];
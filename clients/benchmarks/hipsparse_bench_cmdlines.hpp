@@ -23,6 +23,8 @@
 * ************************************************************************ */
 #pragma once
 
+#include "hipsparse_bench_suite.hpp"
+#include <deque>
 #include <iostream>
 #include <sstream>
 #include <string.h>
@@ -93,8 +95,26 @@
 //       './foo -m 64 -k 7 -l g'
 //
 // option: --bench-o, output filename.
+// option: --bench-format, comma separated list of result formats among json (default), csv, md
+//         and junit, see hipsparse_bench_writer. The file of a format other than json is the
+//         output filename with its extension replaced, e.g. 'r.json' gives 'r.csv'.
+// example
+//  cmd: './foo -f csrmv --bench-x -M 10 20 --bench-o r.json --bench-format json,junit'
+//       writes 'r.json' and 'r.xml'.
 // option: --bench-n, number of runs.
 // option: --bench-std, prevent from standard output to be disabled.
+// option: --bench-peak, peak configuration file for the roofline, see hipsparse_bench_peak.
+// option: --bench-suite, suite file to expand the command lines from, see hipsparse_bench_suite.
+// example
+//  cmd: './foo --bench-suite spmv.json -d 1' gives the command lines of the suite,
+//       each of them being completed with '-d 1'.
+// option: --bench-tune, tuning database to merge the winners into, see hipsparse_bench_tuner.
+// example
+//  cmd: './foo -f csrmv --file nos1.bin --bench-tune tuning.txt' gives
+//       './foo -f csrmv --file nos1.bin --spmv_alg 0'
+//       './foo -f csrmv --file nos1.bin --spmv_alg 2'
+//       './foo -f csrmv --file nos1.bin --spmv_alg 3'
+//       an existing '--spmv_alg' option is replaced, samples of other functions are left as is.
 //
 
 class hipsparse_bench_cmdlines
@@ -203,6 +223,31 @@ private:
             return this->m_no_rawdata;
         }
 
+        bool has_bench_nruns() const
+        {
+            return this->m_has_bench_nruns;
+        }
+
+        const char* get_suite_filename() const
+        {
+            return this->m_suite_filename;
+        }
+
+        const char* get_peak_filename() const
+        {
+            return this->m_peak_filename;
+        }
+
+        const char* get_tune_filename() const
+        {
+            return this->m_tune_filename;
+        }
+
+        const char* get_formats() const
+        {
+            return this->m_formats;
+        }
+
         //
         // Constructor.
         //
@@ -240,15 +285,63 @@ private:
             //
             const char* option_x        = nullptr;
             int detected_option_bench_x = detect_option_string(argc, argv, "--bench-x", option_x);
-            if(detected_option_bench_x == -1 || false == is_option(option_x))
+            if(detected_option_bench_x == -1
+               || (detected_option_bench_x == 1 && false == is_option(option_x)))
             {
                 std::cerr << "wrong position of option --bench-x  ?" << std::endl;
                 exit(1);
             }
 
+            //
+            // Try to get the option --bench-suite.
+            //
+            int detected_option_bench_suite
+                = detect_option_string(argc, argv, "--bench-suite", this->m_suite_filename);
+            if(detected_option_bench_suite == -1)
+            {
+                std::cerr << "missing parameter ?" << std::endl;
+                exit(1);
+            }
+
+            //
+            // Try to get the option --bench-peak.
+            //
+            int detected_option_bench_peak
+                = detect_option_string(argc, argv, "--bench-peak", this->m_peak_filename);
+            if(detected_option_bench_peak == -1)
+            {
+                std::cerr << "missing parameter ?" << std::endl;
+                exit(1);
+            }
+
+            //
+            // Try to get the option --bench-tune.
+            //
+            int detected_option_bench_tune
+                = detect_option_string(argc, argv, "--bench-tune", this->m_tune_filename);
+            if(detected_option_bench_tune == -1)
+            {
+                std::cerr << "missing parameter ?" << std::endl;
+                exit(1);
+            }
+
+            //
+            // Try to get the option --bench-format.
+            //
+            int detected_option_bench_format
+                = detect_option_string(argc, argv, "--bench-format", this->m_formats);
+            if(detected_option_bench_format == -1)
+            {
+                std::cerr << "missing parameter ?" << std::endl;
+                exit(1);
+            }
+
             this->m_name = argv[0];
             this->m_has_bench_option
-                = (detected_option_bench_x || detected_option_bench_o || detected_option_bench_n);
+                = (detected_option_bench_x || detected_option_bench_o || detected_option_bench_n
+                   || detected_option_bench_suite || detected_option_bench_tune
+                   || detected_option_bench_format);
+            this->m_has_bench_nruns = (detected_option_bench_n == 1);
 
             this->m_no_rawdata = detect_flag(argc, argv, "--bench-no-rawdata");
 
@@ -288,6 +381,26 @@ private:
                     {
                         iarg += 2;
                     }
+                    else if(!strcmp(argv[iarg], "--bench-suite"))
+                    {
+                        iarg += 2;
+                    }
+                    else if(!strcmp(argv[iarg], "--bench-peak"))
+                    {
+                        iarg += 2;
+                    }
+                    else if(!strcmp(argv[iarg], "--bench-tune"))
+                    {
+                        iarg += 2;
+                    }
+                    else if(!strcmp(argv[iarg], "--bench-format"))
+                    {
+                        iarg += 2;
+                    }
+                    else if(!strcmp(argv[iarg], "--bench-no-rawdata"))
+                    {
+                        ++iarg;
+                    }
                     else
                     {
                         //
@@ -559,22 +672,51 @@ private:
         std::vector<cmdline_arg> m_args;
         bool                     m_has_bench_option{};
         int                      m_bench_nruns{1};
-        size_t                   m_option_index_x;
+        size_t                   m_option_index_x{};
         int                      m_nsamples;
         bool                     m_is_stdout_disabled{true};
         bool                     m_no_rawdata{};
         const char*              m_ofilename{};
+        const char*              m_suite_filename{};
+        const char*              m_peak_filename{};
+        const char*              m_tune_filename{};
+        const char*              m_formats{};
+        bool                     m_has_bench_nruns{};
     };
 
 private:
-    cmdline m_cmd;
-    val*    m_cmdset{};
+    cmdline               m_cmd;
+    val*                  m_cmdset{};
+    hipsparse_bench_suite m_suite{};
+    int                   m_nsamples{};
+
+    //
+    // Tuning, base sample, option and candidate value of every sample.
+    //
+    std::vector<int>         m_tune_base{};
+    std::vector<const char*> m_tune_option{};
+    std::vector<int>         m_tune_value{};
+    std::deque<std::string>  m_tune_strings{};
+
+    //
+    // Result formats.
+    //
+    std::vector<std::string> m_formats{};
+
+    void        expand_suite(int argc, char** argv);
+    void        expand_tune();
+    const char* get_option_value(int isample, const char* name, const char* short_name) const;
 
 public:
     static void help(std::ostream& out)
     {
         out << "Example:" << std::endl;
         out << "hipsparse-bench -f csrmv --bench-x -M 10 20 30 40" << std::endl;
+        out << "hipsparse-bench --bench-suite spmv.json" << std::endl;
+        out << "hipsparse-bench -f csrmv --file nos1.bin --bench-tune tuning.txt" << std::endl;
+        out << "hipsparse-bench -f csrmv --bench-x -M 10 20 --bench-o r.json "
+               "--bench-format json,csv"
+            << std::endl;
     }
 
     //
@@ -595,6 +737,71 @@ public:
     bool        is_stdout_disabled() const;
     bool        no_rawdata() const;
 
+    //
+    // @brief Is the set of command lines expanded from a suite file.
+    //
+    bool is_suite() const;
+
+    //
+    // @brief Get the name of the suite, nullptr if not a suite.
+    //
+    const char* get_suite_name() const;
+
+    //
+    // @brief Get the matrix file of a sample, empty if none or not a suite.
+    //
+    const std::string& get_matrix(int isample) const;
+
+    //
+    // @brief Get the peak configuration filename, nullptr if none.
+    //
+    const char* get_peak_filename() const;
+
+    //
+    // @brief Get the precision of a sample.
+    //
+    char get_precision(int isample) const;
+
+    //
+    // @brief Get the index type of a sample.
+    //
+    char get_indextype(int isample) const;
+
+    //
+    // @brief Get the function of a sample.
+    //
+    const char* get_function(int isample) const;
+
+    //
+    // @brief Is the set of command lines expanded over candidate algorithms.
+    //
+    bool is_tuning() const;
+
+    //
+    // @brief Get the tuning database filename, nullptr if not tuning.
+    //
+    const char* get_tune_filename() const;
+
+    //
+    // @brief Get the sample the candidate has been expanded from.
+    //
+    int get_tune_base(int isample) const;
+
+    //
+    // @brief Get the tuned option of a sample without '--', nullptr if the function is not tunable.
+    //
+    const char* get_tune_option(int isample) const;
+
+    //
+    // @brief Get the candidate value of a sample.
+    //
+    int get_tune_value(int isample) const;
+
+    //
+    // @brief Get the result formats, json if --bench-format is not specified.
+    //
+    const std::vector<std::string>& get_formats() const;
+
     //
     // @brief Get the number of runs per sample.
     //
@@ -0,0 +1,128 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_bench_roofline.hpp"
+#include "hipsparse_bench_suite.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    int precision_index(char precision)
+    {
+        switch(precision)
+        {
+        case 's':
+            return 0;
+        case 'd':
+            return 1;
+        case 'c':
+            return 2;
+        case 'z':
+            return 3;
+        }
+        return -1;
+    }
+}
+
+bool hipsparse_bench_peak::load(const char* filename)
+{
+    hipsparse_bench_json config;
+    std::string          error;
+    if(!hipsparse_bench_json::parse_file(filename, config, error))
+    {
+        std::cerr << "// hipsparse_bench_peak: " << filename << ": " << error << std::endl;
+        return false;
+    }
+
+    const hipsparse_bench_json* name      = config.find("name");
+    const hipsparse_bench_json* bandwidth = config.find("bandwidth");
+    const hipsparse_bench_json* gflops    = config.find("gflops");
+    if(bandwidth == nullptr || bandwidth->kind != hipsparse_bench_json::number_kind)
+    {
+        std::cerr << "// hipsparse_bench_peak: " << filename << ": missing 'bandwidth'"
+                  << std::endl;
+        return false;
+    }
+
+    this->name      = (name != nullptr) ? name->to_arg() : filename;
+    this->bandwidth = bandwidth->to_double();
+    std::fill(this->gflops, this->gflops + 4, 0.0);
+    if(gflops != nullptr)
+    {
+        if(gflops->is_object())
+        {
+            const char* precisions[] = {"s", "d", "c", "z"};
+            for(int i = 0; i < 4; ++i)
+            {
+                const hipsparse_bench_json* p = gflops->find(precisions[i]);
+                this->gflops[i]               = (p != nullptr) ? p->to_double() : 0.0;
+            }
+        }
+        else
+        {
+            std::fill(this->gflops, this->gflops + 4, gflops->to_double());
+        }
+    }
+    return true;
+}
+
+void hipsparse_bench_peak::estimate(const hipDeviceProp_t& prop)
+{
+    this->name = prop.name;
+
+    //
+    // Double data rate, memoryClockRate is in kHz and memoryBusWidth in bits.
+    //
+    this->bandwidth = 2.0 * prop.memoryClockRate * 1.0e3 * (prop.memoryBusWidth / 8) / 1.0e9;
+    std::fill(this->gflops, this->gflops + 4, 0.0);
+}
+
+double hipsparse_bench_peak::get_gflops(char precision) const
+{
+    const int i = precision_index(precision);
+    return (i < 0) ? 0.0 : this->gflops[i];
+}
+
+hipsparse_bench_roofline::hipsparse_bench_roofline(const hipsparse_bench_peak& peak,
+                                                   char                        precision,
+                                                   double                      gflops,
+                                                   double                      gbs)
+{
+    const double peak_gflops = peak.get_gflops(precision);
+
+    this->intensity    = (gbs > 0.0) ? gflops / gbs : 0.0;
+    this->bound_gflops = this->intensity * peak.bandwidth;
+    this->memory_bound = true;
+    if(peak_gflops > 0.0 && peak_gflops < this->bound_gflops)
+    {
+        this->bound_gflops = peak_gflops;
+        this->memory_bound = false;
+    }
+
+    this->bound_percent
+        = (this->bound_gflops > 0.0) ? 100.0 * gflops / this->bound_gflops : 0.0;
+    this->bandwidth_percent = (peak.bandwidth > 0.0) ? 100.0 * gbs / peak.bandwidth : 0.0;
+    this->gflops_percent    = (peak_gflops > 0.0) ? 100.0 * gflops / peak_gflops : 0.0;
+}
@@ -0,0 +1,87 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include <hip/hip_runtime_api.h>
+#include <string>
+
+//
+// @brief Peak performance of the device the benchmarks run on.
+// @details
+// The peak is either read from a configuration file (--bench-peak) or estimated from the
+// device properties. The configuration file is JSON:
+//
+// {
+//   "name": "MI210",
+//   "bandwidth": 1638.4,
+//   "gflops": { "s": 22630, "d": 22630, "c": 22630, "z": 22630 }
+// }
+//
+// where "bandwidth" is in GB/s and "gflops" is either a number or a per precision object.
+// A configuration file allows to describe any target, e.g. a CPU stand-in.
+// Device properties only give an estimate of the bandwidth, the peak GFlop/s is then unknown.
+//
+struct hipsparse_bench_peak
+{
+    std::string name{};
+    double      bandwidth{};
+    double      gflops[4]{};
+
+    //
+    // @brief Load a peak configuration file, return false on failure.
+    //
+    bool load(const char* filename);
+
+    //
+    // @brief Estimate the peak bandwidth from the device properties.
+    //
+    void estimate(const hipDeviceProp_t& prop);
+
+    //
+    // @brief Return the peak GFlop/s of a precision, 0 if unknown.
+    //
+    double get_gflops(char precision) const;
+};
+
+//
+// @brief Roofline model of a sample.
+// @details
+// The arithmetic intensity is the ratio of the flop count to the byte count, i.e. the ratio
+// of the GFlop/s to the GB/s of a run since both are derived from the same time.
+// The attainable performance is min(peak GFlop/s, intensity * peak GB/s).
+//
+struct hipsparse_bench_roofline
+{
+    double intensity{};
+    double bound_gflops{};
+    double bound_percent{};
+    double bandwidth_percent{};
+    double gflops_percent{};
+    bool   memory_bound{true};
+
+    hipsparse_bench_roofline(const hipsparse_bench_peak& peak,
+                             char                        precision,
+                             double                      gflops,
+                             double                      gbs);
+};
@@ -0,0 +1,610 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "hipsparse_bench_suite.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    //
+    // Recursive descent JSON parser.
+    //
+    struct json_parser
+    {
+        const std::string& s;
+        size_t             pos{};
+        std::string        error{};
+
+        explicit json_parser(const std::string& s_)
+            : s(s_)
+        {
+        }
+
+        void skip_ws()
+        {
+            while(pos < s.size())
+            {
+                const char c = s[pos];
+                if(c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                {
+                    ++pos;
+                }
+                else if(c == '/' && pos + 1 < s.size() && s[pos + 1] == '/')
+                {
+                    // Allow line comments, suite files are written by hand.
+                    while(pos < s.size() && s[pos] != '\n')
+                    {
+                        ++pos;
+                    }
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        bool fail(const char* what)
+        {
+            if(error.empty())
+            {
+                std::ostringstream os;
+                os << what << " at offset " << pos;
+                error = os.str();
+            }
+            return false;
+        }
+
+        bool expect(char c)
+        {
+            skip_ws();
+            if(pos < s.size() && s[pos] == c)
+            {
+                ++pos;
+                return true;
+            }
+            std::string what("expected '");
+            what += c;
+            what += "'";
+            return fail(what.c_str());
+        }
+
+        bool parse_string(std::string& out)
+        {
+            if(!expect('"'))
+            {
+                return false;
+            }
+            out.clear();
+            while(pos < s.size())
+            {
+                const char c = s[pos++];
+                if(c == '"')
+                {
+                    return true;
+                }
+                if(c == '\\')
+                {
+                    if(pos >= s.size())
+                    {
+                        break;
+                    }
+                    const char e = s[pos++];
+                    switch(e)
+                    {
+                    case 'n':
+                        out += '\n';
+                        break;
+                    case 't':
+                        out += '\t';
+                        break;
+                    case 'r':
+                        out += '\r';
+                        break;
+                    case 'b':
+                        out += '\b';
+                        break;
+                    case 'f':
+                        out += '\f';
+                        break;
+                    case 'u':
+                    {
+                        // Only the ASCII range is needed here.
+                        if(pos + 4 > s.size())
+                        {
+                            return fail("invalid unicode escape");
+                        }
+                        const long code = strtol(s.substr(pos, 4).c_str(), nullptr, 16);
+                        out += (code < 128) ? static_cast<char>(code) : '?';
+                        pos += 4;
+                        break;
+                    }
+                    default:
+                        out += e;
+                        break;
+                    }
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+            return fail("unterminated string");
+        }
+
+        bool parse_value(hipsparse_bench_json& v)
+        {
+            skip_ws();
+            if(pos >= s.size())
+            {
+                return fail("unexpected end of document");
+            }
+
+            const char c = s[pos];
+            if(c == '{')
+            {
+                ++pos;
+                v.kind = hipsparse_bench_json::object_kind;
+                skip_ws();
+                if(pos < s.size() && s[pos] == '}')
+                {
+                    ++pos;
+                    return true;
+                }
+                while(true)
+                {
+                    std::string key;
+                    if(!parse_string(key) || !expect(':'))
+                    {
+                        return false;
+                    }
+                    v.object.push_back(std::make_pair(key, hipsparse_bench_json()));
+                    if(!parse_value(v.object.back().second))
+                    {
+                        return false;
+                    }
+                    skip_ws();
+                    if(pos < s.size() && s[pos] == ',')
+                    {
+                        ++pos;
+                        continue;
+                    }
+                    return expect('}');
+                }
+            }
+            else if(c == '[')
+            {
+                ++pos;
+                v.kind = hipsparse_bench_json::array_kind;
+                skip_ws();
+                if(pos < s.size() && s[pos] == ']')
+                {
+                    ++pos;
+                    return true;
+                }
+                while(true)
+                {
+                    v.array.push_back(hipsparse_bench_json());
+                    if(!parse_value(v.array.back()))
+                    {
+                        return false;
+                    }
+                    skip_ws();
+                    if(pos < s.size() && s[pos] == ',')
+                    {
+                        ++pos;
+                        continue;
+                    }
+                    return expect(']');
+                }
+            }
+            else if(c == '"')
+            {
+                v.kind = hipsparse_bench_json::string_kind;
+                return parse_string(v.text);
+            }
+            else if(!s.compare(pos, 4, "true") || !s.compare(pos, 5, "false"))
+            {
+                v.kind = hipsparse_bench_json::boolean_kind;
+                v.text = (s[pos] == 't') ? "1" : "0";
+                pos += (s[pos] == 't') ? 4 : 5;
+                return true;
+            }
+            else if(!s.compare(pos, 4, "null"))
+            {
+                v.kind = hipsparse_bench_json::null_kind;
+                pos += 4;
+                return true;
+            }
+            else if(c == '-' || c == '+' || (c >= '0' && c <= '9'))
+            {
+                const size_t begin = pos;
+                while(pos < s.size()
+                      && (s[pos] == '-' || s[pos] == '+' || s[pos] == '.' || s[pos] == 'e'
+                          || s[pos] == 'E' || (s[pos] >= '0' && s[pos] <= '9')))
+                {
+                    ++pos;
+                }
+                v.kind = hipsparse_bench_json::number_kind;
+                v.text = s.substr(begin, pos - begin);
+                return true;
+            }
+            return fail("unexpected character");
+        }
+    };
+
+    //
+    // Return the entries of a scalar or an array of scalars.
+    //
+    bool json_to_list(const hipsparse_bench_json& v,
+                      const char*                 key,
+                      std::vector<std::string>&   list)
+    {
+        list.clear();
+        if(v.is_scalar())
+        {
+            list.push_back(v.to_arg());
+            return true;
+        }
+        if(v.is_array())
+        {
+            for(const auto& e : v.array)
+            {
+                if(!e.is_scalar())
+                {
+                    std::cerr << "// hipsparse_bench_suite: '" << key
+                              << "' must be a scalar or an array of scalars" << std::endl;
+                    return false;
+                }
+                list.push_back(e.to_arg());
+            }
+            return true;
+        }
+        std::cerr << "// hipsparse_bench_suite: '" << key
+                  << "' must be a scalar or an array of scalars" << std::endl;
+        return false;
+    }
+}
+
+const hipsparse_bench_json* hipsparse_bench_json::find(const char* key) const
+{
+    if(this->kind == object_kind)
+    {
+        for(const auto& member : this->object)
+        {
+            if(member.first == key)
+            {
+                return &member.second;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::string hipsparse_bench_json::to_arg() const
+{
+    return this->text;
+}
+
+double hipsparse_bench_json::to_double() const
+{
+    return (this->kind == number_kind) ? atof(this->text.c_str()) : 0.0;
+}
+
+bool hipsparse_bench_json::parse(const std::string&    s,
+                                 hipsparse_bench_json& value,
+                                 std::string&          error)
+{
+    json_parser p(s);
+    value = hipsparse_bench_json();
+    if(!p.parse_value(value))
+    {
+        error = p.error;
+        return false;
+    }
+    p.skip_ws();
+    if(p.pos != s.size())
+    {
+        p.fail("trailing characters");
+        error = p.error;
+        return false;
+    }
+    return true;
+}
+
+bool hipsparse_bench_json::parse_file(const char*           filename,
+                                      hipsparse_bench_json& value,
+                                      std::string&          error)
+{
+    std::ifstream in(filename);
+    if(!in)
+    {
+        error = std::string("cannot open ") + filename;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return parse(ss.str(), value, error);
+}
+
+bool hipsparse_bench_suite::expand_case(const hipsparse_bench_json& suite,
+                                        const hipsparse_bench_json& c,
+                                        size_t                      icase)
+{
+    if(!c.is_object())
+    {
+        std::cerr << "// hipsparse_bench_suite: case " << icase << " is not an object" << std::endl;
+        return false;
+    }
+
+    //
+    // Matrices, the case overrides the suite.
+    //
+    std::vector<std::string> matrices;
+    const hipsparse_bench_json* m = c.find("matrices");
+    if(m == nullptr)
+    {
+        m = suite.find("matrices");
+    }
+    if(m != nullptr && !json_to_list(*m, "matrices", matrices))
+    {
+        return false;
+    }
+    if(matrices.empty())
+    {
+        matrices.push_back("");
+    }
+
+    //
+    // Routine, precision and index type.
+    //
+    std::vector<std::pair<std::string, std::vector<std::string>>> grid;
+
+    const hipsparse_bench_json* function = c.find("function");
+    if(function == nullptr)
+    {
+        std::cerr << "// hipsparse_bench_suite: case " << icase << " has no 'function'"
+                  << std::endl;
+        return false;
+    }
+
+    grid.push_back(std::make_pair(std::string("function"), std::vector<std::string>()));
+    if(!json_to_list(*function, "function", grid.back().second))
+    {
+        return false;
+    }
+
+    const char* typed_keys[] = {"precision", "indextype"};
+    for(const char* key : typed_keys)
+    {
+        const hipsparse_bench_json* v = c.find(key);
+        if(v != nullptr)
+        {
+            grid.push_back(std::make_pair(std::string(key), std::vector<std::string>()));
+            if(!json_to_list(*v, key, grid.back().second))
+            {
+                return false;
+            }
+        }
+    }
+
+    //
+    // Parameters, the case overrides the defaults.
+    //
+    const hipsparse_bench_json* sources[] = {suite.find("defaults"), c.find("params")};
+    for(const hipsparse_bench_json* source : sources)
+    {
+        if(source == nullptr)
+        {
+            continue;
+        }
+        if(!source->is_object())
+        {
+            std::cerr << "// hipsparse_bench_suite: 'defaults' and 'params' must be objects"
+                      << std::endl;
+            return false;
+        }
+        for(const auto& member : source->object)
+        {
+            std::vector<std::string> values;
+            if(!json_to_list(member.second, member.first.c_str(), values))
+            {
+                return false;
+            }
+
+            bool found = false;
+            for(auto& entry : grid)
+            {
+                if(entry.first == member.first)
+                {
+                    entry.second = values;
+                    found        = true;
+                    break;
+                }
+            }
+            if(!found)
+            {
+                grid.push_back(std::make_pair(member.first, values));
+            }
+        }
+    }
+
+    for(const auto& entry : grid)
+    {
+        if(entry.second.empty())
+        {
+            std::cerr << "// hipsparse_bench_suite: case " << icase << ", '" << entry.first
+                      << "' is an empty sweep" << std::endl;
+            return false;
+        }
+    }
+
+    //
+    // Expand, the first grid entry varies the slowest.
+    //
+    for(const auto& matrix : matrices)
+    {
+        std::vector<size_t> index(grid.size(), 0);
+        bool                more = true;
+        while(more)
+        {
+            sample s;
+            s.matrix = matrix;
+            s.args.push_back(this->m_program_name);
+            for(size_t k = 0; k < grid.size(); ++k)
+            {
+                s.args.push_back("--" + grid[k].first);
+                s.args.push_back(grid[k].second[index[k]]);
+            }
+            if(!matrix.empty())
+            {
+                s.args.push_back("--file");
+                s.args.push_back(matrix);
+            }
+            this->m_samples.push_back(s);
+
+            // Next point of the grid.
+            more = false;
+            for(size_t k = grid.size(); k-- > 0;)
+            {
+                if(++index[k] < grid[k].second.size())
+                {
+                    more = true;
+                    break;
+                }
+                index[k] = 0;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool hipsparse_bench_suite::load(const char* filename, const char* program_name)
+{
+    hipsparse_bench_json suite;
+    std::string          error;
+    if(!hipsparse_bench_json::parse_file(filename, suite, error))
+    {
+        std::cerr << "// hipsparse_bench_suite: " << filename << ": " << error << std::endl;
+        return false;
+    }
+
+    if(!suite.is_object())
+    {
+        std::cerr << "// hipsparse_bench_suite: " << filename << ": expected an object"
+                  << std::endl;
+        return false;
+    }
+
+    this->m_program_name = program_name;
+    this->m_samples.clear();
+
+    const hipsparse_bench_json* name = suite.find("name");
+    this->m_name                     = (name != nullptr) ? name->to_arg() : filename;
+
+    const hipsparse_bench_json* output = suite.find("output");
+    this->m_ofilename                  = (output != nullptr) ? output->to_arg() : "";
+
+    const hipsparse_bench_json* nruns = suite.find("nruns");
+    this->m_nruns = (nruns != nullptr) ? static_cast<int>(nruns->to_double()) : 0;
+
+    const hipsparse_bench_json* cases = suite.find("cases");
+    if(cases == nullptr || !cases->is_array() || cases->array.empty())
+    {
+        std::cerr << "// hipsparse_bench_suite: " << filename << ": missing 'cases'" << std::endl;
+        return false;
+    }
+
+    //
+    // Expand each case, then group samples by matrix so that consecutive samples share it.
+    //
+    for(size_t icase = 0; icase < cases->array.size(); ++icase)
+    {
+        if(!this->expand_case(suite, cases->array[icase], icase))
+        {
+            return false;
+        }
+    }
+
+    std::vector<sample> grouped;
+    grouped.reserve(this->m_samples.size());
+    std::vector<bool> done(this->m_samples.size(), false);
+    for(size_t i = 0; i < this->m_samples.size(); ++i)
+    {
+        if(done[i])
+        {
+            continue;
+        }
+        for(size_t j = i; j < this->m_samples.size(); ++j)
+        {
+            if(!done[j] && this->m_samples[j].matrix == this->m_samples[i].matrix)
+            {
+                grouped.push_back(this->m_samples[j]);
+                done[j] = true;
+            }
+        }
+    }
+    this->m_samples.swap(grouped);
+
+    return true;
+}
+
+int hipsparse_bench_suite::get_nsamples() const
+{
+    return static_cast<int>(this->m_samples.size());
+}
+
+int hipsparse_bench_suite::get_argc(int isample) const
+{
+    return static_cast<int>(this->m_samples[isample].args.size());
+}
+
+const std::string& hipsparse_bench_suite::get_arg(int isample, int iarg) const
+{
+    return this->m_samples[isample].args[iarg];
+}
+
+const std::string& hipsparse_bench_suite::get_matrix(int isample) const
+{
+    return this->m_samples[isample].matrix;
+}
+
+const std::string& hipsparse_bench_suite::get_name() const
+{
+    return this->m_name;
+}
+
+const std::string& hipsparse_bench_suite::get_ofilename() const
+{
+    return this->m_ofilename;
+}
+
+int hipsparse_bench_suite::get_nruns() const
+{
+    return this->m_nruns;
+}
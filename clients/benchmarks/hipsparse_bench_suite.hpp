@@ -0,0 +1,162 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//
+// @brief Minimal JSON value, sufficient to read benchmark suite and result files.
+// @details
+// Numbers keep their original spelling so that they can be forwarded verbatim
+// to the command line parser, e.g. "1.0" is not turned into "1".
+//
+struct hipsparse_bench_json
+{
+    typedef enum kind_
+    {
+        null_kind,
+        boolean_kind,
+        number_kind,
+        string_kind,
+        array_kind,
+        object_kind
+    } kind_t;
+
+    kind_t                                             kind{null_kind};
+    std::string                                        text{};
+    std::vector<hipsparse_bench_json>                  array{};
+    std::vector<std::pair<std::string, hipsparse_bench_json>> object{};
+
+    bool is_null() const
+    {
+        return this->kind == null_kind;
+    }
+    bool is_array() const
+    {
+        return this->kind == array_kind;
+    }
+    bool is_object() const
+    {
+        return this->kind == object_kind;
+    }
+    bool is_scalar() const
+    {
+        return this->kind == boolean_kind || this->kind == number_kind
+               || this->kind == string_kind;
+    }
+
+    //
+    // @brief Return the member named \p key, or nullptr if this is not an object or the key does not exist.
+    //
+    const hipsparse_bench_json* find(const char* key) const;
+
+    //
+    // @brief Return the scalar as it would appear on a command line.
+    //
+    std::string to_arg() const;
+
+    //
+    // @brief Return the scalar as a double, 0 if it is not a number.
+    //
+    double to_double() const;
+
+    //
+    // @brief Parse a JSON document, return false and fill \p error on failure.
+    //
+    static bool parse(const std::string& s, hipsparse_bench_json& value, std::string& error);
+
+    //
+    // @brief Parse a JSON file, return false and fill \p error on failure.
+    //
+    static bool parse_file(const char* filename, hipsparse_bench_json& value, std::string& error);
+};
+
+//
+// @brief The role of this class is to expand a benchmark suite file into multiple command lines.
+// @details
+//
+// A suite file lists routines, precisions, matrices and parameter grids in JSON:
+//
+// {
+//   "name": "spmv",
+//   "output": "spmv.json",
+//   "nruns": 5,
+//   "matrices": ["nos1.bin", "shipsec1.bin"],
+//   "defaults": { "iters": 100, "alpha": 1.0 },
+//   "cases": [
+//     { "function": "csrmv", "precision": ["s", "d"], "params": { "spmv_alg": [1, 2], "beta": [0.0, 1.0] } },
+//     { "function": "axpyi", "precision": "s", "matrices": [], "params": { "sizen": 100000, "sizennz": [1000, 10000] } }
+//   ]
+// }
+//
+// Rules:
+// - every case expands into the product of its matrices, function, precision, indextype and params entries.
+// - an array value is a sweep, a scalar value is a single entry.
+// - "defaults" apply to every case and are overridden by the case "params".
+// - a case "matrices" entry overrides the suite one, an empty array means no --file option.
+// - each params key 'k' is forwarded as the command line option '--k'.
+//
+// Samples are ordered by matrix first, so that consecutive samples share the same matrix.
+//
+class hipsparse_bench_suite
+{
+public:
+    //
+    // @brief Load and expand a suite file, return false on failure.
+    //
+    bool load(const char* filename, const char* program_name);
+
+    int                get_nsamples() const;
+    int                get_argc(int isample) const;
+    const std::string& get_arg(int isample, int iarg) const;
+
+    //
+    // @brief Return the matrix file of a sample, empty if none.
+    //
+    const std::string& get_matrix(int isample) const;
+
+    const std::string& get_name() const;
+    const std::string& get_ofilename() const;
+    int                get_nruns() const;
+
+private:
+    struct sample
+    {
+        std::string              matrix{};
+        std::vector<std::string> args{};
+    };
+
+    bool
+        expand_case(const hipsparse_bench_json& suite, const hipsparse_bench_json& c, size_t icase);
+
+    std::string         m_program_name{};
+    std::string         m_name{};
+    std::string         m_ofilename{};
+    int                 m_nruns{};
+    std::vector<sample> m_samples{};
+};
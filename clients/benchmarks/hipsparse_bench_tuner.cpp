@@ -0,0 +1,304 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse_bench_tuner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+//
+// Candidate algorithms of the tunable functions, the first one is the default.
+// Values are those of hipsparseSpMVAlg_t, hipsparseSpMMAlg_t, hipsparseSpSVAlg_t,
+// hipsparseSpSMAlg_t, hipsparseHybPartition_t (USER requires a width, it is skipped)
+// and of the gtsv/gpsv algorithms of hipsparse-bench.
+//
+namespace
+{
+    struct tunable_t
+    {
+        const char* function;
+        const char* option;
+        int         values[8];
+        int         nvalues;
+    };
+
+    static const tunable_t s_tunables[] = {{"coomv", "spmv_alg", {0, 1, 4}, 3},
+                                           {"csrmv", "spmv_alg", {0, 2, 3}, 3},
+                                           {"csrmv_plan", "spmv_alg", {0, 2, 3}, 3},
+                                           {"coomm", "spmm_alg", {0, 1, 2, 3, 5}, 5},
+                                           {"cscmm", "spmm_alg", {0, 4, 6, 12}, 4},
+                                           {"csrmm", "spmm_alg", {0, 4, 6, 12}, 4},
+                                           {"csrsv", "spsv_alg", {0}, 1},
+                                           {"csrsv_update", "spsv_alg", {0}, 1},
+                                           {"coosm", "spsm_alg", {0}, 1},
+                                           {"csrsm", "spsm_alg", {0}, 1},
+                                           {"hybmv", "hybpart", {0, 2}, 2},
+                                           {"csr2hyb", "hybpart", {0, 2}, 2},
+                                           {"gtsv_interleaved_batch", "gtsv_alg", {0, 1, 2, 3}, 4},
+                                           {"gpsv_interleaved_batch", "gpsv_alg", {0}, 1}};
+}
+
+bool hipsparse_bench_tuner::get_candidates(const char*       function,
+                                           const char*&      option,
+                                           std::vector<int>& values)
+{
+    for(const auto& t : s_tunables)
+    {
+        if(!strcmp(t.function, function))
+        {
+            option = t.option;
+            values.assign(t.values, t.values + t.nvalues);
+            return true;
+        }
+    }
+    return false;
+}
+
+double hipsparse_bench_tuner::median(std::vector<double> v)
+{
+    const size_t n = v.size();
+    if(n == 0)
+    {
+        return 0.0;
+    }
+    std::sort(v.begin(), v.end());
+    return (n % 2 == 0) ? (v[n / 2 - 1] + v[n / 2]) * 0.5 : v[n / 2];
+}
+
+double hipsparse_bench_tuner::mann_whitney_pvalue(const std::vector<double>& x,
+                                                  const std::vector<double>& y)
+{
+    const size_t n1 = x.size();
+    const size_t n2 = y.size();
+    const size_t n  = n1 + n2;
+    if(n1 == 0 || n2 == 0 || n < 2)
+    {
+        return 1.0;
+    }
+
+    std::vector<std::pair<double, int>> values;
+    values.reserve(n);
+    for(auto v : x)
+    {
+        values.push_back(std::make_pair(v, 0));
+    }
+    for(auto v : y)
+    {
+        values.push_back(std::make_pair(v, 1));
+    }
+    std::sort(values.begin(), values.end());
+
+    //
+    // Rank sum of x, ties get their average rank.
+    //
+    double r1   = 0.0;
+    double ties = 0.0;
+    size_t i    = 0;
+    while(i < n)
+    {
+        size_t j = i;
+        while(j + 1 < n && values[j + 1].first == values[i].first)
+        {
+            ++j;
+        }
+        const double rank = 0.5 * (i + j) + 1.0;
+        for(size_t k = i; k <= j; ++k)
+        {
+            if(values[k].second == 0)
+            {
+                r1 += rank;
+            }
+        }
+        const double t = double(j - i + 1);
+        ties += t * t * t - t;
+        i = j + 1;
+    }
+
+    const double u1     = r1 - n1 * (n1 + 1) * 0.5;
+    const double mu     = n1 * n2 * 0.5;
+    const double sigma2 = n1 * n2 / 12.0 * ((n + 1) - ties / (double(n) * (n - 1)));
+    if(sigma2 <= 0.0)
+    {
+        return 1.0;
+    }
+    const double z = (std::abs(u1 - mu) - 0.5) / std::sqrt(sigma2);
+    return std::erfc(std::max(z, 0.0) / std::sqrt(2.0));
+}
+
+int hipsparse_bench_tuner::select(const record& r, double alpha, double& pvalue)
+{
+    pvalue = 1.0;
+    if(r.candidates.empty())
+    {
+        return -1;
+    }
+
+    int    best      = 0;
+    double best_msec = median(r.candidates[0].msec);
+    for(size_t i = 1; i < r.candidates.size(); ++i)
+    {
+        const double msec = median(r.candidates[i].msec);
+        if(msec < best_msec)
+        {
+            best      = i;
+            best_msec = msec;
+        }
+    }
+
+    if(best == 0)
+    {
+        return 0;
+    }
+
+    //
+    // Keep the default unless the winner is faster with statistical confidence.
+    //
+    pvalue = mann_whitney_pvalue(r.candidates[best].msec, r.candidates[0].msec);
+    return (pvalue < alpha) ? best : 0;
+}
+
+void hipsparse_bench_tuner::get_features(const std::string& legend,
+                                         const std::string& values,
+                                         record&            r)
+{
+    //
+    // Keys and values are separated by spaces, M, N and nnz come first so that
+    // keys made of several words further on do not matter.
+    //
+    std::istringstream keys(legend);
+    std::istringstream vals(values);
+    std::string        key, val;
+    bool               has_nnz = false;
+    while((keys >> key) && (vals >> val))
+    {
+        if(key == "M")
+        {
+            r.m = std::atoll(val.c_str());
+        }
+        else if(key == "N")
+        {
+            r.n = std::atoll(val.c_str());
+        }
+        else if(key == "nnz")
+        {
+            r.nnz   = std::atoll(val.c_str());
+            has_nnz = true;
+        }
+        else if(key == "nnzA" && false == has_nnz)
+        {
+            r.nnz = std::atoll(val.c_str());
+        }
+    }
+}
+
+bool hipsparse_bench_tuner::export_db(const char*                filename,
+                                      const std::vector<record>& records,
+                                      std::ostream&              log)
+{
+    //
+    // Read the existing entries, if any.
+    //
+    std::vector<std::string> keys;
+    std::vector<std::string> lines;
+    {
+        std::ifstream in(filename);
+        std::string   line;
+        while(std::getline(in, line))
+        {
+            std::istringstream iss(line);
+            std::string        routine, precision, indextype, m, n, nnz, option;
+            if(!(iss >> routine) || routine[0] == '#')
+            {
+                continue;
+            }
+            if(!(iss >> precision >> indextype >> m >> n >> nnz >> option))
+            {
+                std::cerr << "invalid entry '" << line << "' in tuning database '" << filename
+                          << "'" << std::endl;
+                return false;
+            }
+            keys.push_back(routine + " " + precision + " " + indextype + " " + m + " " + n + " "
+                           + nnz + " " + option);
+            lines.push_back(line);
+        }
+    }
+
+    const double alpha = 0.05;
+    log << "// tuning, alpha " << alpha << std::endl;
+    for(const auto& r : records)
+    {
+        double    pvalue;
+        const int best = select(r, alpha, pvalue);
+        if(best < 0)
+        {
+            continue;
+        }
+
+        std::ostringstream key;
+        key << r.routine << " " << r.precision << " " << r.indextype << " " << r.m << " " << r.n
+            << " " << r.nnz << " " << r.option;
+
+        const double       best_msec    = median(r.candidates[best].msec);
+        const double       default_msec = median(r.candidates[0].msec);
+        std::ostringstream line;
+        line << key.str() << " " << r.candidates[best].value << " " << best_msec << " "
+             << default_msec;
+
+        log << "// " << key.str() << ": " << r.option << " = " << r.candidates[best].value << ", "
+            << best_msec << " msec, default " << default_msec << " msec";
+        if(best > 0)
+        {
+            log << ", p-value " << pvalue;
+        }
+        log << std::endl;
+
+        auto it = std::find(keys.begin(), keys.end(), key.str());
+        if(it != keys.end())
+        {
+            lines[it - keys.begin()] = line.str();
+        }
+        else
+        {
+            keys.push_back(key.str());
+            lines.push_back(line.str());
+        }
+    }
+
+    std::ofstream out(filename);
+    if(!out)
+    {
+        std::cerr << "cannot write tuning database '" << filename << "'" << std::endl;
+        return false;
+    }
+    out << "# hipSPARSE tuning database, written by hipsparse-bench --bench-tune" << std::endl;
+    out << "# routine precision indextype m n nnz option algorithm msec default_msec" << std::endl;
+    for(const auto& line : lines)
+    {
+        out << line << std::endl;
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include <iostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//
+// @brief Algorithm tuner of the benchmarks, see option --bench-tune.
+// @details
+// Every sample of a tunable function is run once per candidate algorithm. The winner is the
+// candidate with the lowest median time, it replaces the default algorithm only if the
+// Mann-Whitney U test finds both timing distributions different (p-value < alpha).
+//
+// Winners are merged into a tuning database, a text file with one entry per line:
+//
+// routine precision indextype m n nnz option algorithm msec default_msec
+//
+// e.g.
+//
+// csrmv d s 1024 1024 32768 spmv_alg 3 0.0123 0.0158
+//
+// An entry of the database is replaced when routine, precision, index type, matrix features
+// and option are all equal. The database is read at runtime with hipsparseCreateTuningDb and
+// queried with hipsparseTuningDbLookup.
+//
+struct hipsparse_bench_tuner
+{
+    //
+    // @brief Timing of one candidate algorithm.
+    //
+    struct candidate
+    {
+        int                 value{};
+        std::vector<double> msec{};
+    };
+
+    //
+    // @brief Tuning record of a sample, the first candidate is the default algorithm.
+    //
+    struct record
+    {
+        std::string            routine{};
+        char                   precision{};
+        char                   indextype{};
+        int64_t                m{};
+        int64_t                n{};
+        int64_t                nnz{};
+        std::string            option{};
+        std::vector<candidate> candidates{};
+    };
+
+    //
+    // @brief Get the option and candidate values of a function, return false if it is not tunable.
+    //
+    static bool get_candidates(const char* function, const char*& option, std::vector<int>& values);
+
+    //
+    // @brief Return the index of the selected candidate and its p-value against the default.
+    //
+    static int select(const record& r, double alpha, double& pvalue);
+
+    //
+    // @brief Get the matrix features from the recorded legend and values of a sample.
+    //
+    static void get_features(const std::string& legend, const std::string& values, record& r);
+
+    //
+    // @brief Merge the winners into the tuning database, return false on failure.
+    //
+    static bool
+        export_db(const char* filename, const std::vector<record>& records, std::ostream& log);
+
+    static double median(std::vector<double> v);
+
+    //
+    // @brief Two-sided Mann-Whitney U test with the normal approximation and tie correction.
+    //
+    static double mann_whitney_pvalue(const std::vector<double>& x, const std::vector<double>& y);
+};
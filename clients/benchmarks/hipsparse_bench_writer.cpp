@@ -0,0 +1,316 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse_bench_writer.hpp"
+
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    //
+    // @brief Quote a CSV field if it contains a separator, a quote or a new line.
+    //
+    std::string csv_field(const std::string& s)
+    {
+        if(s.find_first_of(",\"\n") == std::string::npos)
+        {
+            return s;
+        }
+
+        std::string q("\"");
+        for(char c : s)
+        {
+            if(c == '"')
+            {
+                q += '"';
+            }
+            q += c;
+        }
+        q += '"';
+        return q;
+    }
+
+    std::string xml_escape(const std::string& s)
+    {
+        std::string e;
+        for(char c : s)
+        {
+            switch(c)
+            {
+            case '&':
+                e += "&amp;";
+                break;
+            case '<':
+                e += "&lt;";
+                break;
+            case '>':
+                e += "&gt;";
+                break;
+            case '"':
+                e += "&quot;";
+                break;
+            case '\'':
+                e += "&apos;";
+                break;
+            default:
+                e += c;
+                break;
+            }
+        }
+        return e;
+    }
+
+    std::string md_escape(const std::string& s)
+    {
+        std::string e;
+        for(char c : s)
+        {
+            if(c == '|')
+            {
+                e += '\\';
+            }
+            e += c;
+        }
+        return e;
+    }
+
+    const char* regime(const hipsparse_bench_record& r)
+    {
+        return r.has_roofline ? (r.memory_bound ? "memory" : "compute") : "";
+    }
+
+    //
+    // @brief One row per sample, columns are never removed nor reordered.
+    //
+    class hipsparse_bench_writer_csv : public hipsparse_bench_writer
+    {
+    public:
+        const char* extension() const override
+        {
+            return ".csv";
+        }
+
+        void begin(std::ostream& out, const hipsparse_bench_report& report) override
+        {
+            out << "function,precision,indextype,matrix,nruns,time_ms,time_ms_low,time_ms_high,"
+                   "gflops,gflops_low,gflops_high,gbs,gbs_low,gbs_high,memory_data,memory_buffer,"
+                   "memory_internal,memory_peak,streams,latency_ms,intensity,bound_percent,"
+                   "bandwidth_percent,regime,cmdline"
+                << std::endl;
+        }
+
+        void write(std::ostream& out, const hipsparse_bench_record& r) override
+        {
+            out << csv_field(r.function) << "," << r.precision << "," << r.indextype << ","
+                << csv_field(r.matrix) << "," << r.nruns;
+            for(const double* v : {r.time, r.gflops, r.gbs})
+            {
+                out << "," << v[0] << "," << v[1] << "," << v[2];
+            }
+            out << "," << r.memory_data << "," << r.memory_buffer << "," << r.memory_internal
+                << "," << r.memory_peak << "," << r.streams << ",";
+            if(r.streams > 1)
+            {
+                out << r.latency;
+            }
+            out << ",";
+            if(r.has_roofline)
+            {
+                out << r.intensity << "," << r.bound_percent << "," << r.bandwidth_percent;
+            }
+            else
+            {
+                out << ",,";
+            }
+            out << "," << regime(r) << "," << csv_field(r.cmdline) << std::endl;
+        }
+
+        void end(std::ostream& out) override {}
+    };
+
+    class hipsparse_bench_writer_markdown : public hipsparse_bench_writer
+    {
+    public:
+        const char* extension() const override
+        {
+            return ".md";
+        }
+
+        void begin(std::ostream& out, const hipsparse_bench_report& report) override
+        {
+            out << "# hipsparse-bench";
+            if(false == report.suite.empty())
+            {
+                out << " " << md_escape(report.suite);
+            }
+            out << std::endl
+                << std::endl
+                << "hipSPARSE " << report.version << ", " << md_escape(report.device) << ", "
+                << report.date << std::endl
+                << std::endl
+                << "| Function | Precision | Matrix | Time (ms) | GFlop/s | GB/s | Peak memory (B) "
+                   "| %bound | Command line |"
+                << std::endl
+                << "|---|---|---|---:|---:|---:|---:|---:|---|" << std::endl;
+        }
+
+        void write(std::ostream& out, const hipsparse_bench_record& r) override
+        {
+            out << "| " << md_escape(r.function) << " | " << r.precision << " | "
+                << md_escape(r.matrix) << " | " << r.time[0] << " | " << r.gflops[0] << " | "
+                << r.gbs[0] << " | " << r.memory_peak << " | ";
+            if(r.has_roofline)
+            {
+                out << r.bound_percent;
+            }
+            out << " | `" << md_escape(r.cmdline) << "` |" << std::endl;
+        }
+
+        void end(std::ostream& out) override {}
+    };
+
+    //
+    // @brief The testsuite element carries the number of tests, records are written at the end.
+    //
+    class hipsparse_bench_writer_junit : public hipsparse_bench_writer
+    {
+    public:
+        const char* extension() const override
+        {
+            return ".xml";
+        }
+
+        void begin(std::ostream& out, const hipsparse_bench_report& report) override
+        {
+            this->m_report = report;
+            this->m_records.clear();
+        }
+
+        void write(std::ostream& out, const hipsparse_bench_record& r) override
+        {
+            this->m_records.push_back(r);
+        }
+
+        void end(std::ostream& out) override
+        {
+            const std::string name = this->m_report.suite.empty() ? std::string("hipsparse-bench")
+                                                                   : this->m_report.suite;
+
+            double total_sec = 0.0;
+            for(const auto& r : this->m_records)
+            {
+                total_sec += r.time[0] * r.nruns * 1.0e-3;
+            }
+
+            out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+            out << "<testsuites name=\"hipsparse-bench\" tests=\"" << this->m_records.size()
+                << "\" failures=\"0\" errors=\"0\" time=\"" << total_sec << "\">" << std::endl;
+            out << "  <testsuite name=\"" << xml_escape(name) << "\" tests=\""
+                << this->m_records.size() << "\" failures=\"0\" errors=\"0\" skipped=\"0\" time=\""
+                << total_sec << "\" timestamp=\"" << xml_escape(this->m_report.date) << "\">"
+                << std::endl;
+            out << "    <properties>" << std::endl;
+            property(out, 6, "hipsparse_version", this->m_report.version);
+            property(out, 6, "device", this->m_report.device);
+            property(out, 6, "cmdline", this->m_report.cmdline);
+            out << "    </properties>" << std::endl;
+
+            for(const auto& r : this->m_records)
+            {
+                out << "    <testcase classname=\"hipsparse-bench." << xml_escape(r.function)
+                    << "\" name=\"" << xml_escape(r.cmdline) << "\" time=\""
+                    << r.time[0] * 1.0e-3 << "\">" << std::endl;
+                out << "      <properties>" << std::endl;
+                property(out, 8, "precision", std::string(1, r.precision));
+                property(out, 8, "indextype", std::string(1, r.indextype));
+                if(false == r.matrix.empty())
+                {
+                    property(out, 8, "matrix", r.matrix);
+                }
+                property(out, 8, "nruns", r.nruns);
+                property(out, 8, "time_ms", r.time[0]);
+                property(out, 8, "time_ms_low", r.time[1]);
+                property(out, 8, "time_ms_high", r.time[2]);
+                property(out, 8, "gflops", r.gflops[0]);
+                property(out, 8, "gbs", r.gbs[0]);
+                property(out, 8, "memory_data", r.memory_data);
+                property(out, 8, "memory_buffer", r.memory_buffer);
+                property(out, 8, "memory_internal", r.memory_internal);
+                property(out, 8, "memory_peak", r.memory_peak);
+                if(r.streams > 1)
+                {
+                    property(out, 8, "streams", r.streams);
+                    property(out, 8, "latency_ms", r.latency);
+                }
+                if(r.has_roofline)
+                {
+                    property(out, 8, "intensity", r.intensity);
+                    property(out, 8, "bound_percent", r.bound_percent);
+                    property(out, 8, "bandwidth_percent", r.bandwidth_percent);
+                    property(out, 8, "regime", std::string(regime(r)));
+                }
+                out << "      </properties>" << std::endl;
+                out << "    </testcase>" << std::endl;
+            }
+
+            out << "  </testsuite>" << std::endl;
+            out << "</testsuites>" << std::endl;
+        }
+
+    private:
+        template <typename T>
+        static void property(std::ostream& out, int indent, const char* name, const T& value)
+        {
+            std::ostringstream v;
+            v << value;
+            out << std::string(indent, ' ') << "<property name=\"" << name << "\" value=\""
+                << xml_escape(v.str()) << "\"/>" << std::endl;
+        }
+
+        hipsparse_bench_report              m_report{};
+        std::vector<hipsparse_bench_record> m_records{};
+    };
+}
+
+std::unique_ptr<hipsparse_bench_writer> hipsparse_bench_writer::create(const std::string& format)
+{
+    if(format == "csv")
+    {
+        return std::unique_ptr<hipsparse_bench_writer>(new hipsparse_bench_writer_csv());
+    }
+    else if(format == "md")
+    {
+        return std::unique_ptr<hipsparse_bench_writer>(new hipsparse_bench_writer_markdown());
+    }
+    else if(format == "junit")
+    {
+        return std::unique_ptr<hipsparse_bench_writer>(new hipsparse_bench_writer_junit());
+    }
+    return nullptr;
+}
+
+bool hipsparse_bench_writer::is_format(const std::string& format)
+{
+    return format == "json" || format == "csv" || format == "md" || format == "junit";
+}
@@ -0,0 +1,107 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+//
+// @brief Header of a result file.
+//
+struct hipsparse_bench_report
+{
+    std::string date{}; // ISO 8601
+    std::string version{};
+    std::string device{};
+    std::string cmdline{};
+    std::string suite{};
+};
+
+//
+// @brief Summary of a sample, as written by the result writers.
+// @details
+// Times are in milliseconds, memory in bytes. time, gflops and gbs hold the median over the runs
+// followed by the bounds of its 95% confidence interval. latency is only meaningful when streams
+// is greater than 1, the roofline fields only when has_roofline is true.
+//
+struct hipsparse_bench_record
+{
+    std::string cmdline{};
+    std::string function{};
+    char        precision{};
+    char        indextype{};
+    std::string matrix{};
+    int         nruns{};
+    double      time[3]{};
+    double      gflops[3]{};
+    double      gbs[3]{};
+    size_t      memory_data{};
+    size_t      memory_buffer{};
+    size_t      memory_internal{};
+    size_t      memory_peak{};
+    int         streams{1};
+    double      latency{};
+    bool        has_roofline{};
+    double      intensity{};
+    double      bound_percent{};
+    double      bandwidth_percent{};
+    bool        memory_bound{};
+};
+
+//
+// @brief Result sink of the benchmarks, see option --bench-format.
+// @details
+// A writer receives the header, then one record per sample, then closes the file. Formats:
+//
+// - csv, one row per sample with a fixed set of columns, new columns are only appended.
+// - md, a Markdown table.
+// - junit, a JUnit XML report, one testcase per sample with its measures as properties.
+//
+// The JSON format of --bench-o is written by hipsparse_bench_app itself.
+//
+class hipsparse_bench_writer
+{
+public:
+    virtual ~hipsparse_bench_writer() = default;
+
+    //
+    // @brief Return the file extension of the format, with the leading dot.
+    //
+    virtual const char* extension() const = 0;
+
+    virtual void begin(std::ostream& out, const hipsparse_bench_report& report) = 0;
+    virtual void write(std::ostream& out, const hipsparse_bench_record& record) = 0;
+    virtual void end(std::ostream& out)                                         = 0;
+
+    //
+    // @brief Create the writer of a format, nullptr if the format is unknown.
+    //
+    static std::unique_ptr<hipsparse_bench_writer> create(const std::string& format);
+
+    //
+    // @brief Return true if the format is known, json included.
+    //
+    static bool is_format(const std::string& format);
+};
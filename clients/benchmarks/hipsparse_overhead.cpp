@@ -0,0 +1,641 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+// hipsparse-overhead, host time of every hipSPARSE routine built against the stub HIP runtime
+// and rocSPARSE libraries, see library/src/stub_detail. The stubs return immediately, the time
+// is the one spent by the wrappers, i.e. argument checks, enum and status conversions, tracing,
+// temporary descriptors and allocations.
+//
+// The routines are called with synthetic arguments, see overheadArg. The stubs do not read
+// them, the arrays all point to one buffer and the opaque descriptors are the handle, except
+// those with their own type, e.g. csrsv2Info_t, which are created once. A create routine is
+// timed together with its destroy routine.
+//
+// With --capture, each routine is instead called once inside a stream capture of the stub HIP
+// runtime, with the handle in HIPSPARSE_SYNC_MODE_CAPTURE_SAFE, in host and device pointer
+// modes. It is safe if the capture is still valid, rejected if it returns
+// HIPSPARSE_STATUS_NOT_SUPPORTED, and unsafe if it invalidates the capture, in which case the
+// exit code is 1. As documented for the sync mode, the routine is called once outside of the
+// capture beforehand. A create routine is captured without its destroy routine.
+
+#include "program_options.hpp"
+
+#include <hipsparse.h>
+
+#include <chrono>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct overheadContext
+    {
+        hipsparseHandle_t   handle = nullptr;
+        std::vector<double> scratch;
+    };
+
+    // Objects of the opaque types that are not void*, created before the timings
+    template <typename T>
+    struct overheadObject
+    {
+        static T value;
+    };
+
+    template <typename T>
+    T overheadObject<T>::value = nullptr;
+
+    template <typename T, typename = void>
+    struct isComplete : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct isComplete<T, decltype(void(sizeof(T)))> : std::true_type
+    {
+    };
+
+    // Pointer to an incomplete type other than void, e.g. csrsv2Info_t
+    template <typename T>
+    struct isOpaque : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct isOpaque<T*>
+        : std::integral_constant<bool, !std::is_void<T>::value && !isComplete<T>::value>
+    {
+    };
+
+    // First valid value of an enumeration, the wrappers reject the others
+    template <typename T>
+    struct overheadEnum
+    {
+        static constexpr T value = static_cast<T>(0);
+    };
+
+    template <>
+    struct overheadEnum<hipsparseFormat_t>
+    {
+        static constexpr hipsparseFormat_t value = HIPSPARSE_FORMAT_CSR;
+    };
+
+    template <>
+    struct overheadEnum<hipsparseOrder_t>
+    {
+        static constexpr hipsparseOrder_t value = HIPSPARSE_ORDER_COL;
+    };
+
+    template <>
+    struct overheadEnum<hipsparseIndexType_t>
+    {
+        static constexpr hipsparseIndexType_t value = HIPSPARSE_INDEX_32I;
+    };
+
+    // Sizes, leading dimensions and scalars passed by value
+    template <typename T, typename = void>
+    struct overheadArg
+    {
+        static T get(overheadContext&)
+        {
+            return T(1);
+        }
+    };
+
+    template <typename T>
+    struct overheadArg<T, typename std::enable_if<std::is_enum<T>::value>::type>
+    {
+        static T get(overheadContext&)
+        {
+            return overheadEnum<T>::value;
+        }
+    };
+
+    // Complex scalars passed by value
+    template <typename T>
+    struct overheadArg<T, typename std::enable_if<std::is_class<T>::value>::type>
+    {
+        static T get(overheadContext&)
+        {
+            return T{};
+        }
+    };
+
+    // Arrays and output parameters, or the object of an opaque type
+    template <typename T>
+    struct overheadArg<T*>
+    {
+        static T* get(overheadContext& context)
+        {
+            return get(context, isComplete<T>());
+        }
+
+        static T* get(overheadContext& context, std::true_type)
+        {
+            return reinterpret_cast<T*>(context.scratch.data());
+        }
+
+        static T* get(overheadContext& context, std::false_type)
+        {
+            return (overheadObject<T*>::value != nullptr)
+                       ? overheadObject<T*>::value
+                       : reinterpret_cast<T*>(context.scratch.data());
+        }
+    };
+
+    // Handle and descriptors
+    template <>
+    struct overheadArg<void*>
+    {
+        static void* get(overheadContext& context)
+        {
+            return context.handle;
+        }
+    };
+
+    // Scalars and constant arrays
+    template <>
+    struct overheadArg<const void*>
+    {
+        static const void* get(overheadContext& context)
+        {
+            return context.scratch.data();
+        }
+    };
+
+    template <>
+    struct overheadArg<hipStream_t>
+    {
+        static hipStream_t get(overheadContext&)
+        {
+            return nullptr;
+        }
+    };
+
+    inline hipsparseStatus_t statusOf(hipsparseStatus_t status)
+    {
+        return status;
+    }
+
+    // Routines that do not return a status, e.g. hipsparseGetMatIndexBase()
+    template <typename T>
+    inline hipsparseStatus_t statusOf(const T&)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename R, typename... Ts, typename... Ps, size_t... I>
+    inline R call(R (*routine)(Ts...), const std::tuple<Ps...>& args, std::index_sequence<I...>)
+    {
+        return routine(std::get<I>(args)...);
+    }
+
+    template <typename R, typename T, typename... Ts, typename... Ps, size_t... I>
+    inline R call(R (*routine)(T*, Ts...),
+                  T*                       object,
+                  const std::tuple<Ps...>& args,
+                  std::index_sequence<I...>)
+    {
+        return routine(object, std::get<I>(args)...);
+    }
+
+    struct overheadResult
+    {
+        std::string       routine;
+        hipsparseStatus_t status; // of the first call
+        double            ns; // per call
+    };
+
+    enum captureStatus
+    {
+        captureSafe,
+        captureRejected,
+        captureUnsafe
+    };
+
+    inline const char* captureStatusName(captureStatus status)
+    {
+        switch(status)
+        {
+        case captureSafe:
+            return "safe";
+        case captureRejected:
+            return "rejected";
+        case captureUnsafe:
+            return "unsafe";
+        }
+        return "unknown";
+    }
+
+    struct captureResult
+    {
+        std::string   routine;
+        captureStatus host; // in host pointer mode
+        captureStatus device; // in device pointer mode
+    };
+
+    class overheadBench
+    {
+    public:
+        overheadBench(int iterations, const std::string& filter, bool capture)
+            : m_iterations(iterations)
+            , m_filter(filter)
+            , m_capture(capture)
+        {
+            this->m_context.scratch.resize(8192);
+        }
+
+        hipsparseStatus_t create()
+        {
+            if(this->m_capture && hipStreamCreate(&this->m_stream) != hipSuccess)
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+
+            return hipsparseCreate(&this->m_context.handle);
+        }
+
+        hipsparseStatus_t destroy()
+        {
+            for(auto it = this->m_objects.rbegin(); it != this->m_objects.rend(); ++it)
+            {
+                (*it)();
+            }
+            this->m_objects.clear();
+
+            const hipsparseStatus_t status = hipsparseDestroy(this->m_context.handle);
+            if(this->m_stream != nullptr)
+            {
+                hipStreamDestroy(this->m_stream);
+                this->m_stream = nullptr;
+            }
+            return status;
+        }
+
+        const std::vector<overheadResult>& results() const
+        {
+            return this->m_results;
+        }
+
+        const std::vector<captureResult>& captures() const
+        {
+            return this->m_captures;
+        }
+
+        // Create the object of an opaque type once, it is passed to the other routines
+        template <typename T, typename... Ts, typename R, typename U>
+        void setup(hipsparseStatus_t (*create)(T*, Ts...), R (*destroy)(U))
+        {
+            this->setup(create, destroy, isOpaque<T>());
+        }
+
+        template <typename R, typename... Ts>
+        void routine(const char* name, R (*routine)(Ts...))
+        {
+            if(!this->selected(name))
+            {
+                return;
+            }
+
+            const std::tuple<Ts...> args(overheadArg<Ts>::get(this->m_context)...);
+            const auto              seq = std::index_sequence_for<Ts...>();
+
+            if(this->m_capture)
+            {
+                this->capture(
+                    name, [&]() { return statusOf(call(routine, args, seq)); }, []() {});
+                return;
+            }
+
+            const hipsparseStatus_t status = statusOf(call(routine, args, seq));
+
+            const auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < this->m_iterations; ++i)
+            {
+                call(routine, args, seq);
+            }
+            const auto stop = std::chrono::steady_clock::now();
+
+            this->record(name, status, stop - start);
+        }
+
+        template <typename T, typename... Ts, typename R, typename U>
+        void pair(const char* name, hipsparseStatus_t (*create)(T*, Ts...), R (*destroy)(U))
+        {
+            if(!this->selected(name))
+            {
+                return;
+            }
+
+            const std::tuple<Ts...> args(overheadArg<Ts>::get(this->m_context)...);
+            const auto              seq = std::index_sequence_for<Ts...>();
+
+            T object{};
+            if(this->m_capture)
+            {
+                // A handle is not in capture-safe sync mode before it is created
+                if(create != reinterpret_cast<decltype(create)>(&hipsparseCreate))
+                {
+                    this->capture(
+                        name,
+                        [&]() { return call(create, &object, args, seq); },
+                        [&]() { destroy(object); });
+                }
+                return;
+            }
+
+            const hipsparseStatus_t status = call(create, &object, args, seq);
+            destroy(object);
+
+            const auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < this->m_iterations; ++i)
+            {
+                call(create, &object, args, seq);
+                destroy(object);
+            }
+            const auto stop = std::chrono::steady_clock::now();
+
+            this->record(name, status, stop - start);
+        }
+
+    private:
+        template <typename T, typename... Ts, typename R, typename U>
+        void setup(hipsparseStatus_t (*create)(T*, Ts...), R (*destroy)(U), std::true_type)
+        {
+            const std::tuple<Ts...> args(overheadArg<Ts>::get(this->m_context)...);
+
+            T object{};
+            if(call(create, &object, args, std::index_sequence_for<Ts...>())
+               == HIPSPARSE_STATUS_SUCCESS)
+            {
+                overheadObject<T>::value = object;
+                this->m_objects.push_back([object, destroy]() {
+                    overheadObject<T>::value = nullptr;
+                    destroy(object);
+                });
+            }
+        }
+
+        template <typename T, typename... Ts, typename R, typename U>
+        void setup(hipsparseStatus_t (*)(T*, Ts...), R (*)(U), std::false_type)
+        {
+        }
+
+        // Call a routine inside a capture of the stream of the handle, cleanup is called outside
+        // of the capture when the routine succeeds
+        template <typename F, typename G>
+        captureStatus capture(F run, G cleanup, hipsparsePointerMode_t mode)
+        {
+            const hipsparseHandle_t handle = this->m_context.handle;
+
+            // The first call grows the workspace of the handle and binds it to the stream
+            hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING);
+            hipsparseSetPointerMode(handle, mode);
+            hipsparseSetStream(handle, this->m_stream);
+            if(run() == HIPSPARSE_STATUS_SUCCESS)
+            {
+                cleanup();
+            }
+
+            hipsparseSetPointerMode(handle, mode);
+            hipsparseSetStream(handle, this->m_stream);
+            hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_CAPTURE_SAFE);
+
+            hipGraph_t graph = nullptr;
+            hipError_t begin = hipStreamBeginCapture(this->m_stream, hipStreamCaptureModeGlobal);
+            const hipsparseStatus_t status = run();
+            hipError_t              end    = hipStreamEndCapture(this->m_stream, &graph);
+            if(graph != nullptr)
+            {
+                hipGraphDestroy(graph);
+            }
+
+            hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING);
+            if(status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                cleanup();
+            }
+
+            if(begin != hipSuccess || end != hipSuccess)
+            {
+                return captureUnsafe;
+            }
+            return (status == HIPSPARSE_STATUS_NOT_SUPPORTED) ? captureRejected : captureSafe;
+        }
+
+        template <typename F, typename G>
+        void capture(const char* name, F run, G cleanup)
+        {
+            captureResult result;
+            result.routine = name;
+            result.host    = this->capture(run, cleanup, HIPSPARSE_POINTER_MODE_HOST);
+            result.device  = this->capture(run, cleanup, HIPSPARSE_POINTER_MODE_DEVICE);
+            this->m_captures.push_back(result);
+        }
+
+        bool selected(const char* name) const
+        {
+            return this->m_filter.empty()
+                   || std::string(name).find(this->m_filter) != std::string::npos;
+        }
+
+        void record(const char*                      name,
+                    hipsparseStatus_t                status,
+                    std::chrono::steady_clock::duration time)
+        {
+            const double ns = std::chrono::duration<double, std::nano>(time).count();
+            this->m_results.push_back({name, status, ns / this->m_iterations});
+        }
+
+        overheadContext                    m_context;
+        std::vector<std::function<void()>> m_objects;
+        std::vector<overheadResult>        m_results;
+        std::vector<captureResult>         m_captures;
+        int                                m_iterations;
+        std::string                        m_filter;
+        bool                               m_capture;
+        hipStream_t                        m_stream = nullptr;
+    };
+
+    // Time per call of each routine in a file written by --output
+    bool readBaseline(const std::string& path, std::map<std::string, double>& baseline)
+    {
+        std::ifstream file(path);
+        if(!file)
+        {
+            return false;
+        }
+
+        std::string line;
+        std::getline(file, line); // header
+        while(std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            std::string        routine;
+            std::string        status;
+            std::string        ns;
+            if(std::getline(fields, routine, ',') && std::getline(fields, status, ',')
+               && std::getline(fields, ns, ','))
+            {
+                baseline[routine] = std::stod(ns);
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int         iterations = 100000;
+    double      tolerance  = 0.25;
+    std::string filter;
+    std::string output;
+    std::string baseline_path;
+    bool        capture = false;
+
+    options_description desc("hipsparse-overhead command line options");
+    desc.add_options()("help,h", "produces this help message")(
+        "iterations,i",
+        value<int>(&iterations)->default_value(100000),
+        "number of calls of each routine")(
+        "filter,f",
+        value<std::string>(&filter)->default_value(""),
+        "time the routines whose name contains this string only")(
+        "output,o",
+        value<std::string>(&output)->default_value(""),
+        "write the results to this file, in the format of the standard output")(
+        "baseline,b",
+        value<std::string>(&baseline_path)->default_value(""),
+        "results of a previous run, the routines slower by more than the tolerance are reported "
+        "and the exit code is 1")("tolerance,t",
+                                  value<double>(&tolerance)->default_value(0.25),
+                                  "relative tolerance of the comparison with the baseline")(
+        "capture",
+        bool_switch(&capture)->default_value(false),
+        "list the routines that are safe, rejected or unsafe in a stream capture, with the "
+        "capture-safe sync mode, instead of timing them, the exit code is 1 if one is unsafe");
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        std::cout << "The trace layers are timed too when HIPSPARSE_LAYER is set." << std::endl;
+        return 0;
+    }
+
+    if(iterations <= 0)
+    {
+        std::cerr << "Invalid number of iterations " << iterations << std::endl;
+        return -1;
+    }
+
+    std::map<std::string, double> baseline;
+    if(!baseline_path.empty() && !readBaseline(baseline_path, baseline))
+    {
+        std::cerr << "Cannot read the baseline " << baseline_path << std::endl;
+        return -1;
+    }
+
+    overheadBench bench(iterations, filter, capture);
+    if(bench.create() != HIPSPARSE_STATUS_SUCCESS)
+    {
+        std::cerr << "hipsparseCreate failed" << std::endl;
+        return -1;
+    }
+
+    // The list of routines is generated from hipsparse.h, see CMakeLists.txt
+#define HIPSPARSE_OVERHEAD_ROUTINE(ROUTINE)
+#define HIPSPARSE_OVERHEAD_PAIR(CREATE, DESTROY) bench.setup(CREATE, DESTROY);
+#include "hipsparse_overhead_routines.hpp"
+#undef HIPSPARSE_OVERHEAD_ROUTINE
+#undef HIPSPARSE_OVERHEAD_PAIR
+
+#define HIPSPARSE_OVERHEAD_ROUTINE(ROUTINE) bench.routine(#ROUTINE, ROUTINE);
+#define HIPSPARSE_OVERHEAD_PAIR(CREATE, DESTROY) bench.pair(#CREATE "/" #DESTROY, CREATE, DESTROY);
+#include "hipsparse_overhead_routines.hpp"
+#undef HIPSPARSE_OVERHEAD_ROUTINE
+#undef HIPSPARSE_OVERHEAD_PAIR
+
+    if(bench.destroy() != HIPSPARSE_STATUS_SUCCESS)
+    {
+        std::cerr << "hipsparseDestroy failed" << std::endl;
+        return -1;
+    }
+
+    if(capture)
+    {
+        int unsafe = 0;
+        std::cout << "routine,host,device" << std::endl;
+        for(const auto& result : bench.captures())
+        {
+            std::cout << result.routine << "," << captureStatusName(result.host) << ","
+                      << captureStatusName(result.device) << std::endl;
+            unsafe += (result.host == captureUnsafe || result.device == captureUnsafe) ? 1 : 0;
+        }
+
+        if(unsafe != 0)
+        {
+            std::cerr << unsafe << " routines are not capture-safe" << std::endl;
+        }
+        return (unsafe == 0) ? 0 : 1;
+    }
+
+    std::ostringstream results;
+    results << "routine,status,ns_per_call" << std::endl;
+    for(const auto& result : bench.results())
+    {
+        results << result.routine << "," << result.status << "," << result.ns << std::endl;
+    }
+
+    std::cout << results.str();
+    if(!output.empty())
+    {
+        std::ofstream file(output);
+        file << results.str();
+    }
+
+    int regressions = 0;
+    for(const auto& result : bench.results())
+    {
+        auto it = baseline.find(result.routine);
+        if(it != baseline.end() && result.ns > it->second * (1.0 + tolerance))
+        {
+            std::cerr << result.routine << ": " << result.ns << " ns per call, baseline "
+                      << it->second << " ns" << std::endl;
+            ++regressions;
+        }
+    }
+
+    return (regressions == 0) ? 0 : 1;
+}
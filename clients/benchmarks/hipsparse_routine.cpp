@@ -195,6 +195,7 @@ constexpr const char* hipsparse_routine::to_string() const
 // Extra
 #include "testing_csrgeam.hpp"
 #include "testing_csrgemm.hpp"
+#include "testing_csrgemm2_numeric.hpp"
 
 // Precond
 #include "testing_bsric02.hpp"
@@ -233,9 +234,11 @@ constexpr const char* hipsparse_routine::to_string() const
 #include "testing_spmm_csr.hpp"
 #include "testing_spmv_coo.hpp"
 #include "testing_spmv_csr.hpp"
+#include "testing_spmv_plan_csr.hpp"
 #include "testing_spsm_coo.hpp"
 #include "testing_spsm_csr.hpp"
 #include "testing_spsv_csr.hpp"
+#include "testing_spsv_update_csr.hpp"
 
 bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME)
 {
@@ -263,8 +266,12 @@ bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME
         return routine_support::is_coomv_supported();
     case csrmv:
         return routine_support::is_csrmv_supported();
+    case csrmv_plan:
+        return routine_support::is_csrmv_plan_supported();
     case csrsv:
         return routine_support::is_csrsv_supported();
+    case csrsv_update:
+        return routine_support::is_csrsv_update_supported();
     case gemvi:
         return routine_support::is_gemvi_supported();
     case hybmv:
@@ -291,6 +298,8 @@ bool hipsparse_routine::is_routine_supported(hipsparse_routine::value_type FNAME
         return routine_support::is_csrgeam_supported();
     case csrgemm:
         return routine_support::is_csrgemm_supported();
+    case csrgemm2_numeric:
+        return routine_support::is_csrgemm2_numeric_supported();
     // Precond
     case bsric02:
         return routine_support::is_bsric02_supported();
@@ -388,9 +397,15 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case csrmv:
         routine_support::print_csrmv_support_warning();
         break;
+    case csrmv_plan:
+        routine_support::print_csrmv_plan_support_warning();
+        break;
     case csrsv:
         routine_support::print_csrsv_support_warning();
         break;
+    case csrsv_update:
+        routine_support::print_csrsv_update_support_warning();
+        break;
     case gemvi:
         routine_support::print_gemvi_support_warning();
         break;
@@ -429,6 +444,9 @@ void hipsparse_routine::print_routine_support_info(hipsparse_routine::value_type
     case csrgemm:
         routine_support::print_csrgemm_support_warning();
         break;
+    case csrgemm2_numeric:
+        routine_support::print_csrgemm2_numeric_support_warning();
+        break;
     // Precond
     case bsric02:
         routine_support::print_bsric02_support_warning();
@@ -653,7 +671,9 @@ hipsparseStatus_t hipsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(bsrsv2);
         DEFINE_CASE_IT_X(coomv, testing_spmv_coo);
         DEFINE_CASE_IJT_X(csrmv, testing_spmv_csr);
+        DEFINE_CASE_IJT_X(csrmv_plan, testing_spmv_plan_csr);
         DEFINE_CASE_IJT_X(csrsv, testing_spsv_csr);
+        DEFINE_CASE_IJT_X(csrsv_update, testing_spsv_update_csr);
         DEFINE_CASE_T(gemvi);
         DEFINE_CASE_T(hybmv);
 
@@ -670,6 +690,7 @@ hipsparseStatus_t hipsparse_routine::dispatch_call(const Arguments& arg)
         // Extra
         DEFINE_CASE_T(csrgeam);
         DEFINE_CASE_T(csrgemm);
+        DEFINE_CASE_T(csrgemm2_numeric);
 
         // Precond
         DEFINE_CASE_T(bsric02);
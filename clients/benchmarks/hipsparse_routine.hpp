@@ -36,7 +36,9 @@ HIPSPARSE_DO_ROUTINE(sctr)          \
 HIPSPARSE_DO_ROUTINE(bsrsv2)        \
 HIPSPARSE_DO_ROUTINE(coomv)         \
 HIPSPARSE_DO_ROUTINE(csrmv)         \
+HIPSPARSE_DO_ROUTINE(csrmv_plan)    \
 HIPSPARSE_DO_ROUTINE(csrsv)         \
+HIPSPARSE_DO_ROUTINE(csrsv_update)  \
 HIPSPARSE_DO_ROUTINE(gemvi)         \
 HIPSPARSE_DO_ROUTINE(hybmv)         \
 HIPSPARSE_DO_ROUTINE(bsrmm)         \
@@ -49,6 +51,7 @@ HIPSPARSE_DO_ROUTINE(csrsm)         \
 HIPSPARSE_DO_ROUTINE(gemmi)         \
 HIPSPARSE_DO_ROUTINE(csrgeam)       \
 HIPSPARSE_DO_ROUTINE(csrgemm)       \
+HIPSPARSE_DO_ROUTINE(csrgemm2_numeric) \
 HIPSPARSE_DO_ROUTINE(bsric02)       \
 HIPSPARSE_DO_ROUTINE(bsrilu02)      \
 HIPSPARSE_DO_ROUTINE(csric02)       \
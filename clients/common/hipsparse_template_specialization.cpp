@@ -4226,6 +4226,248 @@ namespace hipsparse
     }
 #endif
 
+#if(!defined(CUDART_VERSION))
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const float*              alpha,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const float*              csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const float*              csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const float*              beta,
+                                                const hipsparseMatDescr_t descrD,
+                                                int                       nnzD,
+                                                const float*              csrValD,
+                                                const int*                csrRowPtrD,
+                                                const int*                csrColIndD,
+                                                const hipsparseMatDescr_t descrC,
+                                                int                       nnzC,
+                                                float*                    csrValC,
+                                                const int*                csrRowPtrC,
+                                                const int*                csrColIndC,
+                                                const csrgemm2Info_t      info,
+                                                void*                     pBuffer)
+    {
+        return hipsparseScsrgemm2Numeric(handle,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         beta,
+                                         descrD,
+                                         nnzD,
+                                         csrValD,
+                                         csrRowPtrD,
+                                         csrColIndD,
+                                         descrC,
+                                         nnzC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         info,
+                                         pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const double*             alpha,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const double*             csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const double*             csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const double*             beta,
+                                                const hipsparseMatDescr_t descrD,
+                                                int                       nnzD,
+                                                const double*             csrValD,
+                                                const int*                csrRowPtrD,
+                                                const int*                csrColIndD,
+                                                const hipsparseMatDescr_t descrC,
+                                                int                       nnzC,
+                                                double*                   csrValC,
+                                                const int*                csrRowPtrC,
+                                                const int*                csrColIndC,
+                                                const csrgemm2Info_t      info,
+                                                void*                     pBuffer)
+    {
+        return hipsparseDcsrgemm2Numeric(handle,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         beta,
+                                         descrD,
+                                         nnzD,
+                                         csrValD,
+                                         csrRowPtrD,
+                                         csrColIndD,
+                                         descrC,
+                                         nnzC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         info,
+                                         pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipComplex*         alpha,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const hipComplex*         csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const hipComplex*         csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipComplex*         beta,
+                                                const hipsparseMatDescr_t descrD,
+                                                int                       nnzD,
+                                                const hipComplex*         csrValD,
+                                                const int*                csrRowPtrD,
+                                                const int*                csrColIndD,
+                                                const hipsparseMatDescr_t descrC,
+                                                int                       nnzC,
+                                                hipComplex*               csrValC,
+                                                const int*                csrRowPtrC,
+                                                const int*                csrColIndC,
+                                                const csrgemm2Info_t      info,
+                                                void*                     pBuffer)
+    {
+        return hipsparseCcsrgemm2Numeric(handle,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         beta,
+                                         descrD,
+                                         nnzD,
+                                         csrValD,
+                                         csrRowPtrD,
+                                         csrColIndD,
+                                         descrC,
+                                         nnzC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         info,
+                                         pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const hipDoubleComplex*   alpha,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const hipDoubleComplex*   csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const hipDoubleComplex*   csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const hipDoubleComplex*   beta,
+                                                const hipsparseMatDescr_t descrD,
+                                                int                       nnzD,
+                                                const hipDoubleComplex*   csrValD,
+                                                const int*                csrRowPtrD,
+                                                const int*                csrColIndD,
+                                                const hipsparseMatDescr_t descrC,
+                                                int                       nnzC,
+                                                hipDoubleComplex*         csrValC,
+                                                const int*                csrRowPtrC,
+                                                const int*                csrColIndC,
+                                                const csrgemm2Info_t      info,
+                                                void*                     pBuffer)
+    {
+        return hipsparseZcsrgemm2Numeric(handle,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descrA,
+                                         nnzA,
+                                         csrValA,
+                                         csrRowPtrA,
+                                         csrColIndA,
+                                         descrB,
+                                         nnzB,
+                                         csrValB,
+                                         csrRowPtrB,
+                                         csrColIndB,
+                                         beta,
+                                         descrD,
+                                         nnzD,
+                                         csrValD,
+                                         csrRowPtrD,
+                                         csrColIndD,
+                                         descrC,
+                                         nnzC,
+                                         csrValC,
+                                         csrRowPtrC,
+                                         csrColIndC,
+                                         info,
+                                         pBuffer);
+    }
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 13000)
     template <>
     hipsparseStatus_t hipsparseXbsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -0,0 +1,200 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//
+// The HIP runtime calls of the clients, for the host backend, which is built with the HIP
+// headers only. There is a single device, the host: the allocations are in host memory, and
+// the copies and the memsets are done before returning, whatever the stream.
+//
+
+#include <hip/hip_runtime_api.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+struct ihipStream_t
+{
+};
+
+struct ihipEvent_t
+{
+    std::chrono::steady_clock::time_point time;
+};
+
+hipError_t hipMalloc(void** ptr, size_t size)
+{
+    if(ptr == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    // The clients allocate empty arrays, they must get distinct pointers
+    *ptr = malloc(size != 0 ? size : 1);
+    return (*ptr != nullptr) ? hipSuccess : hipErrorMemoryAllocation;
+}
+
+hipError_t hipFree(void* ptr)
+{
+    free(ptr);
+    return hipSuccess;
+}
+
+hipError_t hipMemcpy(void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind)
+{
+    if(sizeBytes != 0)
+    {
+        memcpy(dst, src, sizeBytes);
+    }
+    return hipSuccess;
+}
+
+hipError_t hipMemcpyAsync(
+    void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind, hipStream_t stream)
+{
+    return hipMemcpy(dst, src, sizeBytes, kind);
+}
+
+hipError_t hipMemset(void* dst, int value, size_t sizeBytes)
+{
+    if(sizeBytes != 0)
+    {
+        memset(dst, value, sizeBytes);
+    }
+    return hipSuccess;
+}
+
+hipError_t hipMemsetAsync(void* dst, int value, size_t sizeBytes, hipStream_t stream)
+{
+    return hipMemset(dst, value, sizeBytes);
+}
+
+hipError_t hipGetDeviceCount(int* count)
+{
+    *count = 1;
+    return hipSuccess;
+}
+
+hipError_t hipGetDevice(int* deviceId)
+{
+    *deviceId = 0;
+    return hipSuccess;
+}
+
+hipError_t hipSetDevice(int deviceId)
+{
+    return (deviceId == 0) ? hipSuccess : hipErrorInvalidDevice;
+}
+
+hipError_t hipGetDeviceProperties(hipDeviceProp_t* prop, int deviceId)
+{
+    if(deviceId != 0)
+    {
+        return hipErrorInvalidDevice;
+    }
+
+    memset(prop, 0, sizeof(*prop));
+    strncpy(prop->name, "host", sizeof(prop->name) - 1);
+    prop->totalGlobalMem     = size_t(sysconf(_SC_PHYS_PAGES)) * size_t(sysconf(_SC_PAGE_SIZE));
+    prop->l2CacheSize        = 4 << 20;
+    prop->maxThreadsPerBlock = 1024;
+    prop->maxGridSize[0]     = 1;
+
+    // The reference of the SpMV tests sums the rows as 64 wide wavefronts do
+    prop->warpSize = 64;
+    return hipSuccess;
+}
+
+hipError_t hipDeviceSynchronize()
+{
+    return hipSuccess;
+}
+
+hipError_t hipDeviceReset()
+{
+    return hipSuccess;
+}
+
+hipError_t hipStreamCreateWithFlags(hipStream_t* stream, unsigned int flags)
+{
+    *stream = new ihipStream_t;
+    return hipSuccess;
+}
+
+hipError_t hipStreamDestroy(hipStream_t stream)
+{
+    delete stream;
+    return hipSuccess;
+}
+
+hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+    return hipSuccess;
+}
+
+hipError_t hipEventCreate(hipEvent_t* event)
+{
+    *event = new ihipEvent_t;
+    return hipSuccess;
+}
+
+hipError_t hipEventDestroy(hipEvent_t event)
+{
+    delete event;
+    return hipSuccess;
+}
+
+hipError_t hipEventRecord(hipEvent_t event, hipStream_t stream)
+{
+    event->time = std::chrono::steady_clock::now();
+    return hipSuccess;
+}
+
+hipError_t hipEventSynchronize(hipEvent_t event)
+{
+    return hipSuccess;
+}
+
+hipError_t hipEventElapsedTime(float* ms, hipEvent_t start, hipEvent_t stop)
+{
+    *ms = std::chrono::duration<float, std::milli>(stop->time - start->time).count();
+    return hipSuccess;
+}
+
+const char* hipGetErrorString(hipError_t hipError)
+{
+    switch(hipError)
+    {
+    case hipSuccess:
+        return "hipSuccess";
+    case hipErrorInvalidValue:
+        return "hipErrorInvalidValue";
+    case hipErrorMemoryAllocation:
+        return "hipErrorMemoryAllocation";
+    case hipErrorInvalidDevice:
+        return "hipErrorInvalidDevice";
+    default:
+        return "hipErrorUnknown";
+    }
+}
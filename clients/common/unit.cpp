@@ -24,9 +24,13 @@
 #include "unit.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse.h>
+#include <iostream>
 #include <limits>
+#include <sstream>
 
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
@@ -43,213 +47,358 @@
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, sincer assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+// The whole matrix is compared before anything is reported, so that a failure gives the number of
+// wrong elements, the largest errors and the first failing position instead of stopping at the
+// first element. Columns are compared in parallel with OpenMP, the element comparison is branch
+// free so that the inner loop can be vectorized.
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
 #ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+// ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ accept up to 4 ULPs.
+static constexpr uint64_t unit_check_general_max_ulps = 4;
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+static constexpr uint64_t unit_check_general_max_ulps = 0;
 #endif
-        }
-    }
+
+struct unit_check_error
+{
+    int64_t  fail;
+    double   abs_error;
+    double   rel_error;
+    uint64_t ulp_distance;
+};
+
+// Map the bits of a floating point value onto a monotonic integer line, the difference of two
+// mapped values is their ULP distance.
+static inline int64_t unit_ordered_bits(float x)
+{
+    int32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return (bits < 0) ? static_cast<int64_t>(std::numeric_limits<int32_t>::min()) - bits : bits;
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+static inline int64_t unit_ordered_bits(double x)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    int64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return (bits < 0) ? std::numeric_limits<int64_t>::min() - bits : bits;
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
+template <typename R>
+static inline uint64_t unit_ulp_distance(R a, R b)
 {
-    for(int64_t j = 0; j < N; j++)
+    if(std::isnan(a) || std::isnan(b))
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
-#endif
-        }
+        return std::numeric_limits<uint64_t>::max();
     }
+
+    int64_t ia = unit_ordered_bits(a);
+    int64_t ib = unit_ordered_bits(b);
+
+    // Unsigned arithmetic, the distance between the extreme doubles does not fit in int64_t.
+    return (ia >= ib) ? static_cast<uint64_t>(ia) - static_cast<uint64_t>(ib)
+                      : static_cast<uint64_t>(ib) - static_cast<uint64_t>(ia);
 }
 
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
+// A negative tolerance compares with unit_check_general_max_ulps instead.
+template <typename R>
+static inline unit_check_error unit_check_element(R cpu, R gpu, R tolerance)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
-#endif
-        }
-    }
+    unit_check_error e;
+
+    // Same arithmetic as ASSERT_NEAR.
+    double diff = std::abs(static_cast<double>(cpu) - static_cast<double>(gpu));
+
+    e.ulp_distance = unit_ulp_distance(cpu, gpu);
+    e.fail         = (tolerance < 0) ? (e.ulp_distance > unit_check_general_max_ulps)
+                                     : !(diff <= static_cast<double>(tolerance));
+    e.abs_error    = std::isnan(diff) ? std::numeric_limits<double>::infinity() : diff;
+    e.rel_error    = (cpu != 0) ? e.abs_error / std::abs(static_cast<double>(cpu)) : e.abs_error;
+
+    return e;
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
+static inline unit_check_error unit_check_element(const unit_check_error& x,
+                                                  const unit_check_error& y)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    unit_check_error e;
+
+    e.fail         = x.fail | y.fail;
+    e.abs_error    = std::max(x.abs_error, y.abs_error);
+    e.rel_error    = std::max(x.rel_error, y.rel_error);
+    e.ulp_distance = std::max(x.ulp_distance, y.ulp_distance);
+
+    return e;
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, int64_t* hCPU, int64_t* hGPU)
+static inline unit_check_error unit_check_element(float cpu, float gpu, bool near)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    return unit_check_element(
+        cpu,
+        gpu,
+        near ? std::max(std::abs(cpu * 1e-3f), 10 * std::numeric_limits<float>::epsilon())
+             : -1.0f);
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, size_t* hCPU, size_t* hGPU)
+static inline unit_check_error unit_check_element(double cpu, double gpu, bool near)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
-    }
+    return unit_check_element(
+        cpu,
+        gpu,
+        near ? std::max(std::abs(cpu * 1e-10), 10 * std::numeric_limits<double>::epsilon())
+             : -1.0);
 }
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+static inline unit_check_error unit_check_element(hipComplex cpu, hipComplex gpu, bool near)
+{
+    return unit_check_element(unit_check_element(cpu.x, gpu.x, near),
+                              unit_check_element(cpu.y, gpu.y, near));
+}
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
+static inline unit_check_error
+    unit_check_element(hipDoubleComplex cpu, hipDoubleComplex gpu, bool near)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            float compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-3f),
-                                         10 * std::numeric_limits<float>::epsilon());
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-#else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
-#endif
-        }
-    }
+    return unit_check_element(unit_check_element(cpu.x, gpu.x, near),
+                              unit_check_element(cpu.y, gpu.y, near));
 }
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+// Half and bfloat16 results of the mixed precision products are accumulated in float and
+// rounded once, the near check accepts 4 ULPs of the narrow type. ULP distances are counted in
+// the narrow type.
+static inline int64_t unit_ordered_bits(uint16_t bits)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            double compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-10),
-                                          10 * std::numeric_limits<double>::epsilon());
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-#else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
-#endif
-        }
-    }
+    return (bits & 0x8000u) ? -static_cast<int64_t>(bits & 0x7fffu) : bits;
+}
+
+template <typename H>
+static inline unit_check_error unit_check_narrow_element(H cpu, H gpu, float epsilon, bool near)
+{
+    float c = hipsparse_widen(cpu);
+    float g = hipsparse_widen(gpu);
+
+    unit_check_error e
+        = unit_check_element(c, g, near ? std::max(std::abs(c) * 4 * epsilon, 10 * epsilon) : 0.0f);
+
+    int64_t ic     = unit_ordered_bits(cpu.data);
+    int64_t ig     = unit_ordered_bits(gpu.data);
+    e.ulp_distance = (std::isnan(c) || std::isnan(g)) ? std::numeric_limits<uint64_t>::max()
+                                                      : static_cast<uint64_t>(std::abs(ic - ig));
+
+    return e;
+}
+
+static inline unit_check_error
+    unit_check_element(hipsparse_half cpu, hipsparse_half gpu, bool near)
+{
+    return unit_check_narrow_element(cpu, gpu, 9.765625e-4f, near);
+}
+
+static inline unit_check_error
+    unit_check_element(hipsparse_bfloat16 cpu, hipsparse_bfloat16 gpu, bool near)
+{
+    return unit_check_narrow_element(cpu, gpu, 7.8125e-3f, near);
+}
+
+template <typename I>
+static inline unit_check_error unit_check_integral_element(I cpu, I gpu)
+{
+    unit_check_error e;
+
+    e.ulp_distance = (cpu >= gpu) ? static_cast<uint64_t>(cpu) - static_cast<uint64_t>(gpu)
+                                  : static_cast<uint64_t>(gpu) - static_cast<uint64_t>(cpu);
+    e.fail         = (cpu != gpu);
+    e.abs_error    = static_cast<double>(e.ulp_distance);
+    e.rel_error
+        = (cpu != 0) ? e.abs_error / std::abs(static_cast<double>(cpu)) : e.abs_error;
+
+    return e;
+}
+
+static inline unit_check_error unit_check_element(int cpu, int gpu, bool near)
+{
+    return unit_check_integral_element(cpu, gpu);
+}
+
+static inline unit_check_error unit_check_element(int64_t cpu, int64_t gpu, bool near)
+{
+    return unit_check_integral_element(cpu, gpu);
 }
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
+static inline unit_check_error unit_check_element(size_t cpu, size_t gpu, bool near)
 {
+    return unit_check_integral_element(cpu, gpu);
+}
+
+template <typename T>
+static unit_check_summary
+    unit_check_reduce(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU, bool near)
+{
+    unit_check_summary summary;
+
+    summary.count = M * N;
+
+    // Contiguous columns are folded into a single one, vectors and dense matrices then expose
+    // one long loop to the threads. Offsets i + j * lda are unchanged.
+    if(lda == M)
+    {
+        M   = M * N;
+        N   = (N > 0) ? 1 : 0;
+        lda = M;
+    }
+
+    int64_t  nfailures        = 0;
+    int64_t  first_failure    = std::numeric_limits<int64_t>::max();
+    double   max_abs_error    = 0.0;
+    double   max_rel_error    = 0.0;
+    uint64_t max_ulp_distance = 0;
+
     for(int64_t j = 0; j < N; j++)
     {
+        const T* cpu = hCPU + j * lda;
+        const T* gpu = hGPU + j * lda;
+
+#ifdef _OPENMP
+#pragma omp parallel for simd schedule(static) reduction(+ : nfailures) reduction(min : first_failure) \
+    reduction(max : max_abs_error, max_rel_error, max_ulp_distance)
+#endif
         for(int64_t i = 0; i < M; i++)
         {
-            hipComplex compare_val
-                = make_hipFloatComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()),
-                                       std::max(std::abs(hCPU[i + j * lda].y * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()));
+            unit_check_error e = unit_check_element(cpu[i], gpu[i], near);
 
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
-#else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
-#endif
+            nfailures += e.fail;
+            first_failure    = e.fail ? std::min(first_failure, i + j * lda) : first_failure;
+            max_abs_error    = std::max(max_abs_error, e.abs_error);
+            max_rel_error    = std::max(max_rel_error, e.rel_error);
+            max_ulp_distance = std::max(max_ulp_distance, e.ulp_distance);
         }
     }
+
+    summary.nfailures        = nfailures;
+    summary.first_failure    = (nfailures > 0) ? first_failure : -1;
+    summary.max_abs_error    = max_abs_error;
+    summary.max_rel_error    = max_rel_error;
+    summary.max_ulp_distance = max_ulp_distance;
+
+    return summary;
 }
 
-template <>
-void unit_check_near(
-    int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
+template <typename T>
+static void unit_print_value(std::ostream& out, const T& x)
 {
-    for(int64_t j = 0; j < N; j++)
+    out << x;
+}
+
+static void unit_print_value(std::ostream& out, const hipComplex& x)
+{
+    out << "(" << x.x << ", " << x.y << ")";
+}
+
+static void unit_print_value(std::ostream& out, const hipDoubleComplex& x)
+{
+    out << "(" << x.x << ", " << x.y << ")";
+}
+
+static void unit_print_value(std::ostream& out, const hipsparse_half& x)
+{
+    out << hipsparse_widen(x);
+}
+
+static void unit_print_value(std::ostream& out, const hipsparse_bfloat16& x)
+{
+    out << hipsparse_widen(x);
+}
+
+template <typename T>
+static void unit_check_report(const char*               name,
+                              int64_t                   lda,
+                              const T*                  hCPU,
+                              const T*                  hGPU,
+                              const unit_check_summary& summary)
+{
+    if(summary.nfailures == 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipDoubleComplex compare_val
-                = make_hipDoubleComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()),
-                                        std::max(std::abs(hCPU[i + j * lda].y * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()));
+        return;
+    }
+
+    int64_t offset = summary.first_failure;
+    int64_t i      = (lda > 0) ? offset % lda : offset;
+    int64_t j      = (lda > 0) ? offset / lda : 0;
+
+    std::ostringstream msg;
+    msg.precision(std::numeric_limits<double>::max_digits10);
+
+    msg << name << ": " << summary.nfailures << " of " << summary.count
+        << " elements differ, first failure at (" << i << ", " << j << "): expected ";
+    unit_print_value(msg, hCPU[offset]);
+    msg << ", got ";
+    unit_print_value(msg, hGPU[offset]);
+    msg << "; max abs error " << summary.max_abs_error << ", max rel error "
+        << summary.max_rel_error << ", max ULP distance " << summary.max_ulp_distance;
+
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
+    ADD_FAILURE() << msg.str();
 #else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
+    std::cerr << msg.str() << std::endl;
+    assert(summary.nfailures == 0);
 #endif
-        }
-    }
 }
+
+template <typename T>
+unit_check_summary
+    unit_check_general_summary(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU)
+{
+    return unit_check_reduce(M, N, lda, hCPU, hGPU, false);
+}
+
+template <typename T>
+unit_check_summary
+    unit_check_near_summary(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU)
+{
+    return unit_check_reduce(M, N, lda, hCPU, hGPU, true);
+}
+
+/*! \brief Template: gtest unit compare two matrices float/double/complex */
+template <typename T>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU)
+{
+    unit_check_report(
+        "unit_check_general", lda, hCPU, hGPU, unit_check_general_summary(M, N, lda, hCPU, hGPU));
+}
+
+/*! \brief Template: gtest unit compare two matrices float/double/complex */
+template <typename T>
+void unit_check_near(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU)
+{
+    unit_check_report(
+        "unit_check_near", lda, hCPU, hGPU, unit_check_near_summary(M, N, lda, hCPU, hGPU));
+}
+
+#define INSTANTIATE_UNIT_CHECK(TYPE)                                                     \
+    template unit_check_summary unit_check_general_summary(                             \
+        int64_t M, int64_t N, int64_t lda, const TYPE* hCPU, const TYPE* hGPU);         \
+    template void unit_check_general(int64_t M, int64_t N, int64_t lda, TYPE* hCPU, TYPE* hGPU)
+
+#define INSTANTIATE_UNIT_CHECK_NEAR(TYPE)                                                \
+    template unit_check_summary unit_check_near_summary(                                \
+        int64_t M, int64_t N, int64_t lda, const TYPE* hCPU, const TYPE* hGPU);         \
+    template void unit_check_near(int64_t M, int64_t N, int64_t lda, TYPE* hCPU, TYPE* hGPU)
+
+INSTANTIATE_UNIT_CHECK(float);
+INSTANTIATE_UNIT_CHECK(double);
+INSTANTIATE_UNIT_CHECK(hipComplex);
+INSTANTIATE_UNIT_CHECK(hipDoubleComplex);
+INSTANTIATE_UNIT_CHECK(int);
+INSTANTIATE_UNIT_CHECK(int64_t);
+INSTANTIATE_UNIT_CHECK(size_t);
+INSTANTIATE_UNIT_CHECK(hipsparse_half);
+INSTANTIATE_UNIT_CHECK(hipsparse_bfloat16);
+
+INSTANTIATE_UNIT_CHECK_NEAR(float);
+INSTANTIATE_UNIT_CHECK_NEAR(double);
+INSTANTIATE_UNIT_CHECK_NEAR(hipComplex);
+INSTANTIATE_UNIT_CHECK_NEAR(hipDoubleComplex);
+INSTANTIATE_UNIT_CHECK_NEAR(int);
+INSTANTIATE_UNIT_CHECK_NEAR(hipsparse_half);
+INSTANTIATE_UNIT_CHECK_NEAR(hipsparse_bfloat16);
+
+#undef INSTANTIATE_UNIT_CHECK
+#undef INSTANTIATE_UNIT_CHECK_NEAR
@@ -26,9 +26,11 @@
 #include <windows.h>
 #endif
 #include "utility.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
 
 #include <chrono>
 #include <cstdlib>
+#include <mutex>
 
 #ifdef WIN32
 #define strSUITEcmp(A, B) _stricmp(A, B)
@@ -235,3 +237,130 @@ double get_time_us_sync(hipStream_t stream)
 #ifdef __cplusplus
 }
 #endif
+
+/* ============================================================================================ */
+/*  cold mode cache flush:*/
+
+hipsparse_cache_flush::hipsparse_cache_flush(const Arguments& argus)
+{
+    if(argus.cold == 0)
+    {
+        return;
+    }
+
+    if(argus.cold_flush_size > 0)
+    {
+        this->m_size = static_cast<size_t>(argus.cold_flush_size) << 20;
+    }
+    else
+    {
+        //
+        // Several times the L2 cache, and at least 512MB to cover a last level cache behind it.
+        //
+        int             device_id = 0;
+        hipDeviceProp_t prop;
+        CHECK_HIP_ERROR(hipGetDevice(&device_id));
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, device_id));
+        this->m_size = std::max(static_cast<size_t>(prop.l2CacheSize) * 4, size_t(512) << 20);
+        this->m_size = std::min(this->m_size, prop.totalGlobalMem / 8);
+    }
+
+    CHECK_HIP_ERROR(hipMalloc(&this->m_buffer, this->m_size));
+}
+
+hipsparse_cache_flush::~hipsparse_cache_flush()
+{
+    if(this->m_buffer != nullptr)
+    {
+        CHECK_HIP_ERROR(hipFree(this->m_buffer));
+    }
+}
+
+void hipsparse_cache_flush::operator()(hipStream_t stream)
+{
+    if(this->m_buffer != nullptr)
+    {
+        const int value = (++this->m_count) & 0xff;
+        CHECK_HIP_ERROR(hipMemsetAsync(this->m_buffer, value, this->m_size, stream));
+    }
+}
+
+/* ============================================================================================ */
+/*  device memory accounting:*/
+
+namespace
+{
+    typedef hipsparse_test::device_memory::kind_t device_memory_kind_t;
+    static constexpr int device_memory_nkinds = hipsparse_test::device_memory::nkinds;
+
+    struct device_memory_state
+    {
+        std::mutex                                               mutex{};
+        std::map<void*, std::pair<size_t, device_memory_kind_t>> allocations{};
+        size_t                                                   current[device_memory_nkinds]{};
+        size_t                                                   peak[device_memory_nkinds]{};
+        size_t                                                   current_total{};
+        size_t                                                   peak_total{};
+    };
+
+    device_memory_state& get_device_memory_state()
+    {
+        static device_memory_state state;
+        return state;
+    }
+}
+
+void hipsparse_test::device_memory::record_malloc(void* ptr, size_t byte_size, kind_t kind)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    device_memory_state&        state = get_device_memory_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.allocations[ptr] = std::make_pair(byte_size, kind);
+    state.current[kind] += byte_size;
+    state.current_total += byte_size;
+
+    state.peak[kind] = std::max(state.peak[kind], state.current[kind]);
+    state.peak_total = std::max(state.peak_total, state.current_total);
+}
+
+void hipsparse_test::device_memory::record_free(void* ptr)
+{
+    device_memory_state&        state = get_device_memory_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto                        it = state.allocations.find(ptr);
+    if(it != state.allocations.end())
+    {
+        state.current[it->second.second] -= it->second.first;
+        state.current_total -= it->second.first;
+        state.allocations.erase(it);
+    }
+}
+
+void hipsparse_test::device_memory::reset_peak()
+{
+    device_memory_state&        state = get_device_memory_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for(int kind = 0; kind < nkinds; ++kind)
+    {
+        state.peak[kind] = state.current[kind];
+    }
+    state.peak_total = state.current_total;
+}
+
+size_t hipsparse_test::device_memory::get_peak(kind_t kind)
+{
+    device_memory_state&        state = get_device_memory_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.peak[kind];
+}
+
+size_t hipsparse_test::device_memory::get_peak()
+{
+    device_memory_state&        state = get_device_memory_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.peak_total;
+}
@@ -132,7 +132,9 @@ struct display_key_t
         action,
         partition,
         algorithm,
-        permute
+        permute,
+        replan_time_ms,
+        speedup
     } key_t;
 
     static const char* to_str(key_t key_)
@@ -387,6 +389,14 @@ struct display_key_t
         {
             return "permute";
         }
+        case replan_time_ms:
+        {
+            return "replan msec";
+        }
+        case speedup:
+        {
+            return "speedup";
+        }
         default:
         {
             return nullptr;
@@ -678,6 +678,38 @@ namespace hipsparse
                                          void*                     pBuffer);
 #endif
 
+#if(!defined(CUDART_VERSION))
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       k,
+                                                const T*                  alpha,
+                                                const hipsparseMatDescr_t descrA,
+                                                int                       nnzA,
+                                                const T*                  csrValA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const hipsparseMatDescr_t descrB,
+                                                int                       nnzB,
+                                                const T*                  csrValB,
+                                                const int*                csrRowPtrB,
+                                                const int*                csrColIndB,
+                                                const T*                  beta,
+                                                const hipsparseMatDescr_t descrD,
+                                                int                       nnzD,
+                                                const T*                  csrValD,
+                                                const int*                csrRowPtrD,
+                                                const int*                csrColIndD,
+                                                const hipsparseMatDescr_t descrC,
+                                                int                       nnzC,
+                                                T*                        csrValC,
+                                                const int*                csrRowPtrC,
+                                                const int*                csrColIndC,
+                                                const csrgemm2Info_t      info,
+                                                void*                     pBuffer);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 13000)
     template <typename T>
     hipsparseStatus_t hipsparseXbsrilu02_numericBoost(
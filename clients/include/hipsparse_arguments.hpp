@@ -115,6 +115,10 @@ struct Arguments
     int unit_check;
     int timing;
     int iters;
+    int cold;
+    int cold_flush_size;
+    int streams;
+    int ranks;
 
     std::string filename;
     std::string function_name;
@@ -192,6 +196,11 @@ struct Arguments
         this->timing     = 0;
         this->iters      = 10;
 
+        this->cold            = 0;
+        this->cold_flush_size = 0;
+        this->streams         = 1;
+        this->ranks           = 1;
+
         this->filename      = "";
         this->function_name = "";
     }
@@ -30,6 +30,17 @@
 #if(defined(CUDART_VERSION))
 #define STRINGIFY(x) #x
 #define TOSTRING(x) STRINGIFY(x)
+static void print_cuda_12_1_0_to_12_5_1_support_string()
+{
+    std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
+              << " but this routine is not supported. See CUDA support table for this"
+              << " routine below: " << std::endl;
+    std::string table = "                      CUDA Version                    \n"
+                        "|11.8.0|12.0.0|12.0.1|12.1.0|...|12.4.1|12.5.0|12.5.1|\n"
+                        "                     |<-----------supported--------->|  ";
+    std::cout << table << std::endl;
+}
+
 static void print_cuda_12_0_0_to_12_5_1_support_string()
 {
     std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
@@ -97,6 +108,12 @@ static void print_cuda_10_0_0_to_10_2_0_support_string()
                         "|<---------supported---------->|                   ";
     std::cout << table << std::endl;
 }
+
+static void print_rocsparse_only_support_string()
+{
+    std::cout << "Warning: You are using CUDA version: " << TOSTRING(CUDART_VERSION)
+              << " but this routine is only supported with the rocSPARSE backend." << std::endl;
+}
 #undef STRINGIFY
 #undef TOSTRING
 #endif
@@ -186,6 +203,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_csrmv_plan_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_csrsv_supported()
@@ -194,6 +219,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_csrsv_update_supported()
+    {
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+        return true;
+#else
+        return false;
 #endif
     }
     static bool is_gemvi_supported()
@@ -293,6 +326,14 @@ struct routine_support
         return true;
 #else
         return false;
+#endif
+    }
+    static bool is_csrgemm2_numeric_supported()
+    {
+#if(!defined(CUDART_VERSION))
+        return true;
+#else
+        return false;
 #endif
     }
     // Precond
@@ -482,12 +523,24 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_12_5_1_support_string();
+#endif
+    }
+    static void print_csrmv_plan_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_12_0_0_to_12_5_1_support_string();
 #endif
     }
     static void print_csrsv_support_warning()
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_11_8_0_support_string();
+#endif
+    }
+    static void print_csrsv_update_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_cuda_12_1_0_to_12_5_1_support_string();
 #endif
     }
     static void print_gemvi_support_warning()
@@ -562,6 +615,12 @@ struct routine_support
     {
 #if(defined(CUDART_VERSION))
         print_cuda_10_0_0_to_10_2_0_support_string();
+#endif
+    }
+    static void print_csrgemm2_numeric_support_warning()
+    {
+#if(defined(CUDART_VERSION))
+        print_rocsparse_only_support_string();
 #endif
     }
     // Precond
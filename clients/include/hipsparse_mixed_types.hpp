@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_MIXED_TYPES_HPP
+#define HIPSPARSE_MIXED_TYPES_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/* ============================================================================================ */
+/*! \brief  Half and bfloat16 values of the mixed precision tests, stored as their bit patterns.
+ *  The host references widen them to float, results are rounded to nearest even. */
+struct hipsparse_half
+{
+    uint16_t data;
+};
+
+struct hipsparse_bfloat16
+{
+    uint16_t data;
+};
+
+inline float hipsparse_widen(hipsparse_half x)
+{
+    uint32_t sign     = static_cast<uint32_t>(x.data & 0x8000u) << 16;
+    uint32_t exponent = (x.data >> 10) & 0x1fu;
+    uint32_t mantissa = x.data & 0x3ffu;
+
+    if(exponent == 0)
+    {
+        // Zero or subnormal, mantissa * 2^-24
+        float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+        return sign ? -value : value;
+    }
+
+    uint32_t bits
+        = sign | (exponent == 0x1fu ? 0x7f800000u : (exponent + 112) << 23) | (mantissa << 13);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float hipsparse_widen(hipsparse_bfloat16 x)
+{
+    uint32_t bits = static_cast<uint32_t>(x.data) << 16;
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// int8 values are widened by the conversion to the compute type
+template <typename T>
+inline T hipsparse_widen(T x)
+{
+    return x;
+}
+
+template <typename T, typename C>
+inline T hipsparse_narrow(C x)
+{
+    return static_cast<T>(x);
+}
+
+template <>
+inline hipsparse_half hipsparse_narrow<hipsparse_half, float>(float x)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000u;
+    uint32_t abs  = bits & 0x7fffffffu;
+
+    if(abs > 0x7f800000u)
+    {
+        return {static_cast<uint16_t>(sign | 0x7e00u)};
+    }
+
+    // 65520 and above round to infinity
+    if(abs >= 0x477ff000u)
+    {
+        return {static_cast<uint16_t>(sign | 0x7c00u)};
+    }
+
+    if(abs >= 0x38800000u)
+    {
+        uint32_t rebiased = abs - 0x38000000u;
+        return {static_cast<uint16_t>(sign
+                                      | ((rebiased + 0xfffu + ((rebiased >> 13) & 1u)) >> 13))};
+    }
+
+    // Subnormal, the scaling by 2^24 is exact and nearbyint rounds to nearest even
+    float scaled = std::nearbyint(std::fabs(x) * 16777216.0f);
+    return {static_cast<uint16_t>(sign | static_cast<uint16_t>(scaled))};
+}
+
+template <>
+inline hipsparse_bfloat16 hipsparse_narrow<hipsparse_bfloat16, float>(float x)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    if((bits & 0x7fffffffu) > 0x7f800000u)
+    {
+        return {static_cast<uint16_t>((bits >> 16) | 0x40u)};
+    }
+    return {static_cast<uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16)};
+}
+
+#endif // HIPSPARSE_MIXED_TYPES_HPP
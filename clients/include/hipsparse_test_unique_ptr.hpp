@@ -47,31 +47,114 @@
 namespace hipsparse_test
 {
 
+    // device_memory accounts for the device memory allocated by the clients, so that
+    // hipsparse-bench can report the memory footprint of a case.
+    struct device_memory
+    {
+        typedef enum kind_
+        {
+            data   = 0, // matrices, vectors and output arrays
+            buffer = 1, // external buffers, sized by the *_bufferSize routines
+            nkinds = 2
+        } kind_t;
+
+        static void record_malloc(void* ptr, size_t byte_size, kind_t kind);
+        static void record_free(void* ptr);
+
+        // Set the peaks to the memory currently allocated.
+        static void reset_peak();
+
+        // Largest number of bytes of a kind allocated at once since the last reset.
+        static size_t get_peak(kind_t kind);
+
+        // Largest number of bytes allocated at once since the last reset, all kinds together.
+        static size_t get_peak();
+    };
+
     // device_malloc wraps hipMalloc and provides same API as malloc
     static void* device_malloc(size_t byte_size)
     {
         void* pointer;
         PRINT_IF_HIP_ERROR(hipMalloc(&pointer, byte_size));
+        device_memory::record_malloc(pointer, byte_size, device_memory::data);
+        return pointer;
+    }
+
+    // device_malloc_buffer is device_malloc for external buffers
+    static void* device_malloc_buffer(size_t byte_size)
+    {
+        void* pointer;
+        PRINT_IF_HIP_ERROR(hipMalloc(&pointer, byte_size));
+        device_memory::record_malloc(pointer, byte_size, device_memory::buffer);
         return pointer;
     }
 
+    // device_malloc_buffer wraps hipMalloc for external buffers
+    static hipError_t device_malloc_buffer(void** ptr, size_t byte_size)
+    {
+        hipError_t status = hipMalloc(ptr, byte_size);
+        if(status == hipSuccess)
+        {
+            device_memory::record_malloc(*ptr, byte_size, device_memory::buffer);
+        }
+        return status;
+    }
+
     // device_free wraps hipFree and provides same API as free
     static void device_free(void* ptr)
     {
+        device_memory::record_free(ptr);
         PRINT_IF_HIP_ERROR(hipFree(ptr));
     }
 
+    // device_free_buffer wraps hipFree for external buffers
+    static hipError_t device_free_buffer(void* ptr)
+    {
+        device_memory::record_free(ptr);
+        return hipFree(ptr);
+    }
+
     struct handle_struct
     {
         hipsparseHandle_t handle;
+        bool              borrowed;
+
+        // Handle borrowed by every handle_struct while it is set, e.g. by hipsparse-bench
+        // to run all the cases of a suite with a single handle.
+        static hipsparseHandle_t& shared()
+        {
+            static hipsparseHandle_t s_handle = nullptr;
+            return s_handle;
+        }
+
         handle_struct()
+            : borrowed(shared() != nullptr)
         {
+            if(borrowed)
+            {
+                handle = shared();
+                return;
+            }
             hipsparseStatus_t status = hipsparseCreate(&handle);
             verify_hipsparse_status_success(status, "ERROR: handle_struct constructor");
         }
 
         ~handle_struct()
         {
+            if(borrowed)
+            {
+                // Restore the defaults for the next borrower.
+                hipsparseStatus_t status
+                    = hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST);
+                verify_hipsparse_status_success(status, "ERROR: handle_struct destructor");
+                status = hipsparseSetStream(handle, 0);
+                verify_hipsparse_status_success(status, "ERROR: handle_struct destructor");
+                status = hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING);
+                verify_hipsparse_status_success(status, "ERROR: handle_struct destructor");
+                status = hipsparseSetWorkspace(handle, nullptr, 0);
+                verify_hipsparse_status_success(status, "ERROR: handle_struct destructor");
+                return;
+            }
             hipsparseStatus_t status = hipsparseDestroy(handle);
             verify_hipsparse_status_success(status, "ERROR: handle_struct destructor");
         }
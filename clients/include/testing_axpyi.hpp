@@ -166,16 +166,16 @@ hipsparseStatus_t testing_axpyi(Arguments argus)
                 hipsparseXaxpyi(handle, nnz, &h_alpha, dxVal, dxInd, dy_1, idx_base));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(
                 hipsparseXaxpyi(handle, nnz, &h_alpha, dxVal, dxInd, dy_1, idx_base));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = axpyi_gflop_count(nnz);
         double gbyte_count = axpby_gbyte_count<T>(nnz);
@@ -444,11 +444,8 @@ hipsparseStatus_t testing_bsr2csr(Arguments argus)
                                                     dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXbsr2csr(handle,
                                                     dir,
                                                     mb,
@@ -462,9 +459,12 @@ hipsparseStatus_t testing_bsr2csr(Arguments argus)
                                                     dcsr_val,
                                                     dcsr_row_ptr,
                                                     dcsr_col_ind));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = bsr2csr_gbyte_count<T>(mb, block_dim, nnzb);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
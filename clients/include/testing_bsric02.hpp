@@ -486,7 +486,7 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
     void* dbuffer = (void*)dbuffer_managed.get();
 
     int h_analysis_pivot_gold;
@@ -686,7 +686,8 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
         }
 
         // Solve run
-        double gpu_time_used = 0;
+        hipsparse_cache_flush flush(argus);
+        double                gpu_time_used = 0;
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
             CHECK_HIP_ERROR(hipMemcpy(dbsr_val_1,
@@ -694,6 +695,7 @@ hipsparseStatus_t testing_bsric02(Arguments argus)
                                       sizeof(T) * nnzb * block_dim * block_dim,
                                       hipMemcpyHostToDevice));
 
+            flush(0);
             double temp = get_time_us();
             CHECK_HIPSPARSE_ERROR(hipsparseXbsric02(handle,
                                                     dir,
@@ -497,7 +497,7 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -707,7 +707,8 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
                                                      dbuffer));
         }
 
-        double gpu_time_used = 0;
+        hipsparse_cache_flush flush(argus);
+        double                gpu_time_used = 0;
 
         // Solve run
         for(int iter = 0; iter < number_hot_calls; ++iter)
@@ -717,6 +718,7 @@ hipsparseStatus_t testing_bsrilu02(Arguments argus)
                                       sizeof(T) * nnzb * block_dim * block_dim,
                                       hipMemcpyHostToDevice));
 
+            flush(0);
             double temp = get_time_us();
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrilu02(handle,
                                                      dir,
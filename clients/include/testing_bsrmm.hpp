@@ -677,11 +677,8 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
                                                   ldc));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrmm(handle,
                                                   dirA,
                                                   transA,
@@ -701,9 +698,12 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
                                                   &h_beta,
                                                   dC_1,
                                                   ldc));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count
             = bsrmm_gflop_count(n, nnzb, block_dim, m * n, h_beta != make_DataType<T>(0.0));
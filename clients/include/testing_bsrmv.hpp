@@ -521,11 +521,8 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
                                                   dy_1));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrmv(handle,
                                                   dir,
                                                   transA,
@@ -541,9 +538,12 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
                                                   dx,
                                                   &h_beta,
                                                   dy_1));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count
             = spmv_gflop_count(m, nnzb * block_dim * block_dim, h_beta != make_DataType<T>(0.0));
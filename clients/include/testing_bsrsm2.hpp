@@ -667,7 +667,7 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -846,11 +846,8 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXbsrsm2_solve(handle,
                                                          dir,
                                                          transA,
@@ -871,9 +868,12 @@ hipsparseStatus_t testing_bsrsm2(Arguments argus)
                                                          ldx,
                                                          HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
                                                          dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = csrsv_gflop_count(m,
                                                size_t(nnzb) * block_dim * block_dim,
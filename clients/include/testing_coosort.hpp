@@ -232,7 +232,7 @@ hipsparseStatus_t testing_coosort(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -307,11 +307,8 @@ hipsparseStatus_t testing_coosort(Arguments argus)
             }
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             if(by_row)
             {
                 CHECK_HIPSPARSE_ERROR(hipsparseXcoosortByRow(
@@ -322,9 +319,12 @@ hipsparseStatus_t testing_coosort(Arguments argus)
                 CHECK_HIPSPARSE_ERROR(hipsparseXcoosortByColumn(
                     handle, m, n, nnz, dcoo_row_ind, dcoo_col_ind, dperm, dbuffer));
             }
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = coosort_gbyte_count(nnz, permute);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -568,11 +568,8 @@ hipsparseStatus_t testing_csr2bsr(Arguments argus)
                                                     dbsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2bsr(handle,
                                                     dir,
                                                     m,
@@ -586,9 +583,12 @@ hipsparseStatus_t testing_csr2bsr(Arguments argus)
                                                     dbsr_val,
                                                     dbsr_row_ptr,
                                                     dbsr_col_ind));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = csr2bsr_gbyte_count<T>(m, mb, nnz, hbsr_nnzb, block_dim);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -321,11 +321,8 @@ hipsparseStatus_t testing_csr2csc(Arguments argus)
                                                     idx_base));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csc(handle,
                                                     m,
                                                     n,
@@ -338,9 +335,12 @@ hipsparseStatus_t testing_csr2csc(Arguments argus)
                                                     dcsc_col_ptr,
                                                     action,
                                                     idx_base));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = csr2csc_gbyte_count<T>(m, n, nnz, action);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -489,11 +489,8 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
                                                              tol));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2csr_compress(handle,
                                                              m,
                                                              n,
@@ -507,9 +504,12 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
                                                              dcsr_col_ind_C,
                                                              dcsr_row_ptr_C,
                                                              tol));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = csr2csr_compress_gbyte_count<T>(m, hnnz_A, hnnz_C);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -503,7 +503,7 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
                                                          col_block_dim,
                                                          &buffer_size));
 
-    auto  dbuffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+    auto  dbuffer_managed = hipsparse_unique_ptr{device_malloc_buffer(buffer_size), device_free};
     void* dbuffer         = dbuffer_managed.get();
 
     int hbsr_nnzb;
@@ -619,11 +619,8 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
                                                       dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsr2gebsr(handle,
                                                       dir,
                                                       m,
@@ -639,9 +636,12 @@ hipsparseStatus_t testing_csr2gebsr(Arguments argus)
                                                       row_block_dim,
                                                       col_block_dim,
                                                       dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count
             = csr2gebsr_gbyte_count<T>(m, mb, nnz, hbsr_nnzb, row_block_dim, col_block_dim);
@@ -852,7 +852,7 @@ hipsparseStatus_t testing_csrgeam2(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
     void* dbuffer = (void*)dbuffer_managed.get();
 
     // hipsparse pointer mode host
@@ -1064,11 +1064,8 @@ hipsparseStatus_t testing_csrgeam2(Arguments argus)
                                                      dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrgeam2(handle,
                                                      M,
                                                      N,
@@ -1089,9 +1086,12 @@ hipsparseStatus_t testing_csrgeam2(Arguments argus)
                                                      dCptr_1,
                                                      dCcol_1,
                                                      dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = csrgeam_gflop_count<T>(nnz_A, nnz_B, hnnz_C_1, &h_alpha, &h_beta);
         double gbyte_count = csrgeam_gbyte_count<T>(M, nnz_A, nnz_B, hnnz_C_1, &h_alpha, &h_beta);
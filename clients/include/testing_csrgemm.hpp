@@ -963,11 +963,8 @@ hipsparseStatus_t testing_csrgemm(Arguments argus)
                                                     dCcol));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm(handle,
                                                     trans_A,
                                                     trans_B,
@@ -988,9 +985,12 @@ hipsparseStatus_t testing_csrgemm(Arguments argus)
                                                     dCval,
                                                     dCptr,
                                                     dCcol));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = csrgemm_gflop_count<T, int, int>(
             M, hcsr_row_ptr_A.data(), hcsr_col_ind_A.data(), hcsr_row_ptr_B.data(), idx_base_A);
@@ -0,0 +1,1004 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRGEMM2_NUMERIC_HPP
+#define TESTING_CSRGEMM2_NUMERIC_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csrgemm2_numeric_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int M         = 1;
+    int N         = 1;
+    int K         = 1;
+    int nnz_A     = 1;
+    int nnz_B     = 1;
+    int nnz_C     = 1;
+    int safe_size = 1;
+
+    T alpha = make_DataType<T>(1.0);
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_A(new descr_struct);
+    hipsparseMatDescr_t           descr_A = unique_ptr_descr_A->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_B(new descr_struct);
+    hipsparseMatDescr_t           descr_B = unique_ptr_descr_B->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_C(new descr_struct);
+    hipsparseMatDescr_t           descr_C = unique_ptr_descr_C->descr;
+
+    std::unique_ptr<csrgemm2_struct> unique_ptr_csrgemm2(new csrgemm2_struct);
+    csrgemm2Info_t                   info = unique_ptr_csrgemm2->info;
+
+    auto dAptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dAcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dAval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dBptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dBcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dBval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dCptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_size + 1)), device_free};
+    auto dCcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dCval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*  dAptr   = (int*)dAptr_managed.get();
+    int*  dAcol   = (int*)dAcol_managed.get();
+    T*    dAval   = (T*)dAval_managed.get();
+    int*  dBptr   = (int*)dBptr_managed.get();
+    int*  dBcol   = (int*)dBcol_managed.get();
+    T*    dBval   = (T*)dBval_managed.get();
+    int*  dCptr   = (int*)dCptr_managed.get();
+    int*  dCcol   = (int*)dCcol_managed.get();
+    T*    dCval   = (T*)dCval_managed.get();
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    std::vector<int> hcsr_row_ptr_C(M + 1);
+    hcsr_row_ptr_C[0] = 0;
+    hcsr_row_ptr_C[1] = 1;
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dCptr, hcsr_row_ptr_C.data(), sizeof(int) * (M + 1), hipMemcpyHostToDevice));
+
+    // Symbolic phase
+    verify_hipsparse_status_invalid_handle(
+        hipsparseXcsrgemm2Symbolic((hipsparseHandle_t) nullptr,
+                                   M,
+                                   N,
+                                   K,
+                                   descr_A,
+                                   nnz_A,
+                                   dAptr,
+                                   dAcol,
+                                   descr_B,
+                                   nnz_B,
+                                   dBptr,
+                                   dBcol,
+                                   (hipsparseMatDescr_t) nullptr,
+                                   0,
+                                   (int*)nullptr,
+                                   (int*)nullptr,
+                                   descr_C,
+                                   nnz_C,
+                                   dCptr,
+                                   dCcol,
+                                   info,
+                                   dbuffer));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Symbolic(handle,
+                                   M,
+                                   N,
+                                   K,
+                                   descr_A,
+                                   nnz_A,
+                                   (int*)nullptr,
+                                   dAcol,
+                                   descr_B,
+                                   nnz_B,
+                                   dBptr,
+                                   dBcol,
+                                   (hipsparseMatDescr_t) nullptr,
+                                   0,
+                                   (int*)nullptr,
+                                   (int*)nullptr,
+                                   descr_C,
+                                   nnz_C,
+                                   dCptr,
+                                   dCcol,
+                                   info,
+                                   dbuffer),
+        "Error: dAptr is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Symbolic(handle,
+                                   M,
+                                   N,
+                                   K,
+                                   descr_A,
+                                   nnz_A,
+                                   dAptr,
+                                   dAcol,
+                                   descr_B,
+                                   nnz_B,
+                                   dBptr,
+                                   dBcol,
+                                   (hipsparseMatDescr_t) nullptr,
+                                   0,
+                                   (int*)nullptr,
+                                   (int*)nullptr,
+                                   descr_C,
+                                   nnz_C,
+                                   dCptr,
+                                   (int*)nullptr,
+                                   info,
+                                   dbuffer),
+        "Error: dCcol is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Symbolic(handle,
+                                   M,
+                                   N,
+                                   K,
+                                   descr_A,
+                                   nnz_A,
+                                   dAptr,
+                                   dAcol,
+                                   descr_B,
+                                   nnz_B,
+                                   dBptr,
+                                   dBcol,
+                                   (hipsparseMatDescr_t) nullptr,
+                                   0,
+                                   (int*)nullptr,
+                                   (int*)nullptr,
+                                   descr_C,
+                                   nnz_C,
+                                   dCptr,
+                                   dCcol,
+                                   (csrgemm2Info_t) nullptr,
+                                   dbuffer),
+        "Error: info is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Symbolic(handle,
+                                   M,
+                                   N,
+                                   K,
+                                   descr_A,
+                                   nnz_A,
+                                   dAptr,
+                                   dAcol,
+                                   descr_B,
+                                   nnz_B,
+                                   dBptr,
+                                   dBcol,
+                                   (hipsparseMatDescr_t) nullptr,
+                                   0,
+                                   (int*)nullptr,
+                                   (int*)nullptr,
+                                   descr_C,
+                                   nnz_C,
+                                   dCptr,
+                                   dCcol,
+                                   info,
+                                   (void*)nullptr),
+        "Error: dbuffer is nullptr");
+
+    // Numeric phase
+    verify_hipsparse_status_invalid_handle(
+        hipsparseXcsrgemm2Numeric((hipsparseHandle_t) nullptr,
+                                  M,
+                                  N,
+                                  K,
+                                  &alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  dAval,
+                                  dAptr,
+                                  dAcol,
+                                  descr_B,
+                                  nnz_B,
+                                  dBval,
+                                  dBptr,
+                                  dBcol,
+                                  (T*)nullptr,
+                                  (hipsparseMatDescr_t) nullptr,
+                                  0,
+                                  (T*)nullptr,
+                                  (int*)nullptr,
+                                  (int*)nullptr,
+                                  descr_C,
+                                  nnz_C,
+                                  dCval,
+                                  dCptr,
+                                  dCcol,
+                                  info,
+                                  dbuffer));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Numeric(handle,
+                                  M,
+                                  N,
+                                  K,
+                                  &alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  (T*)nullptr,
+                                  dAptr,
+                                  dAcol,
+                                  descr_B,
+                                  nnz_B,
+                                  dBval,
+                                  dBptr,
+                                  dBcol,
+                                  (T*)nullptr,
+                                  (hipsparseMatDescr_t) nullptr,
+                                  0,
+                                  (T*)nullptr,
+                                  (int*)nullptr,
+                                  (int*)nullptr,
+                                  descr_C,
+                                  nnz_C,
+                                  dCval,
+                                  dCptr,
+                                  dCcol,
+                                  info,
+                                  dbuffer),
+        "Error: dAval is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Numeric(handle,
+                                  M,
+                                  N,
+                                  K,
+                                  &alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  dAval,
+                                  dAptr,
+                                  dAcol,
+                                  descr_B,
+                                  nnz_B,
+                                  dBval,
+                                  dBptr,
+                                  dBcol,
+                                  (T*)nullptr,
+                                  (hipsparseMatDescr_t) nullptr,
+                                  0,
+                                  (T*)nullptr,
+                                  (int*)nullptr,
+                                  (int*)nullptr,
+                                  descr_C,
+                                  nnz_C,
+                                  (T*)nullptr,
+                                  dCptr,
+                                  dCcol,
+                                  info,
+                                  dbuffer),
+        "Error: dCval is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Numeric(handle,
+                                  M,
+                                  N,
+                                  K,
+                                  &alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  dAval,
+                                  dAptr,
+                                  dAcol,
+                                  descr_B,
+                                  nnz_B,
+                                  dBval,
+                                  dBptr,
+                                  dBcol,
+                                  (T*)nullptr,
+                                  (hipsparseMatDescr_t) nullptr,
+                                  0,
+                                  (T*)nullptr,
+                                  (int*)nullptr,
+                                  (int*)nullptr,
+                                  descr_C,
+                                  nnz_C,
+                                  dCval,
+                                  dCptr,
+                                  dCcol,
+                                  (csrgemm2Info_t) nullptr,
+                                  dbuffer),
+        "Error: info is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseXcsrgemm2Numeric(handle,
+                                  M,
+                                  N,
+                                  K,
+                                  &alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  dAval,
+                                  dAptr,
+                                  dAcol,
+                                  descr_B,
+                                  nnz_B,
+                                  dBval,
+                                  dBptr,
+                                  dBcol,
+                                  (T*)nullptr,
+                                  (hipsparseMatDescr_t) nullptr,
+                                  0,
+                                  (T*)nullptr,
+                                  (int*)nullptr,
+                                  (int*)nullptr,
+                                  descr_C,
+                                  nnz_C,
+                                  dCval,
+                                  dCptr,
+                                  dCcol,
+                                  info,
+                                  (void*)nullptr),
+        "Error: dbuffer is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_csrgemm2_numeric(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  M          = argus.M;
+    int                  K          = argus.K;
+    hipsparseIndexBase_t idx_base_A = argus.baseA;
+    hipsparseIndexBase_t idx_base_B = argus.baseB;
+    hipsparseIndexBase_t idx_base_C = argus.baseC;
+    hipsparseIndexBase_t idx_base_D = argus.baseD;
+    std::string          filename   = argus.filename;
+    T                    alpha      = make_DataType<T>(argus.alpha);
+    T                    beta       = make_DataType<T>(argus.beta);
+
+    // D is only added when beta != 0
+    T* h_alpha = &alpha;
+    T* h_beta  = (argus.beta != 0.0) ? &beta : nullptr;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_A(new descr_struct);
+    hipsparseMatDescr_t           descr_A = unique_ptr_descr_A->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_B(new descr_struct);
+    hipsparseMatDescr_t           descr_B = unique_ptr_descr_B->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_C(new descr_struct);
+    hipsparseMatDescr_t           descr_C = unique_ptr_descr_C->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_D(new descr_struct);
+    hipsparseMatDescr_t           descr_D = unique_ptr_descr_D->descr;
+
+    std::unique_ptr<csrgemm2_struct> unique_ptr_csrgemm2(new csrgemm2_struct);
+    csrgemm2Info_t                   info = unique_ptr_csrgemm2->info;
+
+    // Set matrix index base
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_A, idx_base_A));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_B, idx_base_B));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_C, idx_base_C));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr_D, idx_base_D));
+
+    srand(12345ULL);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    // Read or construct CSR matrix
+    int nnz_A = 0;
+    if(!generate_csr_matrix(
+           filename, M, K, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base_A))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // B = A^T so that we can compute the square of A
+    int N     = M;
+    int nnz_B = nnz_A;
+
+    std::vector<int> hcsr_row_ptr_B(K + 1, 0);
+    std::vector<int> hcsr_col_ind_B(nnz_B);
+    std::vector<T>   hcsr_val_B(nnz_B);
+
+    transpose_csr(M,
+                  K,
+                  nnz_A,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  idx_base_A,
+                  idx_base_B);
+
+    // D is a random m x m matrix, or empty if beta == 0
+    std::vector<int> hcsr_row_ptr_D;
+    std::vector<int> hcsr_col_ind_D;
+    std::vector<T>   hcsr_val_D;
+
+    int nnz_D = 0;
+    if(h_beta != nullptr)
+    {
+        int M_D = M;
+        int N_D = N;
+        generate_csr_matrix(
+            "", M_D, N_D, nnz_D, hcsr_row_ptr_D, hcsr_col_ind_D, hcsr_val_D, idx_base_D);
+    }
+    else
+    {
+        hcsr_row_ptr_D.assign(M + 1, idx_base_D);
+    }
+
+    // Allocate memory on device
+    int one        = 1;
+    int safe_K     = std::max(K, one);
+    int safe_nnz_A = std::max(nnz_A, one);
+    int safe_nnz_B = std::max(nnz_B, one);
+    int safe_nnz_D = std::max(nnz_D, one);
+
+    auto dAptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto dAcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_nnz_A), device_free};
+    auto dAval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_nnz_A), device_free};
+    auto dBptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (safe_K + 1)), device_free};
+    auto dBcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_nnz_B), device_free};
+    auto dBval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_nnz_B), device_free};
+    auto dDptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto dDcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_nnz_D), device_free};
+    auto dDval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_nnz_D), device_free};
+    auto dCptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto dalpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dbeta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    int* dAptr  = (int*)dAptr_managed.get();
+    int* dAcol  = (int*)dAcol_managed.get();
+    T*   dAval  = (T*)dAval_managed.get();
+    int* dBptr  = (int*)dBptr_managed.get();
+    int* dBcol  = (int*)dBcol_managed.get();
+    T*   dBval  = (T*)dBval_managed.get();
+    int* dDptr  = (h_beta != nullptr) ? (int*)dDptr_managed.get() : nullptr;
+    int* dDcol  = (h_beta != nullptr) ? (int*)dDcol_managed.get() : nullptr;
+    T*   dDval  = (h_beta != nullptr) ? (T*)dDval_managed.get() : nullptr;
+    int* dCptr  = (int*)dCptr_managed.get();
+    T*   dalpha = (T*)dalpha_managed.get();
+    T*   dbeta  = (h_beta != nullptr) ? (T*)dbeta_managed.get() : nullptr;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAptr, hcsr_row_ptr_A.data(), sizeof(int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAcol, hcsr_col_ind_A.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAval, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBptr, hcsr_row_ptr_B.data(), sizeof(int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBcol, hcsr_col_ind_B.data(), sizeof(int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBval, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(h_beta != nullptr)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(
+            dDptr, hcsr_row_ptr_D.data(), sizeof(int) * (M + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dDcol, hcsr_col_ind_D.data(), sizeof(int) * nnz_D, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dDval, hcsr_val_D.data(), sizeof(T) * nnz_D, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dbeta, h_beta, sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    // Symbolic phase, done once for the sparsity patterns of A, B and D
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2_bufferSizeExt(handle,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           h_alpha,
+                                                           descr_A,
+                                                           nnz_A,
+                                                           dAptr,
+                                                           dAcol,
+                                                           descr_B,
+                                                           nnz_B,
+                                                           dBptr,
+                                                           dBcol,
+                                                           h_beta,
+                                                           descr_D,
+                                                           nnz_D,
+                                                           dDptr,
+                                                           dDcol,
+                                                           info,
+                                                           &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    int hnnz_C;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Nnz(handle,
+                                                M,
+                                                N,
+                                                K,
+                                                descr_A,
+                                                nnz_A,
+                                                dAptr,
+                                                dAcol,
+                                                descr_B,
+                                                nnz_B,
+                                                dBptr,
+                                                dBcol,
+                                                descr_D,
+                                                nnz_D,
+                                                dDptr,
+                                                dDcol,
+                                                descr_C,
+                                                dCptr,
+                                                &hnnz_C,
+                                                info,
+                                                dbuffer));
+
+    int safe_nnz_C = std::max(hnnz_C, one);
+
+    auto dCcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_nnz_C), device_free};
+    auto dCval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_nnz_C), device_free};
+
+    int* dCcol = (int*)dCcol_managed.get();
+    T*   dCval = (T*)dCval_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Symbolic(handle,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     descr_A,
+                                                     nnz_A,
+                                                     dAptr,
+                                                     dAcol,
+                                                     descr_B,
+                                                     nnz_B,
+                                                     dBptr,
+                                                     dBcol,
+                                                     descr_D,
+                                                     nnz_D,
+                                                     dDptr,
+                                                     dDcol,
+                                                     descr_C,
+                                                     hnnz_C,
+                                                     dCptr,
+                                                     dCcol,
+                                                     info,
+                                                     dbuffer));
+
+    if(argus.unit_check)
+    {
+        // Compute the reference product with the full host csrgemm2
+        std::vector<int> hcsr_row_ptr_C_gold(M + 1);
+
+        int nnz_C_gold = host_csrgemm2_nnz(M,
+                                           N,
+                                           K,
+                                           h_alpha,
+                                           hcsr_row_ptr_A.data(),
+                                           hcsr_col_ind_A.data(),
+                                           hcsr_row_ptr_B.data(),
+                                           hcsr_col_ind_B.data(),
+                                           h_beta,
+                                           hcsr_row_ptr_D.data(),
+                                           hcsr_col_ind_D.data(),
+                                           hcsr_row_ptr_C_gold.data(),
+                                           idx_base_A,
+                                           idx_base_B,
+                                           idx_base_C,
+                                           idx_base_D);
+
+        unit_check_general(1, 1, 1, &nnz_C_gold, &hnnz_C);
+
+        // If nnz_C == 0, we are done
+        if(nnz_C_gold == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        std::vector<int> hcsr_col_ind_C_gold(nnz_C_gold);
+        std::vector<T>   hcsr_val_C_gold(nnz_C_gold);
+
+        host_csrgemm2(M,
+                      N,
+                      K,
+                      h_alpha,
+                      hcsr_row_ptr_A.data(),
+                      hcsr_col_ind_A.data(),
+                      hcsr_val_A.data(),
+                      hcsr_row_ptr_B.data(),
+                      hcsr_col_ind_B.data(),
+                      hcsr_val_B.data(),
+                      h_beta,
+                      hcsr_row_ptr_D.data(),
+                      hcsr_col_ind_D.data(),
+                      hcsr_val_D.data(),
+                      hcsr_row_ptr_C_gold.data(),
+                      hcsr_col_ind_C_gold.data(),
+                      hcsr_val_C_gold.data(),
+                      idx_base_A,
+                      idx_base_B,
+                      idx_base_C,
+                      idx_base_D);
+
+        // Numeric phase with the first values
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Numeric(handle,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        h_alpha,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        dAval,
+                                                        dAptr,
+                                                        dAcol,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        dBval,
+                                                        dBptr,
+                                                        dBcol,
+                                                        h_beta,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        dDval,
+                                                        dDptr,
+                                                        dDcol,
+                                                        descr_C,
+                                                        hnnz_C,
+                                                        dCval,
+                                                        dCptr,
+                                                        dCcol,
+                                                        info,
+                                                        dbuffer));
+
+        std::vector<int> hcsr_row_ptr_C(M + 1);
+        std::vector<int> hcsr_col_ind_C(nnz_C_gold);
+        std::vector<T>   hcsr_val_C_1(nnz_C_gold);
+        std::vector<T>   hcsr_val_C_2(nnz_C_gold);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_row_ptr_C.data(), dCptr, sizeof(int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind_C.data(), dCcol, sizeof(int) * nnz_C_gold, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_1.data(), dCval, sizeof(T) * nnz_C_gold, hipMemcpyDeviceToHost));
+
+        // Check structure and entries of C
+        unit_check_general(1, M + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+        unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+        unit_check_near(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_1.data());
+
+        // New values of A, B and D, with the same sparsity patterns
+        for(int i = 0; i < nnz_A; ++i)
+        {
+            hcsr_val_A[i] = random_generator<T>();
+        }
+        for(int i = 0; i < nnz_D; ++i)
+        {
+            hcsr_val_D[i] = random_generator<T>();
+        }
+
+        transpose_csr(M,
+                      K,
+                      nnz_A,
+                      hcsr_row_ptr_A.data(),
+                      hcsr_col_ind_A.data(),
+                      hcsr_val_A.data(),
+                      hcsr_row_ptr_B.data(),
+                      hcsr_col_ind_B.data(),
+                      hcsr_val_B.data(),
+                      idx_base_A,
+                      idx_base_B);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dAval, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dBval, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+        if(h_beta != nullptr)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dDval, hcsr_val_D.data(), sizeof(T) * nnz_D, hipMemcpyHostToDevice));
+        }
+        CHECK_HIP_ERROR(hipMemset(dCval, 0, sizeof(T) * nnz_C_gold));
+
+        // Numeric phase with the new values, reusing the symbolic phase
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Numeric(handle,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        dalpha,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        dAval,
+                                                        dAptr,
+                                                        dAcol,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        dBval,
+                                                        dBptr,
+                                                        dBcol,
+                                                        dbeta,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        dDval,
+                                                        dDptr,
+                                                        dDcol,
+                                                        descr_C,
+                                                        hnnz_C,
+                                                        dCval,
+                                                        dCptr,
+                                                        dCcol,
+                                                        info,
+                                                        dbuffer));
+
+        host_csrgemm2_numeric(M,
+                              N,
+                              K,
+                              h_alpha,
+                              hcsr_row_ptr_A.data(),
+                              hcsr_col_ind_A.data(),
+                              hcsr_val_A.data(),
+                              hcsr_row_ptr_B.data(),
+                              hcsr_col_ind_B.data(),
+                              hcsr_val_B.data(),
+                              h_beta,
+                              hcsr_row_ptr_D.data(),
+                              hcsr_col_ind_D.data(),
+                              hcsr_val_D.data(),
+                              hcsr_row_ptr_C_gold.data(),
+                              hcsr_col_ind_C_gold.data(),
+                              hcsr_val_C_gold.data(),
+                              idx_base_A,
+                              idx_base_B,
+                              idx_base_C,
+                              idx_base_D);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_2.data(), dCval, sizeof(T) * nnz_C_gold, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Without the split, each product queries and allocates the buffer, computes the
+        // sparsity pattern of C and allocates C again
+        auto full_call = [&]() {
+            std::unique_ptr<csrgemm2_struct> unique_ptr_full(new csrgemm2_struct);
+            csrgemm2Info_t                   full_info = unique_ptr_full->info;
+
+            size_t full_size;
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2_bufferSizeExt(handle,
+                                                                   M,
+                                                                   N,
+                                                                   K,
+                                                                   h_alpha,
+                                                                   descr_A,
+                                                                   nnz_A,
+                                                                   dAptr,
+                                                                   dAcol,
+                                                                   descr_B,
+                                                                   nnz_B,
+                                                                   dBptr,
+                                                                   dBcol,
+                                                                   h_beta,
+                                                                   descr_D,
+                                                                   nnz_D,
+                                                                   dDptr,
+                                                                   dDcol,
+                                                                   full_info,
+                                                                   &full_size));
+
+            auto full_buffer_managed
+                = hipsparse_unique_ptr{device_malloc_buffer(full_size), device_free};
+            void* full_buffer = (void*)full_buffer_managed.get();
+
+            int full_nnz_C;
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Nnz(handle,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        dAptr,
+                                                        dAcol,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        dBptr,
+                                                        dBcol,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        dDptr,
+                                                        dDcol,
+                                                        descr_C,
+                                                        dCptr,
+                                                        &full_nnz_C,
+                                                        full_info,
+                                                        full_buffer));
+
+            int  safe_full_nnz_C = std::max(full_nnz_C, one);
+            auto full_col_managed
+                = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_full_nnz_C), device_free};
+            auto full_val_managed
+                = hipsparse_unique_ptr{device_malloc(sizeof(T) * safe_full_nnz_C), device_free};
+
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2(handle,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     h_alpha,
+                                                     descr_A,
+                                                     nnz_A,
+                                                     dAval,
+                                                     dAptr,
+                                                     dAcol,
+                                                     descr_B,
+                                                     nnz_B,
+                                                     dBval,
+                                                     dBptr,
+                                                     dBcol,
+                                                     h_beta,
+                                                     descr_D,
+                                                     nnz_D,
+                                                     dDval,
+                                                     dDptr,
+                                                     dDcol,
+                                                     descr_C,
+                                                     (T*)full_val_managed.get(),
+                                                     dCptr,
+                                                     (int*)full_col_managed.get(),
+                                                     full_info,
+                                                     full_buffer));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // With the split, only the values of C are computed
+        auto numeric_call = [&]() {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrgemm2Numeric(handle,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            h_alpha,
+                                                            descr_A,
+                                                            nnz_A,
+                                                            dAval,
+                                                            dAptr,
+                                                            dAcol,
+                                                            descr_B,
+                                                            nnz_B,
+                                                            dBval,
+                                                            dBptr,
+                                                            dBcol,
+                                                            h_beta,
+                                                            descr_D,
+                                                            nnz_D,
+                                                            dDval,
+                                                            dDptr,
+                                                            dDcol,
+                                                            descr_C,
+                                                            hnnz_C,
+                                                            dCval,
+                                                            dCptr,
+                                                            dCcol,
+                                                            info,
+                                                            dbuffer));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(full_call());
+            CHECK_HIPSPARSE_ERROR(numeric_call());
+        }
+
+        // Performance run
+        double replan_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, replan_time_used, full_call));
+
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, numeric_call));
+
+        double gflop_count = csrgemm_gflop_count<T, int, int>(
+            M, hcsr_row_ptr_A.data(), hcsr_col_ind_A.data(), hcsr_row_ptr_B.data(), idx_base_A);
+        double gbyte_count = csrgemm_gbyte_count<T, int, int>(M, N, K, nnz_A, nnz_B, hnnz_C);
+
+        // Count beta * D
+        if(h_beta != nullptr)
+        {
+            gflop_count += 2.0 * nnz_D / 1e9;
+            gbyte_count += ((M + 1.0) * sizeof(int) + nnz_D * (sizeof(int) + sizeof(T))) / 1e9;
+        }
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::K,
+                            K,
+                            display_key_t::nnzA,
+                            nnz_A,
+                            display_key_t::nnzB,
+                            nnz_B,
+                            display_key_t::nnzC,
+                            hnnz_C,
+                            display_key_t::alpha,
+                            alpha,
+                            display_key_t::beta,
+                            beta,
+                            display_key_t::replan_time_ms,
+                            get_gpu_time_msec(replan_time_used),
+                            display_key_t::speedup,
+                            replan_time_used / gpu_time_used,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRGEMM2_NUMERIC_HPP
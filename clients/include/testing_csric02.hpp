@@ -231,7 +231,7 @@ hipsparseStatus_t testing_csric02(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
     void* dbuffer = (void*)dbuffer_managed.get();
 
     int h_analysis_pivot_gold;
@@ -352,7 +352,8 @@ hipsparseStatus_t testing_csric02(Arguments argus)
                 handle, m, nnz, descr, dval_1, dptr, dcol, info, policy, dbuffer));
         }
 
-        double gpu_time_used = 0;
+        hipsparse_cache_flush flush(argus);
+        double                gpu_time_used = 0;
 
         // Solve run
         for(int iter = 0; iter < number_hot_calls; ++iter)
@@ -360,6 +361,7 @@ hipsparseStatus_t testing_csric02(Arguments argus)
             CHECK_HIP_ERROR(
                 hipMemcpy(dval_1, hcsr_val_orig.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
 
+            flush(0);
             double temp = get_time_us();
             CHECK_HIPSPARSE_ERROR(hipsparseXcsric02(
                 handle, m, nnz, descr, dval_1, dptr, dcol, info, policy, dbuffer));
@@ -99,7 +99,8 @@ hipsparseStatus_t testing_csrilusv(Arguments argus)
         hipsparseXcsrilu02_bufferSize(handle, m, nnz, descr_M, dval, dptr, dcol, info_M, &size));
 
     // Allocate buffer on the device
-    auto dbuffer_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * size), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -227,7 +228,8 @@ hipsparseStatus_t testing_csrilusv(Arguments argus)
     size = std::max(size_lower, size_upper);
 
     // Allocate buffer on the device
-    auto dbuffer_sv_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+    auto dbuffer_sv_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * size), device_free};
 
     void* dbuffer_sv = (void*)dbuffer_sv_managed.get();
 
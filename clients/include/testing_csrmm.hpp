@@ -496,11 +496,8 @@ hipsparseStatus_t testing_csrmm(Arguments argus)
                                                    ldc));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrmm2(handle,
                                                    transA,
                                                    transB,
@@ -518,9 +515,12 @@ hipsparseStatus_t testing_csrmm(Arguments argus)
                                                    &h_beta,
                                                    dC_1,
                                                    ldc));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count
             = csrmm_gflop_count<int, int>(B_m, nnz, C_m * C_n, h_beta != make_DataType<T>(0.0));
@@ -270,11 +270,8 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
                                                   dy_1));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrmv(handle,
                                                   transA,
                                                   nrow,
@@ -288,9 +285,12 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
                                                   dx,
                                                   &h_beta,
                                                   dy_1));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = spmv_gflop_count(nrow, nnz, h_beta != make_DataType<T>(0.0));
         double gbyte_count = csrmv_gbyte_count<T>(nrow, ncol, nnz, h_beta != make_DataType<T>(0.0));
@@ -693,7 +693,7 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -888,11 +888,8 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrsm2_solve(handle,
                                                          0,
                                                          transA,
@@ -910,9 +907,12 @@ hipsparseStatus_t testing_csrsm2(Arguments argus)
                                                          info,
                                                          policy,
                                                          dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = csrsv_gflop_count(m, nnz, diag) * nrhs;
         double gbyte_count = csrsv_gbyte_count<T>(m, nnz) * nrhs;
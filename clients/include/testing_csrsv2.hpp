@@ -415,7 +415,7 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * bufferSize), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -556,11 +556,8 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
                                                          dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_solve(handle,
                                                          trans,
                                                          m,
@@ -575,9 +572,12 @@ hipsparseStatus_t testing_csrsv2(Arguments argus)
                                                          dy_1,
                                                          policy,
                                                          dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = csrsv_gflop_count(m, nnz, diag_type);
         double gbyte_count = csrsv_gbyte_count<T>(m, nnz);
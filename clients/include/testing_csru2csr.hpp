@@ -334,7 +334,7 @@ hipsparseStatus_t testing_csru2csr(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * buffer_size), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
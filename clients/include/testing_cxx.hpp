@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CXX_HPP
+#define TESTING_CXX_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse-cxx.hpp>
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+#include <type_traits>
+
+using namespace hipsparse_test;
+
+namespace hc = hipsparse::cxx;
+
+static_assert(hc::dataType<float>::value == HIP_R_32F, "float is HIP_R_32F");
+static_assert(hc::dataType<const double>::value == HIP_R_64F, "const double is HIP_R_64F");
+static_assert(hc::dataType<hipComplex>::value == HIP_C_32F, "hipComplex is HIP_C_32F");
+static_assert(hc::dataType<int8_t>::value == HIP_R_8I, "int8_t is HIP_R_8I");
+static_assert(hc::indexType<int32_t>::value == HIPSPARSE_INDEX_32I, "int32_t is 32I");
+static_assert(hc::indexType<const int64_t>::value == HIPSPARSE_INDEX_64I, "int64_t is 64I");
+static_assert(!std::is_copy_constructible<hc::handle>::value, "handle is move only");
+static_assert(std::is_nothrow_move_constructible<hc::buffer>::value, "buffer is movable");
+
+void testing_cxx_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    hc::handle handle;
+
+    // Errors of the C API are thrown with their status
+    try
+    {
+        hc::dnVec<float> x(100, nullptr);
+        verify_hipsparse_status_invalid_pointer(HIPSPARSE_STATUS_SUCCESS,
+                                                "Error: values is nullptr");
+    }
+    catch(const hc::error& e)
+    {
+        verify_hipsparse_status_invalid_pointer(e.status(), "Error: values is nullptr");
+    }
+
+    // A moved from handle is null and is not destroyed twice
+    hc::handle other(std::move(handle));
+    if(handle.get() != nullptr || other.get() == nullptr)
+    {
+        verify_hipsparse_status_invalid_handle(HIPSPARSE_STATUS_SUCCESS);
+    }
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_cxx_spmv(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+
+    hc::handle handle;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I              nnz;
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+    if(!generate_csr_matrix(std::string(""), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J xsize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    J ysize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(xsize);
+    std::vector<T> hy(ysize);
+    hipsparseInit<T>(hx, 1, xsize);
+    hipsparseInit<T>(hy, 1, ysize);
+
+    std::vector<T> hy_gold = hy;
+
+    // Device arrays and descriptors, the types are deduced from the pointers
+    hc::deviceArray<I> dptr(hcsr_row_ptr);
+    hc::deviceArray<J> dcol(hcol_ind);
+    hc::deviceArray<T> dval(hval);
+    hc::deviceArray<T> dx(hx);
+    hc::deviceArray<T> dy(hy);
+
+    auto A = hc::makeCsr(m, n, nnz, dptr.data(), dcol.data(), dval.data(), idx_base);
+    auto x = hc::makeDnVec(xsize, dx.data());
+    auto y = hc::makeDnVec(ysize, dy.data());
+
+    // The workspace is sized by the first call and reused by the second one
+    hc::buffer workspace;
+    handle.setPointerMode(HIPSPARSE_POINTER_MODE_HOST);
+    hc::spmv(handle, transA, &h_alpha, A, x, &h_beta, y, workspace);
+    hc::spmv(handle, transA, &h_alpha, A, x, &h_beta, y, workspace);
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hy_1 = dy.toHost();
+
+        for(int i = 0; i < 2; ++i)
+        {
+            host_csrmv(transA,
+                       m,
+                       n,
+                       nnz,
+                       h_alpha,
+                       hcsr_row_ptr.data(),
+                       hcol_ind.data(),
+                       hval.data(),
+                       hx.data(),
+                       h_beta,
+                       hy_gold.data(),
+                       idx_base);
+        }
+
+        unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_cxx_spmm(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m        = argus.M;
+    J                    k        = argus.K;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseOrder_t     order    = HIPSPARSE_ORDER_COL;
+
+    hc::handle handle;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I              nnz;
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+    if(!generate_csr_matrix(std::string(""), m, k, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::vector<T> hB(k * n);
+    std::vector<T> hC(m * n);
+    hipsparseInit<T>(hB, k, n);
+    hipsparseInit<T>(hC, m, n);
+
+    std::vector<T> hC_gold = hC;
+
+    hc::deviceArray<I> dptr(hcsr_row_ptr);
+    hc::deviceArray<J> dcol(hcol_ind);
+    hc::deviceArray<T> dval(hval);
+    hc::deviceArray<T> dB(hB);
+    hc::deviceArray<T> dC(hC);
+
+    hc::csrMatrix<T, I, J> A(m, k, nnz, dptr.data(), dcol.data(), dval.data(), idx_base);
+    hc::dnMat<T>           B(k, n, k, dB.data(), order);
+    hc::dnMat<T>           C(m, n, m, dC.data(), order);
+
+    hc::buffer workspace;
+    hc::spmm(handle, transA, transB, &h_alpha, A, B, &h_beta, C, workspace);
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hC_1 = dC.toHost();
+
+        host_csrmm(m,
+                   n,
+                   k,
+                   transA,
+                   transB,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval.data(),
+                   hB.data(),
+                   k,
+                   order,
+                   h_beta,
+                   hC_gold.data(),
+                   m,
+                   order,
+                   idx_base,
+                   false);
+
+        unit_check_near(1, m * n, 1, hC_gold.data(), hC_1.data());
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CXX_HPP
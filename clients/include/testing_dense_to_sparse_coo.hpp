@@ -205,7 +205,7 @@ hipsparseStatus_t testing_dense_to_sparse_coo(Arguments argus)
     CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_bufferSize(handle, matA, matB, alg, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_analysis(handle, matA, matB, alg, buffer));
 
@@ -294,14 +294,15 @@ hipsparseStatus_t testing_dense_to_sparse_coo(Arguments argus)
             CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_convert(handle, matA, matB, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseDenseToSparse_convert(handle, matA, matB, alg, buffer));
-        }
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = dense2coo_gbyte_count<T>(m, n, (I)nnz);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -322,7 +323,7 @@ hipsparseStatus_t testing_dense_to_sparse_coo(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matA));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matB));
 #endif
@@ -0,0 +1,761 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef TESTING_DIST_CSRMV_HPP
+#define TESTING_DIST_CSRMV_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <hipsparse.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_dist_csrmv_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    int64_t              m        = 100;
+    int64_t              nnz      = 100;
+    float                alpha    = 0.6;
+    float                beta     = 0.2;
+    hipsparseIndexBase_t idxBase  = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType  = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType = HIP_R_32F;
+    hipsparseSpMVAlg_t   alg      = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    // A single rank owns all the rows
+    int64_t partition[] = {0, m};
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Diagonal matrix
+    std::vector<int>   hptr(m + 1);
+    std::vector<int>   hcol(nnz);
+    std::vector<float> hval(nnz, 1.0f);
+    for(int i = 0; i < m; ++i)
+    {
+        hptr[i] = i;
+        hcol[i] = i;
+    }
+    hptr[m] = m;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dptr, hptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+
+    // Local transport
+    hipsparseLocalTransport_t local;
+    hipsparseTransport_t      transport;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateLocalTransport(nullptr, 1),
+                                            "Error: transport is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCreateLocalTransport(&local, 0),
+                                         "Error: size is invalid");
+    verify_hipsparse_status_success(hipsparseCreateLocalTransport(&local, 1), "success");
+
+    verify_hipsparse_status_invalid_pointer(hipsparseLocalTransportGet(nullptr, 0, &transport),
+                                            "Error: transport is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseLocalTransportGet(local, 0, nullptr),
+                                            "Error: rankTransport is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseLocalTransportGet(local, 1, &transport),
+                                         "Error: rank is invalid");
+    verify_hipsparse_status_success(hipsparseLocalTransportGet(local, 0, &transport), "success");
+
+    // Distributed matrix creation
+    hipsparseDistCsrDescr_t A;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(nullptr,
+                                                                   handle,
+                                                                   &transport,
+                                                                   partition,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_handle(hipsparseCreateDistCsr(&A,
+                                                                  nullptr,
+                                                                  &transport,
+                                                                  partition,
+                                                                  nnz,
+                                                                  dptr,
+                                                                  dcol,
+                                                                  dval,
+                                                                  idxType,
+                                                                  idxType,
+                                                                  idxBase,
+                                                                  dataType));
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   nullptr,
+                                                                   partition,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: transport is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   &transport,
+                                                                   nullptr,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: partition is nullptr");
+    verify_hipsparse_status_invalid_size(hipsparseCreateDistCsr(&A,
+                                                                handle,
+                                                                &transport,
+                                                                partition,
+                                                                -1,
+                                                                dptr,
+                                                                dcol,
+                                                                dval,
+                                                                idxType,
+                                                                idxType,
+                                                                idxBase,
+                                                                dataType),
+                                         "Error: nnz is invalid");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   &transport,
+                                                                   partition,
+                                                                   nnz,
+                                                                   nullptr,
+                                                                   dcol,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: csrRowOffsets is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   &transport,
+                                                                   partition,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   nullptr,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: csrColInd is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   &transport,
+                                                                   partition,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   nullptr,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: csrValues is nullptr");
+
+    // A transport without callbacks
+    hipsparseTransport_t incomplete = transport;
+    incomplete.wait                 = nullptr;
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateDistCsr(&A,
+                                                                   handle,
+                                                                   &incomplete,
+                                                                   partition,
+                                                                   nnz,
+                                                                   dptr,
+                                                                   dcol,
+                                                                   dval,
+                                                                   idxType,
+                                                                   idxType,
+                                                                   idxBase,
+                                                                   dataType),
+                                            "Error: transport wait is nullptr");
+
+    verify_hipsparse_status_success(hipsparseCreateDistCsr(&A,
+                                                           handle,
+                                                           &transport,
+                                                           partition,
+                                                           nnz,
+                                                           dptr,
+                                                           dcol,
+                                                           dval,
+                                                           idxType,
+                                                           idxType,
+                                                           idxBase,
+                                                           dataType),
+                                    "success");
+
+    // Sizes of the blocks
+    int64_t rows, ghosts, localNnz, ghostNnz;
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistCsrGet(nullptr, &rows, &ghosts, &localNnz, &ghostNnz),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistCsrGet(A, nullptr, &ghosts, &localNnz, &ghostNnz), "Error: rows is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistCsrGet(A, &rows, nullptr, &localNnz, &ghostNnz), "Error: ghosts is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistCsrGet(A, &rows, &ghosts, nullptr, &ghostNnz), "Error: localNnz is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistCsrGet(A, &rows, &ghosts, &localNnz, nullptr), "Error: ghostNnz is nullptr");
+
+    // Distributed SpMV
+    hipsparseDnVecDescr_t x, y, z;
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, m, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&z, m - 1, dy, dataType), "success");
+
+    verify_hipsparse_status_invalid_handle(
+        hipsparseDistSpMV(nullptr, A, &alpha, x, &beta, y, dataType, alg));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistSpMV(handle, nullptr, &alpha, x, &beta, y, dataType, alg),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistSpMV(handle, A, nullptr, x, &beta, y, dataType, alg),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistSpMV(handle, A, &alpha, nullptr, &beta, y, dataType, alg),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistSpMV(handle, A, &alpha, x, nullptr, y, dataType, alg),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseDistSpMV(handle, A, &alpha, x, &beta, nullptr, dataType, alg),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseDistSpMV(handle, A, &alpha, x, &beta, z, dataType, alg),
+        "Error: y size is invalid");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroyDistCsr(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyLocalTransport(local), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(z), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_dist_csrmv(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m        = argus.M;
+    J                    n        = argus.M;
+    int                  ranks    = argus.ranks;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // Global matrix on the host
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // The rows and the columns are distributed with the same blocks
+    if(m != n)
+    {
+        fprintf(stderr, "The distributed matrix must be square\n");
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+    std::vector<T> hy_gold(m);
+    std::vector<T> hy_1(m);
+    std::vector<T> hy_2(m);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy, 1, m);
+
+    hy_gold = hy;
+    host_csrmv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               m,
+               n,
+               nnz,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcol_ind.data(),
+               hval.data(),
+               hx.data(),
+               h_beta,
+               hy_gold.data(),
+               idx_base);
+
+    // Blocks of increasing sizes, the first ranks own no row when m is small
+    std::vector<int64_t> partition(ranks + 1);
+    for(int r = 0; r <= ranks; ++r)
+    {
+        partition[r] = int64_t(m) * r * r / (int64_t(ranks) * ranks);
+    }
+
+    // Expected sizes of the blocks of each rank: rows, ghost columns, local and ghost nnz
+    std::vector<int64_t> hsizes_gold(4 * ranks);
+    std::vector<int64_t> hsizes(4 * ranks);
+    for(int r = 0; r < ranks; ++r)
+    {
+        std::vector<J> ghosts;
+        int64_t        local_nnz = 0;
+        for(int64_t k = hcsr_row_ptr[partition[r]] - idx_base;
+            k < hcsr_row_ptr[partition[r + 1]] - idx_base;
+            ++k)
+        {
+            const J col = hcol_ind[k] - idx_base;
+            if(col >= partition[r] && col < partition[r + 1])
+            {
+                ++local_nnz;
+            }
+            else
+            {
+                ghosts.push_back(col);
+            }
+        }
+        const int64_t ghost_nnz = ghosts.size();
+        std::sort(ghosts.begin(), ghosts.end());
+        ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+        hsizes_gold[4 * r + 0] = partition[r + 1] - partition[r];
+        hsizes_gold[4 * r + 1] = ghosts.size();
+        hsizes_gold[4 * r + 2] = local_nnz;
+        hsizes_gold[4 * r + 3] = ghost_nnz;
+    }
+
+    hipsparseLocalTransport_t local;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateLocalTransport(&local, ranks));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    // Each rank is run by a thread with its own handle, on its rows with global column indices
+    auto run_rank = [&](int rank) {
+        CHECK_HIP_ERROR(hipSetDevice(device));
+
+        std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+        hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+        hipsparseTransport_t transport;
+        CHECK_HIPSPARSE_ERROR(hipsparseLocalTransportGet(local, rank, &transport));
+
+        const int64_t first  = partition[rank];
+        const J       rows   = partition[rank + 1] - first;
+        const I       offset = hcsr_row_ptr[first] - idx_base;
+        const I       nnz_r  = hcsr_row_ptr[first + rows] - hcsr_row_ptr[first];
+
+        std::vector<I> hptr(rows + 1);
+        for(J i = 0; i <= rows; ++i)
+        {
+            hptr[i] = hcsr_row_ptr[first + i] - offset;
+        }
+
+        // allocate memory on device
+        auto dptr_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * (rows + 1)), device_free};
+        auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_r), device_free};
+        auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_r), device_free};
+        auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * rows), device_free};
+        auto dy_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * rows), device_free};
+        auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+        auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+        I* dptr    = (I*)dptr_managed.get();
+        J* dcol    = (J*)dcol_managed.get();
+        T* dval    = (T*)dval_managed.get();
+        T* dx      = (T*)dx_managed.get();
+        T* dy      = (T*)dy_managed.get();
+        T* d_alpha = (T*)d_alpha_managed.get();
+        T* d_beta  = (T*)d_beta_managed.get();
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr, hptr.data(), sizeof(I) * (rows + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcol, hcol_ind.data() + offset, sizeof(J) * nnz_r, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval, hval.data() + offset, sizeof(T) * nnz_r, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        hipsparseDistCsrDescr_t A;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDistCsr(&A,
+                                                     handle,
+                                                     &transport,
+                                                     partition.data(),
+                                                     nnz_r,
+                                                     dptr,
+                                                     dcol,
+                                                     dval,
+                                                     typeI,
+                                                     typeJ,
+                                                     idx_base,
+                                                     typeT));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDistCsrGet(A,
+                                                  &hsizes[4 * rank + 0],
+                                                  &hsizes[4 * rank + 1],
+                                                  &hsizes[4 * rank + 2],
+                                                  &hsizes[4 * rank + 3]));
+
+        hipsparseDnVecDescr_t x, y;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, rows, dx, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, rows, dy, typeT));
+
+        // HIPSPARSE pointer mode host
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseDistSpMV(handle, A, &h_alpha, x, &h_beta, y, typeT, alg));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_1.data() + first, dy, sizeof(T) * rows, hipMemcpyDeviceToHost));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseDistSpMV(handle, A, d_alpha, x, d_beta, y, typeT, alg));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_2.data() + first, dy, sizeof(T) * rows, hipMemcpyDeviceToHost));
+
+        // Only the calls of the rank are profiled, not the routines hipsparseDistSpMV() uses
+        int count = 0;
+        CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, nullptr));
+
+        std::vector<hipsparseProfileEntry_t> entries(count);
+        CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, entries.data()));
+
+        int64_t spmv_calls = 0;
+        for(const hipsparseProfileEntry_t& entry : entries)
+        {
+            const std::string routine = entry.routine;
+            if(routine != "hipsparseCreateDistCsr" && routine != "hipsparseSetPointerMode"
+               && routine != "hipsparseDistSpMV")
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+            spmv_calls += (routine == "hipsparseDistSpMV") ? entry.calls : 0;
+        }
+        if(spmv_calls != 2)
+        {
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDistCsr(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+        return HIPSPARSE_STATUS_SUCCESS;
+    };
+
+    std::vector<hipsparseStatus_t> status(ranks, HIPSPARSE_STATUS_SUCCESS);
+    std::vector<std::thread>       threads;
+    for(int rank = 0; rank < ranks; ++rank)
+    {
+        threads.emplace_back([&, rank]() { status[rank] = run_rank(rank); });
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyLocalTransport(local));
+    for(int rank = 0; rank < ranks; ++rank)
+    {
+        CHECK_HIPSPARSE_ERROR(status[rank]);
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general(1, 4 * ranks, 1, hsizes_gold.data(), hsizes.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+// The last rank fails, the other ranks must return instead of waiting for its messages, and the
+// next calls must work on every rank
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_dist_csrmv_failure(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m        = argus.M;
+    J                    n        = argus.M;
+    int                  ranks    = argus.ranks;
+    int                  fail     = ranks - 1;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // Global matrix on the host
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+    std::vector<T> hy_gold(m);
+    std::vector<T> hy_1(m);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy, 1, m);
+
+    hy_gold = hy;
+    host_csrmv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               m,
+               n,
+               nnz,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcol_ind.data(),
+               hval.data(),
+               hx.data(),
+               h_beta,
+               hy_gold.data(),
+               idx_base);
+
+    // Blocks of equal sizes
+    std::vector<int64_t> partition(ranks + 1);
+    for(int r = 0; r <= ranks; ++r)
+    {
+        partition[r] = int64_t(m) * r / ranks;
+    }
+
+    hipsparseLocalTransport_t local;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateLocalTransport(&local, ranks));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    // Status of the failed creation and of the failed product on each rank
+    std::vector<hipsparseStatus_t> create_status(ranks);
+    std::vector<hipsparseStatus_t> spmv_status(ranks);
+
+    auto run_rank = [&](int rank) {
+        CHECK_HIP_ERROR(hipSetDevice(device));
+
+        std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+        hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+        hipsparseTransport_t transport;
+        CHECK_HIPSPARSE_ERROR(hipsparseLocalTransportGet(local, rank, &transport));
+
+        const int64_t first  = partition[rank];
+        const J       rows   = partition[rank + 1] - first;
+        const I       offset = hcsr_row_ptr[first] - idx_base;
+        const I       nnz_r  = hcsr_row_ptr[first + rows] - hcsr_row_ptr[first];
+
+        std::vector<I> hptr(rows + 1);
+        for(J i = 0; i <= rows; ++i)
+        {
+            hptr[i] = hcsr_row_ptr[first + i] - offset;
+        }
+
+        // allocate memory on device
+        auto dptr_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * (rows + 1)), device_free};
+        auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_r), device_free};
+        auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_r), device_free};
+        auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * rows), device_free};
+        auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * rows), device_free};
+
+        I* dptr = (I*)dptr_managed.get();
+        J* dcol = (J*)dcol_managed.get();
+        T* dval = (T*)dval_managed.get();
+        T* dx   = (T*)dx_managed.get();
+        T* dy   = (T*)dy_managed.get();
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr, hptr.data(), sizeof(I) * (rows + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcol, hcol_ind.data() + offset, sizeof(J) * nnz_r, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval, hval.data() + offset, sizeof(T) * nnz_r, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+
+        // The failed rank passes an invalid number of non-zero entries
+        hipsparseDistCsrDescr_t A;
+        create_status[rank] = hipsparseCreateDistCsr(&A,
+                                                     handle,
+                                                     &transport,
+                                                     partition.data(),
+                                                     (rank == fail) ? -1 : nnz_r,
+                                                     dptr,
+                                                     dcol,
+                                                     dval,
+                                                     typeI,
+                                                     typeJ,
+                                                     idx_base,
+                                                     typeT);
+        if(create_status[rank] == HIPSPARSE_STATUS_SUCCESS)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseDestroyDistCsr(A));
+        }
+
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDistCsr(&A,
+                                                     handle,
+                                                     &transport,
+                                                     partition.data(),
+                                                     nnz_r,
+                                                     dptr,
+                                                     dcol,
+                                                     dval,
+                                                     typeI,
+                                                     typeJ,
+                                                     idx_base,
+                                                     typeT));
+
+        // The failed rank passes a vector y of the wrong size
+        hipsparseDnVecDescr_t x, y, z;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, rows, dx, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, rows, dy, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&z, rows + 1, dy, typeT));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        spmv_status[rank] = hipsparseDistSpMV(
+            handle, A, &h_alpha, x, &h_beta, (rank == fail) ? z : y, typeT, alg);
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data() + first, sizeof(T) * rows, hipMemcpyHostToDevice));
+        CHECK_HIPSPARSE_ERROR(hipsparseDistSpMV(handle, A, &h_alpha, x, &h_beta, y, typeT, alg));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_1.data() + first, dy, sizeof(T) * rows, hipMemcpyDeviceToHost));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDistCsr(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(z));
+        return HIPSPARSE_STATUS_SUCCESS;
+    };
+
+    std::vector<hipsparseStatus_t> status(ranks, HIPSPARSE_STATUS_SUCCESS);
+    std::vector<std::thread>       threads;
+    for(int rank = 0; rank < ranks; ++rank)
+    {
+        threads.emplace_back([&, rank]() { status[rank] = run_rank(rank); });
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyLocalTransport(local));
+    for(int rank = 0; rank < ranks; ++rank)
+    {
+        CHECK_HIPSPARSE_ERROR(status[rank]);
+    }
+
+    // The creation fails on every rank, the product on the failed rank and on the ranks that
+    // receive entries of x from it
+    for(int rank = 0; rank < ranks; ++rank)
+    {
+        if(rank == fail)
+        {
+            verify_hipsparse_status_invalid_size(create_status[rank], "Error: nnz is invalid");
+            verify_hipsparse_status_invalid_size(spmv_status[rank], "Error: y size is invalid");
+        }
+        else
+        {
+            verify_hipsparse_status_internal_error(create_status[rank], "Error: a rank failed");
+            if(spmv_status[rank] != HIPSPARSE_STATUS_SUCCESS)
+            {
+                verify_hipsparse_status_internal_error(spmv_status[rank], "Error: a rank failed");
+            }
+        }
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_DIST_CSRMV_HPP
@@ -166,17 +166,17 @@ hipsparseStatus_t testing_dotci(Arguments argus)
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(
                 hipsparseXdotci(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base));
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = doti_gflop_count(nnz);
         double gbyte_count = doti_gbyte_count<T, T>(nnz);
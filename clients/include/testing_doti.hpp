@@ -98,6 +98,8 @@ hipsparseStatus_t testing_doti(Arguments argus)
 
     T hresult_1;
     T hresult_2;
+    T hresult_3;
+    T hresult_4;
     T hresult_gold;
 
     // Initial Data on CPU
@@ -136,6 +138,49 @@ hipsparseStatus_t testing_doti(Arguments argus)
         // copy output from device to CPU^
         CHECK_HIP_ERROR(hipMemcpy(&hresult_2, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
 
+        // HIPSPARSE pointer mode device, without synchronization
+        hresult_3 = hresult_2;
+#if(!defined(CUDART_VERSION))
+        CHECK_HIP_ERROR(hipMemset(dresult_2, 0, sizeof(T)));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_NON_BLOCKING));
+        CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, dresult_2, idx_base));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hipMemcpy(&hresult_3, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING));
+#endif
+
+        // HIPSPARSE pointer mode device, recorded in a graph in capture-safe sync mode
+        hresult_4 = hresult_2;
+#if(!defined(CUDART_VERSION))
+        hipStream_t capture_stream;
+        CHECK_HIP_ERROR(hipStreamCreate(&capture_stream));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, capture_stream));
+        CHECK_HIP_ERROR(hipMemset(dresult_2, 0, sizeof(T)));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_CAPTURE_SAFE));
+
+        hipGraph_t     graph;
+        hipGraphExec_t graph_exec;
+        CHECK_HIP_ERROR(hipStreamBeginCapture(capture_stream, hipStreamCaptureModeGlobal));
+        CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, dresult_2, idx_base));
+        CHECK_HIP_ERROR(hipStreamEndCapture(capture_stream, &graph));
+        CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+        CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, capture_stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(capture_stream));
+        CHECK_HIP_ERROR(hipMemcpy(&hresult_4, dresult_2, sizeof(T), hipMemcpyDeviceToHost));
+
+        // The result cannot be returned to the host without synchronizing the stream
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        verify_hipsparse_status_not_supported(
+            hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base),
+            "Error: doti is not capture-safe in host pointer mode");
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream));
+        CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+        CHECK_HIP_ERROR(hipStreamDestroy(capture_stream));
+#endif
+
         // CPU
         hresult_gold = make_DataType<T>(0.0);
         for(int i = 0; i < nnz; ++i)
@@ -147,6 +192,8 @@ hipsparseStatus_t testing_doti(Arguments argus)
         // unit check and norm check can not be interchanged their order
         unit_check_general(1, 1, 1, &hresult_gold, &hresult_1);
         unit_check_general(1, 1, 1, &hresult_gold, &hresult_2);
+        unit_check_general(1, 1, 1, &hresult_gold, &hresult_3);
+        unit_check_general(1, 1, 1, &hresult_gold, &hresult_4);
     }
 
     if(argus.timing)
@@ -164,17 +211,17 @@ hipsparseStatus_t testing_doti(Arguments argus)
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(
                 hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &hresult_1, idx_base));
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = doti_gflop_count(nnz);
         double gbyte_count = doti_gbyte_count<T, T>(nnz);
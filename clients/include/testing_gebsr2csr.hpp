@@ -490,11 +490,8 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
                                                       dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2csr(handle,
                                                       dir,
                                                       mb,
@@ -509,9 +506,12 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
                                                       dcsr_val,
                                                       dcsr_row_ptr,
                                                       dcsr_col_ind));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gebsr2csr_gbyte_count<T>(mb, row_block_dim, col_block_dim, nnzb);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -509,7 +509,7 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
                                                               &buffer_size));
 
     // Allocate the buffer size.
-    auto  dbuffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+    auto  dbuffer_managed = hipsparse_unique_ptr{device_malloc_buffer(buffer_size), device_free};
     void* dbuffer         = dbuffer_managed.get();
 
     DEVICE_ALLOC(int, dbsc_row_ind, nnzb);
@@ -605,11 +605,8 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
                                                            dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2gebsc<T>(handle,
                                                            mb,
                                                            nb,
@@ -625,9 +622,12 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
                                                            action,
                                                            base,
                                                            dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count
             = gebsr2gebsc_gbyte_count<T>(mb, nb, nnzb, row_block_dim, col_block_dim, action);
@@ -982,7 +982,7 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
                                                          &buffer_size_conversion));
 
     auto dbuffer_conversion_managed
-        = hipsparse_unique_ptr{device_malloc(buffer_size_conversion), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(buffer_size_conversion), device_free};
     void* dbuffer_conversion = dbuffer_conversion_managed.get();
 
     // Obtain BSR nnzb first on the host and then using the device and ensure they give the same results
@@ -1063,7 +1063,7 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
 
     // Allocate buffer on the device
     auto dbuffer_managed
-        = hipsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+        = hipsparse_unique_ptr{device_malloc_buffer(sizeof(char) * buffer_size), device_free};
 
     void* dbuffer = (void*)dbuffer_managed.get();
 
@@ -1231,11 +1231,8 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
                                                         dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgebsr2gebsr(handle,
                                                         dir,
                                                         mb,
@@ -1254,9 +1251,12 @@ hipsparseStatus_t testing_gebsr2gebsr(Arguments argus)
                                                         row_block_dim_C,
                                                         col_block_dim_C,
                                                         dbuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gebsr2gebsr_gbyte_count<T>(mb,
                                                         mb_C,
@@ -68,7 +68,7 @@ void testing_gemvi_bad_arg(void)
 
     // gemvi
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, 100));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, 100));
 
     verify_hipsparse_status_invalid_handle(hipsparseSgemvi(
         nullptr, opType, m, n, &alpha, A, lda, nnz, x, xInd, &beta, y, idxBase, buffer));
@@ -118,7 +118,7 @@ void testing_gemvi_bad_arg(void)
             handle, opType, m, n, &alpha, A, lda, n + 1, x, xInd, &beta, y, idxBase, buffer),
         "Error: nnz is invalid");
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 #endif
 }
 
@@ -182,7 +182,7 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
     void* externalBuffer;
 
     CHECK_HIPSPARSE_ERROR(hipsparseXgemvi_bufferSize<T>(handle, trans, m, n, nnz, &bufferSize));
-    CHECK_HIP_ERROR(hipMalloc(&externalBuffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&externalBuffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -245,11 +245,8 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
                                                   externalBuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgemvi(handle,
                                                   trans,
                                                   m,
@@ -264,9 +261,12 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
                                                   dy,
                                                   idxBase,
                                                   externalBuffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = gemvi_gflop_count(m, nnz);
         double gbyte_count
@@ -297,7 +297,7 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(externalBuffer));
+    CHECK_HIP_ERROR(device_free_buffer(externalBuffer));
 #endif
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -194,7 +194,7 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
         handle, algo, m, dds, ddl, dd, ddu, ddw, dx, batch_count, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -208,6 +208,9 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
         // Check
         std::vector<T> hresult(m * batch_count, make_DataType<T>(3));
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int b = 0; b < batch_count; b++)
         {
             for(int i = 0; i < m; ++i)
@@ -250,16 +253,16 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
                 handle, algo, m, dds, ddl, dd, ddu, ddw, dx, batch_count, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgpsvInterleavedBatch(
                 handle, algo, m, dds, ddl, dd, ddu, ddw, dx, batch_count, buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gpsv_interleaved_batch_gbyte_count<T>(m, batch_count);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -274,7 +277,7 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -157,7 +157,7 @@ hipsparseStatus_t testing_gtsv2(Arguments argus)
         hipsparseXgtsv2_bufferSizeExt(handle, m, n, ddl, dd, ddu, dB, ldb, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -196,15 +196,15 @@ hipsparseStatus_t testing_gtsv2(Arguments argus)
             CHECK_HIPSPARSE_ERROR(hipsparseXgtsv2(handle, m, n, ddl, dd, ddu, dB, ldb, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgtsv2(handle, m, n, ddl, dd, ddu, dB, ldb, buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gtsv_gbyte_count<T>(m, n);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -219,7 +219,7 @@ hipsparseStatus_t testing_gtsv2(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
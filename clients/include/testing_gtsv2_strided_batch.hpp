@@ -176,7 +176,7 @@ hipsparseStatus_t testing_gtsv2_strided_batch(Arguments argus)
         handle, m, ddl, dd, ddu, dx, batch_count, batch_stride, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -189,6 +189,9 @@ hipsparseStatus_t testing_gtsv2_strided_batch(Arguments argus)
 
         // Check
         std::vector<T> hresult(batch_stride * batch_count, make_DataType<T>(3));
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int j = 0; j < batch_count; j++)
         {
             hresult[batch_stride * j]
@@ -221,16 +224,16 @@ hipsparseStatus_t testing_gtsv2_strided_batch(Arguments argus)
                 handle, m, ddl, dd, ddu, dx, batch_count, batch_stride, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgtsv2StridedBatch(
                 handle, m, ddl, dd, ddu, dx, batch_count, batch_stride, buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gtsv_strided_batch_gbyte_count<T>(m, batch_count);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -247,7 +250,7 @@ hipsparseStatus_t testing_gtsv2_strided_batch(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -165,7 +165,7 @@ hipsparseStatus_t testing_gtsv_interleaved_batch(Arguments argus)
         handle, algo, m, ddl, dd, ddu, dx, batch_count, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -186,6 +186,9 @@ hipsparseStatus_t testing_gtsv_interleaved_batch(Arguments argus)
                   + testing_mult(hd[batch_count * (m - 1) + j], hx[batch_count * (m - 1) + j]);
         }
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(int i = 1; i < m - 1; i++)
         {
             for(int j = 0; j < batch_count; j++)
@@ -212,16 +215,16 @@ hipsparseStatus_t testing_gtsv_interleaved_batch(Arguments argus)
                 handle, algo, m, ddl, dd, ddu, dx, batch_count, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXgtsvInterleavedBatch(
                 handle, algo, m, ddl, dd, ddu, dx, batch_count, buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = gtsv_interleaved_batch_gbyte_count<T>(m, batch_count);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
@@ -236,7 +239,7 @@ hipsparseStatus_t testing_gtsv_interleaved_batch(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
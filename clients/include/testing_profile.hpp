@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2019 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_PROFILE_HPP
+#define TESTING_PROFILE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cstring>
+#include <hipsparse.h>
+#include <thread>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_profile_bad_arg(void)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    int                     count = 1;
+    hipsparseProfileEntry_t entry;
+
+    verify_hipsparse_status(hipsparseGetProfile(nullptr, &count, &entry),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGetProfile(handle, nullptr, &entry),
+                                          "Error: count is nullptr");
+
+    count = -1;
+    verify_hipsparse_status_invalid_value(hipsparseGetProfile(handle, &count, &entry),
+                                          "Error: count is negative");
+
+    verify_hipsparse_status(hipsparseResetProfile(nullptr),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+}
+
+hipsparseStatus_t testing_profile(Arguments argus)
+{
+    int                  ncalls   = argus.iters;
+    int                  m        = 100;
+    int                  nnz      = 200;
+    hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Sorted COO row indices, two entries per row
+    std::vector<int> hcoo_row_ind(nnz);
+    for(int i = 0; i < nnz; ++i)
+    {
+        hcoo_row_ind[i] = i / 2;
+    }
+
+    auto dcoo_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+
+    int* dcoo_row_ind = (int*)dcoo_row_ind_managed.get();
+    int* dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoo_row_ind, hcoo_row_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+
+    // A new handle has no profile
+    int count = 0;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, nullptr));
+    unit_check_general(1, 1, 1, &count, std::vector<int>{0}.data());
+
+    for(int i = 0; i < ncalls; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseXcoo2csr(handle, dcoo_row_ind, nnz, m, dcsr_row_ptr, idx_base));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, nullptr));
+    unit_check_general(1, 1, 1, &count, std::vector<int>{1}.data());
+
+    hipsparseProfileEntry_t entry;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, &entry));
+
+    int64_t calls = entry.calls;
+    unit_check_general(1, 1, 1, &calls, std::vector<int64_t>{ncalls}.data());
+
+    if(std::strcmp(entry.routine, "hipsparseXcoo2csr") != 0 || entry.hostTimeNs < 0)
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // The counters start again from zero after a reset
+    CHECK_HIPSPARSE_ERROR(hipsparseResetProfile(handle));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, nullptr));
+    unit_check_general(1, 1, 1, &count, std::vector<int>{0}.data());
+
+    // The calls of a thread are still counted after it exits
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    hipsparseStatus_t status = HIPSPARSE_STATUS_SUCCESS;
+    std::thread       worker([&]() {
+        if(hipSetDevice(device) != hipSuccess)
+        {
+            status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+        for(int i = 0; i < ncalls && status == HIPSPARSE_STATUS_SUCCESS; ++i)
+        {
+            status = hipsparseXcoo2csr(handle, dcoo_row_ind, nnz, m, dcsr_row_ptr, idx_base);
+        }
+    });
+    worker.join();
+    CHECK_HIPSPARSE_ERROR(status);
+
+    count = 1;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetProfile(handle, &count, &entry));
+    unit_check_general(1, 1, 1, &count, std::vector<int>{1}.data());
+
+    calls = entry.calls;
+    unit_check_general(1, 1, 1, &calls, std::vector<int64_t>{ncalls}.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_PROFILE_HPP
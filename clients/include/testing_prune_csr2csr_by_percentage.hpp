@@ -705,7 +705,8 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                                                         info,
                                                                         &buffer_size));
 
-    auto d_temp_buffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+    auto d_temp_buffer_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(buffer_size), device_free};
     T*   d_temp_buffer         = (T*)d_temp_buffer_managed.get();
 
     std::vector<int> h_nnz_total_dev_host_ptr(1);
@@ -851,11 +852,8 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                                                      d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXpruneCsr2csrByPercentage(handle,
                                                                      M,
                                                                      N,
@@ -871,9 +869,12 @@ hipsparseStatus_t testing_prune_csr2csr_by_percentage(Arguments argus)
                                                                      d_csr_col_ind_C,
                                                                      info,
                                                                      d_temp_buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count
             = prune_csr2csr_by_percentage_gbyte_count<T>(M, nnz_A, h_nnz_total_dev_host_ptr[0]);
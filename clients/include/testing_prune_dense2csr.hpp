@@ -315,7 +315,8 @@ hipsparseStatus_t testing_prune_dense2csr(Arguments argus)
                                                               (const int*)nullptr,
                                                               &buffer_size));
 
-    auto d_temp_buffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+    auto d_temp_buffer_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(buffer_size), device_free};
 
     T* d_temp_buffer = (T*)d_temp_buffer_managed.get();
 
@@ -448,11 +449,8 @@ hipsparseStatus_t testing_prune_dense2csr(Arguments argus)
                                                            d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseXpruneDense2csr(handle,
                                                            M,
                                                            N,
@@ -464,9 +462,12 @@ hipsparseStatus_t testing_prune_dense2csr(Arguments argus)
                                                            d_csr_row_ptr,
                                                            d_csr_col_ind,
                                                            d_temp_buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gbyte_count = prune_dense2csr_gbyte_count<T>(M, N, h_nnz_total_dev_host_ptr[0]);
         double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
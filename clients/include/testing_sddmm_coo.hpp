@@ -323,7 +323,7 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
         handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     // HIPSPARSE pointer mode host
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -399,16 +399,16 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(hipsparseSDDMM(
                 handle, transA, transB, &h_alpha, A, B, &h_beta, C1, typeT, alg, buffer));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = sddmm_gflop_count(k, nnz, h_beta != make_DataType<T>(0));
         double gbyte_count = sddmm_coo_gbyte_count<T>(m, n, k, nnz, h_beta != make_DataType<T>(0));
@@ -445,7 +445,7 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
     }
 
     // free.
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C1));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C2));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(A));
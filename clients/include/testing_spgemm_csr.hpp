@@ -501,7 +501,7 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                          nullptr));
 
     void* externalBuffer1;
-    CHECK_HIP_ERROR(hipMalloc(&externalBuffer1, bufferSize1));
+    CHECK_HIP_ERROR(device_malloc_buffer(&externalBuffer1, bufferSize1));
 
     // SpGEMM work estimation
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -565,7 +565,7 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
                                                   nullptr));
 
     void* externalBuffer2;
-    CHECK_HIP_ERROR(hipMalloc(&externalBuffer2, bufferSize2));
+    CHECK_HIP_ERROR(device_malloc_buffer(&externalBuffer2, bufferSize2));
 
     // SpGEMM compute
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -716,8 +716,8 @@ hipsparseStatus_t testing_spgemm_csr(Arguments argus)
     unit_check_general(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_2.data());
 
     // Free buffers
-    CHECK_HIP_ERROR(hipFree(externalBuffer1));
-    CHECK_HIP_ERROR(hipFree(externalBuffer2));
+    CHECK_HIP_ERROR(device_free_buffer(externalBuffer1));
+    CHECK_HIP_ERROR(device_free_buffer(externalBuffer2));
 
     // Clean up
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
@@ -344,8 +344,9 @@ hipsparseStatus_t testing_spgemmreuse_csr(Arguments argus)
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
         handle, transA, transB, A, B, C, alg, descr, &bufferSize1, nullptr));
 
-    auto  externalBuffer1_managed = hipsparse_unique_ptr{device_malloc(bufferSize1), device_free};
-    void* externalBuffer1         = (void*)externalBuffer1_managed.get();
+    auto externalBuffer1_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(bufferSize1), device_free};
+    void* externalBuffer1 = (void*)externalBuffer1_managed.get();
 
     // SpGEMMreuse work estimation
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
@@ -371,12 +372,15 @@ hipsparseStatus_t testing_spgemmreuse_csr(Arguments argus)
                                                    &bufferSize4,
                                                    externalBuffer4));
 
-    auto externalBuffer2_managed = hipsparse_unique_ptr{device_malloc(bufferSize2), device_free};
-    externalBuffer2              = (void*)externalBuffer2_managed.get();
-    auto externalBuffer3_managed = hipsparse_unique_ptr{device_malloc(bufferSize3), device_free};
-    externalBuffer3              = (void*)externalBuffer3_managed.get();
-    auto externalBuffer4_managed = hipsparse_unique_ptr{device_malloc(bufferSize4), device_free};
-    externalBuffer4              = (void*)externalBuffer4_managed.get();
+    auto externalBuffer2_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(bufferSize2), device_free};
+    externalBuffer2 = (void*)externalBuffer2_managed.get();
+    auto externalBuffer3_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(bufferSize3), device_free};
+    externalBuffer3 = (void*)externalBuffer3_managed.get();
+    auto externalBuffer4_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(bufferSize4), device_free};
+    externalBuffer4 = (void*)externalBuffer4_managed.get();
 
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
                                                    transA,
@@ -420,8 +424,9 @@ hipsparseStatus_t testing_spgemmreuse_csr(Arguments argus)
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
         handle, transA, transB, A, B, C, alg, descr, &bufferSize5, externalBuffer5));
 
-    auto externalBuffer5_managed = hipsparse_unique_ptr{device_malloc(bufferSize5), device_free};
-    externalBuffer5              = (void*)externalBuffer5_managed.get();
+    auto externalBuffer5_managed
+        = hipsparse_unique_ptr{device_malloc_buffer(bufferSize5), device_free};
+    externalBuffer5 = (void*)externalBuffer5_managed.get();
 
     CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
         handle, transA, transB, A, B, C, alg, descr, &bufferSize5, externalBuffer5));
@@ -345,7 +345,7 @@ hipsparseStatus_t testing_spmm_bell()
         handle, transA, transB, &h_alpha, A_bell, B, &h_beta, C1, typeT, alg, &bufferSize_bell));
 
     void* buffer_bell;
-    CHECK_HIP_ERROR(hipMalloc(&buffer_bell, bufferSize_bell));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer_bell, bufferSize_bell));
 
     // HIPSPARSE pointer mode host
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -373,7 +373,7 @@ hipsparseStatus_t testing_spmm_bell()
     unit_check_near(1, m * n, 1, hC_gold.data(), hC_1.data());
     unit_check_near(1, m * n, 1, hC_gold.data(), hC_2.data());
 
-    CHECK_HIP_ERROR(hipFree(buffer_bell));
+    CHECK_HIP_ERROR(device_free_buffer(buffer_bell));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A_csr));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A_bell));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
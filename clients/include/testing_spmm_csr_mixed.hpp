@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMM_CSR_MIXED_HPP
+#define TESTING_SPMM_CSR_MIXED_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+// A and B hold values of type A, C of type Y, the product is accumulated in the compute type U.
+// B and C are column major.
+template <typename I, typename J, typename A, typename Y, typename U>
+hipsparseStatus_t testing_spmm_csr_mixed(Arguments argus)
+{
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    J                    k        = argus.K;
+    U                    h_alpha  = static_cast<U>(argus.alpha);
+    U                    h_beta   = static_cast<U>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMMAlg_t   alg      = static_cast<hipsparseSpMMAlg_t>(argus.spmm_alg);
+    hipsparseOrder_t     order    = HIPSPARSE_ORDER_COL;
+
+    // Index and data types
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeA = getDataType<A>();
+    hipDataType          typeY = getDataType<Y>();
+    hipDataType          typeU = getDataType<U>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Initial Data on CPU, the random values are small integers that every type represents.
+    // op(A) is m x k, the CSR matrix is k x m if it is transposed.
+    srand(12345ULL);
+
+    J A_m = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : k;
+    J A_n = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : m;
+
+    I                  nnz;
+    std::vector<I>     hcsr_row_ptr;
+    std::vector<J>     hcol_ind;
+    std::vector<float> hval_float;
+    if(!generate_csr_matrix(
+           std::string(""), A_m, A_n, nnz, hcsr_row_ptr, hcol_ind, hval_float, idx_base))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J ldb = k;
+    J ldc = m;
+
+    std::vector<float> hB_float(ldb * n);
+    std::vector<float> hC_float(ldc * n);
+    hipsparseInit<float>(hB_float, 1, ldb * n);
+    hipsparseInit<float>(hC_float, 1, ldc * n);
+
+    std::vector<A> hval(nnz);
+    std::vector<A> hB(ldb * n);
+    std::vector<Y> hC_1(ldc * n);
+    std::transform(hval_float.begin(), hval_float.end(), hval.begin(), hipsparse_narrow<A, float>);
+    std::transform(hB_float.begin(), hB_float.end(), hB.begin(), hipsparse_narrow<A, float>);
+    std::transform(hC_float.begin(), hC_float.end(), hC_1.begin(), hipsparse_narrow<Y, float>);
+
+    std::vector<Y> hC_2    = hC_1;
+    std::vector<Y> hC_gold = hC_1;
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (A_m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(A) * nnz), device_free};
+    auto dB_managed      = hipsparse_unique_ptr{device_malloc(sizeof(A) * ldb * n), device_free};
+    auto dC_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(Y) * ldc * n), device_free};
+    auto dC_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(Y) * ldc * n), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(U)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(U)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    A* dval    = (A*)dval_managed.get();
+    A* dB      = (A*)dB_managed.get();
+    Y* dC_1    = (Y*)dC_1_managed.get();
+    Y* dC_2    = (Y*)dC_2_managed.get();
+    U* d_alpha = (U*)d_alpha_managed.get();
+    U* d_beta  = (U*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (A_m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(A) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(A) * ldb * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(Y) * ldc * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(Y) * ldc * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(U), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(U), hipMemcpyHostToDevice));
+
+    // Create matrices, a backend may not support the data type of A, the type of C is then
+    // not supported either
+    hipsparseSpMatDescr_t matA;
+    hipsparseStatus_t     status = hipsparseCreateCsr(
+        &matA, A_m, A_n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeA);
+    if(status == HIPSPARSE_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+    CHECK_HIPSPARSE_ERROR(status);
+
+    hipsparseDnMatDescr_t matB, matC1, matC2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matB, k, n, ldb, dB, typeA, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matC1, m, n, ldc, dC_1, typeY, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&matC2, m, n, ldc, dC_2, typeY, order));
+
+    // Query SpMM buffer, a backend may not implement every type combination
+    size_t bufferSize;
+    status = hipsparseSpMM_bufferSize(handle,
+                                      transA,
+                                      transB,
+                                      &h_alpha,
+                                      matA,
+                                      matB,
+                                      &h_beta,
+                                      matC1,
+                                      typeU,
+                                      alg,
+                                      &bufferSize);
+
+    if(status != HIPSPARSE_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPSPARSE_ERROR(status);
+
+        void* buffer;
+        CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+
+        // Preprocess (optional)
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMM_preprocess(
+            handle, transA, transB, &h_alpha, matA, matB, &h_beta, matC1, typeU, alg, buffer));
+
+        if(argus.unit_check)
+        {
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, &h_alpha, matA, matB, &h_beta, matC1, typeU, alg, buffer));
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMM(
+                handle, transA, transB, d_alpha, matA, matB, d_beta, matC2, typeU, alg, buffer));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_1.data(), dC_1, sizeof(Y) * ldc * n, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_2.data(), dC_2, sizeof(Y) * ldc * n, hipMemcpyDeviceToHost));
+
+            host_csrmm_mixed(transA,
+                             m,
+                             n,
+                             k,
+                             h_alpha,
+                             hcsr_row_ptr.data(),
+                             hcol_ind.data(),
+                             hval.data(),
+                             hB.data(),
+                             ldb,
+                             h_beta,
+                             hC_gold.data(),
+                             ldc,
+                             idx_base);
+
+            unit_check_near(m, n, ldc, hC_gold.data(), hC_1.data());
+            unit_check_near(m, n, ldc, hC_gold.data(), hC_2.data());
+        }
+
+        CHECK_HIP_ERROR(device_free_buffer(buffer));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matB));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matC1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(matC2));
+
+    // HIPSPARSE_STATUS_NOT_SUPPORTED if the backend does not implement the type combination
+    return status;
+}
+
+#endif // TESTING_SPMM_CSR_MIXED_HPP
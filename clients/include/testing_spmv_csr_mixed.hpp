@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_CSR_MIXED_HPP
+#define TESTING_SPMV_CSR_MIXED_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+// A and x hold values of type A, y of type Y, the product is accumulated in the compute type C
+template <typename I, typename J, typename A, typename Y, typename C>
+hipsparseStatus_t testing_spmv_csr_mixed(Arguments argus)
+{
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    C                    h_alpha  = static_cast<C>(argus.alpha);
+    C                    h_beta   = static_cast<C>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+
+    // Index and data types
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeA = getDataType<A>();
+    hipDataType          typeY = getDataType<Y>();
+    hipDataType          typeC = getDataType<C>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Initial Data on CPU, the random values are small integers that every type represents
+    srand(12345ULL);
+
+    I                  nnz;
+    std::vector<I>     hcsr_row_ptr;
+    std::vector<J>     hcol_ind;
+    std::vector<float> hval_float;
+    if(!generate_csr_matrix(
+           std::string(""), m, n, nnz, hcsr_row_ptr, hcol_ind, hval_float, idx_base))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J xsize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    J ysize = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<float> hx_float(xsize);
+    std::vector<float> hy_float(ysize);
+    hipsparseInit<float>(hx_float, 1, xsize);
+    hipsparseInit<float>(hy_float, 1, ysize);
+
+    std::vector<A> hval(nnz);
+    std::vector<A> hx(xsize);
+    std::vector<Y> hy_1(ysize);
+    std::transform(hval_float.begin(), hval_float.end(), hval.begin(), hipsparse_narrow<A, float>);
+    std::transform(hx_float.begin(), hx_float.end(), hx.begin(), hipsparse_narrow<A, float>);
+    std::transform(hy_float.begin(), hy_float.end(), hy_1.begin(), hipsparse_narrow<Y, float>);
+
+    std::vector<Y> hy_2    = hy_1;
+    std::vector<Y> hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(A) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(A) * xsize), device_free};
+    auto dy_1_managed    = hipsparse_unique_ptr{device_malloc(sizeof(Y) * ysize), device_free};
+    auto dy_2_managed    = hipsparse_unique_ptr{device_malloc(sizeof(Y) * ysize), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(C)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(C)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    A* dval    = (A*)dval_managed.get();
+    A* dx      = (A*)dx_managed.get();
+    Y* dy_1    = (Y*)dy_1_managed.get();
+    Y* dy_2    = (Y*)dy_2_managed.get();
+    C* d_alpha = (C*)d_alpha_managed.get();
+    C* d_beta  = (C*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(A) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(A) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(Y) * ysize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(Y) * ysize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(C), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(C), hipMemcpyHostToDevice));
+
+    // Create matrices, a backend may not support the data type of A, the type of y is then
+    // not supported either
+    hipsparseSpMatDescr_t matA;
+    hipsparseStatus_t     status = hipsparseCreateCsr(
+        &matA, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeA);
+    if(status == HIPSPARSE_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+    CHECK_HIPSPARSE_ERROR(status);
+
+    // Create dense vectors
+    hipsparseDnVecDescr_t x, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, xsize, dx, typeA));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, ysize, dy_1, typeY));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, ysize, dy_2, typeY));
+
+    // Query SpMV buffer, a backend may not implement every type combination
+    size_t bufferSize;
+    status = hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, matA, x, &h_beta, y1, typeC, alg, &bufferSize);
+
+    if(status != HIPSPARSE_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPSPARSE_ERROR(status);
+
+        void* buffer;
+        CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+
+        // Preprocess (optional)
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(
+            handle, transA, &h_alpha, matA, x, &h_beta, y1, typeC, alg, buffer));
+
+        if(argus.unit_check)
+        {
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMV(
+                handle, transA, &h_alpha, matA, x, &h_beta, y1, typeC, alg, buffer));
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, d_alpha, matA, x, d_beta, y2, typeC, alg, buffer));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_1.data(), dy_1, sizeof(Y) * ysize, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_2.data(), dy_2, sizeof(Y) * ysize, hipMemcpyDeviceToHost));
+
+            host_csrmv_mixed(transA,
+                             m,
+                             n,
+                             nnz,
+                             h_alpha,
+                             hcsr_row_ptr.data(),
+                             hcol_ind.data(),
+                             hval.data(),
+                             hx.data(),
+                             h_beta,
+                             hy_gold.data(),
+                             idx_base);
+
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_2.data());
+        }
+
+        CHECK_HIP_ERROR(device_free_buffer(buffer));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(matA));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+
+    // HIPSPARSE_STATUS_NOT_SUPPORTED if the backend does not implement the type combination
+    return status;
+}
+
+#endif // TESTING_SPMV_CSR_MIXED_HPP
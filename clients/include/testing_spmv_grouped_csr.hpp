@@ -0,0 +1,388 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_GROUPED_CSR_HPP
+#define TESTING_SPMV_GROUPED_CSR_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spmv_grouped_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    int64_t              m          = 100;
+    int64_t              n          = 100;
+    int64_t              nnz        = 100;
+    int64_t              safe_size  = 100;
+    int                  groupCount = 2;
+    float                alpha      = 0.6;
+    float                beta       = 0.2;
+    hipsparseOperation_t transA     = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase    = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType    = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType   = HIP_R_32F;
+    hipsparseSpMVAlg_t   alg        = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+    void*  dbuf = (void*)dbuf_managed.get();
+
+    // The group is the same matrix twice
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+
+    hipsparseConstSpMatDescr_t matA[] = {A, A};
+    hipsparseConstDnVecDescr_t vecX[] = {x, x};
+    hipsparseDnVecDescr_t      vecY[] = {y, y};
+
+    size_t bsize;
+
+    // SpMVGrouped buffer
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVGrouped_bufferSize(
+        nullptr, transA, groupCount, &alpha, matA, vecX, &beta, vecY, dataType, alg, &bsize));
+    verify_hipsparse_status_invalid_size(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, -1, &alpha, matA, vecX, &beta, vecY, dataType, alg, &bsize),
+        "Error: groupCount is < 0");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, groupCount, &alpha, nullptr, vecX, &beta, vecY, dataType, alg, &bsize),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, groupCount, &alpha, matA, nullptr, &beta, vecY, dataType, alg, &bsize),
+        "Error: vecX is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, groupCount, &alpha, matA, vecX, &beta, nullptr, dataType, alg, &bsize),
+        "Error: vecY is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, groupCount, &alpha, matA, vecX, &beta, vecY, dataType, alg, nullptr),
+        "Error: bsize is nullptr");
+
+    // An empty group is valid
+    verify_hipsparse_status_success(
+        hipsparseSpMVGrouped_bufferSize(
+            handle, transA, 0, &alpha, nullptr, nullptr, &beta, nullptr, dataType, alg, &bsize),
+        "success");
+
+    // SpMVGrouped
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVGrouped(
+        nullptr, transA, groupCount, &alpha, matA, vecX, &beta, vecY, dataType, alg, dbuf));
+    verify_hipsparse_status_invalid_size(
+        hipsparseSpMVGrouped(
+            handle, transA, -1, &alpha, matA, vecX, &beta, vecY, dataType, alg, dbuf),
+        "Error: groupCount is < 0");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped(
+            handle, transA, groupCount, &alpha, nullptr, vecX, &beta, vecY, dataType, alg, dbuf),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped(
+            handle, transA, groupCount, &alpha, matA, nullptr, &beta, vecY, dataType, alg, dbuf),
+        "Error: vecX is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVGrouped(
+            handle, transA, groupCount, &alpha, matA, vecX, &beta, nullptr, dataType, alg, dbuf),
+        "Error: vecY is nullptr");
+    verify_hipsparse_status_success(
+        hipsparseSpMVGrouped(
+            handle, transA, 0, &alpha, nullptr, nullptr, &beta, nullptr, dataType, alg, dbuf),
+        "success");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_grouped_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m          = argus.M;
+    J                    n          = argus.N;
+    int                  groupCount = argus.batch_count;
+    T                    h_alpha    = make_DataType<T>(argus.alpha);
+    T                    h_beta     = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA     = argus.transA;
+    hipsparseIndexBase_t idx_base   = argus.baseA;
+    hipsparseSpMVAlg_t   alg        = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    // The matrices differ in size and sparsity pattern, they are packed one after the other
+    // in the same arrays
+    std::vector<J>      hm(groupCount);
+    std::vector<J>      hn(groupCount);
+    std::vector<I>      hnnz(groupCount);
+    std::vector<size_t> ptr_offset(groupCount + 1, 0);
+    std::vector<size_t> nnz_offset(groupCount + 1, 0);
+    std::vector<size_t> x_offset(groupCount + 1, 0);
+    std::vector<size_t> y_offset(groupCount + 1, 0);
+
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    for(int i = 0; i < groupCount; ++i)
+    {
+        hm[i] = m + (i % 7) * 3;
+        hn[i] = n + (i % 5) * 2;
+
+        std::vector<I> row_ptr;
+        std::vector<J> col_ind;
+        std::vector<T> val;
+        if(!generate_csr_matrix(
+               std::string(""), hm[i], hn[i], hnnz[i], row_ptr, col_ind, val, idx_base))
+        {
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        hcsr_row_ptr.insert(hcsr_row_ptr.end(), row_ptr.begin(), row_ptr.end());
+        hcol_ind.insert(hcol_ind.end(), col_ind.begin(), col_ind.end());
+        hval.insert(hval.end(), val.begin(), val.end());
+
+        bool trans        = transA != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        ptr_offset[i + 1] = ptr_offset[i] + hm[i] + 1;
+        nnz_offset[i + 1] = nnz_offset[i] + hnnz[i];
+        x_offset[i + 1]   = x_offset[i] + (trans ? hm[i] : hn[i]);
+        y_offset[i + 1]   = y_offset[i] + (trans ? hn[i] : hm[i]);
+    }
+
+    std::vector<T> hx(x_offset[groupCount]);
+    std::vector<T> hy_1(y_offset[groupCount]);
+    std::vector<T> hy_2(y_offset[groupCount]);
+    std::vector<T> hy_gold(y_offset[groupCount]);
+
+    hipsparseInit<T>(hx, 1, hx.size());
+    hipsparseInit<T>(hy_1, 1, hy_1.size());
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * hcsr_row_ptr.size()), device_free};
+    auto dcol_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * hcol_ind.size()), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * hval.size()), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * hx.size()), device_free};
+    auto dy_1_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * hy_1.size()), device_free};
+    auto dy_2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * hy_2.size()), device_free};
+
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval    = (T*)dval_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy_1    = (T*)dy_1_managed.get();
+    T* dy_2    = (T*)dy_2_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(I) * hcsr_row_ptr.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * hcol_ind.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * hval.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * hy_1.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * hy_2.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create the descriptors of each matrix of the group
+    std::vector<hipsparseSpMatDescr_t> A(groupCount);
+    std::vector<hipsparseDnVecDescr_t> x(groupCount);
+    std::vector<hipsparseDnVecDescr_t> y1(groupCount);
+    std::vector<hipsparseDnVecDescr_t> y2(groupCount);
+
+    for(int i = 0; i < groupCount; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A[i],
+                                                 hm[i],
+                                                 hn[i],
+                                                 hnnz[i],
+                                                 dptr + ptr_offset[i],
+                                                 dcol + nnz_offset[i],
+                                                 dval + nnz_offset[i],
+                                                 typeI,
+                                                 typeJ,
+                                                 idx_base,
+                                                 typeT));
+
+        J x_size = x_offset[i + 1] - x_offset[i];
+        J y_size = y_offset[i + 1] - y_offset[i];
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x[i], x_size, dx + x_offset[i], typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1[i], y_size, dy_1 + y_offset[i], typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2[i], y_size, dy_2 + y_offset[i], typeT));
+    }
+
+    std::vector<hipsparseConstSpMatDescr_t> matA(A.begin(), A.end());
+    std::vector<hipsparseConstDnVecDescr_t> vecX(x.begin(), x.end());
+
+    // Query SpMVGrouped buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMVGrouped_bufferSize(handle,
+                                                          transA,
+                                                          groupCount,
+                                                          &h_alpha,
+                                                          matA.data(),
+                                                          vecX.data(),
+                                                          &h_beta,
+                                                          y1.data(),
+                                                          typeT,
+                                                          alg,
+                                                          &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+
+    // Preprocess (optional)
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMVGrouped_preprocess(handle,
+                                                          transA,
+                                                          groupCount,
+                                                          &h_alpha,
+                                                          matA.data(),
+                                                          vecX.data(),
+                                                          &h_beta,
+                                                          y1.data(),
+                                                          typeT,
+                                                          alg,
+                                                          buffer));
+
+    if(argus.unit_check)
+    {
+        // HIPSPARSE pointer mode host
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVGrouped(handle,
+                                                   transA,
+                                                   groupCount,
+                                                   &h_alpha,
+                                                   matA.data(),
+                                                   vecX.data(),
+                                                   &h_beta,
+                                                   y1.data(),
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+
+        // HIPSPARSE pointer mode device
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVGrouped(handle,
+                                                   transA,
+                                                   groupCount,
+                                                   d_alpha,
+                                                   matA.data(),
+                                                   vecX.data(),
+                                                   d_beta,
+                                                   y2.data(),
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_1.data(), dy_1, sizeof(T) * hy_1.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_2.data(), dy_2, sizeof(T) * hy_2.size(), hipMemcpyDeviceToHost));
+
+        // Host reference, one SpMV per matrix
+        for(int i = 0; i < groupCount; ++i)
+        {
+            host_csrmv(transA,
+                       hm[i],
+                       hn[i],
+                       hnnz[i],
+                       h_alpha,
+                       hcsr_row_ptr.data() + ptr_offset[i],
+                       hcol_ind.data() + nnz_offset[i],
+                       hval.data() + nnz_offset[i],
+                       hx.data() + x_offset[i],
+                       h_beta,
+                       hy_gold.data() + y_offset[i],
+                       idx_base);
+        }
+
+        unit_check_near(1, hy_gold.size(), 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, hy_gold.size(), 1, hy_gold.data(), hy_2.data());
+    }
+
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
+    for(int i = 0; i < groupCount; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A[i]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x[i]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1[i]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2[i]));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_GROUPED_CSR_HPP
@@ -0,0 +1,396 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_PLAN_CSR_HPP
+#define TESTING_SPMV_PLAN_CSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spmv_plan_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                alpha     = 0.6;
+    float                beta      = 0.2;
+    hipsparseOperation_t transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpMVAlg_t   alg       = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y;
+    hipsparseSpMVPlan_t   plan;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+
+    // SpMV plan creation
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(nullptr, handle, transA, &alpha, A, x, &beta, y, dataType, alg),
+        "Error: plan is nullptr");
+    verify_hipsparse_status_invalid_handle(
+        hipsparseCreateSpMVPlan(&plan, nullptr, transA, &alpha, A, x, &beta, y, dataType, alg));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, nullptr, A, x, &beta, y, dataType, alg),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &alpha, nullptr, x, &beta, y, dataType, alg),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &alpha, A, nullptr, &beta, y, dataType, alg),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &alpha, A, x, nullptr, y, dataType, alg),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &alpha, A, x, &beta, nullptr, dataType, alg),
+        "Error: y is nullptr");
+
+    verify_hipsparse_status_success(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &alpha, A, x, &beta, y, dataType, alg),
+        "success");
+
+    // SpMV plan values
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVPlanUpdateValues(nullptr, plan, dval));
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMVPlanUpdateValues(handle, nullptr, dval),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMVPlanUpdateValues(handle, plan, nullptr),
+                                            "Error: values is nullptr");
+
+    // SpMV plan execution
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpMVPlanExecute(nullptr, plan, &alpha, x, &beta, y));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVPlanExecute(handle, nullptr, &alpha, x, &beta, y), "Error: plan is nullptr");
+
+    // Destruct
+    verify_hipsparse_status_invalid_pointer(hipsparseDestroySpMVPlan(nullptr),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_success(hipsparseDestroySpMVPlan(plan), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_plan_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval_1;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval_1, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Second set of values on the same sparsity pattern
+    std::vector<T> hval_2(nnz);
+    hipsparseInit<T>(hval_2, 1, nnz);
+
+    bool trans  = transA != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    J    x_size = trans ? m : n;
+    J    y_size = trans ? n : m;
+
+    std::vector<T> hx(x_size);
+    std::vector<T> hy_1(y_size);
+    std::vector<T> hy_2(y_size);
+    std::vector<T> hy_gold(y_size);
+
+    hipsparseInit<T>(hx, 1, x_size);
+    hipsparseInit<T>(hy_1, 1, y_size);
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_1_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * x_size), device_free};
+    auto dy_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval_1  = (T*)dval_1_managed.get();
+    T* dval_2  = (T*)dval_2_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hval_1.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hval_2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrix and dense vectors
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval_1, typeI, typeJ, idx_base, typeT));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, x_size, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, y_size, dy, typeT));
+
+    // The plan analyses A once
+    hipsparseSpMVPlan_t plan;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateSpMVPlan(&plan, handle, transA, &h_alpha, A, x, &h_beta, y, typeT, alg));
+
+    if(argus.unit_check)
+    {
+        // Execute with the values of the creation, then with new values, each in both pointer
+        // modes
+        for(int k = 0; k < 2; ++k)
+        {
+            const std::vector<T>& hval = k == 0 ? hval_1 : hval_2;
+            if(k == 1)
+            {
+                CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanUpdateValues(handle, plan, dval_2));
+            }
+
+            hy_gold = hy_1;
+            host_csrmv(transA,
+                       m,
+                       n,
+                       nnz,
+                       h_alpha,
+                       hcsr_row_ptr.data(),
+                       hcol_ind.data(),
+                       hval.data(),
+                       hx.data(),
+                       h_beta,
+                       hy_gold.data(),
+                       idx_base);
+
+            // HIPSPARSE pointer mode host
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanExecute(handle, plan, &h_alpha, x, &h_beta, y));
+            CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+            unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data());
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanExecute(handle, plan, d_alpha, x, d_beta, y));
+            CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+            unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data());
+        }
+
+        // Values changed in place are read by the next execution
+        CHECK_HIP_ERROR(hipMemcpy(dval_2, hval_1.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+        hy_gold = hy_1;
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval_1.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanExecute(handle, plan, &h_alpha, x, &h_beta, y));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // The values alternate between the two arrays at each call
+        int  call        = 0;
+        auto next_values = [&]() { return (call++ % 2 == 0) ? dval_1 : dval_2; };
+
+        // Without a plan, each call with new values queries, allocates and preprocesses its
+        // buffer again
+        hipsparseSpMatDescr_t B;
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCreateCsr(&B, m, n, nnz, dptr, dcol, dval_1, typeI, typeJ, idx_base, typeT));
+
+        auto replan_call = [&]() {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMatSetValues(B, next_values()));
+
+            size_t bufferSize;
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+                handle, transA, &h_alpha, B, x, &h_beta, y, typeT, alg, &bufferSize));
+
+            void* buffer;
+            CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(
+                handle, transA, &h_alpha, B, x, &h_beta, y, typeT, alg, buffer));
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, B, x, &h_beta, y, typeT, alg, buffer));
+            CHECK_HIP_ERROR(device_free_buffer(buffer));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // With a plan, new values are only a pointer update
+        auto plan_call = [&]() {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanUpdateValues(handle, plan, next_values()));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVPlanExecute(handle, plan, &h_alpha, x, &h_beta, y));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(replan_call());
+            CHECK_HIPSPARSE_ERROR(plan_call());
+        }
+
+        // Performance run
+        double replan_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, replan_time_used, replan_call));
+
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, plan_call));
+
+        double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
+        double gbyte_count = csrmv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::transA,
+                            transA,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::algorithm,
+                            hipsparse_spmvalg2string(alg),
+                            display_key_t::replan_time_ms,
+                            get_gpu_time_msec(replan_time_used),
+                            display_key_t::speedup,
+                            replan_time_used / gpu_time_used,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMVPlan(plan));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_PLAN_CSR_HPP
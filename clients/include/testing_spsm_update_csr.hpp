@@ -0,0 +1,322 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPSM_UPDATE_CSR_HPP
+#define TESTING_SPSM_UPDATE_CSR_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spsm_update_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    hipsparseSpSMUpdate_t update = HIPSPARSE_SPSM_UPDATE_GENERAL;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpSMDescr_t  descr;
+
+    verify_hipsparse_status_success(hipsparseSpSM_createDescr(&descr), "success");
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+
+    // SpSM update
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpSM_updateMatrix(nullptr, descr, dval, update));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSM_updateMatrix(handle, nullptr, dval, update), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSM_updateMatrix(handle, descr, nullptr, update), "Error: values is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSpSM_updateMatrix(handle, descr, dval, update),
+                                          "Error: descr is not analysed");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseSpSM_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spsm_update_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12040)
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    J                    k        = argus.K;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOrder_t     order    = HIPSPARSE_ORDER_COL;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseDiagType_t  diag     = argus.diag_type;
+    hipsparseFillMode_t  uplo     = argus.fill_mode;
+    hipsparseSpSMAlg_t   alg      = static_cast<hipsparseSpSMAlg_t>(argus.spsm_alg);
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hval_1;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    // The matrix is a 2D Laplacian, whose triangular parts have a full diagonal and many
+    // levels
+    int ndim = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(m))));
+
+    m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hval_1, idx_base);
+    n     = m;
+    I nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Second set of values on the same sparsity pattern, and a new diagonal, both keep the
+    // matrix diagonally dominant
+    std::vector<T> hval_2(nnz);
+    std::vector<T> hdiag(m);
+    hipsparseInit<T>(hval_2, 1, nnz);
+    for(J i = 0; i < m; ++i)
+    {
+        for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            if(hcsr_col_ind[j] - idx_base == i)
+            {
+                hval_2[j] = make_DataType<T>(40.0);
+            }
+        }
+        hdiag[i] = make_DataType<T>(30.0 + i % 10);
+    }
+
+    // B and C are m x k column major matrices
+    J      ld   = std::max(J(1), m);
+    size_t size = size_t(ld) * k;
+
+    std::vector<T> hB(size);
+    std::vector<T> hC(size);
+    std::vector<T> hC_gold(size);
+
+    hipsparseInit<T>(hB, 1, size);
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_1_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto ddiag_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dB_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto dC_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval_1  = (T*)dval_1_managed.get();
+    T* dval_2  = (T*)dval_2_managed.get();
+    T* ddiag   = (T*)ddiag_managed.get();
+    T* dB      = (T*)dB_managed.get();
+    T* dC      = (T*)dC_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hval_1.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hval_2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ddiag, hdiag.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpSMDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSM_createDescr(&descr));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval_1, typeI, typeJ, idx_base, typeT));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &uplo, sizeof(uplo)));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag)));
+
+    hipsparseDnMatDescr_t B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, m, k, ld, dB, typeT, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C, m, k, ld, dC, typeT, order));
+
+    // Query SpSM buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSM_bufferSize(
+        handle, transA, transB, &h_alpha, A, B, C, typeT, alg, descr, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+
+    // The analysis is done once, with the first values
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSM_analysis(
+        handle, transA, transB, &h_alpha, A, B, C, typeT, alg, descr, buffer));
+
+    if(argus.unit_check)
+    {
+        // Solve in both pointer modes and compare with the solution of hval
+        auto check = [&](const std::vector<T>& hval) {
+            J struct_pivot  = -1;
+            J numeric_pivot = -1;
+            host_csrsm(m,
+                       k,
+                       nnz,
+                       transA,
+                       transB,
+                       h_alpha,
+                       hcsr_row_ptr,
+                       hcsr_col_ind,
+                       hval,
+                       hB,
+                       ld,
+                       order,
+                       hC_gold,
+                       ld,
+                       order,
+                       diag,
+                       uplo,
+                       idx_base,
+                       &struct_pivot,
+                       &numeric_pivot);
+
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSM_solve(
+                handle, transA, transB, &h_alpha, A, B, C, typeT, alg, descr, buffer));
+            CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+            if(struct_pivot == -1 && numeric_pivot == -1)
+            {
+                unit_check_near(1, size, 1, hC_gold.data(), hC.data());
+            }
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSM_solve(
+                handle, transA, transB, d_alpha, A, B, C, typeT, alg, descr, buffer));
+            CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+            if(struct_pivot == -1 && numeric_pivot == -1)
+            {
+                unit_check_near(1, size, 1, hC_gold.data(), hC.data());
+            }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        CHECK_HIPSPARSE_ERROR(check(hval_1));
+
+        // New values, the analysis is kept
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpSM_updateMatrix(handle, descr, dval_2, HIPSPARSE_SPSM_UPDATE_GENERAL));
+        CHECK_HIPSPARSE_ERROR(check(hval_2));
+
+        // The update sets the values of the analysed descriptor, see hipsparseSpSM_updateMatrix
+#if(!defined(CUDART_VERSION))
+        void* values;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetValues(A, &values));
+        if(values != dval_2)
+        {
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+#endif
+
+        // New diagonal, where supported by the backend
+        hipsparseStatus_t status
+            = hipsparseSpSM_updateMatrix(handle, descr, ddiag, HIPSPARSE_SPSM_UPDATE_DIAGONAL);
+        if(status != HIPSPARSE_STATUS_NOT_SUPPORTED)
+        {
+            CHECK_HIPSPARSE_ERROR(status);
+
+            std::vector<T> hval_3 = hval_2;
+            for(J i = 0; i < m; ++i)
+            {
+                for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+                {
+                    if(hcsr_col_ind[j] - idx_base == i)
+                    {
+                        hval_3[j] = hdiag[i];
+                    }
+                }
+            }
+            CHECK_HIPSPARSE_ERROR(check(hval_3));
+
+            // A general update drops the diagonal
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpSM_updateMatrix(handle, descr, dval_1, HIPSPARSE_SPSM_UPDATE_GENERAL));
+            CHECK_HIPSPARSE_ERROR(check(hval_1));
+        }
+    }
+
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSM_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPSM_UPDATE_CSR_HPP
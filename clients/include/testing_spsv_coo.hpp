@@ -270,7 +270,7 @@ hipsparseStatus_t testing_spsv_coo(Arguments argus)
         handle, transA, &h_alpha, A, x, y1, typeT, alg, descr, &bufferSize));
 
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
 
     // HIPSPARSE pointer mode host
     CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
@@ -336,16 +336,16 @@ hipsparseStatus_t testing_spsv_coo(Arguments argus)
                 hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(
                 hipsparseSpSV_solve(handle, transA, &h_alpha, A, x, y1, typeT, alg, descr));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = spsv_gflop_count(m, nnz, diag);
         double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
@@ -371,7 +371,7 @@ hipsparseStatus_t testing_spsv_coo(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 
     CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(descr));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
@@ -0,0 +1,474 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPSV_UPDATE_CSR_HPP
+#define TESTING_SPSV_UPDATE_CSR_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spsv_update_csr_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                alpha     = 0.6;
+    hipsparseOperation_t transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpSVAlg_t   alg       = HIPSPARSE_SPSV_ALG_DEFAULT;
+
+    hipsparseSpSVUpdate_t update = HIPSPARSE_SPSV_UPDATE_GENERAL;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y;
+
+    hipsparseSpSVDescr_t descr;
+
+    verify_hipsparse_status_success(hipsparseSpSV_createDescr(&descr), "success");
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, m, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+
+    hipsparseConstDnVecDescr_t xs[] = {x};
+    hipsparseDnVecDescr_t      ys[] = {y};
+
+    // SpSV update
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpSV_updateMatrix(nullptr, descr, dval, update));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSV_updateMatrix(handle, nullptr, dval, update), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSV_updateMatrix(handle, descr, nullptr, update), "Error: values is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSpSV_updateMatrix(handle, descr, dval, update),
+                                          "Error: descr is not analysed");
+
+    // SpSV batched solve
+    verify_hipsparse_status_invalid_handle(
+        hipsparseSpSV_solveBatched(nullptr, transA, &alpha, A, 1, xs, ys, dataType, alg, descr));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSV_solveBatched(handle, transA, &alpha, A, 1, nullptr, ys, dataType, alg, descr),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSV_solveBatched(handle, transA, &alpha, A, 1, xs, nullptr, dataType, alg, descr),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpSV_solveBatched(handle, transA, &alpha, A, 1, xs, ys, dataType, alg, nullptr),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseSpSV_solveBatched(handle, transA, &alpha, A, -1, xs, ys, dataType, alg, descr),
+        "Error: batchCount is invalid");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseSpSV_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spsv_update_csr(Arguments argus)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12010)
+    J                    m           = argus.M;
+    J                    n           = argus.N;
+    int                  batch_count = argus.batch_count;
+    T                    h_alpha     = make_DataType<T>(argus.alpha);
+    hipsparseOperation_t transA      = argus.transA;
+    hipsparseIndexBase_t idx_base    = argus.baseA;
+    hipsparseDiagType_t  diag        = argus.diag_type;
+    hipsparseFillMode_t  uplo        = argus.fill_mode;
+    hipsparseSpSVAlg_t   alg         = static_cast<hipsparseSpSVAlg_t>(argus.spsv_alg);
+    std::string          filename    = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hval_1;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(filename == "")
+    {
+        // Without a file, the matrix is a 2D Laplacian, whose triangular parts have a full
+        // diagonal and many levels
+        int ndim = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(m))));
+
+        m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hval_1, idx_base);
+        n   = m;
+        nnz = hcsr_row_ptr[m] - idx_base;
+    }
+    else if(!generate_csr_matrix(
+                filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hval_1, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Second set of values on the same sparsity pattern, and a new diagonal, both keep the
+    // matrix diagonally dominant
+    std::vector<T> hval_2(nnz);
+    std::vector<T> hdiag(m);
+    hipsparseInit<T>(hval_2, 1, nnz);
+    for(J i = 0; i < m; ++i)
+    {
+        for(I k = hcsr_row_ptr[i] - idx_base; k < hcsr_row_ptr[i + 1] - idx_base; ++k)
+        {
+            if(hcsr_col_ind[k] - idx_base == i)
+            {
+                hval_2[k] = make_DataType<T>(40.0);
+            }
+        }
+        hdiag[i] = make_DataType<T>(30.0 + i % 10);
+    }
+
+    // The right-hand sides and the solutions of the batch are stored one after the other
+    size_t size = size_t(m) * batch_count;
+
+    std::vector<T> hx(size);
+    std::vector<T> hy(size);
+    std::vector<T> hy_gold(size);
+
+    hipsparseInit<T>(hx, 1, size);
+
+    // allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_1_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto ddiag_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto dy_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr    = (I*)dptr_managed.get();
+    J* dcol    = (J*)dcol_managed.get();
+    T* dval_1  = (T*)dval_1_managed.get();
+    T* dval_2  = (T*)dval_2_managed.get();
+    T* ddiag   = (T*)ddiag_managed.get();
+    T* dx      = (T*)dx_managed.get();
+    T* dy      = (T*)dy_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hval_1.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_2, hval_2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ddiag, hdiag.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpSVDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_createDescr(&descr));
+
+    // Create matrix
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval_1, typeI, typeJ, idx_base, typeT));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &uplo, sizeof(uplo)));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_DIAG_TYPE, &diag, sizeof(diag)));
+
+    // Create one dense vector per right-hand side and solution
+    std::vector<hipsparseDnVecDescr_t>      x(batch_count);
+    std::vector<hipsparseDnVecDescr_t>      y(batch_count);
+    std::vector<hipsparseConstDnVecDescr_t> const_x(batch_count);
+    for(int j = 0; j < batch_count; ++j)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x[j], m, dx + size_t(m) * j, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y[j], m, dy + size_t(m) * j, typeT));
+        const_x[j] = x[j];
+    }
+
+    // Query SpSV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_bufferSize(
+        handle, transA, &h_alpha, A, x[0], y[0], typeT, alg, descr, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, bufferSize));
+
+    // The analysis is done once, with the first values
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpSV_analysis(handle, transA, &h_alpha, A, x[0], y[0], typeT, alg, descr, buffer));
+
+    if(argus.unit_check)
+    {
+        // Solve the batch in both pointer modes and compare with the solutions of hval
+        auto check = [&](const std::vector<T>& hval) {
+            J struct_pivot  = -1;
+            J numeric_pivot = -1;
+            for(int j = 0; j < batch_count; ++j)
+            {
+                host_csrsv(transA,
+                           m,
+                           nnz,
+                           h_alpha,
+                           hcsr_row_ptr.data(),
+                           hcsr_col_ind.data(),
+                           hval.data(),
+                           hx.data() + size_t(m) * j,
+                           hy_gold.data() + size_t(m) * j,
+                           diag,
+                           uplo,
+                           idx_base,
+                           &struct_pivot,
+                           &numeric_pivot);
+            }
+
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_solveBatched(handle,
+                                                             transA,
+                                                             &h_alpha,
+                                                             A,
+                                                             batch_count,
+                                                             const_x.data(),
+                                                             y.data(),
+                                                             typeT,
+                                                             alg,
+                                                             descr));
+            CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+            if(struct_pivot == -1 && numeric_pivot == -1)
+            {
+                unit_check_near(1, size, 1, hy_gold.data(), hy.data());
+            }
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_solveBatched(handle,
+                                                             transA,
+                                                             d_alpha,
+                                                             A,
+                                                             batch_count,
+                                                             const_x.data(),
+                                                             y.data(),
+                                                             typeT,
+                                                             alg,
+                                                             descr));
+            CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+            if(struct_pivot == -1 && numeric_pivot == -1)
+            {
+                unit_check_near(1, size, 1, hy_gold.data(), hy.data());
+            }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        CHECK_HIPSPARSE_ERROR(check(hval_1));
+
+        // New values, the analysis is kept
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpSV_updateMatrix(handle, descr, dval_2, HIPSPARSE_SPSV_UPDATE_GENERAL));
+        CHECK_HIPSPARSE_ERROR(check(hval_2));
+
+        // New diagonal, where supported by the backend
+        hipsparseStatus_t status
+            = hipsparseSpSV_updateMatrix(handle, descr, ddiag, HIPSPARSE_SPSV_UPDATE_DIAGONAL);
+        if(status != HIPSPARSE_STATUS_NOT_SUPPORTED)
+        {
+            CHECK_HIPSPARSE_ERROR(status);
+
+            std::vector<T> hval_3 = hval_2;
+            for(J i = 0; i < m; ++i)
+            {
+                for(I k = hcsr_row_ptr[i] - idx_base; k < hcsr_row_ptr[i + 1] - idx_base; ++k)
+                {
+                    if(hcsr_col_ind[k] - idx_base == i)
+                    {
+                        hval_3[k] = hdiag[i];
+                    }
+                }
+            }
+            CHECK_HIPSPARSE_ERROR(check(hval_3));
+
+            // A general update drops the diagonal
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpSV_updateMatrix(handle, descr, dval_1, HIPSPARSE_SPSV_UPDATE_GENERAL));
+            CHECK_HIPSPARSE_ERROR(check(hval_1));
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // The values alternate between the two arrays at each call
+        int  call        = 0;
+        auto next_values = [&]() { return (call++ % 2 == 0) ? dval_1 : dval_2; };
+
+        // Without an update, each call with new values analyses the matrix again
+        auto reanalysis_call = [&]() {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMatSetValues(A, next_values()));
+
+            hipsparseSpSVDescr_t new_descr;
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_createDescr(&new_descr));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_analysis(
+                handle, transA, &h_alpha, A, x[0], y[0], typeT, alg, new_descr, buffer));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_solveBatched(handle,
+                                                             transA,
+                                                             &h_alpha,
+                                                             A,
+                                                             batch_count,
+                                                             const_x.data(),
+                                                             y.data(),
+                                                             typeT,
+                                                             alg,
+                                                             new_descr));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(new_descr));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // With an update, the level schedule of the analysis is kept
+        auto update_call = [&]() {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_updateMatrix(
+                handle, descr, next_values(), HIPSPARSE_SPSV_UPDATE_GENERAL));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpSV_solveBatched(handle,
+                                                             transA,
+                                                             &h_alpha,
+                                                             A,
+                                                             batch_count,
+                                                             const_x.data(),
+                                                             y.data(),
+                                                             typeT,
+                                                             alg,
+                                                             descr));
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(reanalysis_call());
+            CHECK_HIPSPARSE_ERROR(update_call());
+        }
+
+        // Performance run
+        double replan_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, replan_time_used, reanalysis_call));
+
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, update_call));
+
+        double gflop_count = batch_count * spsv_gflop_count(m, nnz, diag);
+        double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = batch_count * csrsv_gbyte_count<T>(m, nnz);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::batch_count,
+                            batch_count,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::algorithm,
+                            hipsparse_spsvalg2string(alg),
+                            display_key_t::replan_time_ms,
+                            get_gpu_time_msec(replan_time_used),
+                            display_key_t::speedup,
+                            replan_time_used / gpu_time_used,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpSV_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    for(int j = 0; j < batch_count; ++j)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x[j]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y[j]));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPSV_UPDATE_CSR_HPP
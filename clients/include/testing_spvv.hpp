@@ -90,7 +90,7 @@ void testing_spvv_bad_arg(void)
 
     // SpVV
     void* buffer;
-    CHECK_HIP_ERROR(hipMalloc(&buffer, 100));
+    CHECK_HIP_ERROR(device_malloc_buffer(&buffer, 100));
 
     verify_hipsparse_status_invalid_handle(
         hipsparseSpVV(nullptr, opType, x, y, &result, dataType, buffer));
@@ -110,7 +110,7 @@ void testing_spvv_bad_arg(void)
     verify_hipsparse_status_success(hipsparseDestroySpVec(x), "Success");
     verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "Success");
 
-    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIP_ERROR(device_free_buffer(buffer));
 #endif
 }
 
@@ -180,7 +180,7 @@ hipsparseStatus_t testing_spvv(Arguments argus)
         hipsparseSpVV_bufferSize(handle, trans, x, y, &hresult, dataType, &bufferSize));
 
     void* externalBuffer;
-    CHECK_HIP_ERROR(hipMalloc(&externalBuffer, bufferSize));
+    CHECK_HIP_ERROR(device_malloc_buffer(&externalBuffer, bufferSize));
 
     if(argus.unit_check)
     {
@@ -235,17 +235,17 @@ hipsparseStatus_t testing_spvv(Arguments argus)
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
         }
 
-        double gpu_time_used = get_time_us();
-
         // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
+        auto hot_call = [&]() {
             CHECK_HIPSPARSE_ERROR(
                 hipsparseSpVV(handle, trans, x, y, &hresult, dataType, externalBuffer));
             CHECK_HIP_ERROR(hipStreamSynchronize(stream));
-        }
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        double gpu_time_used;
+        CHECK_HIPSPARSE_ERROR(
+            time_hot_calls(argus, handle, number_hot_calls, gpu_time_used, hot_call));
 
         double gflop_count = doti_gflop_count(nnz);
         double gbyte_count = doti_gbyte_count<T, T>(nnz);
@@ -263,7 +263,7 @@ hipsparseStatus_t testing_spvv(Arguments argus)
                             get_gpu_time_msec(gpu_time_used));
     }
 
-    CHECK_HIP_ERROR(hipFree(externalBuffer));
+    CHECK_HIP_ERROR(device_free_buffer(externalBuffer));
 
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpVec(x));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
@@ -25,6 +25,8 @@
 #ifndef UNIT_HPP
 #define UNIT_HPP
 
+#include "hipsparse_mixed_types.hpp"
+
 #include <hipsparse.h>
 
 /* =====================================================================
@@ -41,13 +43,39 @@
  * ==================================================== */
 
 /*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+// The whole matrix is compared first, a mismatch is then reported once with its summary
+// (number of failures, first failing element, max abs/rel error, max ULP distance).
 template <typename T>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
 
 template <typename T>
 void unit_check_near(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
 
+/*! \brief Summary of an element wise comparison between a reference and a result.
+ *  \details
+ *  The relative error is taken with respect to the reference, it falls back to the absolute
+ *  error where the reference is zero. The ULP distance counts the representable values between
+ *  the two elements, it is the absolute difference for integral types. Complex elements report
+ *  the worst of their real and imaginary parts.
+ */
+struct unit_check_summary
+{
+    int64_t  count{}; // number of compared elements
+    int64_t  nfailures{}; // number of elements outside of the tolerance
+    int64_t  first_failure{-1}; // offset i + j * lda of the first failing element, -1 if none
+    double   max_abs_error{};
+    double   max_rel_error{};
+    uint64_t max_ulp_distance{};
+};
+
+/*! \brief Compare two matrices with the tolerance of unit_check_general, without asserting. */
+template <typename T>
+unit_check_summary
+    unit_check_general_summary(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU);
+
+/*! \brief Compare two matrices with the tolerance of unit_check_near, without asserting. */
+template <typename T>
+unit_check_summary
+    unit_check_near_summary(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU);
+
 #endif // UNIT_HPP
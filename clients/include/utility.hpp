@@ -30,6 +30,7 @@
 #include <complex>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse/hipsparse.h>
+#include <map>
 #include <math.h>
 #include <sstream>
 #include <stdio.h>
@@ -39,6 +40,9 @@
 
 #include <iostream>
 
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_mixed_types.hpp"
+
 #ifdef GOOGLE_TEST
 #include "gtest/gtest.h"
 #endif
@@ -138,6 +142,24 @@ std::string hipsparse_exepath();
 
 #endif
 
+#ifdef GOOGLE_TEST
+// Status of a mixed precision test. A type combination the backend does not implement is
+// skipped, unless the AMD backend maps it to rocSPARSE, i.e. int8 values accumulated in int32 or
+// float and half or bfloat16 values accumulated in float, it must then run.
+#ifdef __HIP_PLATFORM_AMD__
+#define MIXED_PRECISION_REQUIRED(mapped_) (mapped_)
+#else
+#define MIXED_PRECISION_REQUIRED(mapped_) false
+#endif
+
+#define EXPECT_MIXED_PRECISION_STATUS(status_, mapped_)                                     \
+    if((status_) == HIPSPARSE_STATUS_NOT_SUPPORTED && !MIXED_PRECISION_REQUIRED(mapped_)) \
+    {                                                                                      \
+        GTEST_SKIP() << "type combination not supported by the backend";                  \
+    }                                                                                      \
+    EXPECT_EQ(status_, HIPSPARSE_STATUS_SUCCESS)
+#endif
+
 #ifdef __HIP_PLATFORM_NVIDIA__
 static inline hipComplex operator-(const hipComplex& op)
 {
@@ -1047,6 +1069,109 @@ int read_bin_matrix(const char*          filename,
     return 0;
 }
 
+/* ============================================================================================ */
+/*! \brief  Host matrix cache, matrices read from file are kept while it is enabled.
+ *  hipsparse-bench enables it to read each matrix of a suite only once.
+ */
+inline bool& hipsparse_matrix_cache_enabled()
+{
+    static bool s_enabled = false;
+    return s_enabled;
+}
+
+inline std::vector<void (*)()>& hipsparse_matrix_cache_registry()
+{
+    static std::vector<void (*)()> s_registry;
+    return s_registry;
+}
+
+template <typename I, typename J, typename T>
+struct hipsparse_matrix_cache
+{
+    struct entry
+    {
+        J              nrow;
+        J              ncol;
+        I              nnz;
+        std::vector<I> ptr;
+        std::vector<J> ind;
+        std::vector<T> val;
+    };
+
+    static std::map<std::string, entry>& entries()
+    {
+        static std::map<std::string, entry> s_entries;
+        static bool s_registered = (hipsparse_matrix_cache_registry().push_back(&clear), true);
+        (void)s_registered;
+        return s_entries;
+    }
+
+    static std::string
+        key(const char* format, const std::string& filename, hipsparseIndexBase_t base)
+    {
+        std::ostringstream os;
+        os << format << ":" << base << ":" << filename;
+        return os.str();
+    }
+
+    static bool find(const char*          format,
+                     const std::string&   filename,
+                     hipsparseIndexBase_t base,
+                     J&                   nrow,
+                     J&                   ncol,
+                     I&                   nnz,
+                     std::vector<I>&      ptr,
+                     std::vector<J>&      ind,
+                     std::vector<T>&      val)
+    {
+        if(!hipsparse_matrix_cache_enabled())
+        {
+            return false;
+        }
+        auto it = entries().find(key(format, filename, base));
+        if(it == entries().end())
+        {
+            return false;
+        }
+        nrow = it->second.nrow;
+        ncol = it->second.ncol;
+        nnz  = it->second.nnz;
+        ptr  = it->second.ptr;
+        ind  = it->second.ind;
+        val  = it->second.val;
+        return true;
+    }
+
+    static void insert(const char*           format,
+                       const std::string&    filename,
+                       hipsparseIndexBase_t  base,
+                       J                     nrow,
+                       J                     ncol,
+                       I                     nnz,
+                       const std::vector<I>& ptr,
+                       const std::vector<J>& ind,
+                       const std::vector<T>& val)
+    {
+        if(hipsparse_matrix_cache_enabled())
+        {
+            entries()[key(format, filename, base)] = entry{nrow, ncol, nnz, ptr, ind, val};
+        }
+    }
+
+    static void clear()
+    {
+        entries().clear();
+    }
+};
+
+inline void hipsparse_matrix_cache_clear()
+{
+    for(auto clear : hipsparse_matrix_cache_registry())
+    {
+        clear();
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Generate CSR matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
 template <typename I, typename J, typename T>
@@ -1088,6 +1213,13 @@ bool generate_csr_matrix(const std::string    filename,
     }
     else
     {
+        typedef hipsparse_matrix_cache<I, J, T> cache;
+        if(cache::find(
+               "csr", filename, idx_base, nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val))
+        {
+            return true;
+        }
+
         std::string extension = filename.substr(filename.find_last_of(".") + 1);
         if(extension == "bin")
         {
@@ -1095,6 +1227,8 @@ bool generate_csr_matrix(const std::string    filename,
                    filename.c_str(), nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
                == 0)
             {
+                cache::insert(
+                    "csr", filename, idx_base, nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val);
                 return true;
             }
         }
@@ -1128,6 +1262,15 @@ bool generate_csr_matrix(const std::string    filename,
                         csr_row_ptr[i + 1] += csr_row_ptr[i];
                     }
 
+                    cache::insert("csr",
+                                  filename,
+                                  idx_base,
+                                  nrow,
+                                  ncol,
+                                  nnz,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csr_val);
                     return true;
                 }
             }
@@ -1165,6 +1308,13 @@ bool generate_coo_matrix(const std::string    filename,
     }
     else
     {
+        typedef hipsparse_matrix_cache<I, I, T> cache;
+        if(cache::find(
+               "coo", filename, idx_base, nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val))
+        {
+            return true;
+        }
+
         std::string extension = filename.substr(filename.find_last_of(".") + 1);
         if(extension == "bin")
         {
@@ -1185,6 +1335,8 @@ bool generate_coo_matrix(const std::string    filename,
                     }
                 }
 
+                cache::insert(
+                    "coo", filename, idx_base, nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val);
                 return true;
             }
         }
@@ -1204,6 +1356,15 @@ bool generate_coo_matrix(const std::string    filename,
                 if(nnz_count < std::numeric_limits<I>::max())
                 {
                     nnz = (I)nnz_count;
+                    cache::insert("coo",
+                                  filename,
+                                  idx_base,
+                                  nrow,
+                                  ncol,
+                                  nnz,
+                                  coo_row_ind,
+                                  coo_col_ind,
+                                  coo_val);
                     return true;
                 }
             }
@@ -2644,6 +2805,9 @@ inline void host_csrmv(hipsparseOperation_t trans,
         else
             WF_SIZE = 64;
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(J i = 0; i < M; ++i)
         {
             I row_begin = csr_row_ptr[i] - base;
@@ -2685,6 +2849,9 @@ inline void host_csrmv(hipsparseOperation_t trans,
     else
     {
         // Scale y with beta
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(J i = 0; i < N; ++i)
         {
             y[i] = testing_mult(y[i], beta);
@@ -2710,6 +2877,106 @@ inline void host_csrmv(hipsparseOperation_t trans,
     }
 }
 
+/* ============================================================================================ */
+/*! \brief  Mixed precision SpMV reference, the values of A, x and y are widened to the compute
+ *  type C, the result is narrowed to the type of y. */
+template <typename I, typename J, typename A, typename Y, typename C>
+inline void host_csrmv_mixed(hipsparseOperation_t trans,
+                             J                    M,
+                             J                    N,
+                             I                    nnz,
+                             C                    alpha,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             const A*             csr_val,
+                             const A*             x,
+                             C                    beta,
+                             Y*                   y,
+                             hipsparseIndexBase_t base)
+{
+    J ysize = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+
+    std::vector<C> sum(ysize, static_cast<C>(0));
+
+    for(J i = 0; i < M; ++i)
+    {
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+            C val = static_cast<C>(hipsparse_widen(csr_val[j]));
+
+            if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+            {
+                sum[i] += val * static_cast<C>(hipsparse_widen(x[col]));
+            }
+            else
+            {
+                sum[col] += val * static_cast<C>(hipsparse_widen(x[i]));
+            }
+        }
+    }
+
+    for(J i = 0; i < ysize; ++i)
+    {
+        C old = (beta == static_cast<C>(0)) ? static_cast<C>(0)
+                                            : static_cast<C>(hipsparse_widen(y[i]));
+        y[i]  = hipsparse_narrow<Y>(alpha * sum[i] + beta * old);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Mixed precision SpMM reference on column major B and C, see host_csrmv_mixed. */
+template <typename I, typename J, typename A, typename Y, typename C>
+inline void host_csrmm_mixed(hipsparseOperation_t trans,
+                             J                    M,
+                             J                    N,
+                             J                    K,
+                             C                    alpha,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             const A*             csr_val,
+                             const A*             B,
+                             J                    ldb,
+                             C                    beta,
+                             Y*                   C_val,
+                             J                    ldc,
+                             hipsparseIndexBase_t base)
+{
+    // M x K is the size of op(A), the CSR matrix has K rows if it is transposed
+    bool notrans = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    J    rows    = notrans ? M : K;
+
+    std::vector<C> sum(static_cast<size_t>(M) * N, static_cast<C>(0));
+
+    for(J i = 0; i < rows; ++i)
+    {
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+            C val = static_cast<C>(hipsparse_widen(csr_val[j]));
+            J row = notrans ? i : col;
+            J k   = notrans ? col : i;
+
+            for(J n = 0; n < N; ++n)
+            {
+                sum[row + static_cast<size_t>(n) * M]
+                    += val * static_cast<C>(hipsparse_widen(B[k + static_cast<size_t>(n) * ldb]));
+            }
+        }
+    }
+
+    for(J n = 0; n < N; ++n)
+    {
+        for(J i = 0; i < M; ++i)
+        {
+            Y& c   = C_val[i + static_cast<size_t>(n) * ldc];
+            C  old = (beta == static_cast<C>(0)) ? static_cast<C>(0)
+                                                 : static_cast<C>(hipsparse_widen(c));
+            c      = hipsparse_narrow<Y>(alpha * sum[i + static_cast<size_t>(n) * M] + beta * old);
+        }
+    }
+}
+
 template <typename T>
 inline void host_bsrmm(int                     Mb,
                        int                     N,
@@ -2856,6 +3123,9 @@ void host_csrmm(J                    M,
     else
     {
         // scale C by beta
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
         for(J i = 0; i < K; i++)
         {
             for(J j = 0; j < N; ++j)
@@ -2865,13 +3135,18 @@ void host_csrmm(J                    M,
             }
         }
 
-        for(J i = 0; i < M; i++)
+        // Every column of C only depends on the same column of B, the accumulation order of
+        // each entry of C stays the one of a serial loop over the rows of A.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(J j = 0; j < N; ++j)
         {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
-
-            for(J j = 0; j < N; ++j)
+            for(J i = 0; i < M; i++)
             {
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
+
                 for(I k = row_begin; k < row_end; ++k)
                 {
                     J col = csr_col_ind_A[k] - base;
@@ -6597,6 +6872,93 @@ static void host_csrgemm2(J                    m,
     }
 }
 
+/* ============================================================================================ */
+/*! \brief  Compute the values of a sparse matrix sparse matrix multiplication, the sparsity
+ *          pattern of C being known. */
+template <typename I, typename J, typename T>
+static void host_csrgemm2_numeric(J                    m,
+                                  J                    n,
+                                  J                    k,
+                                  const T*             alpha,
+                                  const I*             csr_row_ptr_A,
+                                  const J*             csr_col_ind_A,
+                                  const T*             csr_val_A,
+                                  const I*             csr_row_ptr_B,
+                                  const J*             csr_col_ind_B,
+                                  const T*             csr_val_B,
+                                  const T*             beta,
+                                  const I*             csr_row_ptr_D,
+                                  const J*             csr_col_ind_D,
+                                  const T*             csr_val_D,
+                                  const I*             csr_row_ptr_C,
+                                  const J*             csr_col_ind_C,
+                                  T*                   csr_val_C,
+                                  hipsparseIndexBase_t idx_base_A,
+                                  hipsparseIndexBase_t idx_base_B,
+                                  hipsparseIndexBase_t idx_base_C,
+                                  hipsparseIndexBase_t idx_base_D)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Position of each column in the current row of C
+        std::vector<I> pos(n, -1);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for(J i = 0; i < m; ++i)
+        {
+            I row_begin_C = csr_row_ptr_C[i] - idx_base_C;
+            I row_end_C   = csr_row_ptr_C[i + 1] - idx_base_C;
+
+            for(I j = row_begin_C; j < row_end_C; ++j)
+            {
+                pos[csr_col_ind_C[j] - idx_base_C] = j;
+                csr_val_C[j]                       = make_DataType<T>(0);
+            }
+
+            if(alpha)
+            {
+                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
+                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
+
+                // Loop over columns of A
+                for(I j = row_begin_A; j < row_end_A; ++j)
+                {
+                    J col_A = csr_col_ind_A[j] - idx_base_A;
+                    T val_A = testing_mult(*alpha, csr_val_A[j]);
+
+                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                    // Accumulate the products into the existing entries of C
+                    for(I l = row_begin_B; l < row_end_B; ++l)
+                    {
+                        I idx = pos[csr_col_ind_B[l] - idx_base_B];
+
+                        csr_val_C[idx] = csr_val_C[idx] + testing_mult(val_A, csr_val_B[l]);
+                    }
+                }
+            }
+
+            if(beta)
+            {
+                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
+                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
+
+                for(I j = row_begin_D; j < row_end_D; ++j)
+                {
+                    I idx = pos[csr_col_ind_D[j] - idx_base_D];
+
+                    csr_val_C[idx] = csr_val_C[idx] + testing_mult(*beta, csr_val_D[j]);
+                }
+            }
+        }
+    }
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -6626,6 +6988,212 @@ double get_time_us_sync(hipStream_t stream);
 }
 #endif
 
+/* ============================================================================================ */
+/*! \brief  Cache flush of the cold mode (--cold): a device buffer larger than the last level
+ *  cache is overwritten before each timed call, so that the operands are not cache resident.
+ *  The flush is a no-op if the cold mode is disabled.
+ */
+class hipsparse_cache_flush
+{
+public:
+    explicit hipsparse_cache_flush(const Arguments& argus);
+    ~hipsparse_cache_flush();
+
+    hipsparse_cache_flush(const hipsparse_cache_flush&) = delete;
+    hipsparse_cache_flush& operator=(const hipsparse_cache_flush&) = delete;
+
+    bool enabled() const
+    {
+        return this->m_buffer != nullptr;
+    }
+
+    void operator()(hipStream_t stream);
+
+private:
+    void*  m_buffer{};
+    size_t m_size{};
+    int    m_count{};
+};
+
+/*! \brief  Record the mean latency of a call in the concurrent mode, implemented by the clients.
+ */
+hipsparseStatus_t hipsparse_record_latency(int streams, double msec);
+
+/*! \brief  Concurrent mode of time_hot_calls (--streams K > 1).
+ *  The calls are dispatched round-robin to K handles, each with its own stream, and each handle
+ *  runs \p number_hot_calls calls. \p handle is swapped in place before each call, so that
+ *  \p call, which captures it by reference, runs on the handle of its turn; it is restored
+ *  before returning. \p gpu_time_used is the wall time of the batch divided by the number of
+ *  calls, i.e. the inverse of the aggregate throughput. The mean latency of a call, from events
+ *  recorded around it on its stream, is printed or recorded with hipsparse_record_latency.
+ */
+template <typename F>
+hipsparseStatus_t time_concurrent_calls(const Arguments&   argus,
+                                        hipsparseHandle_t& handle,
+                                        int                number_hot_calls,
+                                        double&            gpu_time_used,
+                                        F                  call)
+{
+    const int nstreams = argus.streams;
+    const int ncalls   = number_hot_calls * nstreams;
+
+    hipsparsePointerMode_t mode;
+    hipsparseStatus_t      status = hipsparseGetPointerMode(handle, &mode);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const hipsparseHandle_t        base = handle;
+    std::vector<hipsparseHandle_t> handles(nstreams, nullptr);
+    std::vector<hipStream_t>       streams(nstreams, nullptr);
+    for(int k = 0; k < nstreams && status == HIPSPARSE_STATUS_SUCCESS; ++k)
+    {
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&streams[k], hipStreamNonBlocking));
+        status = hipsparseCreate(&handles[k]);
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparseSetStream(handles[k], streams[k]);
+        }
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparseSetPointerMode(handles[k], mode);
+        }
+    }
+
+    std::vector<hipEvent_t> start(ncalls), stop(ncalls);
+    for(int i = 0; i < ncalls; ++i)
+    {
+        CHECK_HIP_ERROR(hipEventCreate(&start[i]));
+        CHECK_HIP_ERROR(hipEventCreate(&stop[i]));
+    }
+
+    //
+    // Warm up every handle.
+    //
+    for(int k = 0; k < nstreams && status == HIPSPARSE_STATUS_SUCCESS; ++k)
+    {
+        handle = handles[k];
+        status = call();
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    double wall_time_used = get_time_us();
+    for(int i = 0; i < ncalls && status == HIPSPARSE_STATUS_SUCCESS; ++i)
+    {
+        const int k = i % nstreams;
+        handle      = handles[k];
+        CHECK_HIP_ERROR(hipEventRecord(start[i], streams[k]));
+        status = call();
+        CHECK_HIP_ERROR(hipEventRecord(stop[i], streams[k]));
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    wall_time_used = get_time_us() - wall_time_used;
+    handle         = base;
+
+    double latency = 0.0;
+    for(int i = 0; i < ncalls; ++i)
+    {
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            float msec;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&msec, start[i], stop[i]));
+            latency += msec;
+        }
+        CHECK_HIP_ERROR(hipEventDestroy(start[i]));
+        CHECK_HIP_ERROR(hipEventDestroy(stop[i]));
+    }
+
+    for(int k = 0; k < nstreams; ++k)
+    {
+        if(handles[k] != nullptr)
+        {
+            hipsparseDestroy(handles[k]);
+        }
+        if(streams[k] != nullptr)
+        {
+            CHECK_HIP_ERROR(hipStreamDestroy(streams[k]));
+        }
+    }
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    gpu_time_used = wall_time_used / ncalls;
+    latency /= ncalls;
+    return hipsparse_record_latency(nstreams, latency);
+}
+
+/*! \brief  Time the hot calls of a benchmark, return the average time per call in microseconds.
+ *  In cold mode, the caches are flushed before each call and each call is timed with events
+ *  on the stream of the handle, so that the flush is excluded from the timing.
+ *  In concurrent mode (--streams K > 1), see time_concurrent_calls, the cold mode is ignored.
+ */
+template <typename F>
+hipsparseStatus_t time_hot_calls(const Arguments&   argus,
+                                 hipsparseHandle_t& handle,
+                                 int                number_hot_calls,
+                                 double&            gpu_time_used,
+                                 F                  call)
+{
+    if(argus.streams > 1)
+    {
+        return time_concurrent_calls(argus, handle, number_hot_calls, gpu_time_used, call);
+    }
+
+    hipsparse_cache_flush flush(argus);
+    if(!flush.enabled())
+    {
+        gpu_time_used = get_time_us();
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            hipsparseStatus_t status = call();
+            if(status != HIPSPARSE_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipStream_t stream;
+    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    gpu_time_used = 0.0;
+    for(int iter = 0; iter < number_hot_calls; ++iter)
+    {
+        flush(stream);
+        CHECK_HIP_ERROR(hipEventRecord(start, stream));
+        status = call();
+        CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            break;
+        }
+        CHECK_HIP_ERROR(hipEventSynchronize(stop));
+
+        float msec;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&msec, start, stop));
+        gpu_time_used += msec * 1.0e3;
+    }
+    gpu_time_used /= number_hot_calls;
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    return status;
+}
+
 inline void missing_file_error_message(const char* filename)
 {
     std::cerr << "#" << std::endl;
@@ -6717,6 +7285,24 @@ hipsparseIndexType_t getIndexType()
 template <typename T>
 hipDataType getDataType()
 {
+    // Value types of the mixed precision tests
+    if(typeid(T) == typeid(hipsparse_half))
+    {
+        return HIP_R_16F;
+    }
+    if(typeid(T) == typeid(hipsparse_bfloat16))
+    {
+        return HIP_R_16BF;
+    }
+    if(typeid(T) == typeid(int8_t))
+    {
+        return HIP_R_8I;
+    }
+    if(typeid(T) == typeid(int32_t))
+    {
+        return HIP_R_32I;
+    }
+
     return (typeid(T) == typeid(float))
                ? HIP_R_32F
                : ((typeid(T) == typeid(double))
@@ -161,6 +161,11 @@ hipsparseStatus_t hipsparse_record_timing(double msec, double gflops, double gbs
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparse_record_latency(int streams, double msec)
+{
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 bool display_timing_info_is_stdout_disabled()
 {
     return HIPSPARSE_STATUS_SUCCESS;
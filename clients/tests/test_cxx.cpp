@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_cxx.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, double, double, hipsparseOperation_t, hipsparseIndexBase_t>
+    cxx_tuple;
+
+int cxx_M_range[] = {50, 73};
+int cxx_N_range[] = {9, 84};
+int cxx_K_range[] = {51};
+
+std::vector<double> cxx_alpha_range = {2.0};
+std::vector<double> cxx_beta_range  = {0.0, 1.0};
+
+hipsparseOperation_t cxx_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseIndexBase_t cxx_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_cxx : public testing::TestWithParam<cxx_tuple>
+{
+protected:
+    parameterized_cxx() {}
+    virtual ~parameterized_cxx() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_cxx_arguments(cxx_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.K      = std::get<2>(tup);
+    arg.alpha  = std::get<3>(tup);
+    arg.beta   = std::get<4>(tup);
+    arg.transA = std::get<5>(tup);
+    arg.baseA  = std::get<6>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+TEST(cxx_bad_arg, cxx)
+{
+    testing_cxx_bad_arg();
+}
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+TEST_P(parameterized_cxx, cxx_spmv_i32_float)
+{
+    Arguments arg = setup_cxx_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_cxx_spmv<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_cxx, cxx_spmv_i64_double)
+{
+    Arguments arg = setup_cxx_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_cxx_spmv<int64_t, int32_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_cxx, cxx_spmv_i32_double_complex)
+{
+    Arguments arg = setup_cxx_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_cxx_spmv<int32_t, int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_cxx, cxx_spmm_i32_float)
+{
+    Arguments arg = setup_cxx_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_cxx_spmm<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_cxx, cxx_spmm_i64_float_complex)
+{
+    Arguments arg = setup_cxx_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_cxx_spmm<int64_t, int64_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(cxx,
+                         parameterized_cxx,
+                         testing::Combine(testing::ValuesIn(cxx_M_range),
+                                          testing::ValuesIn(cxx_N_range),
+                                          testing::ValuesIn(cxx_K_range),
+                                          testing::ValuesIn(cxx_alpha_range),
+                                          testing::ValuesIn(cxx_beta_range),
+                                          testing::ValuesIn(cxx_transA_range),
+                                          testing::ValuesIn(cxx_idxbase_range)));
+#endif
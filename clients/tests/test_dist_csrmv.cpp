@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_dist_csrmv.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+typedef std::tuple<int, int, double, double, hipsparseIndexBase_t>         dist_csrmv_tuple;
+typedef std::tuple<int, double, double, hipsparseIndexBase_t, std::string> dist_csrmv_bin_tuple;
+
+int dist_csrmv_M_range[]     = {1, 50, 647};
+int dist_csrmv_ranks_range[] = {1, 2, 3, 4, 7};
+
+std::vector<double> dist_csrmv_alpha_range = {2.0};
+std::vector<double> dist_csrmv_beta_range  = {0.0, 1.0};
+
+hipsparseIndexBase_t dist_csrmv_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string dist_csrmv_bin[] = {"nos1.bin", "nos3.bin", "nos5.bin"};
+
+class parameterized_dist_csrmv : public testing::TestWithParam<dist_csrmv_tuple>
+{
+protected:
+    parameterized_dist_csrmv() {}
+    virtual ~parameterized_dist_csrmv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_dist_csrmv_bin : public testing::TestWithParam<dist_csrmv_bin_tuple>
+{
+protected:
+    parameterized_dist_csrmv_bin() {}
+    virtual ~parameterized_dist_csrmv_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_dist_csrmv_arguments(dist_csrmv_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.ranks  = std::get<1>(tup);
+    arg.alpha  = std::get<2>(tup);
+    arg.beta   = std::get<3>(tup);
+    arg.baseA  = std::get<4>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+Arguments setup_dist_csrmv_arguments(dist_csrmv_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M      = -99;
+    arg.ranks  = std::get<0>(tup);
+    arg.alpha  = std::get<1>(tup);
+    arg.beta   = std::get<2>(tup);
+    arg.baseA  = std::get<3>(tup);
+    arg.timing = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<4>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+TEST(dist_csrmv_bad_arg, dist_csrmv_float)
+{
+    testing_dist_csrmv_bad_arg();
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_i32_float)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_i64_double)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_i32_float_complex)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int32_t, int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_i64_i32_double_complex)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int64_t, int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_failure_float)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv_failure<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv, dist_csrmv_failure_i64_double)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv_failure<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv_bin, dist_csrmv_bin_float)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_dist_csrmv_bin, dist_csrmv_bin_double)
+{
+    Arguments arg = setup_dist_csrmv_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_dist_csrmv<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(dist_csrmv,
+                         parameterized_dist_csrmv,
+                         testing::Combine(testing::ValuesIn(dist_csrmv_M_range),
+                                          testing::ValuesIn(dist_csrmv_ranks_range),
+                                          testing::ValuesIn(dist_csrmv_alpha_range),
+                                          testing::ValuesIn(dist_csrmv_beta_range),
+                                          testing::ValuesIn(dist_csrmv_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(dist_csrmv_bin,
+                         parameterized_dist_csrmv_bin,
+                         testing::Combine(testing::ValuesIn(dist_csrmv_ranks_range),
+                                          testing::ValuesIn(dist_csrmv_alpha_range),
+                                          testing::ValuesIn(dist_csrmv_beta_range),
+                                          testing::ValuesIn(dist_csrmv_idxbase_range),
+                                          testing::ValuesIn(dist_csrmv_bin)));
+#endif
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2019 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_profile.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+int profile_ncalls_range[] = {1, 3, 10};
+
+class parameterized_profile : public testing::TestWithParam<int>
+{
+protected:
+    parameterized_profile() {}
+    virtual ~parameterized_profile() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_profile_arguments(int ncalls)
+{
+    Arguments arg;
+    arg.iters  = ncalls;
+    arg.timing = 0;
+    return arg;
+}
+
+TEST(profile_bad_arg, profile)
+{
+    testing_profile_bad_arg();
+}
+
+TEST_P(parameterized_profile, profile)
+{
+    Arguments arg = setup_profile_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_profile(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(profile, parameterized_profile, testing::ValuesIn(profile_ncalls_range));
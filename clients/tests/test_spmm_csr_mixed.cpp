@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmm_csr_mixed.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, double, double, hipsparseOperation_t, hipsparseIndexBase_t>
+    spmm_csr_mixed_tuple;
+
+int spmm_csr_mixed_M_range[] = {50};
+int spmm_csr_mixed_N_range[] = {5};
+int spmm_csr_mixed_K_range[] = {84};
+
+std::vector<double> spmm_csr_mixed_alpha_range = {2.0};
+std::vector<double> spmm_csr_mixed_beta_range  = {0.0, 1.0};
+
+hipsparseOperation_t spmm_csr_mixed_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseIndexBase_t spmm_csr_mixed_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_spmm_csr_mixed : public testing::TestWithParam<spmm_csr_mixed_tuple>
+{
+protected:
+    parameterized_spmm_csr_mixed() {}
+    virtual ~parameterized_spmm_csr_mixed() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmm_csr_mixed_arguments(spmm_csr_mixed_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.transA   = std::get<5>(tup);
+    arg.baseA    = std::get<6>(tup);
+    arg.spmm_alg = HIPSPARSE_SPMM_ALG_DEFAULT;
+    arg.timing   = 0;
+    return arg;
+}
+
+// Mixed precision SpMM, the names give the value type of A and B, then the type of C
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_i8_i32)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spmm_csr_mixed<int32_t, int32_t, int8_t, int32_t, int32_t>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, true);
+}
+
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_i8_f32)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_csr_mixed<int32_t, int32_t, int8_t, float, float>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, true);
+}
+
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_f16_f32)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spmm_csr_mixed<int32_t, int32_t, hipsparse_half, float, float>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, true);
+}
+
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_f16_f16)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spmm_csr_mixed<int32_t, int32_t, hipsparse_half, hipsparse_half, float>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, false);
+}
+
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_bf16_f32)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spmm_csr_mixed<int32_t, int32_t, hipsparse_bfloat16, float, float>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, true);
+}
+
+TEST_P(parameterized_spmm_csr_mixed, spmm_csr_mixed_bf16_bf16)
+{
+    Arguments arg = setup_spmm_csr_mixed_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_csr_mixed<int32_t,
+                                                      int32_t,
+                                                      hipsparse_bfloat16,
+                                                      hipsparse_bfloat16,
+                                                      float>(arg);
+    EXPECT_MIXED_PRECISION_STATUS(status, false);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmm_csr_mixed,
+                         parameterized_spmm_csr_mixed,
+                         testing::Combine(testing::ValuesIn(spmm_csr_mixed_M_range),
+                                          testing::ValuesIn(spmm_csr_mixed_N_range),
+                                          testing::ValuesIn(spmm_csr_mixed_K_range),
+                                          testing::ValuesIn(spmm_csr_mixed_alpha_range),
+                                          testing::ValuesIn(spmm_csr_mixed_beta_range),
+                                          testing::ValuesIn(spmm_csr_mixed_transA_range),
+                                          testing::ValuesIn(spmm_csr_mixed_idxbase_range)));
+#endif
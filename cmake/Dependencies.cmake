@@ -34,7 +34,17 @@ else( )
 endif( )
 
 # Either rocSPARSE or cuSPARSE is required
-if(NOT USE_CUDA)
+if(USE_HOST)
+  # The host backend only uses the HIP headers, for the types of the API
+  find_path(HIP_INCLUDE_DIR hip/hip_runtime_api.h
+            PATHS ${HIP_PATH}/include ${ROCM_PATH}/include /opt/rocm/include)
+  if(NOT HIP_INCLUDE_DIR)
+    message(FATAL_ERROR "The HIP headers are required, set HIP_PATH or HIP_INCLUDE_DIR")
+  endif()
+
+  # The host backend kernels run in parallel if OpenMP is available
+  find_package(OpenMP QUIET)
+elseif(NOT USE_CUDA)
   if(WIN32)
         find_package(hip REQUIRED CONFIG PATHS ${HIP_PATH} ${ROCM_PATH})
         if( CUSTOM_ROCSPARSE )
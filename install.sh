@@ -21,6 +21,8 @@ function display_help()
   echo "    [--codecoverage] build with code coverage profiling enabled"
   echo "    [--compiler] specify host compiler"
   echo "    [--cuda] build library for cuda backend"
+  echo "    [--host] build library for host (CPU) backend"
+  echo "    [--stubs] build library against stub HIP runtime and rocSPARSE libraries, with hipsparse-overhead"
   echo "    [--static] build static library"
   echo "    [--address-sanitizer] build with address sanitizer enabled. Uses hip-clang to compile"
   echo "    [--matrices-dir] existing client matrices directory"
@@ -260,6 +262,8 @@ install_package=false
 install_dependencies=false
 build_clients=false
 build_cuda=false
+build_host=false
+build_stubs=false
 build_static=false
 build_release=true
 build_release_debug=false
@@ -278,7 +282,7 @@ compiler=${CXX}
 # check if we have a modern version of getopt that can handle whitespace and long parameters
 getopt -T
 if [[ $? -eq 4 ]]; then
-  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,compiler:,cuda,static,relocatable,codecoverage,relwithdebinfo,address-sanitizer,matrices-dir:,matrices-dir-install:,rm-legacy-include-dir --options hicdgrk -- "$@")
+  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,clients,dependencies,debug,compiler:,cuda,host,stubs,static,relocatable,codecoverage,relwithdebinfo,address-sanitizer,matrices-dir:,matrices-dir-install:,rm-legacy-include-dir --options hicdgrk -- "$@")
 else
   echo "Need a new version of getopt"
   exit 1
@@ -318,6 +322,12 @@ while true; do
     --cuda)
         build_cuda=true
         shift ;;
+    --host)
+        build_host=true
+        shift ;;
+    --stubs)
+        build_stubs=true
+        shift ;;
     --static)
         build_static=true
         shift ;;
@@ -524,6 +534,16 @@ pushd .
     cmake_common_options="${cmake_common_options} -DUSE_CUDA=ON"
   fi
 
+  # host
+  if [[ "${build_host}" == true ]]; then
+    cmake_common_options="${cmake_common_options} -DUSE_HOST=ON"
+  fi
+
+  # stubs
+  if [[ "${build_stubs}" == true ]]; then
+    cmake_common_options="${cmake_common_options} -DUSE_STUBS=ON"
+  fi
+
   # Build library
   if [[ "${build_relocatable}" == true ]]; then
     CXX=${compiler} ${cmake_executable} ${cmake_common_options} ${cmake_client_options} \
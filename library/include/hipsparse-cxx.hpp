@@ -0,0 +1,1078 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+/*! \file
+ *  \brief hipsparse-cxx.hpp provides a header-only C++ interface on top of hipsparse.h
+ */
+
+#ifndef HIPSPARSE_CXX_HPP
+#define HIPSPARSE_CXX_HPP
+
+#include "hipsparse.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace hipsparse
+{
+    namespace cxx
+    {
+        /*! \ingroup cxx_module
+         *  \brief Exception thrown by the C++ interface
+         *
+         *  \details
+         *  Every function of the C++ interface throws an \p error when the underlying
+         *  hipSPARSE or HIP call fails. \p status() returns the hipSPARSE status.
+         */
+        class error : public std::runtime_error
+        {
+        public:
+            explicit error(hipsparseStatus_t status)
+                : std::runtime_error(hipsparseGetErrorString(status))
+                , status_(status)
+            {
+            }
+
+            hipsparseStatus_t status() const noexcept
+            {
+                return status_;
+            }
+
+        private:
+            hipsparseStatus_t status_;
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Throw an \p error if \p status is not \ref HIPSPARSE_STATUS_SUCCESS
+         */
+        inline void check(hipsparseStatus_t status)
+        {
+            if(status != HIPSPARSE_STATUS_SUCCESS)
+            {
+                throw error(status);
+            }
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief \p hipDataType of a value type
+         *
+         *  \details
+         *  \p dataType<T>::value is the \p hipDataType describing values of type \p T. It is
+         *  specialized for the types supported by the generic API; other 16 bit storage types
+         *  can be added by specializing it. Using an unsupported type is a compile error.
+         */
+        template <typename T>
+        struct dataType;
+
+        template <typename T>
+        struct dataType<const T> : dataType<T>
+        {
+        };
+
+        template <>
+        struct dataType<float> : std::integral_constant<hipDataType, HIP_R_32F>
+        {
+        };
+
+        template <>
+        struct dataType<double> : std::integral_constant<hipDataType, HIP_R_64F>
+        {
+        };
+
+        template <>
+        struct dataType<hipComplex> : std::integral_constant<hipDataType, HIP_C_32F>
+        {
+        };
+
+        template <>
+        struct dataType<hipDoubleComplex> : std::integral_constant<hipDataType, HIP_C_64F>
+        {
+        };
+
+        template <>
+        struct dataType<int8_t> : std::integral_constant<hipDataType, HIP_R_8I>
+        {
+        };
+
+        template <>
+        struct dataType<uint8_t> : std::integral_constant<hipDataType, HIP_R_8U>
+        {
+        };
+
+        template <>
+        struct dataType<int32_t> : std::integral_constant<hipDataType, HIP_R_32I>
+        {
+        };
+
+        template <>
+        struct dataType<uint32_t> : std::integral_constant<hipDataType, HIP_R_32U>
+        {
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief \p hipsparseIndexType_t of an index type
+         *
+         *  \details
+         *  \p indexType<I>::value is the \p hipsparseIndexType_t describing indices of type
+         *  \p I. Using an unsupported type is a compile error.
+         */
+        template <typename I>
+        struct indexType;
+
+        template <typename I>
+        struct indexType<const I> : indexType<I>
+        {
+        };
+
+        template <>
+        struct indexType<uint16_t>
+            : std::integral_constant<hipsparseIndexType_t, HIPSPARSE_INDEX_16U>
+        {
+        };
+
+        template <>
+        struct indexType<int32_t>
+            : std::integral_constant<hipsparseIndexType_t, HIPSPARSE_INDEX_32I>
+        {
+        };
+
+        template <>
+        struct indexType<int64_t>
+            : std::integral_constant<hipsparseIndexType_t, HIPSPARSE_INDEX_64I>
+        {
+        };
+
+        namespace detail
+        {
+            // Move-only owner of an opaque hipSPARSE object, D destroys it.
+            template <typename H, typename D>
+            class resource
+            {
+            public:
+                resource() noexcept = default;
+
+                ~resource()
+                {
+                    reset();
+                }
+
+                resource(resource&& other) noexcept
+                    : h_(other.release())
+                {
+                }
+
+                resource& operator=(resource&& other) noexcept
+                {
+                    if(this != &other)
+                    {
+                        reset(other.release());
+                    }
+                    return *this;
+                }
+
+                H get() const noexcept
+                {
+                    return h_;
+                }
+
+                operator H() const noexcept
+                {
+                    return h_;
+                }
+
+                H release() noexcept
+                {
+                    H h = h_;
+                    h_  = nullptr;
+                    return h;
+                }
+
+                void reset(H h = nullptr) noexcept
+                {
+                    if(h_ != nullptr)
+                    {
+                        D()(h_);
+                    }
+                    h_ = h;
+                }
+
+            protected:
+                H h_ = nullptr;
+            };
+
+            struct handleDeleter
+            {
+                void operator()(hipsparseHandle_t h) const noexcept
+                {
+                    hipsparseDestroy(h);
+                }
+            };
+
+            struct matDescrDeleter
+            {
+                void operator()(hipsparseMatDescr_t h) const noexcept
+                {
+                    hipsparseDestroyMatDescr(h);
+                }
+            };
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Owning hipSPARSE handle
+         *
+         *  \details
+         *  \p handle creates a hipSPARSE handle and destroys it when it goes out of scope. It
+         *  converts implicitly to \p hipsparseHandle_t, hence it can be passed to the C API.
+         */
+        class handle : public detail::resource<hipsparseHandle_t, detail::handleDeleter>
+        {
+        public:
+            handle()
+            {
+                check(hipsparseCreate(&h_));
+            }
+
+            explicit handle(hipStream_t stream)
+                : handle()
+            {
+                setStream(stream);
+            }
+
+            void setStream(hipStream_t stream)
+            {
+                check(hipsparseSetStream(h_, stream));
+            }
+
+            hipStream_t stream() const
+            {
+                hipStream_t stream;
+                check(hipsparseGetStream(h_, &stream));
+                return stream;
+            }
+
+            void setPointerMode(hipsparsePointerMode_t mode)
+            {
+                check(hipsparseSetPointerMode(h_, mode));
+            }
+
+            hipsparsePointerMode_t pointerMode() const
+            {
+                hipsparsePointerMode_t mode;
+                check(hipsparseGetPointerMode(h_, &mode));
+                return mode;
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning matrix descriptor of the legacy API
+         */
+        class matDescr : public detail::resource<hipsparseMatDescr_t, detail::matDescrDeleter>
+        {
+        public:
+            matDescr()
+            {
+                check(hipsparseCreateMatDescr(&h_));
+            }
+
+            void setType(hipsparseMatrixType_t type)
+            {
+                check(hipsparseSetMatType(h_, type));
+            }
+
+            void setFillMode(hipsparseFillMode_t fillMode)
+            {
+                check(hipsparseSetMatFillMode(h_, fillMode));
+            }
+
+            void setDiagType(hipsparseDiagType_t diagType)
+            {
+                check(hipsparseSetMatDiagType(h_, diagType));
+            }
+
+            void setIndexBase(hipsparseIndexBase_t base)
+            {
+                check(hipsparseSetMatIndexBase(h_, base));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Typed device array
+         *
+         *  \details
+         *  \p deviceArray owns \p size() elements of type \p T allocated with \p hipMalloc.
+         *  \p resize only reallocates when the array grows, so an array used as temporary
+         *  storage in a loop is allocated once. Its contents are not preserved when it is
+         *  reallocated. The copies to and from the host are blocking.
+         */
+        template <typename T>
+        class deviceArray
+        {
+        public:
+            deviceArray() noexcept = default;
+
+            explicit deviceArray(size_t size)
+            {
+                resize(size);
+            }
+
+            explicit deviceArray(const std::vector<T>& host)
+            {
+                assign(host);
+            }
+
+            ~deviceArray()
+            {
+                if(data_ != nullptr)
+                {
+                    hipFree(data_);
+                }
+            }
+
+            deviceArray(deviceArray&& other) noexcept
+                : data_(other.data_)
+                , size_(other.size_)
+                , capacity_(other.capacity_)
+            {
+                other.data_     = nullptr;
+                other.size_     = 0;
+                other.capacity_ = 0;
+            }
+
+            deviceArray& operator=(deviceArray&& other) noexcept
+            {
+                if(this != &other)
+                {
+                    if(data_ != nullptr)
+                    {
+                        hipFree(data_);
+                    }
+
+                    data_     = other.data_;
+                    size_     = other.size_;
+                    capacity_ = other.capacity_;
+
+                    other.data_     = nullptr;
+                    other.size_     = 0;
+                    other.capacity_ = 0;
+                }
+                return *this;
+            }
+
+            T* data() noexcept
+            {
+                return data_;
+            }
+
+            const T* data() const noexcept
+            {
+                return data_;
+            }
+
+            size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            size_t sizeInBytes() const noexcept
+            {
+                return size_ * sizeof(T);
+            }
+
+            void resize(size_t size)
+            {
+                if(size > capacity_)
+                {
+                    void* data = nullptr;
+                    if(hipMalloc(&data, size * sizeof(T)) != hipSuccess)
+                    {
+                        throw error(HIPSPARSE_STATUS_ALLOC_FAILED);
+                    }
+
+                    if(data_ != nullptr)
+                    {
+                        hipFree(data_);
+                    }
+
+                    data_     = static_cast<T*>(data);
+                    capacity_ = size;
+                }
+
+                size_ = size;
+            }
+
+            void assign(const std::vector<T>& host)
+            {
+                resize(host.size());
+                copy(data_, host.data(), sizeInBytes(), hipMemcpyHostToDevice);
+            }
+
+            std::vector<T> toHost() const
+            {
+                std::vector<T> host(size_);
+                copy(host.data(), data_, sizeInBytes(), hipMemcpyDeviceToHost);
+                return host;
+            }
+
+        private:
+            static void copy(void* dst, const void* src, size_t bytes, hipMemcpyKind kind)
+            {
+                if(bytes != 0 && hipMemcpy(dst, src, bytes, kind) != hipSuccess)
+                {
+                    throw error(HIPSPARSE_STATUS_INTERNAL_ERROR);
+                }
+            }
+
+            T*     data_     = nullptr;
+            size_t size_     = 0;
+            size_t capacity_ = 0;
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Untyped device workspace, sized in bytes
+         */
+        using buffer = deviceArray<char>;
+
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+        namespace detail
+        {
+            struct spVecDeleter
+            {
+                void operator()(hipsparseSpVecDescr_t h) const noexcept
+                {
+                    hipsparseDestroySpVec(h);
+                }
+            };
+
+            struct spMatDeleter
+            {
+                void operator()(hipsparseSpMatDescr_t h) const noexcept
+                {
+                    hipsparseDestroySpMat(h);
+                }
+            };
+
+            struct dnVecDeleter
+            {
+                void operator()(hipsparseDnVecDescr_t h) const noexcept
+                {
+                    hipsparseDestroyDnVec(h);
+                }
+            };
+
+            struct dnMatDeleter
+            {
+                void operator()(hipsparseDnMatDescr_t h) const noexcept
+                {
+                    hipsparseDestroyDnMat(h);
+                }
+            };
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Owning sparse vector descriptor with values of type \p T and indices of
+         *  type \p I
+         */
+        template <typename T, typename I = int32_t>
+        class spVec : public detail::resource<hipsparseSpVecDescr_t, detail::spVecDeleter>
+        {
+        public:
+            using value_type = T;
+            using index_type = I;
+
+            spVec(int64_t              size,
+                  int64_t              nnz,
+                  I*                   indices,
+                  T*                   values,
+                  hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+            {
+                check(hipsparseCreateSpVec(&h_,
+                                           size,
+                                           nnz,
+                                           indices,
+                                           values,
+                                           indexType<I>::value,
+                                           base,
+                                           dataType<T>::value));
+            }
+
+            void setValues(T* values)
+            {
+                check(hipsparseSpVecSetValues(h_, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning sparse matrix descriptor with values of type \p T
+         *
+         *  \details
+         *  \p spMat is the common base of \p csrMatrix, \p cscMatrix and \p cooMatrix. The
+         *  generic routines of the C++ interface accept any of them.
+         */
+        template <typename T>
+        class spMat : public detail::resource<hipsparseSpMatDescr_t, detail::spMatDeleter>
+        {
+        public:
+            using value_type = T;
+
+            void setValues(T* values)
+            {
+                check(hipsparseSpMatSetValues(h_, values));
+            }
+
+        protected:
+            spMat() = default;
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning CSR matrix descriptor with row offsets of type \p I and column
+         *  indices of type \p J
+         */
+        template <typename T, typename I = int32_t, typename J = I>
+        class csrMatrix : public spMat<T>
+        {
+        public:
+            csrMatrix(int64_t              rows,
+                      int64_t              cols,
+                      int64_t              nnz,
+                      I*                   rowOffsets,
+                      J*                   colInd,
+                      T*                   values,
+                      hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+            {
+                check(hipsparseCreateCsr(&this->h_,
+                                         rows,
+                                         cols,
+                                         nnz,
+                                         rowOffsets,
+                                         colInd,
+                                         values,
+                                         indexType<I>::value,
+                                         indexType<J>::value,
+                                         base,
+                                         dataType<T>::value));
+            }
+
+            void setPointers(I* rowOffsets, J* colInd, T* values)
+            {
+                check(hipsparseCsrSetPointers(this->h_, rowOffsets, colInd, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning CSC matrix descriptor with column offsets of type \p I and row
+         *  indices of type \p J
+         */
+        template <typename T, typename I = int32_t, typename J = I>
+        class cscMatrix : public spMat<T>
+        {
+        public:
+            cscMatrix(int64_t              rows,
+                      int64_t              cols,
+                      int64_t              nnz,
+                      I*                   colOffsets,
+                      J*                   rowInd,
+                      T*                   values,
+                      hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+            {
+                check(hipsparseCreateCsc(&this->h_,
+                                         rows,
+                                         cols,
+                                         nnz,
+                                         colOffsets,
+                                         rowInd,
+                                         values,
+                                         indexType<I>::value,
+                                         indexType<J>::value,
+                                         base,
+                                         dataType<T>::value));
+            }
+
+            void setPointers(I* colOffsets, J* rowInd, T* values)
+            {
+                check(hipsparseCscSetPointers(this->h_, colOffsets, rowInd, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning COO matrix descriptor with indices of type \p I
+         */
+        template <typename T, typename I = int32_t>
+        class cooMatrix : public spMat<T>
+        {
+        public:
+            cooMatrix(int64_t              rows,
+                      int64_t              cols,
+                      int64_t              nnz,
+                      I*                   rowInd,
+                      I*                   colInd,
+                      T*                   values,
+                      hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+            {
+                check(hipsparseCreateCoo(&this->h_,
+                                         rows,
+                                         cols,
+                                         nnz,
+                                         rowInd,
+                                         colInd,
+                                         values,
+                                         indexType<I>::value,
+                                         base,
+                                         dataType<T>::value));
+            }
+
+            void setPointers(I* rowInd, I* colInd, T* values)
+            {
+                check(hipsparseCooSetPointers(this->h_, rowInd, colInd, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning dense vector descriptor with values of type \p T
+         */
+        template <typename T>
+        class dnVec : public detail::resource<hipsparseDnVecDescr_t, detail::dnVecDeleter>
+        {
+        public:
+            using value_type = T;
+
+            dnVec(int64_t size, T* values)
+            {
+                check(hipsparseCreateDnVec(&h_, size, values, dataType<T>::value));
+            }
+
+            void setValues(T* values)
+            {
+                check(hipsparseDnVecSetValues(h_, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Owning dense matrix descriptor with values of type \p T
+         */
+        template <typename T>
+        class dnMat : public detail::resource<hipsparseDnMatDescr_t, detail::dnMatDeleter>
+        {
+        public:
+            using value_type = T;
+
+            dnMat(int64_t          rows,
+                  int64_t          cols,
+                  int64_t          ld,
+                  T*               values,
+                  hipsparseOrder_t order = HIPSPARSE_ORDER_COL)
+            {
+                check(hipsparseCreateDnMat(&h_, rows, cols, ld, values, dataType<T>::value, order));
+            }
+
+            void setValues(T* values)
+            {
+                check(hipsparseDnMatSetValues(h_, values));
+            }
+        };
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p csrMatrix, deducing its value and index types
+         */
+        template <typename T, typename I, typename J>
+        csrMatrix<T, I, J> makeCsr(int64_t              rows,
+                                   int64_t              cols,
+                                   int64_t              nnz,
+                                   I*                   rowOffsets,
+                                   J*                   colInd,
+                                   T*                   values,
+                                   hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+        {
+            return csrMatrix<T, I, J>(rows, cols, nnz, rowOffsets, colInd, values, base);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p cscMatrix, deducing its value and index types
+         */
+        template <typename T, typename I, typename J>
+        cscMatrix<T, I, J> makeCsc(int64_t              rows,
+                                   int64_t              cols,
+                                   int64_t              nnz,
+                                   I*                   colOffsets,
+                                   J*                   rowInd,
+                                   T*                   values,
+                                   hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+        {
+            return cscMatrix<T, I, J>(rows, cols, nnz, colOffsets, rowInd, values, base);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p cooMatrix, deducing its value and index types
+         */
+        template <typename T, typename I>
+        cooMatrix<T, I> makeCoo(int64_t              rows,
+                                int64_t              cols,
+                                int64_t              nnz,
+                                I*                   rowInd,
+                                I*                   colInd,
+                                T*                   values,
+                                hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+        {
+            return cooMatrix<T, I>(rows, cols, nnz, rowInd, colInd, values, base);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p spVec, deducing its value and index types
+         */
+        template <typename T, typename I>
+        spVec<T, I> makeSpVec(int64_t              size,
+                              int64_t              nnz,
+                              I*                   indices,
+                              T*                   values,
+                              hipsparseIndexBase_t base = HIPSPARSE_INDEX_BASE_ZERO)
+        {
+            return spVec<T, I>(size, nnz, indices, values, base);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p dnVec, deducing its value type
+         */
+        template <typename T>
+        dnVec<T> makeDnVec(int64_t size, T* values)
+        {
+            return dnVec<T>(size, values);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Create a \p dnMat, deducing its value type
+         */
+        template <typename T>
+        dnMat<T> makeDnMat(int64_t          rows,
+                           int64_t          cols,
+                           int64_t          ld,
+                           T*               values,
+                           hipsparseOrder_t order = HIPSPARSE_ORDER_COL)
+        {
+            return dnMat<T>(rows, cols, ld, values, order);
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse vector sparse vector addition, see hipsparseAxpby()
+         */
+        template <typename T, typename I>
+        void axpby(hipsparseHandle_t  handle,
+                   const T*           alpha,
+                   const spVec<T, I>& x,
+                   const T*           beta,
+                   dnVec<T>&          y)
+        {
+            check(hipsparseAxpby(handle, alpha, x, beta, y));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Gather the entries of a dense vector into a sparse vector, see
+         *  hipsparseGather()
+         */
+        template <typename T, typename I>
+        void gather(hipsparseHandle_t handle, const dnVec<T>& y, spVec<T, I>& x)
+        {
+            check(hipsparseGather(handle, y, x));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Scatter the entries of a sparse vector into a dense vector, see
+         *  hipsparseScatter()
+         */
+        template <typename T, typename I>
+        void scatter(hipsparseHandle_t handle, const spVec<T, I>& x, dnVec<T>& y)
+        {
+            check(hipsparseScatter(handle, x, y));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Buffer size of spvv(), see hipsparseSpVV_bufferSize()
+         *
+         *  \details
+         *  The compute type is the type \p C of \p result.
+         */
+        template <typename C, typename T, typename I>
+        size_t spvvBufferSize(hipsparseHandle_t    handle,
+                              hipsparseOperation_t opX,
+                              const spVec<T, I>&   x,
+                              const dnVec<T>&      y,
+                              C*                   result)
+        {
+            size_t size;
+            check(hipsparseSpVV_bufferSize(handle, opX, x, y, result, dataType<C>::value, &size));
+            return size;
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse vector dense vector dot product, see hipsparseSpVV()
+         */
+        template <typename C, typename T, typename I>
+        void spvv(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opX,
+                  const spVec<T, I>&   x,
+                  const dnVec<T>&      y,
+                  C*                   result,
+                  void*                externalBuffer)
+        {
+            check(hipsparseSpVV(handle, opX, x, y, result, dataType<C>::value, externalBuffer));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse vector dense vector dot product, growing \p workspace as needed
+         */
+        template <typename C, typename T, typename I>
+        void spvv(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opX,
+                  const spVec<T, I>&   x,
+                  const dnVec<T>&      y,
+                  C*                   result,
+                  buffer&              workspace)
+        {
+            workspace.resize(spvvBufferSize(handle, opX, x, y, result));
+            spvv(handle, opX, x, y, result, workspace.data());
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Buffer size of spmv(), see hipsparseSpMV_bufferSize()
+         *
+         *  \details
+         *  The compute type is the type \p C of \p alpha and \p beta. Together with the value
+         *  types of \p A, \p x and \p y it is resolved at compile time.
+         */
+        template <typename C, typename T, typename X, typename Y>
+        size_t spmvBufferSize(hipsparseHandle_t    handle,
+                              hipsparseOperation_t opA,
+                              const C*             alpha,
+                              const spMat<T>&      A,
+                              const dnVec<X>&      x,
+                              const C*             beta,
+                              dnVec<Y>&            y,
+                              hipsparseSpMVAlg_t   alg = HIPSPARSE_SPMV_ALG_DEFAULT)
+        {
+            size_t size;
+            check(hipsparseSpMV_bufferSize(
+                handle, opA, alpha, A, x, beta, y, dataType<C>::value, alg, &size));
+            return size;
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse matrix dense vector multiplication, see hipsparseSpMV()
+         */
+        template <typename C, typename T, typename X, typename Y>
+        void spmv(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opA,
+                  const C*             alpha,
+                  const spMat<T>&      A,
+                  const dnVec<X>&      x,
+                  const C*             beta,
+                  dnVec<Y>&            y,
+                  hipsparseSpMVAlg_t   alg,
+                  void*                externalBuffer)
+        {
+            check(hipsparseSpMV(
+                handle, opA, alpha, A, x, beta, y, dataType<C>::value, alg, externalBuffer));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse matrix dense vector multiplication, growing \p workspace as needed
+         */
+        template <typename C, typename T, typename X, typename Y>
+        void spmv(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opA,
+                  const C*             alpha,
+                  const spMat<T>&      A,
+                  const dnVec<X>&      x,
+                  const C*             beta,
+                  dnVec<Y>&            y,
+                  buffer&              workspace,
+                  hipsparseSpMVAlg_t   alg = HIPSPARSE_SPMV_ALG_DEFAULT)
+        {
+            workspace.resize(spmvBufferSize(handle, opA, alpha, A, x, beta, y, alg));
+            spmv(handle, opA, alpha, A, x, beta, y, alg, workspace.data());
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Buffer size of spmm(), see hipsparseSpMM_bufferSize()
+         *
+         *  \details
+         *  The compute type is the type \p C of \p alpha and \p beta.
+         */
+        template <typename C, typename T, typename U, typename Y>
+        size_t spmmBufferSize(hipsparseHandle_t    handle,
+                              hipsparseOperation_t opA,
+                              hipsparseOperation_t opB,
+                              const C*             alpha,
+                              const spMat<T>&      A,
+                              const dnMat<U>&      B,
+                              const C*             beta,
+                              dnMat<Y>&            Cmat,
+                              hipsparseSpMMAlg_t   alg = HIPSPARSE_SPMM_ALG_DEFAULT)
+        {
+            size_t size;
+            check(hipsparseSpMM_bufferSize(
+                handle, opA, opB, alpha, A, B, beta, Cmat, dataType<C>::value, alg, &size));
+            return size;
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse matrix dense matrix multiplication, see hipsparseSpMM()
+         */
+        template <typename C, typename T, typename U, typename Y>
+        void spmm(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opA,
+                  hipsparseOperation_t opB,
+                  const C*             alpha,
+                  const spMat<T>&      A,
+                  const dnMat<U>&      B,
+                  const C*             beta,
+                  dnMat<Y>&            Cmat,
+                  hipsparseSpMMAlg_t   alg,
+                  void*                externalBuffer)
+        {
+            check(hipsparseSpMM(handle,
+                                opA,
+                                opB,
+                                alpha,
+                                A,
+                                B,
+                                beta,
+                                Cmat,
+                                dataType<C>::value,
+                                alg,
+                                externalBuffer));
+        }
+
+        /*! \ingroup cxx_module
+         *  \brief Sparse matrix dense matrix multiplication, growing \p workspace as needed
+         */
+        template <typename C, typename T, typename U, typename Y>
+        void spmm(hipsparseHandle_t    handle,
+                  hipsparseOperation_t opA,
+                  hipsparseOperation_t opB,
+                  const C*             alpha,
+                  const spMat<T>&      A,
+                  const dnMat<U>&      B,
+                  const C*             beta,
+                  dnMat<Y>&            Cmat,
+                  buffer&              workspace,
+                  hipsparseSpMMAlg_t   alg = HIPSPARSE_SPMM_ALG_DEFAULT)
+        {
+            workspace.resize(spmmBufferSize(handle, opA, opB, alpha, A, B, beta, Cmat, alg));
+            spmm(handle, opA, opB, alpha, A, B, beta, Cmat, alg, workspace.data());
+        }
+#endif
+
+        // The legacy routines are resolved by overloading on the value type.
+#define HIPSPARSE_CXX_BSRMV(T, prefix)                                                    \
+    inline void bsrmv(hipsparseHandle_t         handle,                                  \
+                      hipsparseDirection_t      dirA,                                    \
+                      hipsparseOperation_t      transA,                                  \
+                      int                       mb,                                      \
+                      int                       nb,                                      \
+                      int                       nnzb,                                    \
+                      const T*                  alpha,                                   \
+                      const hipsparseMatDescr_t descrA,                                  \
+                      const T*                  bsrVal,                                  \
+                      const int*                bsrRowPtr,                               \
+                      const int*                bsrColInd,                               \
+                      int                       blockDim,                                \
+                      const T*                  x,                                       \
+                      const T*                  beta,                                    \
+                      T*                        y)                                       \
+    {                                                                                    \
+        check(hipsparse##prefix##bsrmv(handle,                                           \
+                                       dirA,                                             \
+                                       transA,                                           \
+                                       mb,                                               \
+                                       nb,                                               \
+                                       nnzb,                                             \
+                                       alpha,                                            \
+                                       descrA,                                           \
+                                       bsrVal,                                           \
+                                       bsrRowPtr,                                        \
+                                       bsrColInd,                                        \
+                                       blockDim,                                         \
+                                       x,                                                \
+                                       beta,                                             \
+                                       y));                                              \
+    }
+
+#define HIPSPARSE_CXX_BSRMM(T, prefix)                                                    \
+    inline void bsrmm(hipsparseHandle_t         handle,                                  \
+                      hipsparseDirection_t      dirA,                                    \
+                      hipsparseOperation_t      transA,                                  \
+                      hipsparseOperation_t      transB,                                  \
+                      int                       mb,                                      \
+                      int                       n,                                       \
+                      int                       kb,                                      \
+                      int                       nnzb,                                    \
+                      const T*                  alpha,                                   \
+                      const hipsparseMatDescr_t descrA,                                  \
+                      const T*                  bsrVal,                                  \
+                      const int*                bsrRowPtr,                               \
+                      const int*                bsrColInd,                               \
+                      int                       blockDim,                                \
+                      const T*                  B,                                       \
+                      int                       ldb,                                     \
+                      const T*                  beta,                                    \
+                      T*                        C,                                       \
+                      int                       ldc)                                     \
+    {                                                                                    \
+        check(hipsparse##prefix##bsrmm(handle,                                           \
+                                       dirA,                                             \
+                                       transA,                                           \
+                                       transB,                                           \
+                                       mb,                                               \
+                                       n,                                                \
+                                       kb,                                               \
+                                       nnzb,                                             \
+                                       alpha,                                            \
+                                       descrA,                                           \
+                                       bsrVal,                                           \
+                                       bsrRowPtr,                                        \
+                                       bsrColInd,                                        \
+                                       blockDim,                                         \
+                                       B,                                                \
+                                       ldb,                                              \
+                                       beta,                                             \
+                                       C,                                                \
+                                       ldc));                                            \
+    }
+
+        HIPSPARSE_CXX_BSRMV(float, S)
+        HIPSPARSE_CXX_BSRMV(double, D)
+        HIPSPARSE_CXX_BSRMV(hipComplex, C)
+        HIPSPARSE_CXX_BSRMV(hipDoubleComplex, Z)
+
+        HIPSPARSE_CXX_BSRMM(float, S)
+        HIPSPARSE_CXX_BSRMM(double, D)
+        HIPSPARSE_CXX_BSRMM(hipComplex, C)
+        HIPSPARSE_CXX_BSRMM(hipDoubleComplex, Z)
+
+#undef HIPSPARSE_CXX_BSRMV
+#undef HIPSPARSE_CXX_BSRMM
+    }
+}
+
+#endif // HIPSPARSE_CXX_HPP
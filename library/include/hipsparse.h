@@ -249,6 +249,10 @@ typedef struct csric02Info* csric02Info_t;
  *  hipsparseCreateCsrgemm2Info() and the returned structure must be passed to all subsequent 
  *  library calls that involve csrgemm2. It should be destroyed at the end using 
  *  hipsparseDestroyCsrgemm2Info().
+ *
+ *  With the rocSPARSE backend, the structure also holds the result of the symbolic phase
+ *  computed by hipsparseXcsrgemm2Nnz() and hipsparseXcsrgemm2Symbolic(), so that the values
+ *  of the product can be recomputed by hipsparseXcsrgemm2Numeric() alone.
  */
 typedef struct csrgemm2Info* csrgemm2Info_t;
 
@@ -277,6 +281,34 @@ typedef struct pruneInfo* pruneInfo_t;
  */
 typedef struct csru2csrInfo* csru2csrInfo_t;
 
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding an algorithm tuning database.
+ *
+ *  \details
+ *  The hipSPARSE tuning database holds the fastest algorithms found by the tuner of
+ *  hipsparse-bench (\p --bench-tune), keyed by routine, precision and matrix features.
+ *  It must be loaded using hipsparseCreateTuningDb(), queried using hipsparseTuningDbLookup()
+ *  and destroyed at the end using hipsparseDestroyTuningDb().
+ */
+typedef struct hipsparseTuningDb* hipsparseTuningDb_t;
+
+/*! \ingroup types_module
+ *  \brief Profiling counters of a routine on a handle.
+ *
+ *  \details
+ *  The hipSPARSE profiling entries are returned by hipsparseGetProfile(), one per routine
+ *  called on the handle since it was created or since the last call to
+ *  hipsparseResetProfile().
+ */
+typedef struct hipsparseProfileEntry
+{
+    const char* routine;     /**< name of the routine, e.g. "hipsparseScsrmv" */
+    int64_t     calls;       /**< number of calls */
+    int64_t     hostTimeNs;  /**< host time spent in the calls, in nanoseconds */
+    int64_t     bufferBytes; /**< external buffer sizes returned by the buffer size queries */
+    int64_t     allocations; /**< device allocations made by hipSPARSE itself */
+} hipsparseProfileEntry_t;
+
 // clang-format off
 
 /*! \ingroup types_module
@@ -348,6 +380,22 @@ typedef enum {
     HIPSPARSE_POINTER_MODE_DEVICE = 1 /**< Scalar pointers are in device memory */
 } hipsparsePointerMode_t;
 
+/*! \ingroup types_module
+ *  \brief Indicates if the routines that block in cuSPARSE synchronize the stream.
+ *
+ *  \details
+ *  The \ref hipsparseSyncMode_t indicates whether the routines that are blocking in
+ *  cuSPARSE, e.g. hipsparseSdoti() or hipsparseXcsrsv2_zeroPivot(), synchronize the
+ *  stream of the handle before returning. The \ref hipsparseSyncMode_t can be changed by
+ *  hipsparseSetSyncMode(). The currently used sync mode can be obtained by
+ *  hipsparseGetSyncMode().
+ */
+typedef enum {
+    HIPSPARSE_SYNC_MODE_BLOCKING     = 0, /**< The stream is synchronized, as in cuSPARSE */
+    HIPSPARSE_SYNC_MODE_NON_BLOCKING = 1, /**< The stream is not synchronized */
+    HIPSPARSE_SYNC_MODE_CAPTURE_SAFE = 2 /**< No call breaks a stream capture */
+} hipsparseSyncMode_t;
+
 /*! \ingroup types_module
  *  \brief Specify where the operation is performed on.
  *
@@ -595,6 +643,170 @@ hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePoi
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify sync mode
+ *
+ *  \details
+ *  \p hipsparseSetSyncMode specifies whether the routines that are blocking in cuSPARSE
+ *  synchronize the stream of the handle before returning. By default, the stream is
+ *  synchronized (\ref HIPSPARSE_SYNC_MODE_BLOCKING). With
+ *  \ref HIPSPARSE_SYNC_MODE_NON_BLOCKING and \ref HIPSPARSE_POINTER_MODE_DEVICE,
+ *  hipsparseSdoti(), hipsparseCdotci(), hipsparseScsr2csc(), the csrsv2, csrilu02,
+ *  csric02, bsrilu02 and bsric02 analysis routines and their zero pivot queries return as
+ *  soon as their work is enqueued, their results are available once the stream is
+ *  synchronized. In host pointer mode, these routines still synchronize the stream.
+ *
+ *  With \ref HIPSPARSE_SYNC_MODE_CAPTURE_SAFE, the routines can be recorded by
+ *  hipStreamBeginCapture() into a graph. They never synchronize a stream or the device,
+ *  allocate or free device memory, or copy memory synchronously. A routine that would
+ *  have to, e.g. hipsparseSdoti() in host pointer mode, or hipsparseXcsrgemm() when its
+ *  internal workspace has to grow, returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED without
+ *  enqueuing any work. The mode is meant to be set around the captured region only, after
+ *  the same sequence of calls has been run once on the same stream outside of the capture,
+ *  so that the internal workspace has reached its size. The routines that do not take a
+ *  handle, e.g. the destroy routines, are not covered and must be called outside of the
+ *  capture.
+ *
+ *  \note
+ *  The cuSPARSE backend only supports \ref HIPSPARSE_SYNC_MODE_BLOCKING.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle is invalid or \p mode is not a valid
+ *           sync mode.
+ *  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p mode is not supported by the backend.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current sync mode from library context
+ *
+ *  \details
+ *  \p hipsparseGetSyncMode gets the hipSPARSE library context sync mode which is
+ *  currently used for all subsequent function calls.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode);
+
+/*! \ingroup aux_module
+ *  \brief Get the device memory allocated internally by the library
+ *
+ *  \details
+ *  \p hipsparseGetInternalMemoryUsage returns the number of bytes of device memory
+ *  currently allocated by hipSPARSE itself, and the largest number of bytes allocated at
+ *  once since the last call to hipsparseResetInternalMemoryUsage(). It covers the
+ *  temporary buffers and scalars of routines that do not take an external buffer, e.g.
+ *  hipsparseXcsrgemmNnz(), hipsparseXcsrgemm(), hipsparseXcsr2csc() and hipsparseXhyb2csr(),
+ *  as well as the arrays held by info structures, e.g. \ref csru2csrInfo_t. Memory
+ *  allocated by the backend library is not included. The counters are shared by all
+ *  handles of the process.
+ *
+ *  @param[out]
+ *  currentBytes    number of bytes currently allocated, can be nullptr.
+ *  @param[out]
+ *  peakBytes       largest number of bytes allocated at once, can be nullptr.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetInternalMemoryUsage(size_t* currentBytes, size_t* peakBytes);
+
+/*! \ingroup aux_module
+ *  \brief Reset the peak of the device memory allocated internally by the library
+ *
+ *  \details
+ *  \p hipsparseResetInternalMemoryUsage sets the peak returned by
+ *  hipsparseGetInternalMemoryUsage() to the number of bytes currently allocated.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseResetInternalMemoryUsage(void);
+
+/*! \ingroup aux_module
+ *  \brief Get the profiling counters of a handle
+ *
+ *  \details
+ *  \p hipsparseGetProfile returns, for each routine called on \p handle, the number of
+ *  calls, the host time spent in them, the external buffer sizes returned by the buffer
+ *  size queries, e.g. hipsparseXcsrsv2_bufferSize(), and the number of device
+ *  allocations made by hipSPARSE itself. The counters are always enabled, they cover the
+ *  calls of all threads since the handle was created or since the last call to
+ *  hipsparseResetProfile(). hipsparseGetProfile() and hipsparseResetProfile() are not
+ *  counted themselves. The entries are sorted by decreasing host time.
+ *
+ *  If \p entries is nullptr, the number of entries is returned in \p count. Otherwise
+ *  \p count is the capacity of \p entries on input and the number of entries written
+ *  on output.
+ *
+ *  \note
+ *  Calls that are in progress on other threads may or may not be counted.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[inout]
+ *  count       number of entries.
+ *  @param[out]
+ *  entries     array of \p count profiling entries, can be nullptr.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is nullptr.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p count is nullptr or negative.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseGetProfile(hipsparseHandle_t handle, int* count, hipsparseProfileEntry_t* entries);
+
+/*! \ingroup aux_module
+ *  \brief Reset the profiling counters of a handle
+ *
+ *  \details
+ *  \p hipsparseResetProfile sets all the counters returned by hipsparseGetProfile() to
+ *  zero.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is nullptr.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseResetProfile(hipsparseHandle_t handle);
+
+/*! \ingroup aux_module
+ *  \brief Specify the device workspace of a handle
+ *
+ *  \details
+ *  Some routines need a temporary device buffer that is not part of their interface, e.g.
+ *  hipsparseXcsrgemmNnz(), hipsparseScsrgemm(), hipsparseScsr2csc() and
+ *  hipsparseShyb2csr(). By default, hipSPARSE allocates it once per handle and grows it
+ *  when a larger one is needed, it is released by hipsparseDestroy().
+ *  \p hipsparseSetWorkspace lets the user provide this buffer instead. A routine that
+ *  needs more than \p workspaceSizeInBytes bytes falls back to the buffer allocated by
+ *  hipSPARSE. Passing nullptr and 0 restores the default behaviour.
+ *
+ *  \note
+ *  \p workspace must remain valid until the handle is destroyed or another workspace is
+ *  set, and it must not be accessed by other work while routines using it are pending.
+ *
+ *  \note
+ *  The workspace is not used by the cuSPARSE backend.
+ *
+ *  @param[in]
+ *  handle                  handle to the hipsparse library context queue.
+ *  @param[in]
+ *  workspace               device buffer, can be nullptr.
+ *  @param[in]
+ *  workspaceSizeInBytes    size of \p workspace in bytes.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle is invalid, or \p workspace is
+ *           nullptr while \p workspaceSizeInBytes is not 0.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseSetWorkspace(hipsparseHandle_t handle, void* workspace, size_t workspaceSizeInBytes);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -1039,6 +1251,87 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyPruneInfo(pruneInfo_t info);
 #endif
 
+/*! \ingroup aux_module
+ *  \brief Load an algorithm tuning database
+ *
+ *  \details
+ *  \p hipsparseCreateTuningDb reads the tuning database written by hipsparse-bench
+ *  (\p --bench-tune). It should be destroyed at the end using hipsparseDestroyTuningDb().
+ *
+ *  Each line of the file holds one entry
+ *  \code
+ *  routine precision indextype m n nnz option algorithm msec default_msec
+ *  \endcode
+ *  where \p routine is the hipsparse-bench function, e.g. \p csrmv, \p precision is one of
+ *  \p s, \p d, \p c, \p z and \p option is the hipsparse-bench option holding the algorithm,
+ *  e.g. \p spmv_alg. Lines starting with \p # are ignored.
+ *
+ *  @param[out]
+ *  db          the pointer to the tuning database.
+ *  @param[in]
+ *  filename    the name of the tuning database file.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p db or \p filename pointer is invalid, or the
+ *              file cannot be read or is malformed.
+ *  \retval HIPSPARSE_STATUS_ALLOC_FAILED the resources could not be allocated.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateTuningDb(hipsparseTuningDb_t* db, const char* filename);
+
+/*! \ingroup aux_module
+ *  \brief Destroy an algorithm tuning database
+ *
+ *  \details
+ *  \p hipsparseDestroyTuningDb destroys a tuning database.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyTuningDb(hipsparseTuningDb_t db);
+
+/*! \ingroup aux_module
+ *  \brief Query the algorithm of a tuning database
+ *
+ *  \details
+ *  \p hipsparseTuningDbLookup returns the algorithm stored for the entry of \p routine and
+ *  \p valueType whose matrix features are the closest to \p m, \p n and \p nnz. The
+ *  distance is measured on the logarithm of the features, so that an entry tuned for a
+ *  matrix of similar size and density is preferred. \p alg is set to -1 if the database
+ *  holds no entry for \p routine and \p valueType, in which case the default algorithm
+ *  should be used.
+ *
+ *  The returned value is the integer value of the algorithm enumeration of the routine,
+ *  e.g. \ref hipsparseSpMVAlg_t for \p csrmv, or of \ref hipsparseHybPartition_t for
+ *  \p hybmv.
+ *
+ *  @param[in]
+ *  db          the tuning database.
+ *  @param[in]
+ *  routine     the name of the routine, e.g. \p csrmv.
+ *  @param[in]
+ *  valueType   the data type of the matrix values.
+ *  @param[in]
+ *  m           the number of rows of the matrix.
+ *  @param[in]
+ *  n           the number of columns of the matrix.
+ *  @param[in]
+ *  nnz         the number of non-zero entries of the matrix.
+ *  @param[out]
+ *  alg         the algorithm, -1 if no entry matches.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p db, \p routine or \p alg pointer is invalid,
+ *              or \p m, \p n or \p nnz is negative.
+ *  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p valueType is not supported.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseTuningDbLookup(hipsparseTuningDb_t db,
+                                          const char*         routine,
+                                          hipDataType         valueType,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             nnz,
+                                          int*                alg);
+
 /*
 * ===========================================================================
 *    level 1 SPARSE
@@ -6714,6 +7007,242 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
 /**@}*/
 #endif
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsrgemm2Symbolic computes the CSR column indices of the resulting
+*  multiplied matrix C, without computing any of its values. It is the symbolic part of
+*  hipsparseXcsrgemm2(). The row offsets \p csrRowPtrC and the total number of non-zero
+*  elements \p nnzC must have been computed by hipsparseXcsrgemm2Nnz() with the same
+*  \p info and \p pBuffer. The array \p csrColIndC must have been allocated with size
+*  \p nnzC.
+*
+*  Once the sparsity pattern of C is known, the values of C can be computed with
+*  hipsparseXcsrgemm2Numeric(). As long as the sparsity patterns of A, B and D do not
+*  change, the values of C can be recomputed any number of times with a single call to
+*  hipsparseXcsrgemm2Numeric(), reusing \p info, \p pBuffer and the sparsity pattern of C.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  \note
+*  This function is only available with the rocSPARSE backend.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrgemm2Symbolic(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             int                       k,
+                                             const hipsparseMatDescr_t descrA,
+                                             int                       nnzA,
+                                             const int*                csrRowPtrA,
+                                             const int*                csrColIndA,
+                                             const hipsparseMatDescr_t descrB,
+                                             int                       nnzB,
+                                             const int*                csrRowPtrB,
+                                             const int*                csrColIndB,
+                                             const hipsparseMatDescr_t descrD,
+                                             int                       nnzD,
+                                             const int*                csrRowPtrD,
+                                             const int*                csrColIndD,
+                                             const hipsparseMatDescr_t descrC,
+                                             int                       nnzC,
+                                             const int*                csrRowPtrC,
+                                             int*                      csrColIndC,
+                                             const csrgemm2Info_t      info,
+                                             void*                     pBuffer);
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p hipsparseXcsrgemm2Numeric multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
+*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. Only
+*  the values of the resulting matrix \f$C\f$ are computed, such that
+*  \f[
+*    C := \alpha \cdot A \cdot B + \beta \cdot D
+*  \f]
+*
+*  \p hipsparseXcsrgemm2Numeric is the numeric part of hipsparseXcsrgemm2(). The sparsity
+*  pattern of C, i.e. \p csrRowPtrC and \p csrColIndC, must have been computed by
+*  hipsparseXcsrgemm2Nnz() and hipsparseXcsrgemm2Symbolic() with the same \p info and
+*  \p pBuffer. When only the values of A, B or D change, the values of C are updated by
+*  calling \p hipsparseXcsrgemm2Numeric again, without repeating the buffer size query,
+*  the allocations and the symbolic phase.
+*
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot A \cdot B\f$ will be computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note \p alpha and \p beta must be null, or not, as in the call to
+*        hipsparseXcsrgemm2_bufferSizeExt() that initialized \p info.
+*  \note Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*  \note This function is only available with the rocSPARSE backend.
+*
+*  \par Example
+*  \code{.c}
+*    // Symbolic phase, once per sparsity pattern
+*    hipsparseScsrgemm2_bufferSizeExt(handle, m, n, k, &alpha, descrA, nnzA, dcsrRowPtrA,
+*                                     dcsrColIndA, descrB, nnzB, dcsrRowPtrB, dcsrColIndB,
+*                                     nullptr, descrD, 0, nullptr, nullptr, info, &bufferSize);
+*    hipMalloc(&dbuffer, bufferSize);
+*
+*    hipsparseXcsrgemm2Nnz(handle, m, n, k, descrA, nnzA, dcsrRowPtrA, dcsrColIndA, descrB,
+*                          nnzB, dcsrRowPtrB, dcsrColIndB, descrD, 0, nullptr, nullptr,
+*                          descrC, dcsrRowPtrC, &nnzC, info, dbuffer);
+*
+*    hipMalloc((void**)&dcsrColIndC, sizeof(int) * nnzC);
+*    hipMalloc((void**)&dcsrValC, sizeof(float) * nnzC);
+*
+*    hipsparseXcsrgemm2Symbolic(handle, m, n, k, descrA, nnzA, dcsrRowPtrA, dcsrColIndA,
+*                               descrB, nnzB, dcsrRowPtrB, dcsrColIndB, descrD, 0, nullptr,
+*                               nullptr, descrC, nnzC, dcsrRowPtrC, dcsrColIndC, info,
+*                               dbuffer);
+*
+*    // Numeric phase, once per update of the values of A and B
+*    for(int iter = 0; iter < iters; ++iter)
+*    {
+*        update_values(dcsrValA, dcsrValB);
+*
+*        hipsparseScsrgemm2Numeric(handle, m, n, k, &alpha, descrA, nnzA, dcsrValA,
+*                                  dcsrRowPtrA, dcsrColIndA, descrB, nnzB, dcsrValB,
+*                                  dcsrRowPtrB, dcsrColIndB, nullptr, descrD, 0, nullptr,
+*                                  nullptr, nullptr, descrC, nnzC, dcsrValC, dcsrRowPtrC,
+*                                  dcsrColIndC, info, dbuffer);
+*    }
+*  \endcode
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const float*              alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const float*              csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const float*              beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const float*              csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            float*                    csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const double*             alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const double*             csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const double*             beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const double*             csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            double*                   csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipComplex*         alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipComplex*         csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipComplex*         csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipComplex*         beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const hipComplex*         csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            hipComplex*               csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipDoubleComplex*   alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipDoubleComplex*   csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipDoubleComplex*   csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipDoubleComplex*   beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const hipDoubleComplex*   csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            hipDoubleComplex*         csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer);
+/**@}*/
+#endif
+
 /*
 * ===========================================================================
 *    preconditioner SPARSE
@@ -13710,6 +14239,79 @@ typedef struct hipsparseSpGEMMDescr* hipsparseSpGEMMDescr_t;
 typedef struct hipsparseSpSVDescr* hipsparseSpSVDescr_t;
 #endif
 
+/*! \ingroup types_module
+ *  \brief Generic API opaque structure holding a prepared sparse matrix vector multiplication
+ *
+ *  \details
+ *  The hipSPARSE SpMV plan owns the buffer and the preprocessed data of the products
+ *  \f$y := \alpha \cdot op(A) \cdot x + \beta \cdot y\f$ with one sparse matrix. It must be
+ *  created using hipsparseCreateSpMVPlan(), executed using hipsparseSpMVPlanExecute() and
+ *  destroyed at the end using hipsparseDestroySpMVPlan().
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef struct hipsparseSpMVPlan* hipsparseSpMVPlan_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Transport of the messages between the ranks of a distributed matrix
+ *
+ *  \details
+ *  The hipSPARSE transport is the communication layer of the distributed matrices, see
+ *  hipsparseCreateDistCsr(). Its callbacks post non-blocking point to point messages of
+ *  host memory, e.g. with \p MPI_Isend, \p MPI_Irecv and \p MPI_Wait, and \p userData is
+ *  passed to each of them, e.g. a pointer to the communicator. The transport of the ranks of
+ *  a single process can be obtained from hipsparseCreateLocalTransport().
+ *
+ *  \p isend and \p irecv return a request in \p request, \p wait is called exactly once for
+ *  each request and returns when its message is sent or received. A request can be set to
+ *  \p NULL when its operation is already complete, in which case \p wait is still called
+ *  with it. The messages between two ranks with the same \p tag must be received in the
+ *  order they are sent, the sizes of a message on both sides are always equal.
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef struct hipsparseTransport
+{
+    void* userData; /**< passed to the callbacks */
+    int   rank;     /**< rank of the caller, in [0, size) */
+    int   size;     /**< number of ranks */
+
+    /*! send \p bytes of \p buf to \p dest, \p buf is unchanged until the request completes */
+    hipsparseStatus_t (*isend)(
+        void* userData, const void* buf, size_t bytes, int dest, int tag, void** request);
+    /*! receive \p bytes from \p source into \p buf */
+    hipsparseStatus_t (*irecv)(
+        void* userData, void* buf, size_t bytes, int source, int tag, void** request);
+    /*! complete and release \p request */
+    hipsparseStatus_t (*wait)(void* userData, void* request);
+} hipsparseTransport_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding the in-process transport of a group of ranks
+ *
+ *  \details
+ *  The hipSPARSE local transport connects ranks run by the threads of a single process. It
+ *  must be created using hipsparseCreateLocalTransport(), the transport of each rank is
+ *  obtained using hipsparseLocalTransportGet(), and it should be destroyed at the end using
+ *  hipsparseDestroyLocalTransport().
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef struct hipsparseLocalTransport* hipsparseLocalTransport_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding the rows of a distributed CSR matrix
+ *
+ *  \details
+ *  The hipSPARSE distributed CSR descriptor holds the rows of a square matrix owned by one
+ *  rank, split into a local block and a ghost block, and the lists of the halo exchange. It
+ *  must be created using hipsparseCreateDistCsr(), used in hipsparseDistSpMV() and
+ *  destroyed at the end using hipsparseDestroyDistCsr().
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef struct hipsparseDistCsrDescr* hipsparseDistCsrDescr_t;
+#endif
+
 /*! \ingroup types_module
  *  \brief Generic API opaque structure holding information for a SpSM calculations
  *
@@ -14028,6 +14630,36 @@ typedef enum
 } hipsparseSpSMAlg_t;
 #endif
 
+/*! \ingroup generic_module
+ *  \brief List of hipsparse SpSV matrix updates.
+ *
+ *  \details
+ *  This is a list of the \ref hipsparseSpSVUpdate_t types that are used by
+ *  hipsparseSpSV_updateMatrix().
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef enum
+{
+    HIPSPARSE_SPSV_UPDATE_GENERAL  = 0, /**< All the values of the matrix are replaced */
+    HIPSPARSE_SPSV_UPDATE_DIAGONAL = 1 /**< The diagonal of the matrix is replaced */
+} hipsparseSpSVUpdate_t;
+#endif
+
+/*! \ingroup generic_module
+ *  \brief List of hipsparse SpSM matrix updates.
+ *
+ *  \details
+ *  This is a list of the \ref hipsparseSpSMUpdate_t types that are used by
+ *  hipsparseSpSM_updateMatrix().
+ */
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+typedef enum
+{
+    HIPSPARSE_SPSM_UPDATE_GENERAL  = 0, /**< All the values of the matrix are replaced */
+    HIPSPARSE_SPSM_UPDATE_DIAGONAL = 1 /**< The diagonal of the matrix is replaced */
+} hipsparseSpSMUpdate_t;
+#endif
+
 /*! \ingroup generic_module
  *  \brief List of hipsparse attributes.
  *
@@ -15744,6 +16376,15 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
 *  \details
 *  \p hipsparseSpMV computes sparse matrix multiplication with a dense vector
 *
+*  \p matA and \p vecX either hold values of \p computeType, as \p vecY does, or narrower
+*  values accumulated in a wider \p computeType:
+*  - HIP_R_8I values with HIP_R_32I or HIP_R_32F compute and y of the compute type,
+*  - HIP_R_16F values with HIP_R_32F compute and y of type HIP_R_16F or HIP_R_32F,
+*  - HIP_R_16BF values with HIP_R_32F compute and y of type HIP_R_16BF or HIP_R_32F.
+*
+*  \p alpha and \p beta are of \p computeType. Which of these combinations a backend implements
+*  depends on its version, the others return \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*
 *  \par Example
 *  \code{.c}
 *    // A, x, and y are m×k, k×1, and m×1
@@ -15881,6 +16522,624 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 void*                       externalBuffer);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Description: Buffer size step of the grouped sparse matrix multiplication with a
+*  dense vector
+*
+*  \details
+*  \p hipsparseSpMVGrouped_bufferSize computes the size of the user allocated buffer needed
+*  by hipsparseSpMVGrouped_preprocess() and hipsparseSpMVGrouped() for the
+*  \p groupCount products \f$y_i := \alpha \cdot op(A_i) \cdot x_i + \beta \cdot y_i\f$. The
+*  buffer holds one part per matrix, its size is at least the sum of the sizes returned
+*  by hipsparseSpMV_bufferSize() for each matrix.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  opA         matrix operation applied to all the matrices.
+*  @param[in]
+*  groupCount  number of matrices in the group.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$, shared by all the products.
+*  @param[in]
+*  matA        host array of \p groupCount sparse matrix descriptors.
+*  @param[in]
+*  vecX        host array of \p groupCount dense vector descriptors.
+*  @param[in]
+*  beta        scalar \f$\beta\f$, shared by all the products.
+*  @param[in]
+*  vecY        host array of \p groupCount dense vector descriptors.
+*  @param[in]
+*  computeType floating point precision of all the products.
+*  @param[in]
+*  alg         SpMV algorithm of all the products.
+*  @param[out]
+*  pBufferSizeInBytes  number of bytes of the buffer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p vecX, \p vecY or
+*          \p pBufferSizeInBytes is invalid, or \p groupCount is negative.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the product of one of the matrices is not
+*          supported.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVGrouped_bufferSize(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  size_t* pBufferSizeInBytes);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Preprocess step of the grouped sparse matrix multiplication with a
+*  dense vector (optional)
+*
+*  \details
+*  \p hipsparseSpMVGrouped_preprocess performs the optional preprocess of
+*  hipsparseSpMV_preprocess() for each matrix of the group, in the part of
+*  \p externalBuffer of the matrix. The parameters are those of
+*  hipsparseSpMVGrouped_bufferSize().
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVGrouped_preprocess(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  void*                             externalBuffer);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Compute the grouped sparse matrix multiplication with a dense vector
+*
+*  \details
+*  \p hipsparseSpMVGrouped computes \f$y_i := \alpha \cdot op(A_i) \cdot x_i + \beta \cdot
+*  y_i\f$ for the \p groupCount independent matrices of \p matA, which can differ in size,
+*  sparsity pattern and format, but share the compute type. Unlike
+*  hipsparseCsrSetStridedBatch(), the matrices do not share a sparsity pattern. The
+*  arguments are checked and the products are enqueued on the stream of \p handle by a
+*  single call, which removes the per call overhead of hipsparseSpMV() when the group has
+*  many small matrices. The host backend distributes the matrices over its threads.
+*
+*  \note
+*  The results are the same as those of hipsparseSpMV() called for each matrix with the
+*  same parameters. Each matrix uses its own part of \p externalBuffer, the parts are sized
+*  on the host by every call from the descriptors as they are at the call.
+*
+*  \par Example
+*  \code{.c}
+*    // The matrices, vectors and their descriptors are created as for hipsparseSpMV()
+*    std::vector<hipsparseConstSpMatDescr_t> matA(groupCount);
+*    std::vector<hipsparseConstDnVecDescr_t> vecX(groupCount);
+*    std::vector<hipsparseDnVecDescr_t>      vecY(groupCount);
+*
+*    size_t bufferSize;
+*    hipsparseSpMVGrouped_bufferSize(handle,
+*                                    HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*                                    groupCount,
+*                                    &alpha,
+*                                    matA.data(),
+*                                    vecX.data(),
+*                                    &beta,
+*                                    vecY.data(),
+*                                    HIP_R_32F,
+*                                    HIPSPARSE_SPMV_ALG_DEFAULT,
+*                                    &bufferSize);
+*
+*    void* buffer;
+*    hipMalloc(&buffer, bufferSize);
+*
+*    hipsparseSpMVGrouped(handle,
+*                         HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*                         groupCount,
+*                         &alpha,
+*                         matA.data(),
+*                         vecX.data(),
+*                         &beta,
+*                         vecY.data(),
+*                         HIP_R_32F,
+*                         HIPSPARSE_SPMV_ALG_DEFAULT,
+*                         buffer);
+*  \endcode
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVGrouped(hipsparseHandle_t                 handle,
+                                       hipsparseOperation_t              opA,
+                                       int                               groupCount,
+                                       const void*                       alpha,
+                                       const hipsparseConstSpMatDescr_t* matA,
+                                       const hipsparseConstDnVecDescr_t* vecX,
+                                       const void*                       beta,
+                                       const hipsparseDnVecDescr_t*      vecY,
+                                       hipDataType                       computeType,
+                                       hipsparseSpMVAlg_t                alg,
+                                       void*                             externalBuffer);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Create a plan of the sparse matrix multiplication with a dense vector
+*
+*  \details
+*  \p hipsparseCreateSpMVPlan prepares the products
+*  \f$y := \alpha \cdot op(A) \cdot x + \beta \cdot y\f$ with the matrix \p matA. It
+*  allocates the buffer returned by hipsparseSpMV_bufferSize() and runs
+*  hipsparseSpMV_preprocess() once. The plan keeps \p opA, \p matA, \p computeType and
+*  \p alg, the vectors and the scalars are only used to prepare it and can differ in
+*  hipsparseSpMVPlanExecute(), as long as their sizes and data types do not change.
+*
+*  The preprocessed data depends on the sparsity pattern of \p matA only. The values of
+*  \p matA can be changed in place or replaced with hipsparseSpMVPlanUpdateValues()
+*  between two executions without preparing the plan again. If the sizes, the row or column
+*  arrays of \p matA change, the plan must be destroyed and created again. \p matA must
+*  not be destroyed before the plan.
+*
+*  \note
+*  The buffer of the plan is allocated on the device, it is freed by hipsparseDestroySpMVPlan().
+*
+*  @param[out]
+*  plan        the SpMV plan.
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  opA         matrix operation.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  matA        sparse matrix descriptor.
+*  @param[in]
+*  vecX        dense vector descriptor of \f$x\f$.
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[in]
+*  vecY        dense vector descriptor of \f$y\f$.
+*  @param[in]
+*  computeType precision of the products.
+*  @param[in]
+*  alg         SpMV algorithm.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p plan, \p handle, \p alpha, \p matA, \p vecX,
+*          \p beta or \p vecY is invalid.
+*  \retval HIPSPARSE_STATUS_ALLOC_FAILED the buffer could not be allocated.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the product is not supported.
+*
+*  \par Example
+*  \code{.c}
+*    hipsparseSpMVPlan_t plan;
+*    hipsparseCreateSpMVPlan(&plan,
+*                            handle,
+*                            HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*                            &alpha,
+*                            matA,
+*                            vecX,
+*                            &beta,
+*                            vecY,
+*                            HIP_R_32F,
+*                            HIPSPARSE_SPMV_ALG_DEFAULT);
+*
+*    for(int step = 0; step < steps; ++step)
+*    {
+*        // New values of A, same sparsity pattern
+*        hipsparseSpMVPlanUpdateValues(handle, plan, csrVal[step]);
+*        hipsparseSpMVPlanExecute(handle, plan, &alpha, vecX, &beta, vecY);
+*    }
+*
+*    hipsparseDestroySpMVPlan(plan);
+*  \endcode
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateSpMVPlan(hipsparseSpMVPlan_t*        plan,
+                                          hipsparseHandle_t           handle,
+                                          hipsparseOperation_t        opA,
+                                          const void*                 alpha,
+                                          hipsparseSpMatDescr_t       matA,
+                                          hipsparseConstDnVecDescr_t  vecX,
+                                          const void*                 beta,
+                                          const hipsparseDnVecDescr_t vecY,
+                                          hipDataType                 computeType,
+                                          hipsparseSpMVAlg_t          alg);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Destroy a plan of the sparse matrix multiplication with a dense vector
+*
+*  \details
+*  \p hipsparseDestroySpMVPlan frees the buffer and the preprocessed data of a plan. The
+*  sparse matrix descriptor of the plan is not destroyed.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroySpMVPlan(hipsparseSpMVPlan_t plan);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Set the values of the sparse matrix of a plan
+*
+*  \details
+*  \p hipsparseSpMVPlanUpdateValues replaces the values array of the sparse matrix of the
+*  plan, as hipsparseSpMatSetValues(). The sparsity pattern is unchanged, hence the
+*  preprocessed data of the plan is kept.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  plan        the SpMV plan.
+*  @param[in]
+*  values      the new values of the sparse matrix.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p plan or \p values is invalid.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseSpMVPlanUpdateValues(hipsparseHandle_t handle, hipsparseSpMVPlan_t plan, void* values);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Execute a plan of the sparse matrix multiplication with a dense vector
+*
+*  \details
+*  \p hipsparseSpMVPlanExecute computes \f$y := \alpha \cdot op(A) \cdot x + \beta \cdot
+*  y\f$ with the operation, the matrix, the compute type, the algorithm and the buffer of
+*  the plan. It is equivalent to hipsparseSpMV() with these parameters, without any
+*  preprocessing.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  plan        the SpMV plan.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  vecX        dense vector descriptor of \f$x\f$, of the size and data type used to
+*              create the plan.
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  vecY        dense vector descriptor of \f$y\f$, of the size and data type used to
+*              create the plan.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p plan, \p alpha, \p vecX, \p beta
+*          or \p vecY is invalid.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVPlanExecute(hipsparseHandle_t           handle,
+                                           hipsparseSpMVPlan_t         plan,
+                                           const void*                 alpha,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Create the in-process transport of a group of ranks
+*
+*  \details
+*  \p hipsparseCreateLocalTransport creates a group of \p size ranks run by the threads of
+*  the calling process, e.g. to test a distributed matrix without MPI. The messages are
+*  copied when they are sent and delivered through a mailbox per rank, hence a send never
+*  blocks and a receive blocks in the wait of its request until the message arrives.
+*
+*  @param[out]
+*  transport   the local transport.
+*  @param[in]
+*  size        number of ranks of the group.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p transport is invalid or \p size is not positive.
+*  \retval HIPSPARSE_STATUS_ALLOC_FAILED the resources could not be allocated.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateLocalTransport(hipsparseLocalTransport_t* transport, int size);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Destroy the in-process transport of a group of ranks
+*
+*  \details
+*  \p hipsparseDestroyLocalTransport destroys a local transport, once no rank uses it.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyLocalTransport(hipsparseLocalTransport_t transport);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Get the transport of a rank of an in-process group
+*
+*  \details
+*  \p hipsparseLocalTransportGet fills \p rankTransport with the callbacks of rank \p rank of
+*  the local transport. It is passed to the routines called by the thread running the rank.
+*
+*  @param[in]
+*  transport       the local transport.
+*  @param[in]
+*  rank            the rank, in [0, size).
+*  @param[out]
+*  rankTransport   the transport of the rank.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p transport or \p rankTransport is invalid, or
+*          \p rank is out of range.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseLocalTransportGet(hipsparseLocalTransport_t transport,
+                                             int                       rank,
+                                             hipsparseTransport_t*     rankTransport);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Create the rows of a distributed CSR matrix owned by a rank
+*
+*  \details
+*  \p hipsparseCreateDistCsr distributes a square matrix \f$A\f$ of size \p partition[size]
+*  by blocks of rows, and the vectors \f$x\f$ and \f$y\f$ of \f$y := \alpha \cdot A \cdot x +
+*  \beta \cdot y\f$ with the same blocks: the rank \p r of the transport owns the rows and
+*  the entries of \f$x\f$ and \f$y\f$ from \p partition[r] to \p partition[r+1]. Each rank
+*  passes its rows in CSR format, with the global indices of the columns.
+*
+*  The rows are split into a local block, with the columns owned by the rank renumbered from
+*  zero, and a ghost block, with the other columns. The ghost columns are compressed, they are
+*  numbered from zero in increasing global order, hence grouped by owner. The ranks then
+*  exchange the lists of their ghost columns, so that each rank knows which entries of its
+*  part of \f$x\f$ to send to which neighbour in hipsparseDistSpMV().
+*
+*  The routine is collective, it must be called by every rank of the transport with the same
+*  partition. The arrays of the rows are copied, they can be freed after the call. A rank that
+*  fails, with invalid arguments or on the device, still takes part in the exchanges, and the
+*  status of every rank is exchanged last: the failed rank returns its error and the other
+*  ranks return \ref HIPSPARSE_STATUS_INTERNAL_ERROR, none of them waits for the failed rank.
+*  Only an invalid \p transport is returned at once.
+*
+*  \note
+*  The number of rows and of non-zero entries of a rank, and its number of ghost columns,
+*  must fit in 32 bit integers.
+*
+*  \note
+*  This routine is blocking, it is not supported with \ref HIPSPARSE_SYNC_MODE_CAPTURE_SAFE.
+*
+*  @param[out]
+*  matA                the rows of the distributed matrix owned by the rank.
+*  @param[in]
+*  handle              handle to the hipsparse library context queue.
+*  @param[in]
+*  transport           transport of the rank.
+*  @param[in]
+*  partition           array of \p transport->size + 1 elements on the host, with the first
+*                      row of each rank and the size of the matrix.
+*  @param[in]
+*  nnz                 number of non-zero entries of the rows of the rank.
+*  @param[in]
+*  csrRowOffsets       array of \p partition[rank+1] - \p partition[rank] + 1 elements that
+*                      point to the start of every row.
+*  @param[in]
+*  csrColInd           array of \p nnz elements containing the global column indices.
+*  @param[in]
+*  csrValues           array of \p nnz elements containing the values.
+*  @param[in]
+*  csrRowOffsetsType   \ref HIPSPARSE_INDEX_32I or \ref HIPSPARSE_INDEX_64I.
+*  @param[in]
+*  csrColIndType       \ref HIPSPARSE_INDEX_32I or \ref HIPSPARSE_INDEX_64I.
+*  @param[in]
+*  idxBase             \ref HIPSPARSE_INDEX_BASE_ZERO or \ref HIPSPARSE_INDEX_BASE_ONE.
+*  @param[in]
+*  valueType           data type of the values.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p matA, \p handle, \p transport, \p partition,
+*          \p csrRowOffsets, \p csrColInd or \p csrValues is invalid, or a column index is out
+*          of range.
+*  \retval HIPSPARSE_STATUS_ALLOC_FAILED the resources could not be allocated.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED a type, the sizes or the sync mode are not
+*          supported.
+*  \retval HIPSPARSE_STATUS_INTERNAL_ERROR another rank failed.
+*
+*  \par Example
+*  \code{.c}
+*    // Transport over MPI
+*    static hipsparseStatus_t
+*        mpiIsend(void* comm, const void* buf, size_t bytes, int dest, int tag, void** request)
+*    {
+*        *request = malloc(sizeof(MPI_Request));
+*        MPI_Isend(buf, bytes, MPI_BYTE, dest, tag, *(MPI_Comm*)comm, *request);
+*        return HIPSPARSE_STATUS_SUCCESS;
+*    }
+*
+*    static hipsparseStatus_t
+*        mpiIrecv(void* comm, void* buf, size_t bytes, int source, int tag, void** request)
+*    {
+*        *request = malloc(sizeof(MPI_Request));
+*        MPI_Irecv(buf, bytes, MPI_BYTE, source, tag, *(MPI_Comm*)comm, *request);
+*        return HIPSPARSE_STATUS_SUCCESS;
+*    }
+*
+*    static hipsparseStatus_t mpiWait(void* comm, void* request)
+*    {
+*        MPI_Wait(request, MPI_STATUS_IGNORE);
+*        free(request);
+*        return HIPSPARSE_STATUS_SUCCESS;
+*    }
+*
+*    MPI_Comm             comm = MPI_COMM_WORLD;
+*    hipsparseTransport_t transport;
+*    transport.userData = &comm;
+*    transport.isend    = mpiIsend;
+*    transport.irecv    = mpiIrecv;
+*    transport.wait     = mpiWait;
+*    MPI_Comm_rank(comm, &transport.rank);
+*    MPI_Comm_size(comm, &transport.size);
+*
+*    // Rows partition[rank] to partition[rank + 1] - 1, with global column indices
+*    hipsparseDistCsrDescr_t matA;
+*    hipsparseCreateDistCsr(&matA,
+*                           handle,
+*                           &transport,
+*                           partition,
+*                           nnz,
+*                           dcsrRowPtr,
+*                           dcsrColInd,
+*                           dcsrVal,
+*                           HIPSPARSE_INDEX_32I,
+*                           HIPSPARSE_INDEX_64I,
+*                           HIPSPARSE_INDEX_BASE_ZERO,
+*                           HIP_R_64F);
+*
+*    // Parts of x and y owned by the rank
+*    hipsparseDnVecDescr_t vecX, vecY;
+*    hipsparseCreateDnVec(&vecX, partition[rank + 1] - partition[rank], dx, HIP_R_64F);
+*    hipsparseCreateDnVec(&vecY, partition[rank + 1] - partition[rank], dy, HIP_R_64F);
+*
+*    hipsparseDistSpMV(
+*        handle, matA, &alpha, vecX, &beta, vecY, HIP_R_64F, HIPSPARSE_SPMV_ALG_DEFAULT);
+*
+*    hipsparseDestroyDistCsr(matA);
+*  \endcode
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateDistCsr(hipsparseDistCsrDescr_t*    matA,
+                                         hipsparseHandle_t           handle,
+                                         const hipsparseTransport_t* transport,
+                                         const int64_t*              partition,
+                                         int64_t                     nnz,
+                                         const void*                 csrRowOffsets,
+                                         const void*                 csrColInd,
+                                         const void*                 csrValues,
+                                         hipsparseIndexType_t        csrRowOffsetsType,
+                                         hipsparseIndexType_t        csrColIndType,
+                                         hipsparseIndexBase_t        idxBase,
+                                         hipDataType                 valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Destroy the rows of a distributed CSR matrix
+*
+*  \details
+*  \p hipsparseDestroyDistCsr frees the blocks, the buffers and the plans of the rows of a
+*  distributed matrix. It is not collective.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyDistCsr(hipsparseDistCsrDescr_t matA);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Get the sizes of the blocks of the rows of a distributed CSR matrix
+*
+*  \details
+*  \p hipsparseDistCsrGet returns the sizes of the local and the ghost blocks of a rank.
+*
+*  @param[in]
+*  matA        the rows of the distributed matrix owned by the rank.
+*  @param[out]
+*  rows        number of rows of the rank, and of columns of its local block.
+*  @param[out]
+*  ghosts      number of compressed ghost columns.
+*  @param[out]
+*  localNnz    number of non-zero entries of the local block.
+*  @param[out]
+*  ghostNnz    number of non-zero entries of the ghost block.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p matA, \p rows, \p ghosts, \p localNnz or
+*          \p ghostNnz is invalid.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDistCsrGet(hipsparseDistCsrDescr_t matA,
+                                      int64_t*                rows,
+                                      int64_t*                ghosts,
+                                      int64_t*                localNnz,
+                                      int64_t*                ghostNnz);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Distributed sparse matrix multiplication with a dense vector
+*
+*  \details
+*  \p hipsparseDistSpMV computes the rows of \f$y := \alpha \cdot A \cdot x + \beta \cdot y\f$
+*  owned by the rank, where \f$A\f$ is a distributed matrix, see hipsparseCreateDistCsr().
+*  \p vecX and \p vecY hold the entries of \f$x\f$ and \f$y\f$ owned by the rank.
+*
+*  The halo exchange overlaps the product with the local block:
+*  - the entries of \f$x\f$ needed by the neighbours are gathered and copied to the host,
+*    and the receives of the ghost entries are posted,
+*  - the product with the local block is enqueued, then the sends are posted,
+*  - once every message is received, the ghost entries are copied to the device and the
+*    product with the ghost block is accumulated into \f$y\f$.
+*
+*  The routine is collective, every rank of the transport must call it. The plans of the two
+*  products are prepared by the first call, see hipsparseCreateSpMVPlan(), and again when
+*  the data type of \f$x\f$, \p computeType or \p alg changes. A rank that fails, with
+*  invalid arguments or on the device, still sends and receives every message of the halo
+*  exchange, with its status in the header of each message, so that the neighbours do not wait
+*  for it: the failed rank returns its error, and the ranks that receive entries of \f$x\f$
+*  from it return \ref HIPSPARSE_STATUS_INTERNAL_ERROR. Only a null \p matA is returned at
+*  once.
+*
+*  \note
+*  This routine is blocking, it returns when the ghost entries are received and the
+*  product with the ghost block is enqueued. It is not supported with
+*  \ref HIPSPARSE_SYNC_MODE_CAPTURE_SAFE.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  matA        the rows of the distributed matrix owned by the rank.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  vecX        dense vector descriptor of the entries of \f$x\f$ owned by the rank.
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  vecY        dense vector descriptor of the entries of \f$y\f$ owned by the rank.
+*  @param[in]
+*  computeType precision of the products.
+*  @param[in]
+*  alg         SpMV algorithm of the products.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p alpha, \p vecX, \p beta or
+*          \p vecY is invalid, or the size of \p vecX or \p vecY is not the number of rows of
+*          the rank.
+*  \retval HIPSPARSE_STATUS_ALLOC_FAILED the resources could not be allocated.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType or the sync mode is not supported.
+*  \retval HIPSPARSE_STATUS_INTERNAL_ERROR a rank sending entries of \f$x\f$ to this rank
+*          failed.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDistSpMV(hipsparseHandle_t           handle,
+                                    hipsparseDistCsrDescr_t     matA,
+                                    const void*                 alpha,
+                                    hipsparseConstDnVecDescr_t  vecX,
+                                    const void*                 beta,
+                                    const hipsparseDnVecDescr_t vecY,
+                                    hipDataType                 computeType,
+                                    hipsparseSpMVAlg_t          alg);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Description: Calculate the buffer size required for the sparse matrix multiplication with a dense matrix
 *
@@ -15961,6 +17220,15 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
 *  \details
 *  \p hipsparseSpMM computes sparse matrix multiplication with a dense matrix
 *
+*  \p matA and \p matB either hold values of \p computeType, as \p matC does, or narrower
+*  values accumulated in a wider \p computeType:
+*  - HIP_R_8I values with HIP_R_32I or HIP_R_32F compute and C of the compute type,
+*  - HIP_R_16F values with HIP_R_32F compute and C of type HIP_R_16F or HIP_R_32F,
+*  - HIP_R_16BF values with HIP_R_32F compute and C of type HIP_R_16BF or HIP_R_32F.
+*
+*  \p alpha and \p beta are of \p computeType. Which of these combinations a backend implements
+*  depends on its version, the others return \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*
 *  \par Example
 *  \code{.c}
 *    // A, B, and C are m×k, k×n, and m×n
@@ -17045,6 +18313,89 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVDescr_t        spsvDescr);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Description: Update the values of the matrix of a sparse triangular solve
+*
+*  \details
+*  \p hipsparseSpSV_updateMatrix replaces the values of the matrix analysed by
+*  hipsparseSpSV_analysis() with \p spsvDescr. The sparsity pattern and the analysis,
+*  e.g. the level schedule, are kept, so that the next calls to hipsparseSpSV_solve() use
+*  the new values without a new analysis. This is the case of a factorization whose values
+*  are recomputed on a fixed pattern.
+*
+*  With \ref HIPSPARSE_SPSV_UPDATE_GENERAL, \p newValues holds the nnz values of the
+*  matrix in the order of the analysed matrix, and the values pointer of its descriptor is
+*  set to \p newValues. With \ref HIPSPARSE_SPSV_UPDATE_DIAGONAL, \p newValues holds the
+*  \f$m\f$ diagonal entries used by the next solves in place of those of the matrix, it
+*  must remain valid until the next update or analysis.
+*
+*  \note
+*  With \ref HIPSPARSE_SPSV_UPDATE_GENERAL, the AMD and host backends modify the sparse
+*  matrix descriptor passed to hipsparseSpSV_analysis(), even though it is passed as a
+*  const descriptor: hipsparseSpMatGetValues() returns \p newValues afterwards, and the
+*  descriptor must not be destroyed while \p spsvDescr is in use. Its previous values array
+*  is not modified.
+*
+*  \note
+*  The AMD backend only supports \ref HIPSPARSE_SPSV_UPDATE_GENERAL. The CUDA backend
+*  requires CUDA 12.1 or later.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p spsvDescr or \p newValues is
+*          invalid, or \p spsvDescr has not been analysed.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p updatePart is not supported.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpSV_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSVDescr_t  spsvDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSVUpdate_t updatePart);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Description: Sparse triangular solve of a batch of right-hand sides
+*
+*  \details
+*  \p hipsparseSpSV_solveBatched solves \f$op(A) \cdot y_i = \alpha \cdot x_i\f$ for the
+*  \p batchCount independent pairs of dense vectors of \p x and \p y, with the analysis of
+*  \p spsvDescr. The vectors do not need to be stored in a dense matrix as for
+*  hipsparseSpSM_solve(). The results are the same as those of hipsparseSpSV_solve() called
+*  for each pair with the same parameters, but the arguments are checked once. The host
+*  backend solves the vectors of a level of the schedule together.
+*
+*  \par Example
+*  \code{.c}
+*    // A, x[0] and y[0] are analysed as for hipsparseSpSV_solve()
+*    std::vector<hipsparseConstDnVecDescr_t> x(batchCount);
+*    std::vector<hipsparseDnVecDescr_t>      y(batchCount);
+*
+*    hipsparseSpSV_solveBatched(handle,
+*                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+*                               &alpha,
+*                               A,
+*                               batchCount,
+*                               x.data(),
+*                               y.data(),
+*                               HIP_R_32F,
+*                               HIPSPARSE_SPSV_ALG_DEFAULT,
+*                               spsvDescr);
+*  \endcode
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpSV_solveBatched(hipsparseHandle_t                 handle,
+                                             hipsparseOperation_t              opA,
+                                             const void*                       alpha,
+                                             hipsparseConstSpMatDescr_t        matA,
+                                             int                               batchCount,
+                                             const hipsparseConstDnVecDescr_t* x,
+                                             const hipsparseDnVecDescr_t*      y,
+                                             hipDataType                       computeType,
+                                             hipsparseSpSVAlg_t                alg,
+                                             hipsparseSpSVDescr_t              spsvDescr);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Description: Create sparse matrix triangular solve with multiple rhs descriptor
 *  \details
@@ -17200,6 +18551,31 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       void*                       externalBuffer);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Description: Update the values of the matrix of a sparse triangular system solve
+*
+*  \details
+*  \p hipsparseSpSM_updateMatrix replaces the values of the matrix analysed by
+*  hipsparseSpSM_analysis() with \p spsmDescr, the sparsity pattern and the analysis are
+*  kept. \p newValues and \p updatePart are as in hipsparseSpSV_updateMatrix().
+*
+*  \note
+*  With \ref HIPSPARSE_SPSM_UPDATE_GENERAL, the AMD backend sets the values pointer of the
+*  sparse matrix descriptor passed to hipsparseSpSM_analysis() to \p newValues, as
+*  hipsparseSpSV_updateMatrix() does.
+*
+*  \note
+*  The AMD backend only supports \ref HIPSPARSE_SPSM_UPDATE_GENERAL. The CUDA backend
+*  requires CUDA 12.4 or later.
+*/
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpSM_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSMDescr_t  spsmDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSMUpdate_t updatePart);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
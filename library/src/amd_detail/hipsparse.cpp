@@ -23,24 +23,35 @@
 
 #include "hipsparse.h"
 
+#include "../common/hipsparse_memory.hpp"
+#include "../common/hipsparse_trace.hpp"
+
 #include <hip/hip_complex.h>
 #include <hip/hip_runtime_api.h>
 #include <rocsparse/rocsparse.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
 
-#define RETURN_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                            \
-    {                                                                          \
-        hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;              \
-        if(TMP_STATUS_FOR_CHECK != hipSuccess)                                 \
-        {                                                                      \
-            return hipsparse::hipErrorToHIPSPARSEStatus(TMP_STATUS_FOR_CHECK); \
-        }                                                                      \
+// Used in API functions only, the status is returned through the trace of the function, see
+// HIPSPARSE_TRACE.
+#define RETURN_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                                   \
+    {                                                                                 \
+        hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                     \
+        if(TMP_STATUS_FOR_CHECK != hipSuccess)                                        \
+        {                                                                             \
+            return trace(hipsparse::hipErrorToHIPSPARSEStatus(TMP_STATUS_FOR_CHECK)); \
+        }                                                                             \
     }
 
 #define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
@@ -48,28 +59,104 @@
         hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
         if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
         {                                                                \
-            return TMP_STATUS_FOR_CHECK;                                 \
+            return trace(TMP_STATUS_FOR_CHECK);                          \
         }                                                                \
     }
 
-#define RETURN_IF_ROCSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                       \
-    {                                                                           \
-        rocsparse_status TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;         \
-        if(TMP_STATUS_FOR_CHECK != rocsparse_status_success)                    \
-        {                                                                       \
-            return hipsparse::rocSPARSEStatusToHIPStatus(TMP_STATUS_FOR_CHECK); \
-        }                                                                       \
+#define RETURN_IF_ROCSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                              \
+    {                                                                                  \
+        rocsparse_status TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                \
+        if(TMP_STATUS_FOR_CHECK != rocsparse_status_success)                           \
+        {                                                                              \
+            return trace(hipsparse::rocSPARSEStatusToHIPStatus(TMP_STATUS_FOR_CHECK)); \
+        }                                                                              \
     }
 
 // csru2csr struct - to hold permutation array
 struct csru2csrInfo
 {
-    int  size = 0;
-    int* P    = nullptr;
+    int  size     = 0;
+    int  capacity = 0;
+    int* P        = nullptr;
 };
 
 namespace hipsparse
 {
+    // Accounting of the device memory allocated by hipSPARSE itself.
+    struct internalMemoryUsage
+    {
+        std::mutex              mutex;
+        std::map<void*, size_t> sizes;
+        size_t                  current = 0;
+        size_t                  peak    = 0;
+    };
+
+    static internalMemoryUsage& getInternalMemoryUsage()
+    {
+        static internalMemoryUsage usage;
+        return usage;
+    }
+
+    hipError_t internalMalloc(void** ptr, size_t size)
+    {
+        hipError_t status = hipMalloc(ptr, size);
+        if(status == hipSuccess)
+        {
+            profileAllocation();
+
+            internalMemoryUsage&        usage = getInternalMemoryUsage();
+            std::lock_guard<std::mutex> lock(usage.mutex);
+            usage.sizes[*ptr] = size;
+            usage.current += size;
+            usage.peak = std::max(usage.peak, usage.current);
+        }
+        return status;
+    }
+
+    hipError_t internalFree(void* ptr)
+    {
+        {
+            internalMemoryUsage&        usage = getInternalMemoryUsage();
+            std::lock_guard<std::mutex> lock(usage.mutex);
+            auto                        it = usage.sizes.find(ptr);
+            if(it != usage.sizes.end())
+            {
+                usage.current -= it->second;
+                usage.sizes.erase(it);
+            }
+        }
+        return hipFree(ptr);
+    }
+
+    hipError_t internalMemcpyAsync(void* dst, const void* src, size_t size, hipStream_t stream)
+    {
+        return hipMemcpyAsync(dst, src, size, hipMemcpyDefault, stream);
+    }
+
+    hipError_t internalStreamSynchronize(hipStream_t stream)
+    {
+        return hipStreamSynchronize(stream);
+    }
+
+    hipError_t internalMemcpyToHost(void* dst, const void* src, size_t size)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, src) == hipSuccess && attr.type == hipMemoryTypeDevice)
+        {
+            return hipMemcpy(dst, src, size, hipMemcpyDeviceToHost);
+        }
+
+        // Unregistered host memory is reported as an error by some runtimes, clear it.
+        (void)hipGetLastError();
+        memcpy(dst, src, size);
+        return hipSuccess;
+    }
+
+    hipError_t internalDeviceSynchronize()
+    {
+        return hipDeviceSynchronize();
+    }
+
     hipsparseStatus_t hipErrorToHIPSPARSEStatus(hipError_t status)
     {
         switch(status)
@@ -94,6 +181,377 @@ namespace hipsparse
         }
     }
 
+    // Device resident 0 and 1 in all precisions, the internal scalars of the routines in
+    // device pointer mode, e.g. the alpha of hipsparseXcsrgemm().
+    struct deviceConstants
+    {
+        float            s[2];
+        double           d[2];
+        hipComplex       c[2];
+        hipDoubleComplex z[2];
+    };
+
+    // Device workspace of a handle, it holds the temporary buffers of the routines that do not
+    // take one from the user, e.g. hipsparseXcsrgemmNnz(). The library owned buffer only
+    // grows, so that these routines do not allocate once the largest size has been reached.
+    // It also holds the other state hipSPARSE keeps per handle on top of rocSPARSE.
+    struct workspace
+    {
+        std::mutex  mutex;
+        void*       buffer      = nullptr;
+        size_t      size        = 0;
+        void*       user_buffer = nullptr;
+        size_t      user_size   = 0;
+        bool        used        = false;
+        hipStream_t stream      = nullptr;
+
+        // Read by every routine that may synchronize, without a lock
+        std::atomic<hipsparseSyncMode_t> sync_mode{HIPSPARSE_SYNC_MODE_BLOCKING};
+
+        // Staged by hipsparseCreate(), immutable afterwards
+        deviceConstants* constants = nullptr;
+
+        // Handle of the workspace, nullptr while it is free
+        std::atomic<hipsparseHandle_t> owner{nullptr};
+    };
+
+    // The workspaces are recycled rather than freed, so that a workspace cached by a thread
+    // remains valid memory once its handle is destroyed, its owner tells whether it still
+    // belongs to the handle.
+    struct workspaceRegistry
+    {
+        std::mutex                              mutex;
+        std::map<hipsparseHandle_t, workspace*> workspaces;
+        std::vector<std::unique_ptr<workspace>> entries;
+        std::vector<workspace*>                 free;
+    };
+
+    static workspaceRegistry& getWorkspaceRegistry()
+    {
+        static workspaceRegistry registry;
+        return registry;
+    }
+
+    // Workspace of a handle, created if needed and create is true, nullptr otherwise.
+    static workspace* findWorkspace(hipsparseHandle_t handle, bool create)
+    {
+        // Most threads use a single handle, its workspace is cached and read without the lock
+        thread_local workspace* cached = nullptr;
+        if(cached != nullptr && handle != nullptr
+           && cached->owner.load(std::memory_order_acquire) == handle)
+        {
+            return cached;
+        }
+
+        workspaceRegistry&          registry = getWorkspaceRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto it = registry.workspaces.find(handle);
+        if(it != registry.workspaces.end())
+        {
+            cached = it->second;
+            return cached;
+        }
+        if(create == false)
+        {
+            return nullptr;
+        }
+
+        workspace* ws;
+        if(registry.free.empty())
+        {
+            registry.entries.emplace_back(new workspace);
+            ws = registry.entries.back().get();
+        }
+        else
+        {
+            ws = registry.free.back();
+            registry.free.pop_back();
+        }
+        ws->owner.store(handle, std::memory_order_release);
+        registry.workspaces[handle] = ws;
+
+        cached = ws;
+        return cached;
+    }
+
+    static workspace& getWorkspace(hipsparseHandle_t handle)
+    {
+        return *findWorkspace(handle, true);
+    }
+
+    static hipError_t destroyWorkspace(hipsparseHandle_t handle)
+    {
+        workspace* ws;
+        {
+            workspaceRegistry&          registry = getWorkspaceRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto                        it = registry.workspaces.find(handle);
+            if(it == registry.workspaces.end())
+            {
+                return hipSuccess;
+            }
+            ws = it->second;
+            ws->owner.store(nullptr, std::memory_order_release);
+            registry.workspaces.erase(it);
+        }
+
+        hipError_t status = hipSuccess;
+        if(ws->constants != nullptr)
+        {
+            status = internalFree(ws->constants);
+        }
+        if(ws->buffer != nullptr)
+        {
+            hipError_t buffer_status = internalFree(ws->buffer);
+            status                   = (status != hipSuccess) ? status : buffer_status;
+        }
+
+        ws->buffer      = nullptr;
+        ws->size        = 0;
+        ws->user_buffer = nullptr;
+        ws->user_size   = 0;
+        ws->used        = false;
+        ws->stream      = nullptr;
+        ws->constants   = nullptr;
+        ws->sync_mode.store(HIPSPARSE_SYNC_MODE_BLOCKING, std::memory_order_relaxed);
+
+        workspaceRegistry&          registry = getWorkspaceRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.free.push_back(ws);
+        return status;
+    }
+
+    // Stage the constants of a new handle, called by hipsparseCreate().
+    static hipError_t createDeviceConstants(hipsparseHandle_t handle)
+    {
+        deviceConstants host;
+        host.s[0] = 0.0f;
+        host.s[1] = 1.0f;
+        host.d[0] = 0.0;
+        host.d[1] = 1.0;
+        host.c[0] = make_hipComplex(0.0f, 0.0f);
+        host.c[1] = make_hipComplex(1.0f, 0.0f);
+        host.z[0] = make_hipDoubleComplex(0.0, 0.0);
+        host.z[1] = make_hipDoubleComplex(1.0, 0.0);
+
+        void*      ptr;
+        hipError_t status = internalMalloc(&ptr, sizeof(deviceConstants));
+        if(status != hipSuccess)
+        {
+            return status;
+        }
+
+        status = hipMemcpy(ptr, &host, sizeof(deviceConstants), hipMemcpyHostToDevice);
+        if(status != hipSuccess)
+        {
+            internalFree(ptr);
+            return status;
+        }
+
+        getWorkspace(handle).constants = static_cast<deviceConstants*>(ptr);
+        return hipSuccess;
+    }
+
+    // The constants are immutable once the handle is created, they are read without a lock.
+    static hipError_t getDeviceConstants(hipsparseHandle_t handle, deviceConstants** constants)
+    {
+        workspace* ws = findWorkspace(handle, false);
+        if(ws == nullptr || ws->constants == nullptr)
+        {
+            return hipErrorInvalidResourceHandle;
+        }
+
+        *constants = ws->constants;
+        return hipSuccess;
+    }
+
+    // Return in ptr the device copy of value, 0 or 1, in the precision of type.
+    static hipError_t
+        getDeviceConstant(hipsparseHandle_t handle, hipDataType type, int value, const void** ptr)
+    {
+        deviceConstants* constants;
+        hipError_t       status = getDeviceConstants(handle, &constants);
+        if(status != hipSuccess)
+        {
+            return status;
+        }
+
+        value = (value != 0) ? 1 : 0;
+        switch(type)
+        {
+        case HIP_R_32F:
+            *ptr = &constants->s[value];
+            return hipSuccess;
+        case HIP_R_64F:
+            *ptr = &constants->d[value];
+            return hipSuccess;
+        case HIP_C_32F:
+            *ptr = &constants->c[value];
+            return hipSuccess;
+        case HIP_C_64F:
+            *ptr = &constants->z[value];
+            return hipSuccess;
+        default:
+            return hipErrorInvalidValue;
+        }
+    }
+
+    static void setSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+    {
+        getWorkspace(handle).sync_mode.store(mode, std::memory_order_relaxed);
+    }
+
+    static hipsparseSyncMode_t getSyncMode(hipsparseHandle_t handle)
+    {
+        workspace* ws = findWorkspace(handle, false);
+        return (ws != nullptr) ? ws->sync_mode.load(std::memory_order_relaxed)
+                               : HIPSPARSE_SYNC_MODE_BLOCKING;
+    }
+
+    // Reject a routine that has to allocate, free or synchronize, if the handle is in
+    // capture-safe sync mode.
+    static hipsparseStatus_t checkCapture(hipsparseHandle_t handle)
+    {
+        return (getSyncMode(handle) == HIPSPARSE_SYNC_MODE_CAPTURE_SAFE)
+                   ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                   : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Reject a routine that is blocking in cuSPARSE, or that returns a result through a host
+    // pointer, if the handle is in capture-safe sync mode and the pointer mode is host. It
+    // is called before any work is enqueued.
+    static hipsparseStatus_t checkBlockingCapture(hipsparseHandle_t handle)
+    {
+        if(getSyncMode(handle) != HIPSPARSE_SYNC_MODE_CAPTURE_SAFE)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        rocsparse_pointer_mode pointer_mode;
+        if(rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode)
+               == rocsparse_status_success
+           && pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Synchronize the stream of a routine that is blocking in cuSPARSE, unless the handle is
+    // in non-blocking or capture-safe sync mode and the results are in device memory.
+    static hipError_t blockingSync(hipsparseHandle_t handle, hipStream_t stream)
+    {
+        if(getSyncMode(handle) != HIPSPARSE_SYNC_MODE_BLOCKING)
+        {
+            rocsparse_pointer_mode pointer_mode;
+            if(rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode)
+                   == rocsparse_status_success
+               && pointer_mode == rocsparse_pointer_mode_device)
+            {
+                return hipSuccess;
+            }
+        }
+        return hipStreamSynchronize(stream);
+    }
+
+    static hipsparseStatus_t getStream(hipsparseHandle_t handle, hipStream_t* stream);
+
+    // Exclusive access to the workspace of a handle for the duration of a routine.
+    class workspaceLock
+    {
+    public:
+        explicit workspaceLock(hipsparseHandle_t handle)
+            : m_handle(handle)
+            , m_workspace(getWorkspace(handle))
+            , m_lock(m_workspace.mutex)
+        {
+        }
+
+        // Return a buffer of at least size bytes, it is valid until the lock is released.
+        hipsparseStatus_t acquire(size_t size, void** buffer)
+        {
+            *buffer = nullptr;
+
+            if(size == 0)
+            {
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+
+            hipStream_t       stream;
+            hipsparseStatus_t status = getStream(m_handle, &stream);
+            if(status != HIPSPARSE_STATUS_SUCCESS)
+            {
+                return status;
+            }
+
+            // The buffer cannot be reallocated, nor the device synchronized, during a capture
+            const bool capture = (getSyncMode(m_handle) == HIPSPARSE_SYNC_MODE_CAPTURE_SAFE);
+
+            // The previous routine may still use the buffer on another stream, which may have
+            // been destroyed since, hence the device synchronization
+            if(m_workspace.used && m_workspace.stream != stream)
+            {
+                if(capture)
+                {
+                    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+                }
+
+                status = hipErrorToHIPSPARSEStatus(hipDeviceSynchronize());
+                if(status != HIPSPARSE_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+            }
+
+            if(m_workspace.user_size >= size)
+            {
+                *buffer = m_workspace.user_buffer;
+            }
+            else
+            {
+                if(m_workspace.size < size)
+                {
+                    if(capture)
+                    {
+                        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+                    }
+
+                    // hipFree waits for the pending work using the buffer
+                    if(m_workspace.buffer != nullptr)
+                    {
+                        status = hipErrorToHIPSPARSEStatus(internalFree(m_workspace.buffer));
+                        m_workspace.buffer = nullptr;
+                        m_workspace.size   = 0;
+                        if(status != HIPSPARSE_STATUS_SUCCESS)
+                        {
+                            return status;
+                        }
+                    }
+
+                    status = hipErrorToHIPSPARSEStatus(internalMalloc(&m_workspace.buffer, size));
+                    if(status != HIPSPARSE_STATUS_SUCCESS)
+                    {
+                        m_workspace.buffer = nullptr;
+                        return status;
+                    }
+                    m_workspace.size = size;
+                }
+                *buffer = m_workspace.buffer;
+            }
+
+            m_workspace.used   = true;
+            m_workspace.stream = stream;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+    private:
+        hipsparseHandle_t           m_handle;
+        workspace&                  m_workspace;
+        std::lock_guard<std::mutex> m_lock;
+    };
+
     hipsparseStatus_t rocSPARSEStatusToHIPStatus(rocsparse_status_ status)
     {
         switch(status)
@@ -187,6 +645,25 @@ namespace hipsparse
         }
     }
 
+    // Stream and pointer mode of a handle, for the library itself, the public getters are
+    // traced and profiled as calls of the user.
+    static hipsparseStatus_t getStream(hipsparseHandle_t handle, hipStream_t* stream)
+    {
+        return rocSPARSEStatusToHIPStatus(rocsparse_get_stream((rocsparse_handle)handle, stream));
+    }
+
+    static hipsparseStatus_t getPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
+    {
+        rocsparse_pointer_mode_ rocsparse_mode;
+        rocsparse_status        status
+            = rocsparse_get_pointer_mode((rocsparse_handle)handle, &rocsparse_mode);
+        if(status == rocsparse_status_success)
+        {
+            *mode = HCCPtrModeToHIPPtrMode(rocsparse_mode);
+        }
+        return rocSPARSEStatusToHIPStatus(status);
+    }
+
     rocsparse_action_ hipActionToHCCAction(hipsparseAction_t action)
     {
         switch(action)
@@ -450,6 +927,13 @@ namespace hipsparse
         }
     }
 
+// The narrow value types of mixed precision SpMV and SpMM, i.e. int8 values accumulated in int32
+// or float, and half or bfloat16 values accumulated in float. Half and bfloat16 came with later
+// rocSPARSE releases than the integer types.
+#define HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(major_, minor_) \
+    (ROCSPARSE_VERSION_MAJOR > (major_)                      \
+     || (ROCSPARSE_VERSION_MAJOR == (major_) && ROCSPARSE_VERSION_MINOR >= (minor_)))
+
     rocsparse_datatype_ hipDataTypeToHCCDataType(hipDataType datatype)
     {
         switch(datatype)
@@ -462,11 +946,57 @@ namespace hipsparse
             return rocsparse_datatype_f32_c;
         case HIP_C_64F:
             return rocsparse_datatype_f64_c;
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(2, 0)
+        case HIP_R_8I:
+            return rocsparse_datatype_i8_r;
+        case HIP_R_8U:
+            return rocsparse_datatype_u8_r;
+        case HIP_R_32I:
+            return rocsparse_datatype_i32_r;
+        case HIP_R_32U:
+            return rocsparse_datatype_u32_r;
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(3, 2)
+        case HIP_R_16F:
+            return rocsparse_datatype_f16_r;
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(4, 0)
+        case HIP_R_16BF:
+            return rocsparse_datatype_bf16_r;
+#endif
         default:
             throw "Non existent hipDataType";
         }
     }
 
+    // Reject the data types hipDataTypeToHCCDataType() cannot map with this rocSPARSE
+    // version, before they are converted.
+    hipsparseStatus_t checkDataType(hipDataType datatype)
+    {
+        switch(datatype)
+        {
+        case HIP_R_32F:
+        case HIP_R_64F:
+        case HIP_C_32F:
+        case HIP_C_64F:
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(2, 0)
+        case HIP_R_8I:
+        case HIP_R_8U:
+        case HIP_R_32I:
+        case HIP_R_32U:
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(3, 2)
+        case HIP_R_16F:
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(4, 0)
+        case HIP_R_16BF:
+#endif
+            return HIPSPARSE_STATUS_SUCCESS;
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     hipDataType HCCDataTypeToHIPDataType(rocsparse_datatype_ datatype)
     {
         switch(datatype)
@@ -479,6 +1009,24 @@ namespace hipsparse
             return HIP_C_32F;
         case rocsparse_datatype_f64_c:
             return HIP_C_64F;
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(2, 0)
+        case rocsparse_datatype_i8_r:
+            return HIP_R_8I;
+        case rocsparse_datatype_u8_r:
+            return HIP_R_8U;
+        case rocsparse_datatype_i32_r:
+            return HIP_R_32I;
+        case rocsparse_datatype_u32_r:
+            return HIP_R_32U;
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(3, 2)
+        case rocsparse_datatype_f16_r:
+            return HIP_R_16F;
+#endif
+#if HIPSPARSE_ROCSPARSE_VERSION_AT_LEAST(4, 0)
+        case rocsparse_datatype_bf16_r:
+            return HIP_R_16BF;
+#endif
         default:
             throw "Non existent rocsparse_datatype";
         }
@@ -670,10 +1218,12 @@ namespace hipsparse
 
 hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
 {
+    HIPSPARSE_TRACE(handle);
+
     // Check if handle is valid
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     int               deviceId;
@@ -686,13 +1236,106 @@ hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
         retval = hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_create_handle((rocsparse_handle*)handle));
     }
-    return retval;
+
+    if(err == hipSuccess && retval == HIPSPARSE_STATUS_SUCCESS)
+    {
+        // Stage the internal scalars once, instead of copying them in every call
+        err = hipsparse::createDeviceConstants(*handle);
+        if(err != hipSuccess)
+        {
+            hipsparse::destroyWorkspace(*handle);
+            rocsparse_destroy_handle((rocsparse_handle)*handle);
+            retval = hipsparse::hipErrorToHIPSPARSEStatus(err);
+        }
+    }
+    return trace(retval);
 }
 
 hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle);
+
+    // The workspace is recycled even if freeing its memory fails, the handle is destroyed
+    // regardless and the first error is returned
+    hipError_t hip_status = hipsparse::destroyWorkspace(handle);
+
+    // Free the counters before the address of the handle can be reused
+    hipsparse::profileRelease(handle);
+
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_handle((rocsparse_handle)handle));
+
+    return trace((hip_status != hipSuccess) ? hipsparse::hipErrorToHIPSPARSEStatus(hip_status)
+                                            : status);
+}
+
+hipsparseStatus_t hipsparseGetInternalMemoryUsage(size_t* currentBytes, size_t* peakBytes)
+{
+    HIPSPARSE_TRACE(currentBytes, peakBytes);
+
+    hipsparse::internalMemoryUsage& usage = hipsparse::getInternalMemoryUsage();
+    std::lock_guard<std::mutex>     lock(usage.mutex);
+    if(currentBytes != nullptr)
+    {
+        *currentBytes = usage.current;
+    }
+    if(peakBytes != nullptr)
+    {
+        *peakBytes = usage.peak;
+    }
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseResetInternalMemoryUsage(void)
+{
+    static const hipsparse::traceSite trace_site = {__func__, "", -1, -1, -1};
+    hipsparse::traceCall              trace(trace_site);
+
+    hipsparse::internalMemoryUsage& usage = hipsparse::getInternalMemoryUsage();
+    std::lock_guard<std::mutex>     lock(usage.mutex);
+    usage.peak = usage.current;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t
+    hipsparseSetWorkspace(hipsparseHandle_t handle, void* workspace, size_t workspaceSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, workspace, workspaceSizeInBytes);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(workspace == nullptr && workspaceSizeInBytes != 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::workspace&       ws = hipsparse::getWorkspace(handle);
+    std::lock_guard<std::mutex> lock(ws.mutex);
+
+    // The library owned buffer cannot be freed during a capture, the handle is left unchanged
+    const bool release = workspaceSizeInBytes != 0 && ws.buffer != nullptr;
+    if(release)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
+    }
+
+    ws.user_buffer = workspace;
+    ws.user_size   = workspaceSizeInBytes;
+
+    // The library owned buffer is released, it is allocated again if a routine needs more
+    // than the user workspace
+    if(release)
+    {
+        void* buffer = ws.buffer;
+        ws.buffer    = nullptr;
+        ws.size      = 0;
+        RETURN_IF_HIP_ERROR(hipsparse::internalFree(buffer));
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 const char* hipsparseGetErrorName(hipsparseStatus_t status)
@@ -707,27 +1350,31 @@ const char* hipsparseGetErrorString(hipsparseStatus_t status)
 
 hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 {
+    HIPSPARSE_TRACE(handle, version);
+
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
     }
 
     *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 {
+    HIPSPARSE_TRACE(handle, rev);
+
     // Get hipSPARSE revision
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
     }
 
     if(rev == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     static constexpr char v[] = TO_STR(hipsparseVersionTweak);
@@ -752,57 +1399,107 @@ hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
             rocsparse_ver % 100,
             rocsparse_rev);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_set_stream((rocsparse_handle)handle, streamId));
+    HIPSPARSE_TRACE(handle, streamId);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_set_stream((rocsparse_handle)handle, streamId)));
 }
 
 hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_get_stream((rocsparse_handle)handle, streamId));
+    HIPSPARSE_TRACE(handle, streamId);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_get_stream((rocsparse_handle)handle, streamId)));
 }
 
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_pointer_mode(
-        (rocsparse_handle)handle, hipsparse::hipPtrModeToHCCPtrMode(mode)));
+    HIPSPARSE_TRACE(handle, mode);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_pointer_mode(
+        (rocsparse_handle)handle, hipsparse::hipPtrModeToHCCPtrMode(mode))));
 }
 
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
 {
+    HIPSPARSE_TRACE(handle, mode);
+
     rocsparse_pointer_mode_ rocsparse_mode;
     rocsparse_status status = rocsparse_get_pointer_mode((rocsparse_handle)handle, &rocsparse_mode);
     *mode                   = hipsparse::HCCPtrModeToHIPPtrMode(rocsparse_mode);
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
+}
+
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(mode != HIPSPARSE_SYNC_MODE_BLOCKING && mode != HIPSPARSE_SYNC_MODE_NON_BLOCKING
+       && mode != HIPSPARSE_SYNC_MODE_CAPTURE_SAFE)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::setSyncMode(handle, mode);
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr || mode == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *mode = hipsparse::getSyncMode(handle);
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_descr((rocsparse_mat_descr*)descrA));
+    HIPSPARSE_TRACE(descrA);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_descr((rocsparse_mat_descr*)descrA)));
 }
 
 hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_descr((rocsparse_mat_descr)descrA));
+    HIPSPARSE_TRACE(descrA);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_descr((rocsparse_mat_descr)descrA)));
 }
 
 hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_copy_mat_descr((rocsparse_mat_descr)dest, (const rocsparse_mat_descr)src));
+    HIPSPARSE_TRACE(dest, src);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_copy_mat_descr((rocsparse_mat_descr)dest, (const rocsparse_mat_descr)src)));
 }
 
 hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_type(
-        (rocsparse_mat_descr)descrA, hipsparse::hipMatTypeToHCCMatType(type)));
+    HIPSPARSE_TRACE(descrA, type);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_type(
+        (rocsparse_mat_descr)descrA, hipsparse::hipMatTypeToHCCMatType(type))));
 }
 
 hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
@@ -812,8 +1509,10 @@ hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatFillMode(hipsparseMatDescr_t descrA, hipsparseFillMode_t fillMode)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_fill_mode(
-        (rocsparse_mat_descr)descrA, hipsparse::hipFillModeToHCCFillMode(fillMode)));
+    HIPSPARSE_TRACE(descrA, fillMode);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_fill_mode(
+        (rocsparse_mat_descr)descrA, hipsparse::hipFillModeToHCCFillMode(fillMode))));
 }
 
 hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
@@ -824,8 +1523,10 @@ hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatDiagType(hipsparseMatDescr_t descrA, hipsparseDiagType_t diagType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_diag_type(
-        (rocsparse_mat_descr)descrA, hipsparse::hipDiagTypeToHCCDiagType(diagType)));
+    HIPSPARSE_TRACE(descrA, diagType);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_diag_type(
+        (rocsparse_mat_descr)descrA, hipsparse::hipDiagTypeToHCCDiagType(diagType))));
 }
 
 hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
@@ -836,8 +1537,10 @@ hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparseIndexBase_t base)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_index_base(
-        (rocsparse_mat_descr)descrA, hipsparse::hipBaseToHCCBase(base)));
+    HIPSPARSE_TRACE(descrA, base);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_mat_index_base(
+        (rocsparse_mat_descr)descrA, hipsparse::hipBaseToHCCBase(base))));
 }
 
 hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
@@ -847,180 +1550,234 @@ hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseCreateHybMat(hipsparseHybMat_t* hybA)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_hyb_mat((rocsparse_hyb_mat*)hybA));
+    HIPSPARSE_TRACE(hybA);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_hyb_mat((rocsparse_hyb_mat*)hybA)));
 }
 
 hipsparseStatus_t hipsparseDestroyHybMat(hipsparseHybMat_t hybA)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_hyb_mat((rocsparse_hyb_mat)hybA));
+    HIPSPARSE_TRACE(hybA);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_hyb_mat((rocsparse_hyb_mat)hybA)));
 }
 
 hipsparseStatus_t hipsparseCreateBsrsv2Info(bsrsv2Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrsv2Info(bsrsv2Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateBsrsm2Info(bsrsm2Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrsm2Info(bsrsm2Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsrsv2Info(csrsv2Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrsv2Info(csrsv2Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateColorInfo(hipsparseColorInfo_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyColorInfo(hipsparseColorInfo_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsrsm2Info(csrsm2Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrsm2Info(csrsm2Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateBsrilu02Info(bsrilu02Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrilu02Info(bsrilu02Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsrilu02Info(csrilu02Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrilu02Info(csrilu02Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateBsric02Info(bsric02Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsric02Info(bsric02Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsric02Info(csric02Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsric02Info(csric02Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsrgemm2Info(csrgemm2Info_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreatePruneInfo(pruneInfo_t* info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_mat_info((rocsparse_mat_info*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_mat_info((rocsparse_mat_info*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyPruneInfo(pruneInfo_t info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_mat_info((rocsparse_mat_info)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_mat_info((rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info)
 {
+    HIPSPARSE_TRACE(info);
+
     if(info == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     *info = new csru2csrInfo;
 
     // Initialize permutation array with nullptr
-    (*info)->size = 0;
-    (*info)->P    = nullptr;
+    (*info)->size     = 0;
+    (*info)->capacity = 0;
+    (*info)->P        = nullptr;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
 {
+    HIPSPARSE_TRACE(info);
+
     // Check if info structure has been created
     if(info != nullptr)
     {
         // Check if permutation array is allocated
         if(info->P != nullptr)
         {
-            RETURN_IF_HIP_ERROR(hipFree(info->P));
-            info->size = 0;
+            RETURN_IF_HIP_ERROR(hipsparse::internalFree(info->P));
+            info->size     = 0;
+            info->capacity = 0;
         }
 
         delete info;
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
@@ -1031,8 +1788,16 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_saxpyi(
-        (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_saxpyi((rocsparse_handle)handle,
+                         nnz,
+                         alpha,
+                         xVal,
+                         xInd,
+                         y,
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
@@ -1043,8 +1808,16 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_daxpyi(
-        (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_daxpyi((rocsparse_handle)handle,
+                         nnz,
+                         alpha,
+                         xVal,
+                         xInd,
+                         y,
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
@@ -1055,14 +1828,16 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_caxpyi((rocsparse_handle)handle,
                          nnz,
                          (const rocsparse_float_complex*)alpha,
                          (const rocsparse_float_complex*)xVal,
                          xInd,
                          (rocsparse_float_complex*)y,
-                         hipsparse::hipBaseToHCCBase(idxBase)));
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
@@ -1073,14 +1848,16 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zaxpyi((rocsparse_handle)handle,
                          nnz,
                          (const rocsparse_double_complex*)alpha,
                          (const rocsparse_double_complex*)xVal,
                          xInd,
                          (rocsparse_double_complex*)y,
-                         hipsparse::hipBaseToHCCBase(idxBase)));
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
@@ -1091,9 +1868,13 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Doti
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdoti((rocsparse_handle)handle,
@@ -1105,9 +1886,9 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
@@ -1118,9 +1899,13 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Doti
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddoti((rocsparse_handle)handle,
@@ -1132,9 +1917,9 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
@@ -1145,9 +1930,13 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Doti
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdoti((rocsparse_handle)handle,
@@ -1159,9 +1948,9 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
@@ -1172,9 +1961,13 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Doti
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdoti((rocsparse_handle)handle,
@@ -1186,9 +1979,9 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
@@ -1199,9 +1992,13 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Dotci
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdotci((rocsparse_handle)handle,
@@ -1213,9 +2010,9 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
@@ -1226,9 +2023,13 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Dotci
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdotci((rocsparse_handle)handle,
@@ -1240,9 +2041,9 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
@@ -1252,8 +2053,10 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthr(
-        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthr(
+        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
@@ -1263,8 +2066,10 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthr(
-        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthr(
+        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
@@ -1274,13 +2079,15 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthr((rocsparse_handle)handle,
                         nnz,
                         (const rocsparse_float_complex*)y,
                         (rocsparse_float_complex*)xVal,
                         xInd,
-                        hipsparse::hipBaseToHCCBase(idxBase)));
+                        hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
@@ -1290,13 +2097,15 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthr((rocsparse_handle)handle,
                         nnz,
                         (const rocsparse_double_complex*)y,
                         (rocsparse_double_complex*)xVal,
                         xInd,
-                        hipsparse::hipBaseToHCCBase(idxBase)));
+                        hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
@@ -1306,8 +2115,10 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthrz(
-        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthrz(
+        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
@@ -1317,8 +2128,10 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthrz(
-        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthrz(
+        (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
@@ -1328,13 +2141,15 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthrz((rocsparse_handle)handle,
                          nnz,
                          (rocsparse_float_complex*)y,
                          (rocsparse_float_complex*)xVal,
                          xInd,
-                         hipsparse::hipBaseToHCCBase(idxBase)));
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
@@ -1344,13 +2159,15 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthrz((rocsparse_handle)handle,
                          nnz,
                          (rocsparse_double_complex*)y,
                          (rocsparse_double_complex*)xVal,
                          xInd,
-                         hipsparse::hipBaseToHCCBase(idxBase)));
+                         hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
@@ -1362,8 +2179,10 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                                  const float*         s,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sroti(
-        (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sroti(
+        (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
@@ -1375,8 +2194,10 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                                  const double*        s,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_droti(
-        (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_droti(
+        (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
@@ -1386,8 +2207,10 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_ssctr(
-        (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_ssctr(
+        (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
@@ -1397,8 +2220,10 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsctr(
-        (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsctr(
+        (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
@@ -1408,13 +2233,15 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csctr((rocsparse_handle)handle,
                         nnz,
                         (const rocsparse_float_complex*)xVal,
                         xInd,
                         (rocsparse_float_complex*)y,
-                        hipsparse::hipBaseToHCCBase(idxBase)));
+                        hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
@@ -1424,13 +2251,15 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zsctr((rocsparse_handle)handle,
                         nnz,
                         (const rocsparse_double_complex*)xVal,
                         xInd,
                         (rocsparse_double_complex*)y,
-                        hipsparse::hipBaseToHCCBase(idxBase)));
+                        hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
@@ -1447,7 +2276,21 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -1461,7 +2304,7 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
@@ -1478,7 +2321,21 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -1492,7 +2349,7 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
@@ -1509,7 +2366,21 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -1523,7 +2394,7 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          (const rocsparse_float_complex*)x,
                          (const rocsparse_float_complex*)beta,
-                         (rocsparse_float_complex*)y));
+                         (rocsparse_float_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
@@ -1540,7 +2411,21 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -1554,24 +2439,28 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          (const rocsparse_double_complex*)x,
                          (const rocsparse_double_complex*)beta,
-                         (rocsparse_double_complex*)y));
+                         (rocsparse_double_complex*)y)));
 }
 
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsv zero pivot
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_zero_pivot(
         (rocsparse_handle)handle, nullptr, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1585,9 +2474,20 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -1606,7 +2506,7 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1620,9 +2520,20 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -1641,7 +2552,7 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1655,9 +2566,20 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -1676,7 +2598,7 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1690,9 +2612,20 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -1711,7 +2644,7 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1725,7 +2658,18 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      m,
@@ -1735,7 +2679,7 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1749,7 +2693,18 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      m,
@@ -1759,7 +2714,7 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1773,7 +2728,18 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      m,
@@ -1783,7 +2749,7 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1797,7 +2763,18 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      m,
@@ -1807,7 +2784,7 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1822,9 +2799,23 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsv analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -1842,9 +2833,9 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1859,9 +2850,23 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsv analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -1879,9 +2884,9 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1896,9 +2901,23 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsv analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -1916,9 +2935,9 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1933,9 +2952,23 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsv analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -1953,9 +2986,9 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
@@ -1973,7 +3006,22 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                m,
@@ -1987,7 +3035,7 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                f,
                                x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
@@ -2005,7 +3053,22 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                m,
@@ -2019,7 +3082,7 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                f,
                                x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
@@ -2037,7 +3100,22 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                m,
@@ -2051,7 +3129,7 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                (const rocsparse_float_complex*)f,
                                (rocsparse_float_complex*)x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
@@ -2069,7 +3147,22 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                m,
@@ -2083,7 +3176,7 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                (const rocsparse_double_complex*)f,
                                (rocsparse_double_complex*)x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
@@ -2095,7 +3188,9 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_shybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          alpha,
@@ -2103,7 +3198,7 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                          (rocsparse_hyb_mat)hybA,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
@@ -2115,7 +3210,9 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          alpha,
@@ -2123,7 +3220,7 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                          (rocsparse_hyb_mat)hybA,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
@@ -2135,7 +3232,9 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_chybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          (const rocsparse_float_complex*)alpha,
@@ -2143,7 +3242,7 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                          (rocsparse_hyb_mat)hybA,
                          (const rocsparse_float_complex*)x,
                          (const rocsparse_float_complex*)beta,
-                         (rocsparse_float_complex*)y));
+                         (rocsparse_float_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
@@ -2155,7 +3254,9 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          (const rocsparse_double_complex*)alpha,
@@ -2163,7 +3264,7 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                          (rocsparse_hyb_mat)hybA,
                          (const rocsparse_double_complex*)x,
                          (const rocsparse_double_complex*)beta,
-                         (rocsparse_double_complex*)y));
+                         (rocsparse_double_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
@@ -2182,7 +3283,23 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2198,7 +3315,7 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
@@ -2217,7 +3334,23 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2233,7 +3366,7 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          x,
                          beta,
-                         y));
+                         y)));
 }
 
 hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
@@ -2252,7 +3385,23 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2268,7 +3417,7 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          (const rocsparse_float_complex*)x,
                          (const rocsparse_float_complex*)beta,
-                         (rocsparse_float_complex*)y));
+                         (rocsparse_float_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
@@ -2287,7 +3436,23 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2303,7 +3468,7 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                          nullptr,
                          (const rocsparse_double_complex*)x,
                          (const rocsparse_double_complex*)beta,
-                         (rocsparse_double_complex*)y));
+                         (rocsparse_double_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
@@ -2325,7 +3490,26 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
                           hipsparse::hipOperationToHCCOperation(trans),
@@ -2343,7 +3527,7 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                           blockDim,
                           x,
                           beta,
-                          y));
+                          y)));
 }
 
 hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
@@ -2365,7 +3549,26 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
                           hipsparse::hipOperationToHCCOperation(trans),
@@ -2383,7 +3586,7 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                           blockDim,
                           x,
                           beta,
-                          y));
+                          y)));
 }
 
 hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
@@ -2405,7 +3608,26 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
                           hipsparse::hipOperationToHCCOperation(trans),
@@ -2423,7 +3645,7 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                           blockDim,
                           (const rocsparse_float_complex*)x,
                           (const rocsparse_float_complex*)beta,
-                          (rocsparse_float_complex*)y));
+                          (rocsparse_float_complex*)y)));
 }
 
 hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
@@ -2445,7 +3667,26 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
                           hipsparse::hipOperationToHCCOperation(trans),
@@ -2463,14 +3704,18 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                           blockDim,
                           (const rocsparse_double_complex*)x,
                           (const rocsparse_double_complex*)beta,
-                          (rocsparse_double_complex*)y));
+                          (rocsparse_double_complex*)y)));
 }
 
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position)));
 }
 
 hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2486,9 +3731,22 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -2509,7 +3767,7 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2525,9 +3783,22 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -2548,7 +3819,7 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2564,9 +3835,22 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -2587,7 +3871,7 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2603,9 +3887,22 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -2626,7 +3923,7 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2642,7 +3939,20 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -2654,7 +3964,7 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      bsrSortedColIndA,
                                      blockDim,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2670,7 +3980,20 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -2682,7 +4005,7 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      bsrSortedColIndA,
                                      blockDim,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2698,7 +4021,20 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -2710,7 +4046,7 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      bsrSortedColIndA,
                                      blockDim,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2726,7 +4062,20 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -2738,7 +4087,7 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                      bsrSortedColIndA,
                                      blockDim,
                                      (rocsparse_mat_info)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2755,7 +4104,21 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -2769,7 +4132,7 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2786,7 +4149,21 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -2800,7 +4177,7 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2817,7 +4194,21 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -2831,7 +4222,7 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2848,7 +4239,21 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -2862,7 +4267,7 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2882,7 +4287,24 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2898,7 +4320,7 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                f,
                                x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2918,7 +4340,24 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2934,7 +4373,7 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                f,
                                x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2954,7 +4393,24 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2970,7 +4426,7 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                (const rocsparse_float_complex*)f,
                                (rocsparse_float_complex*)x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2990,7 +4446,24 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -3006,7 +4479,7 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                (const rocsparse_double_complex*)f,
                                (rocsparse_double_complex*)x,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -3016,9 +4489,11 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t buffer_size;
@@ -3033,7 +4508,7 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -3043,9 +4518,11 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t buffer_size;
@@ -3060,7 +4537,7 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -3070,9 +4547,11 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t buffer_size;
@@ -3087,7 +4566,7 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -3097,9 +4576,11 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t buffer_size;
@@ -3114,7 +4595,7 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
@@ -3132,7 +4613,9 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -3146,7 +4629,7 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                          beta,
                          y,
                          hipsparse::hipBaseToHCCBase(idxBase),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
@@ -3164,7 +4647,9 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -3178,7 +4663,7 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                          beta,
                          y,
                          hipsparse::hipBaseToHCCBase(idxBase),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
@@ -3196,7 +4681,9 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -3210,7 +4697,7 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                          (const rocsparse_float_complex*)beta,
                          (rocsparse_float_complex*)y,
                          hipsparse::hipBaseToHCCBase(idxBase),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
@@ -3228,7 +4715,9 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          m,
@@ -3242,7 +4731,7 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                          (const rocsparse_double_complex*)beta,
                          (rocsparse_double_complex*)y,
                          hipsparse::hipBaseToHCCBase(idxBase),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
@@ -3265,7 +4754,27 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3284,7 +4793,7 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
@@ -3307,7 +4816,27 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3326,7 +4855,7 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
@@ -3349,7 +4878,27 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3368,7 +4917,7 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_float_complex*)beta,
                          (rocsparse_float_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
@@ -3391,7 +4940,27 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3410,7 +4979,7 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_double_complex*)beta,
                          (rocsparse_double_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
@@ -3430,7 +4999,24 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          rocsparse_operation_none,
@@ -3447,7 +5033,7 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
@@ -3467,7 +5053,24 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          rocsparse_operation_none,
@@ -3484,7 +5087,7 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
@@ -3504,7 +5107,24 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          rocsparse_operation_none,
@@ -3521,7 +5141,7 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_float_complex*)beta,
                          (rocsparse_float_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
@@ -3541,7 +5161,24 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          rocsparse_operation_none,
@@ -3558,7 +5195,7 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_double_complex*)beta,
                          (rocsparse_double_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
@@ -3579,7 +5216,25 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          hipsparse::hipOperationToHCCOperation(transB),
@@ -3596,7 +5251,7 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
@@ -3617,7 +5272,25 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          hipsparse::hipOperationToHCCOperation(transB),
@@ -3634,7 +5307,7 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                          ldb,
                          beta,
                          C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
@@ -3655,7 +5328,25 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          hipsparse::hipOperationToHCCOperation(transB),
@@ -3672,7 +5363,7 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_float_complex*)beta,
                          (rocsparse_float_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
@@ -3693,7 +5384,25 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
                          hipsparse::hipOperationToHCCOperation(transB),
@@ -3710,24 +5419,28 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                          ldb,
                          (const rocsparse_double_complex*)beta,
                          (rocsparse_double_complex*)C,
-                         ldc));
+                         ldc)));
 }
 
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrsm2_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrsm zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_bsrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3745,9 +5458,24 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t size;
@@ -3770,7 +5498,7 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3788,9 +5516,24 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t size;
@@ -3813,7 +5556,7 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3831,9 +5574,24 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t size;
@@ -3856,7 +5614,7 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3874,9 +5632,24 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t size;
@@ -3899,7 +5672,7 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)size;
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3918,7 +5691,23 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -3934,7 +5723,7 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3953,7 +5742,23 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -3969,7 +5774,7 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3988,7 +5793,23 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4004,7 +5825,7 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4023,7 +5844,23 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4039,7 +5876,7 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
@@ -4063,7 +5900,28 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4083,7 +5941,7 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                X,
                                ldx,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
@@ -4107,7 +5965,28 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4127,7 +6006,7 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                X,
                                ldx,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
@@ -4151,7 +6030,28 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4171,7 +6071,7 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                (rocsparse_float_complex*)X,
                                ldx,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
@@ -4195,7 +6095,28 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4215,24 +6136,28 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                (rocsparse_double_complex*)X,
                                ldx,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrsm2_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrsm zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_csrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4253,7 +6178,25 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      hipsparse::hipOperationToHCCOperation(transB),
@@ -4269,7 +6212,7 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                      ldb,
                                      (rocsparse_mat_info)info,
                                      rocsparse_solve_policy_auto,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4290,7 +6233,25 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      hipsparse::hipOperationToHCCOperation(transB),
@@ -4306,7 +6267,7 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                      ldb,
                                      (rocsparse_mat_info)info,
                                      rocsparse_solve_policy_auto,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4327,7 +6288,25 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      hipsparse::hipOperationToHCCOperation(transB),
@@ -4343,7 +6322,7 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                      ldb,
                                      (rocsparse_mat_info)info,
                                      rocsparse_solve_policy_auto,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4364,7 +6343,25 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
                                      hipsparse::hipOperationToHCCOperation(transB),
@@ -4380,7 +6377,7 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                      ldb,
                                      (rocsparse_mat_info)info,
                                      rocsparse_solve_policy_auto,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4401,7 +6398,25 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
                                   hipsparse::hipOperationToHCCOperation(transB),
@@ -4418,7 +6433,7 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4439,7 +6454,25 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
                                   hipsparse::hipOperationToHCCOperation(transB),
@@ -4456,7 +6489,7 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4477,7 +6510,25 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
                                   hipsparse::hipOperationToHCCOperation(transB),
@@ -4494,7 +6545,7 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4515,7 +6566,25 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
                                   hipsparse::hipOperationToHCCOperation(transB),
@@ -4532,7 +6601,7 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                   (rocsparse_mat_info)info,
                                   rocsparse_analysis_policy_force,
                                   rocsparse_solve_policy_auto,
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
@@ -4553,7 +6622,25 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                hipsparse::hipOperationToHCCOperation(transB),
@@ -4569,7 +6656,7 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                ldb,
                                (rocsparse_mat_info)info,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4590,7 +6677,25 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                hipsparse::hipOperationToHCCOperation(transB),
@@ -4606,7 +6711,7 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                ldb,
                                (rocsparse_mat_info)info,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4627,7 +6732,25 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                hipsparse::hipOperationToHCCOperation(transB),
@@ -4643,7 +6766,7 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                ldb,
                                (rocsparse_mat_info)info,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4664,7 +6787,25 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
                                hipsparse::hipOperationToHCCOperation(transB),
@@ -4680,7 +6821,7 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                ldb,
                                (rocsparse_mat_info)info,
                                rocsparse_solve_policy_auto,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
@@ -4698,6 +6839,21 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4723,12 +6879,12 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
     {
         rocsparse_destroy_mat_descr(descr);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
@@ -4746,6 +6902,21 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4771,12 +6942,12 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
     {
         rocsparse_destroy_mat_descr(descr);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
@@ -4794,6 +6965,21 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4819,12 +7005,12 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
     {
         rocsparse_destroy_mat_descr(descr);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
@@ -4842,6 +7028,21 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4867,12 +7068,12 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
     {
         rocsparse_destroy_mat_descr(descr);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
@@ -4890,7 +7091,24 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
                               n,
@@ -4904,7 +7122,7 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                               csrColIndB,
                               (const rocsparse_mat_descr)descrC,
                               csrRowPtrC,
-                              nnzTotalDevHostPtr));
+                              nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
@@ -4927,7 +7145,27 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -4946,7 +7184,7 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
@@ -4969,7 +7207,27 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -4988,7 +7246,7 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
@@ -5011,7 +7269,27 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5030,7 +7308,7 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            (rocsparse_float_complex*)csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
@@ -5053,7 +7331,27 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5072,7 +7370,7 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            (rocsparse_double_complex*)csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5096,9 +7394,30 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5122,9 +7441,30 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5148,9 +7488,30 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5174,9 +7535,30 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
@@ -5195,7 +7577,25 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    nnzA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    descrB,
+                    nnzB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedRowPtrC,
+                    nnzTotalDevHostPtr,
+                    workspace);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
                               n,
@@ -5209,7 +7609,7 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                               csrSortedColIndB,
                               (const rocsparse_mat_descr)descrC,
                               csrSortedRowPtrC,
-                              nnzTotalDevHostPtr));
+                              nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
@@ -5233,7 +7633,28 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5252,7 +7673,7 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            csrSortedValC,
                            csrSortedRowPtrC,
-                           csrSortedColIndC));
+                           csrSortedColIndC)));
 }
 
 hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
@@ -5276,7 +7697,28 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5295,7 +7737,7 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            csrSortedValC,
                            csrSortedRowPtrC,
-                           csrSortedColIndC));
+                           csrSortedColIndC)));
 }
 
 hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
@@ -5319,7 +7761,28 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5338,7 +7801,7 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            (rocsparse_float_complex*)csrSortedValC,
                            csrSortedRowPtrC,
-                           csrSortedColIndC));
+                           csrSortedColIndC)));
 }
 
 hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
@@ -5362,7 +7825,28 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
                            n,
@@ -5381,7 +7865,7 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                            (const rocsparse_mat_descr)descrC,
                            (rocsparse_double_complex*)csrSortedValC,
                            csrSortedRowPtrC,
-                           csrSortedColIndC));
+                           csrSortedColIndC)));
 }
 
 hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
@@ -5402,6 +7886,26 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5410,9 +7914,9 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    // alpha = 1.0, taken from the device constants of the handle in device pointer mode
+    hipDoubleComplex        one   = make_hipDoubleComplex(1.0, 0.0);
+    const hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5425,19 +7929,13 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
         RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
+            hipsparse::getDeviceConstant(handle, HIP_C_64F, 1, (const void**)&alpha));
     }
 
     // Obtain temporary buffer size
@@ -5467,21 +7965,13 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &temp_buffer));
 
     // Determine nnz
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5509,27 +7999,16 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                               info,
                               temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
@@ -5553,6 +8032,27 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5561,9 +8061,9 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    float  one = 1.0f;
-    float* alpha;
+    // alpha = 1.0, taken from the device constants of the handle in device pointer mode
+    float        one   = 1.0f;
+    const float* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5576,18 +8076,13 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        alpha  = (float*)malloc(sizeof(float));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(float)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(float), hipMemcpyHostToDevice));
+        RETURN_IF_HIP_ERROR(
+            hipsparse::getDeviceConstant(handle, HIP_R_32F, 1, (const void**)&alpha));
     }
 
     // Obtain temporary buffer size
@@ -5617,21 +8112,13 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5665,27 +8152,16 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
@@ -5709,6 +8185,27 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5717,9 +8214,9 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    double  one = 1.0;
-    double* alpha;
+    // alpha = 1.0, taken from the device constants of the handle in device pointer mode
+    double        one   = 1.0;
+    const double* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5732,18 +8229,13 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        alpha  = (double*)malloc(sizeof(double));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(double)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(double), hipMemcpyHostToDevice));
+        RETURN_IF_HIP_ERROR(
+            hipsparse::getDeviceConstant(handle, HIP_R_64F, 1, (const void**)&alpha));
     }
 
     // Obtain temporary buffer size
@@ -5773,21 +8265,13 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5815,33 +8299,22 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                            nullptr,
                            nullptr,
                            (rocsparse_mat_descr)descrC,
-                           csrValC,
-                           csrRowPtrC,
-                           csrColIndC,
-                           info,
-                           temp_buffer));
-
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+                           csrValC,
+                           csrRowPtrC,
+                           csrColIndC,
+                           info,
+                           temp_buffer));
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
@@ -5865,6 +8338,27 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5873,9 +8367,9 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    hipComplex  one = make_hipComplex(1.0f, 0.0f);
-    hipComplex* alpha;
+    // alpha = 1.0, taken from the device constants of the handle in device pointer mode
+    hipComplex        one   = make_hipComplex(1.0f, 0.0f);
+    const hipComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5888,18 +8382,13 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        alpha  = (hipComplex*)malloc(sizeof(hipComplex));
-        *alpha = one;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipComplex)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(hipComplex), hipMemcpyHostToDevice));
+        RETURN_IF_HIP_ERROR(
+            hipsparse::getDeviceConstant(handle, HIP_C_32F, 1, (const void**)&alpha));
     }
 
     // Obtain temporary buffer size
@@ -5929,21 +8418,13 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5977,27 +8458,16 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
@@ -6021,6 +8491,27 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -6029,9 +8520,9 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     size_t buffer_size;
     void*  temp_buffer;
 
-    // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    // alpha = 1.0, taken from the device constants of the handle in device pointer mode
+    hipDoubleComplex        one   = make_hipDoubleComplex(1.0, 0.0);
+    const hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -6044,19 +8535,13 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
         RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
+            hipsparse::getDeviceConstant(handle, HIP_C_64F, 1, (const void**)&alpha));
     }
 
     // Obtain temporary buffer size
@@ -6086,21 +8571,13 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &temp_buffer));
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -6134,27 +8611,16 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
 
-        return status;
+        return trace(status);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6178,7 +8644,28 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
                                        rocsparse_operation_none,
@@ -6200,7 +8687,7 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                        csrRowPtrD,
                                        csrColIndD,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6224,7 +8711,28 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
                                        rocsparse_operation_none,
@@ -6246,7 +8754,7 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                        csrRowPtrD,
                                        csrColIndD,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6270,7 +8778,28 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
                                        rocsparse_operation_none,
@@ -6292,7 +8821,7 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                        csrRowPtrD,
                                        csrColIndD,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6316,7 +8845,28 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
                                        rocsparse_operation_none,
@@ -6338,7 +8888,7 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                        csrRowPtrD,
                                        csrColIndD,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
@@ -6363,29 +8913,54 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
-                                                                       rocsparse_operation_none,
-                                                                       rocsparse_operation_none,
-                                                                       m,
-                                                                       n,
-                                                                       k,
-                                                                       (rocsparse_mat_descr)descrA,
-                                                                       nnzA,
-                                                                       csrRowPtrA,
-                                                                       csrColIndA,
-                                                                       (rocsparse_mat_descr)descrB,
-                                                                       nnzB,
-                                                                       csrRowPtrB,
-                                                                       csrColIndB,
-                                                                       (rocsparse_mat_descr)descrD,
-                                                                       nnzD,
-                                                                       csrRowPtrD,
-                                                                       csrColIndD,
-                                                                       (rocsparse_mat_descr)descrC,
-                                                                       csrRowPtrC,
-                                                                       nnzTotalDevHostPtr,
-                                                                       (rocsparse_mat_info)info,
-                                                                       pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_csrgemm_nnz((rocsparse_handle)handle,
+                              rocsparse_operation_none,
+                              rocsparse_operation_none,
+                              m,
+                              n,
+                              k,
+                              (rocsparse_mat_descr)descrA,
+                              nnzA,
+                              csrRowPtrA,
+                              csrColIndA,
+                              (rocsparse_mat_descr)descrB,
+                              nnzB,
+                              csrRowPtrB,
+                              csrColIndB,
+                              (rocsparse_mat_descr)descrD,
+                              nnzD,
+                              csrRowPtrD,
+                              csrColIndD,
+                              (rocsparse_mat_descr)descrC,
+                              csrRowPtrC,
+                              nnzTotalDevHostPtr,
+                              (rocsparse_mat_info)info,
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
@@ -6416,35 +8991,64 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
-                                                                    rocsparse_operation_none,
-                                                                    rocsparse_operation_none,
-                                                                    m,
-                                                                    n,
-                                                                    k,
-                                                                    alpha,
-                                                                    (rocsparse_mat_descr)descrA,
-                                                                    nnzA,
-                                                                    csrValA,
-                                                                    csrRowPtrA,
-                                                                    csrColIndA,
-                                                                    (rocsparse_mat_descr)descrB,
-                                                                    nnzB,
-                                                                    csrValB,
-                                                                    csrRowPtrB,
-                                                                    csrColIndB,
-                                                                    beta,
-                                                                    (rocsparse_mat_descr)descrD,
-                                                                    nnzD,
-                                                                    csrValD,
-                                                                    csrRowPtrD,
-                                                                    csrColIndD,
-                                                                    (rocsparse_mat_descr)descrC,
-                                                                    csrValC,
-                                                                    csrRowPtrC,
-                                                                    csrColIndC,
-                                                                    (rocsparse_mat_info)info,
-                                                                    pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scsrgemm((rocsparse_handle)handle,
+                           rocsparse_operation_none,
+                           rocsparse_operation_none,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           (rocsparse_mat_descr)descrA,
+                           nnzA,
+                           csrValA,
+                           csrRowPtrA,
+                           csrColIndA,
+                           (rocsparse_mat_descr)descrB,
+                           nnzB,
+                           csrValB,
+                           csrRowPtrB,
+                           csrColIndB,
+                           beta,
+                           (rocsparse_mat_descr)descrD,
+                           nnzD,
+                           csrValD,
+                           csrRowPtrD,
+                           csrColIndD,
+                           (rocsparse_mat_descr)descrC,
+                           csrValC,
+                           csrRowPtrC,
+                           csrColIndC,
+                           (rocsparse_mat_info)info,
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
@@ -6475,35 +9079,64 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
-                                                                    rocsparse_operation_none,
-                                                                    rocsparse_operation_none,
-                                                                    m,
-                                                                    n,
-                                                                    k,
-                                                                    alpha,
-                                                                    (rocsparse_mat_descr)descrA,
-                                                                    nnzA,
-                                                                    csrValA,
-                                                                    csrRowPtrA,
-                                                                    csrColIndA,
-                                                                    (rocsparse_mat_descr)descrB,
-                                                                    nnzB,
-                                                                    csrValB,
-                                                                    csrRowPtrB,
-                                                                    csrColIndB,
-                                                                    beta,
-                                                                    (rocsparse_mat_descr)descrD,
-                                                                    nnzD,
-                                                                    csrValD,
-                                                                    csrRowPtrD,
-                                                                    csrColIndD,
-                                                                    (rocsparse_mat_descr)descrC,
-                                                                    csrValC,
-                                                                    csrRowPtrC,
-                                                                    csrColIndC,
-                                                                    (rocsparse_mat_info)info,
-                                                                    pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dcsrgemm((rocsparse_handle)handle,
+                           rocsparse_operation_none,
+                           rocsparse_operation_none,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           (rocsparse_mat_descr)descrA,
+                           nnzA,
+                           csrValA,
+                           csrRowPtrA,
+                           csrColIndA,
+                           (rocsparse_mat_descr)descrB,
+                           nnzB,
+                           csrValB,
+                           csrRowPtrB,
+                           csrColIndB,
+                           beta,
+                           (rocsparse_mat_descr)descrD,
+                           nnzD,
+                           csrValD,
+                           csrRowPtrD,
+                           csrColIndD,
+                           (rocsparse_mat_descr)descrC,
+                           csrValC,
+                           csrRowPtrC,
+                           csrColIndC,
+                           (rocsparse_mat_info)info,
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
@@ -6534,7 +9167,35 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
                            rocsparse_operation_none,
@@ -6563,7 +9224,7 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                            csrRowPtrC,
                            csrColIndC,
                            (rocsparse_mat_info)info,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
@@ -6594,7 +9255,35 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
                            rocsparse_operation_none,
@@ -6623,38 +9312,483 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                            csrRowPtrC,
                            csrColIndC,
                            (rocsparse_mat_info)info,
-                           pBuffer));
+                           pBuffer)));
+}
+
+hipsparseStatus_t hipsparseXcsrgemm2Symbolic(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       n,
+                                             int                       k,
+                                             const hipsparseMatDescr_t descrA,
+                                             int                       nnzA,
+                                             const int*                csrRowPtrA,
+                                             const int*                csrColIndA,
+                                             const hipsparseMatDescr_t descrB,
+                                             int                       nnzB,
+                                             const int*                csrRowPtrB,
+                                             const int*                csrColIndB,
+                                             const hipsparseMatDescr_t descrD,
+                                             int                       nnzD,
+                                             const int*                csrRowPtrD,
+                                             const int*                csrColIndD,
+                                             const hipsparseMatDescr_t descrC,
+                                             int                       nnzC,
+                                             const int*                csrRowPtrC,
+                                             int*                      csrColIndC,
+                                             const csrgemm2Info_t      info,
+                                             void*                     pBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    nnzC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_csrgemm_symbolic((rocsparse_handle)handle,
+                                   rocsparse_operation_none,
+                                   rocsparse_operation_none,
+                                   m,
+                                   n,
+                                   k,
+                                   (rocsparse_mat_descr)descrA,
+                                   nnzA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   (rocsparse_mat_descr)descrB,
+                                   nnzB,
+                                   csrRowPtrB,
+                                   csrColIndB,
+                                   (rocsparse_mat_descr)descrD,
+                                   nnzD,
+                                   csrRowPtrD,
+                                   csrColIndD,
+                                   (rocsparse_mat_descr)descrC,
+                                   nnzC,
+                                   csrRowPtrC,
+                                   csrColIndC,
+                                   (rocsparse_mat_info)info,
+                                   pBuffer)));
+}
+
+hipsparseStatus_t hipsparseScsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const float*              alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const float*              csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const float*              csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const float*              beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const float*              csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            float*                    csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    nnzC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scsrgemm_numeric((rocsparse_handle)handle,
+                                   rocsparse_operation_none,
+                                   rocsparse_operation_none,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   (rocsparse_mat_descr)descrA,
+                                   nnzA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   (rocsparse_mat_descr)descrB,
+                                   nnzB,
+                                   csrValB,
+                                   csrRowPtrB,
+                                   csrColIndB,
+                                   beta,
+                                   (rocsparse_mat_descr)descrD,
+                                   nnzD,
+                                   csrValD,
+                                   csrRowPtrD,
+                                   csrColIndD,
+                                   (rocsparse_mat_descr)descrC,
+                                   nnzC,
+                                   csrValC,
+                                   csrRowPtrC,
+                                   csrColIndC,
+                                   (rocsparse_mat_info)info,
+                                   pBuffer)));
+}
+
+hipsparseStatus_t hipsparseDcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const double*             alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const double*             csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const double*             csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const double*             beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const double*             csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            double*                   csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    nnzC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dcsrgemm_numeric((rocsparse_handle)handle,
+                                   rocsparse_operation_none,
+                                   rocsparse_operation_none,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   (rocsparse_mat_descr)descrA,
+                                   nnzA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   (rocsparse_mat_descr)descrB,
+                                   nnzB,
+                                   csrValB,
+                                   csrRowPtrB,
+                                   csrColIndB,
+                                   beta,
+                                   (rocsparse_mat_descr)descrD,
+                                   nnzD,
+                                   csrValD,
+                                   csrRowPtrD,
+                                   csrColIndD,
+                                   (rocsparse_mat_descr)descrC,
+                                   nnzC,
+                                   csrValC,
+                                   csrRowPtrC,
+                                   csrColIndC,
+                                   (rocsparse_mat_info)info,
+                                   pBuffer)));
+}
+
+hipsparseStatus_t hipsparseCcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipComplex*         alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipComplex*         csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipComplex*         csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipComplex*         beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const hipComplex*         csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            hipComplex*               csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    nnzC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_ccsrgemm_numeric((rocsparse_handle)handle,
+                                   rocsparse_operation_none,
+                                   rocsparse_operation_none,
+                                   m,
+                                   n,
+                                   k,
+                                   (const rocsparse_float_complex*)alpha,
+                                   (rocsparse_mat_descr)descrA,
+                                   nnzA,
+                                   (const rocsparse_float_complex*)csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   (rocsparse_mat_descr)descrB,
+                                   nnzB,
+                                   (const rocsparse_float_complex*)csrValB,
+                                   csrRowPtrB,
+                                   csrColIndB,
+                                   (const rocsparse_float_complex*)beta,
+                                   (rocsparse_mat_descr)descrD,
+                                   nnzD,
+                                   (const rocsparse_float_complex*)csrValD,
+                                   csrRowPtrD,
+                                   csrColIndD,
+                                   (rocsparse_mat_descr)descrC,
+                                   nnzC,
+                                   (rocsparse_float_complex*)csrValC,
+                                   csrRowPtrC,
+                                   csrColIndC,
+                                   (rocsparse_mat_info)info,
+                                   pBuffer)));
+}
+
+hipsparseStatus_t hipsparseZcsrgemm2Numeric(hipsparseHandle_t         handle,
+                                            int                       m,
+                                            int                       n,
+                                            int                       k,
+                                            const hipDoubleComplex*   alpha,
+                                            const hipsparseMatDescr_t descrA,
+                                            int                       nnzA,
+                                            const hipDoubleComplex*   csrValA,
+                                            const int*                csrRowPtrA,
+                                            const int*                csrColIndA,
+                                            const hipsparseMatDescr_t descrB,
+                                            int                       nnzB,
+                                            const hipDoubleComplex*   csrValB,
+                                            const int*                csrRowPtrB,
+                                            const int*                csrColIndB,
+                                            const hipDoubleComplex*   beta,
+                                            const hipsparseMatDescr_t descrD,
+                                            int                       nnzD,
+                                            const hipDoubleComplex*   csrValD,
+                                            const int*                csrRowPtrD,
+                                            const int*                csrColIndD,
+                                            const hipsparseMatDescr_t descrC,
+                                            int                       nnzC,
+                                            hipDoubleComplex*         csrValC,
+                                            const int*                csrRowPtrC,
+                                            const int*                csrColIndC,
+                                            const csrgemm2Info_t      info,
+                                            void*                     pBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    nnzC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_zcsrgemm_numeric((rocsparse_handle)handle,
+                                   rocsparse_operation_none,
+                                   rocsparse_operation_none,
+                                   m,
+                                   n,
+                                   k,
+                                   (const rocsparse_double_complex*)alpha,
+                                   (rocsparse_mat_descr)descrA,
+                                   nnzA,
+                                   (const rocsparse_double_complex*)csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   (rocsparse_mat_descr)descrB,
+                                   nnzB,
+                                   (const rocsparse_double_complex*)csrValB,
+                                   csrRowPtrB,
+                                   csrColIndB,
+                                   (const rocsparse_double_complex*)beta,
+                                   (rocsparse_mat_descr)descrD,
+                                   nnzD,
+                                   (const rocsparse_double_complex*)csrValD,
+                                   csrRowPtrD,
+                                   csrColIndD,
+                                   (rocsparse_mat_descr)descrC,
+                                   nnzC,
+                                   (rocsparse_double_complex*)csrValC,
+                                   csrRowPtrC,
+                                   csrColIndC,
+                                   (rocsparse_mat_info)info,
+                                   pBuffer)));
 }
 
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrilu0 zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_bsrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
-        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
+        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
-        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
+        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -6663,12 +9797,14 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcbsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
                                           enable_boost,
                                           tol,
-                                          (rocsparse_float_complex*)boost_val));
+                                          (rocsparse_float_complex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -6677,12 +9813,14 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
                                          enable_boost,
                                          tol,
-                                         (rocsparse_double_complex*)boost_val));
+                                         (rocsparse_double_complex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6697,9 +9835,21 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -6719,7 +9869,7 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6734,9 +9884,21 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -6756,7 +9918,7 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6771,9 +9933,21 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -6793,7 +9967,7 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6808,9 +9982,21 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -6830,7 +10016,7 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6846,9 +10032,24 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -6867,9 +10068,9 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6885,9 +10086,24 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -6906,9 +10122,9 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6924,9 +10140,24 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -6945,9 +10176,9 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6963,9 +10194,24 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -6984,9 +10230,9 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
@@ -7002,7 +10248,20 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
                            mb,
@@ -7014,7 +10273,7 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                            blockDim,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
@@ -7030,7 +10289,20 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
                            mb,
@@ -7042,7 +10314,7 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                            blockDim,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
@@ -7058,7 +10330,20 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
                            mb,
@@ -7070,7 +10355,7 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                            blockDim,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
@@ -7086,7 +10371,20 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
                            mb,
@@ -7098,38 +10396,46 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                            blockDim,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrilu0 zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_csrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dscsrilu0_numeric_boost(
-        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dscsrilu0_numeric_boost(
+        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_numeric_boost(
-        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_numeric_boost(
+        (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -7138,12 +10444,14 @@ hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dccsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
                                           enable_boost,
                                           tol,
-                                          (rocsparse_float_complex*)boost_val));
+                                          (rocsparse_float_complex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -7152,12 +10460,14 @@ hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
                                          enable_boost,
                                          tol,
-                                         (rocsparse_double_complex*)boost_val));
+                                         (rocsparse_double_complex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -7170,9 +10480,19 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7190,7 +10510,7 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -7203,9 +10523,19 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7223,7 +10553,7 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -7236,9 +10566,19 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7256,7 +10596,7 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -7269,9 +10609,19 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7289,7 +10639,7 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7302,7 +10652,17 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
                                        nnz,
@@ -7311,7 +10671,7 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                        csrSortedRowPtrA,
                                        csrSortedColIndA,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7324,7 +10684,17 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
                                        nnz,
@@ -7333,7 +10703,7 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                        csrSortedRowPtrA,
                                        csrSortedColIndA,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7346,7 +10716,17 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
                                        nnz,
@@ -7355,7 +10735,7 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                        csrSortedRowPtrA,
                                        csrSortedColIndA,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7368,7 +10748,17 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
                                        nnz,
@@ -7377,7 +10767,7 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                        csrSortedRowPtrA,
                                        csrSortedColIndA,
                                        (rocsparse_mat_info)info,
-                                       pBufferSizeInBytes));
+                                       pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
@@ -7391,9 +10781,22 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsrilu0_analysis((rocsparse_handle)handle,
@@ -7409,9 +10812,9 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -7425,9 +10828,22 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsrilu0_analysis((rocsparse_handle)handle,
@@ -7443,9 +10859,9 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -7459,9 +10875,22 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7478,9 +10907,9 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -7494,9 +10923,22 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csrilu0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7513,9 +10955,9 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
@@ -7531,16 +10973,28 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrilu0((rocsparse_handle)handle,
-                                                                    m,
-                                                                    nnz,
-                                                                    (rocsparse_mat_descr)descrA,
-                                                                    csrSortedValA_valM,
-                                                                    csrSortedRowPtrA,
-                                                                    csrSortedColIndA,
-                                                                    (rocsparse_mat_info)info,
-                                                                    rocsparse_solve_policy_auto,
-                                                                    pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scsrilu0((rocsparse_handle)handle,
+                           m,
+                           nnz,
+                           (rocsparse_mat_descr)descrA,
+                           csrSortedValA_valM,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           (rocsparse_mat_info)info,
+                           rocsparse_solve_policy_auto,
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
@@ -7556,16 +11010,28 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0((rocsparse_handle)handle,
-                                                                    m,
-                                                                    nnz,
-                                                                    (rocsparse_mat_descr)descrA,
-                                                                    csrSortedValA_valM,
-                                                                    csrSortedRowPtrA,
-                                                                    csrSortedColIndA,
-                                                                    (rocsparse_mat_info)info,
-                                                                    rocsparse_solve_policy_auto,
-                                                                    pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dcsrilu0((rocsparse_handle)handle,
+                           m,
+                           nnz,
+                           (rocsparse_mat_descr)descrA,
+                           csrSortedValA_valM,
+                           csrSortedRowPtrA,
+                           csrSortedColIndA,
+                           (rocsparse_mat_info)info,
+                           rocsparse_solve_policy_auto,
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
@@ -7581,7 +11047,18 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0((rocsparse_handle)handle,
                            m,
                            nnz,
@@ -7591,7 +11068,7 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
@@ -7607,7 +11084,18 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0((rocsparse_handle)handle,
                            m,
                            nnz,
@@ -7617,24 +11105,28 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_mat_info)info,
                            rocsparse_solve_policy_auto,
-                           pBuffer));
+                           pBuffer)));
 }
 
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsric0 zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_bsric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -7649,9 +11141,21 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7671,7 +11175,7 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -7686,9 +11190,21 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7708,7 +11224,7 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -7723,9 +11239,21 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7745,7 +11273,7 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -7760,9 +11288,21 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -7782,7 +11322,7 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
@@ -7798,9 +11338,24 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7819,9 +11374,9 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
@@ -7837,9 +11392,24 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7858,9 +11428,9 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
@@ -7876,9 +11446,24 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7897,9 +11482,9 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
@@ -7915,9 +11500,24 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // bsric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -7936,9 +11536,9 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
@@ -7954,7 +11554,20 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
                           mb,
@@ -7966,7 +11579,7 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                           blockDim,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
@@ -7982,7 +11595,20 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
                           mb,
@@ -7994,7 +11620,7 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                           blockDim,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
@@ -8010,7 +11636,20 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
                           mb,
@@ -8022,7 +11661,7 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                           blockDim,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
@@ -8038,7 +11677,20 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
                           mb,
@@ -8050,24 +11702,28 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                           blockDim,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE(handle, info, position);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_zeropivot is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csric0 zero pivot
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_csric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
@@ -8080,9 +11736,19 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -8100,7 +11766,7 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -8113,9 +11779,19 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -8133,7 +11809,7 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -8146,9 +11822,19 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -8166,7 +11852,7 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -8179,9 +11865,19 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     size_t           buffer_size;
@@ -8199,7 +11895,7 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
 
     *pBufferSizeInBytes = (int)buffer_size;
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -8212,7 +11908,17 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsric0_buffer_size((rocsparse_handle)handle,
                                       m,
                                       nnz,
@@ -8221,7 +11927,7 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                       csrSortedRowPtrA,
                                       csrSortedColIndA,
                                       (rocsparse_mat_info)info,
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -8234,7 +11940,17 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
                                       nnz,
@@ -8243,7 +11959,7 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                       csrSortedRowPtrA,
                                       csrSortedColIndA,
                                       (rocsparse_mat_info)info,
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -8256,7 +11972,17 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0_buffer_size((rocsparse_handle)handle,
                                       m,
                                       nnz,
@@ -8265,7 +11991,7 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                       csrSortedRowPtrA,
                                       csrSortedColIndA,
                                       (rocsparse_mat_info)info,
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -8278,7 +12004,17 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
                                       nnz,
@@ -8287,7 +12023,7 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                       csrSortedRowPtrA,
                                       csrSortedColIndA,
                                       (rocsparse_mat_info)info,
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
@@ -8301,9 +12037,22 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsric0_analysis((rocsparse_handle)handle,
@@ -8319,9 +12068,9 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
@@ -8335,9 +12084,22 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsric0_analysis((rocsparse_handle)handle,
@@ -8353,9 +12115,9 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
@@ -8369,9 +12131,22 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8388,9 +12163,9 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
@@ -8404,9 +12179,22 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // csric0 analysis
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8423,9 +12211,9 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
@@ -8441,16 +12229,28 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsric0((rocsparse_handle)handle,
-                                                                   m,
-                                                                   nnz,
-                                                                   (rocsparse_mat_descr)descrA,
-                                                                   csrSortedValA_valM,
-                                                                   csrSortedRowPtrA,
-                                                                   csrSortedColIndA,
-                                                                   (rocsparse_mat_info)info,
-                                                                   rocsparse_solve_policy_auto,
-                                                                   pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scsric0((rocsparse_handle)handle,
+                          m,
+                          nnz,
+                          (rocsparse_mat_descr)descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          (rocsparse_mat_info)info,
+                          rocsparse_solve_policy_auto,
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
@@ -8466,16 +12266,28 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsric0((rocsparse_handle)handle,
-                                                                   m,
-                                                                   nnz,
-                                                                   (rocsparse_mat_descr)descrA,
-                                                                   csrSortedValA_valM,
-                                                                   csrSortedRowPtrA,
-                                                                   csrSortedColIndA,
-                                                                   (rocsparse_mat_info)info,
-                                                                   rocsparse_solve_policy_auto,
-                                                                   pBuffer));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dcsric0((rocsparse_handle)handle,
+                          m,
+                          nnz,
+                          (rocsparse_mat_descr)descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          (rocsparse_mat_info)info,
+                          rocsparse_solve_policy_auto,
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
@@ -8491,7 +12303,18 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0((rocsparse_handle)handle,
                           m,
                           nnz,
@@ -8501,7 +12324,7 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
@@ -8517,7 +12340,18 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0((rocsparse_handle)handle,
                           m,
                           nnz,
@@ -8527,7 +12361,7 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (rocsparse_mat_info)info,
                           rocsparse_solve_policy_auto,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
@@ -8537,13 +12371,15 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2coo((rocsparse_handle)handle,
                           csrRowPtr,
                           nnz,
                           m,
                           cooRowInd,
-                          hipsparse::hipBaseToHCCBase(idxBase)));
+                          hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
@@ -8559,6 +12395,21 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8571,19 +12422,18 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
+    hipsparseStatus_t status = hipsparse::getStream(handle, &stream);
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
+        return trace(status);
     }
 
     // Format conversion
@@ -8602,13 +12452,10 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
@@ -8624,6 +12471,21 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8636,19 +12498,18 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
+    hipsparseStatus_t status = hipsparse::getStream(handle, &stream);
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
+        return trace(status);
     }
 
     // Format conversion
@@ -8667,13 +12528,10 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
@@ -8689,6 +12547,21 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8701,19 +12574,18 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
+    hipsparseStatus_t status = hipsparse::getStream(handle, &stream);
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
+        return trace(status);
     }
 
     // Format conversion
@@ -8732,13 +12604,10 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
@@ -8754,6 +12623,21 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8766,19 +12650,18 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
-    hipsparseStatus_t status = hipsparseGetStream(handle, &stream);
+    hipsparseStatus_t status = hipsparse::getStream(handle, &stream);
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-        return status;
+        return trace(status);
     }
 
     // Format conversion
@@ -8797,13 +12680,10 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipsparse::blockingSync(handle, stream));
 
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
@@ -8822,7 +12702,23 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                                  hipsparseCsr2CscAlg_t alg,
                                                  size_t*               pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
                                       m,
                                       n,
@@ -8830,7 +12726,7 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                       csrRowPtr,
                                       csrColInd,
                                       hipsparse::hipActionToHCCAction(copyValues),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
@@ -8849,10 +12745,26 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                       hipsparseCsr2CscAlg_t alg,
                                       void*                 buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    buffer);
+
     switch(valType)
     {
     case HIP_R_32F:
-        return hipsparse::rocSPARSEStatusToHIPStatus(
+        return trace(hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_scsr2csc((rocsparse_handle)handle,
                                m,
                                n,
@@ -8865,9 +12777,9 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                cscColPtr,
                                hipsparse::hipActionToHCCAction(copyValues),
                                hipsparse::hipBaseToHCCBase(idxBase),
-                               buffer));
+                               buffer)));
     case HIP_R_64F:
-        return hipsparse::rocSPARSEStatusToHIPStatus(
+        return trace(hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_dcsr2csc((rocsparse_handle)handle,
                                m,
                                n,
@@ -8880,9 +12792,9 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                cscColPtr,
                                hipsparse::hipActionToHCCAction(copyValues),
                                hipsparse::hipBaseToHCCBase(idxBase),
-                               buffer));
+                               buffer)));
     case HIP_C_32F:
-        return hipsparse::rocSPARSEStatusToHIPStatus(
+        return trace(hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_ccsr2csc((rocsparse_handle)handle,
                                m,
                                n,
@@ -8895,9 +12807,9 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                cscColPtr,
                                hipsparse::hipActionToHCCAction(copyValues),
                                hipsparse::hipBaseToHCCBase(idxBase),
-                               buffer));
+                               buffer)));
     case HIP_C_64F:
-        return hipsparse::rocSPARSEStatusToHIPStatus(
+        return trace(hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_zcsr2csc((rocsparse_handle)handle,
                                m,
                                n,
@@ -8910,12 +12822,12 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                cscColPtr,
                                hipsparse::hipActionToHCCAction(copyValues),
                                hipsparse::hipBaseToHCCBase(idxBase),
-                               buffer));
+                               buffer)));
     default:
-        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
     }
 
-    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
 }
 
 hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
@@ -8929,7 +12841,18 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2hyb((rocsparse_handle)handle,
                            m,
                            n,
@@ -8939,7 +12862,7 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_hyb_mat)hybA,
                            userEllWidth,
-                           hipsparse::hipHybPartToHCCHybPart(partitionType)));
+                           hipsparse::hipHybPartToHCCHybPart(partitionType))));
 }
 
 hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
@@ -8953,7 +12876,18 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2hyb((rocsparse_handle)handle,
                            m,
                            n,
@@ -8963,7 +12897,7 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_hyb_mat)hybA,
                            userEllWidth,
-                           hipsparse::hipHybPartToHCCHybPart(partitionType)));
+                           hipsparse::hipHybPartToHCCHybPart(partitionType))));
 }
 
 hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
@@ -8977,7 +12911,18 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2hyb((rocsparse_handle)handle,
                            m,
                            n,
@@ -8987,7 +12932,7 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_hyb_mat)hybA,
                            userEllWidth,
-                           hipsparse::hipHybPartToHCCHybPart(partitionType)));
+                           hipsparse::hipHybPartToHCCHybPart(partitionType))));
 }
 
 hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
@@ -9001,7 +12946,18 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2hyb((rocsparse_handle)handle,
                            m,
                            n,
@@ -9011,7 +12967,7 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            (rocsparse_hyb_mat)hybA,
                            userEllWidth,
-                           hipsparse::hipHybPartToHCCHybPart(partitionType)));
+                           hipsparse::hipHybPartToHCCHybPart(partitionType))));
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
@@ -9025,6 +12981,17 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9035,7 +13002,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                                  rowBlockDim,
                                                                  colBlockDim,
                                                                  pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
@@ -9049,6 +13016,17 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9059,7 +13037,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                                  rowBlockDim,
                                                                  colBlockDim,
                                                                  pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
@@ -9073,6 +13051,16 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9085,7 +13073,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                            rowBlockDim,
                                            colBlockDim,
                                            pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handle,
@@ -9099,6 +13087,16 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     colBlockDim,
                                                    size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9111,7 +13109,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                            rowBlockDim,
                                            colBlockDim,
                                            pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
@@ -9130,6 +13128,22 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idx_base,
+                    temp_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
                                                      nb,
@@ -9145,7 +13159,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                                      hipsparse::hipActionToHCCAction(copyValues),
                                                      hipsparse::hipBaseToHCCBase(idx_base),
                                                      temp_buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
@@ -9164,6 +13178,21 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idx_base,
+                    temp_buffer);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9180,7 +13209,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                                      hipsparse::hipActionToHCCAction(copyValues),
                                                      hipsparse::hipBaseToHCCBase(idx_base),
                                                      temp_buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
@@ -9199,6 +13228,21 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idx_base,
+                    temp_buffer);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9215,7 +13259,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                                      hipsparse::hipActionToHCCAction(copyValues),
                                                      hipsparse::hipBaseToHCCBase(idx_base),
                                                      temp_buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
@@ -9234,6 +13278,21 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idx_base,
                                         void*                   temp_buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idx_base,
+                    temp_buffer);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9250,7 +13309,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                                      hipsparse::hipActionToHCCAction(copyValues),
                                                      hipsparse::hipBaseToHCCBase(idx_base),
                                                      temp_buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -9265,6 +13324,18 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_scsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9277,7 +13348,7 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                          rowBlockDim,
                                          colBlockDim,
                                          pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -9292,6 +13363,18 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9304,7 +13387,7 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                          rowBlockDim,
                                          colBlockDim,
                                          pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -9319,6 +13402,18 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_ccsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9331,7 +13426,7 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                          rowBlockDim,
                                          colBlockDim,
                                          pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -9346,6 +13441,18 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9358,7 +13465,7 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                          rowBlockDim,
                                          colBlockDim,
                                          pBufferSizeInBytes));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
@@ -9375,6 +13482,21 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsrNnzDevhost,
                                          void*                     pbuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrRowPtr,
+                    rowBlockDim,
+                    colBlockDim,
+                    bsrNnzDevhost,
+                    pbuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz((rocsparse_handle)handle,
                                                       hipsparse::hipDirectionToHCCDirection(dir),
@@ -9389,7 +13511,7 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                                       colBlockDim,
                                                       bsrNnzDevhost,
                                                       pbuffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
@@ -9408,6 +13530,22 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9423,7 +13561,7 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                                    rowBlockDim,
                                                    colBlockDim,
                                                    pbuffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
@@ -9442,6 +13580,22 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9457,7 +13611,7 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                                    rowBlockDim,
                                                    colBlockDim,
                                                    pbuffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
@@ -9476,6 +13630,22 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9491,7 +13661,7 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                                    rowBlockDim,
                                                    colBlockDim,
                                                    pbuffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
@@ -9510,6 +13680,22 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9525,7 +13711,7 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                                    rowBlockDim,
                                                    colBlockDim,
                                                    pbuffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
@@ -9542,6 +13728,20 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9555,7 +13755,7 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                                  bsrValC,
                                                  bsrRowPtrC,
                                                  bsrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
@@ -9572,6 +13772,20 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9585,7 +13799,7 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                                  bsrValC,
                                                  bsrRowPtrC,
                                                  bsrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
@@ -9602,6 +13816,20 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9615,7 +13843,7 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                                  (rocsparse_float_complex*)bsrValC,
                                                  bsrRowPtrC,
                                                  bsrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
@@ -9632,6 +13860,20 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9645,7 +13887,7 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                                  (rocsparse_double_complex*)bsrValC,
                                                  bsrRowPtrC,
                                                  bsrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
@@ -9662,6 +13904,20 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9675,7 +13931,7 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                                  csrValC,
                                                  csrRowPtrC,
                                                  csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
@@ -9692,6 +13948,20 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9705,7 +13975,7 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                                  csrValC,
                                                  csrRowPtrC,
                                                  csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
@@ -9722,6 +13992,20 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9735,7 +14019,7 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                                  (rocsparse_float_complex*)csrValC,
                                                  csrRowPtrC,
                                                  csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
@@ -9752,6 +14036,20 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9765,7 +14063,7 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                                  (rocsparse_double_complex*)csrValC,
                                                  csrRowPtrC,
                                                  csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
@@ -9783,6 +14081,21 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9797,7 +14110,7 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                                    csrValC,
                                                    csrRowPtrC,
                                                    csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
@@ -9815,6 +14128,21 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9829,7 +14157,7 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                                    csrValC,
                                                    csrRowPtrC,
                                                    csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
@@ -9847,6 +14175,21 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9861,7 +14204,7 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                                    (rocsparse_float_complex*)csrValC,
                                                    csrRowPtrC,
                                                    csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
@@ -9879,6 +14222,21 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9893,7 +14251,7 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                                    (rocsparse_double_complex*)csrValC,
                                                    csrRowPtrC,
                                                    csrColIndC));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
@@ -9910,7 +14268,21 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2csr_compress((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -9923,7 +14295,7 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                     csrValC,
                                     csrRowPtrC,
                                     csrColIndC,
-                                    tol));
+                                    tol)));
 }
 
 hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
@@ -9940,7 +14312,21 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2csr_compress((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -9953,7 +14339,7 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                     csrValC,
                                     csrRowPtrC,
                                     csrColIndC,
-                                    tol));
+                                    tol)));
 }
 
 hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
@@ -9970,7 +14356,21 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csr_compress((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -9983,7 +14383,7 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                     (rocsparse_float_complex*)csrValC,
                                     csrRowPtrC,
                                     csrColIndC,
-                                    {hipCrealf(tol), hipCimagf(tol)}));
+                                    {hipCrealf(tol), hipCimagf(tol)})));
 }
 
 hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
@@ -10000,7 +14400,21 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csr_compress((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -10013,7 +14427,7 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                     (rocsparse_double_complex*)csrValC,
                                     csrRowPtrC,
                                     csrColIndC,
-                                    {hipCreal(tol), hipCimag(tol)}));
+                                    {hipCreal(tol), hipCimag(tol)})));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
@@ -10031,7 +14445,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -10045,7 +14474,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                              csrValC,
                                              csrRowPtrC,
                                              csrColIndC,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
@@ -10063,7 +14492,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -10077,7 +14521,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                              csrValC,
                                              csrRowPtrC,
                                              csrColIndC,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10095,7 +14539,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -10109,7 +14568,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                              csrValC,
                                              csrRowPtrC,
                                              csrColIndC,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10127,7 +14586,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -10141,7 +14615,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                              csrValC,
                                              csrRowPtrC,
                                              csrColIndC,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
@@ -10158,7 +14632,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
                                      n,
@@ -10171,7 +14661,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                      (const rocsparse_mat_descr)descrC,
                                      csrRowPtrC,
                                      nnzTotalDevHostPtr,
-                                     buffer));
+                                     buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
@@ -10188,7 +14678,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
                                      n,
@@ -10201,7 +14707,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                      (const rocsparse_mat_descr)descrC,
                                      csrRowPtrC,
                                      nnzTotalDevHostPtr,
-                                     buffer));
+                                     buffer)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
@@ -10219,7 +14725,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    buffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr((rocsparse_handle)handle,
                                  m,
                                  n,
@@ -10233,7 +14754,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                  csrValC,
                                  csrRowPtrC,
                                  csrColIndC,
-                                 buffer));
+                                 buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
@@ -10251,7 +14772,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    buffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr((rocsparse_handle)handle,
                                  m,
                                  n,
@@ -10265,7 +14801,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                  csrValC,
                                  csrRowPtrC,
                                  csrColIndC,
-                                 buffer));
+                                 buffer)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
@@ -10284,7 +14820,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            n,
@@ -10299,7 +14851,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                            csrRowPtrC,
                                                            csrColIndC,
                                                            (rocsparse_mat_info)info,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
@@ -10318,7 +14870,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            n,
@@ -10333,7 +14901,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                            csrRowPtrC,
                                                            csrColIndC,
                                                            (rocsparse_mat_info)info,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10352,7 +14920,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            n,
@@ -10367,7 +14951,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                            csrRowPtrC,
                                                            csrColIndC,
                                                            (rocsparse_mat_info)info,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10386,7 +14970,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            n,
@@ -10401,7 +15001,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                            csrRowPtrC,
                                                            csrColIndC,
                                                            (rocsparse_mat_info)info,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -10419,7 +15019,24 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10433,7 +15050,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                    csrRowPtrC,
                                                    nnzTotalDevHostPtr,
                                                    (rocsparse_mat_info)info,
-                                                   buffer));
+                                                   buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -10451,7 +15068,24 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10465,7 +15099,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                    csrRowPtrC,
                                                    nnzTotalDevHostPtr,
                                                    (rocsparse_mat_info)info,
-                                                   buffer));
+                                                   buffer)));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
@@ -10484,7 +15118,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
                                                n,
@@ -10499,7 +15149,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                csrRowPtrC,
                                                csrColIndC,
                                                (rocsparse_mat_info)info,
-                                               buffer));
+                                               buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
@@ -10518,7 +15168,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
                                                n,
@@ -10533,7 +15199,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                csrRowPtrC,
                                                csrColIndC,
                                                (rocsparse_mat_info)info,
-                                               buffer));
+                                               buffer)));
 }
 
 hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
@@ -10543,6 +15209,8 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10551,9 +15219,10 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10565,10 +15234,7 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
@@ -10578,6 +15244,8 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10586,9 +15254,10 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10600,10 +15269,7 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
@@ -10613,6 +15279,8 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10621,9 +15289,10 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10635,10 +15304,7 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
@@ -10648,6 +15314,8 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10656,9 +15324,10 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
-    void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Get buffer from the handle workspace
+    void*                    buffer = nullptr;
+    hipsparse::workspaceLock workspace_lock(handle);
+    RETURN_IF_HIPSPARSE_ERROR(workspace_lock.acquire(buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10670,10 +15339,7 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
@@ -10686,6 +15352,10 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10695,7 +15365,7 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                              lda,
                                              nnzPerRowColumn,
                                              nnzTotalDevHostPtr));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
@@ -10708,6 +15378,10 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10717,7 +15391,7 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                              lda,
                                              nnzPerRowColumn,
                                              nnzTotalDevHostPtr));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
@@ -10730,6 +15404,10 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10739,7 +15417,7 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                              lda,
                                              nnzPerRowColumn,
                                              nnzTotalDevHostPtr));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
@@ -10752,6 +15430,10 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10761,7 +15443,7 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                              lda,
                                              nnzPerRowColumn,
                                              nnzTotalDevHostPtr));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
@@ -10775,6 +15457,8 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10785,7 +15469,7 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                                    csrVal,
                                                    csrRowPtr,
                                                    csrColInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
@@ -10799,6 +15483,8 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10809,7 +15495,7 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                                    csrVal,
                                                    csrRowPtr,
                                                    csrColInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
@@ -10823,6 +15509,8 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10833,7 +15521,7 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                                    (rocsparse_float_complex*)csrVal,
                                                    csrRowPtr,
                                                    csrColInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
@@ -10847,6 +15535,8 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10857,7 +15547,7 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                                    (rocsparse_double_complex*)csrVal,
                                                    csrRowPtr,
                                                    csrColInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
@@ -10872,6 +15562,18 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10885,7 +15587,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                csrColInd,
                                                pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
@@ -10900,6 +15602,18 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10913,7 +15627,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                csrColInd,
                                                pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10928,6 +15642,18 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10941,7 +15667,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                csrColInd,
                                                pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -10956,6 +15682,18 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10969,7 +15707,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                csrColInd,
                                                pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
@@ -10983,6 +15721,10 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -10994,7 +15736,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                                              nnzTotalDevHostPtr,
                                                              buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
@@ -11008,6 +15750,10 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -11019,7 +15765,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                                              nnzTotalDevHostPtr,
                                                              buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
@@ -11034,6 +15780,8 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11046,7 +15794,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                                          csrColInd,
                                                          buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
@@ -11061,6 +15809,8 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11073,7 +15823,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                                          csrColInd,
                                                          buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
@@ -11089,6 +15839,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11103,7 +15866,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                              (rocsparse_mat_info)info,
                                                              pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
@@ -11119,6 +15882,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11133,7 +15909,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                              (rocsparse_mat_info)info,
                                                              pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t
@@ -11150,6 +15926,19 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11164,7 +15953,7 @@ hipsparseStatus_t
                                                              (rocsparse_mat_info)info,
                                                              pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t
@@ -11181,6 +15970,19 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11195,7 +15997,7 @@ hipsparseStatus_t
                                                              (rocsparse_mat_info)info,
                                                              pBufferSizeInBytes));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -11210,6 +16012,20 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrRowPtr,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11223,7 +16039,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                      (rocsparse_mat_info)info,
                                                      buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -11238,6 +16054,20 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrRowPtr,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11251,7 +16081,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                      (rocsparse_mat_info)info,
                                                      buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t         handle,
@@ -11267,6 +16097,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11281,7 +16124,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                  (rocsparse_mat_info)info,
                                                  buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t         handle,
@@ -11297,6 +16140,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11311,7 +16167,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                  (rocsparse_mat_info)info,
                                                  buffer));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
@@ -11325,6 +16181,8 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11335,7 +16193,7 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                                    cscVal,
                                                    cscColPtr,
                                                    cscRowInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
@@ -11349,6 +16207,8 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11359,7 +16219,7 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                                    cscVal,
                                                    cscColPtr,
                                                    cscRowInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
@@ -11373,6 +16233,8 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11383,7 +16245,7 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                                    (rocsparse_float_complex*)cscVal,
                                                    cscColPtr,
                                                    cscRowInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
@@ -11397,6 +16259,8 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11407,7 +16271,7 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                                    (rocsparse_double_complex*)cscVal,
                                                    cscColPtr,
                                                    cscRowInd));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
@@ -11420,6 +16284,8 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11429,7 +16295,7 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                                    csrColInd,
                                                    A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
@@ -11442,6 +16308,8 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11451,7 +16319,7 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                                    csrColInd,
                                                    A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
@@ -11464,6 +16332,8 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11473,7 +16343,7 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                                    csrColInd,
                                                    (rocsparse_float_complex*)A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
@@ -11486,6 +16356,8 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11495,7 +16367,7 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                                    csrColInd,
                                                    (rocsparse_double_complex*)A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
@@ -11508,6 +16380,8 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11517,7 +16391,7 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                                    cscRowInd,
                                                    A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
@@ -11530,6 +16404,8 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11539,7 +16415,7 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                                    cscRowInd,
                                                    A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
@@ -11552,6 +16428,8 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11561,7 +16439,7 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                                    cscRowInd,
                                                    (rocsparse_float_complex*)A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
@@ -11574,6 +16452,8 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11583,7 +16463,7 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                                    cscRowInd,
                                                    (rocsparse_double_complex*)A,
                                                    ld));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
@@ -11598,6 +16478,20 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrRowPtrC,
+                    bsrNnzb);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz((rocsparse_handle)handle,
                                                     hipsparse::hipDirectionToHCCDirection(dirA),
                                                     m,
@@ -11610,7 +16504,7 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                                     bsrRowPtrC,
                                                     bsrNnzb));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
@@ -11622,6 +16516,10 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          float                     tol)
 {
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11630,7 +16528,7 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                                       nnzPerRow,
                                                       nnzC,
                                                       tol));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
@@ -11642,6 +16540,10 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          double                    tol)
 {
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11650,7 +16552,7 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                                       nnzPerRow,
                                                       nnzC,
                                                       tol));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
@@ -11662,6 +16564,10 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipComplex                tol)
 {
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11670,7 +16576,7 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                                       nnzPerRow,
                                                       nnzC,
                                                       {hipCrealf(tol), hipCimagf(tol)}));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
@@ -11682,6 +16588,10 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipDoubleComplex          tol)
 {
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11690,7 +16600,7 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                                       nnzPerRow,
                                                       nnzC,
                                                       {hipCreal(tol), hipCimag(tol)}));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
@@ -11700,19 +16610,23 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_coo2csr((rocsparse_handle)handle,
                           cooRowInd,
                           nnz,
                           m,
                           csrRowPtr,
-                          hipsparse::hipBaseToHCCBase(idxBase)));
+                          hipsparse::hipBaseToHCCBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p));
+    HIPSPARSE_TRACE(handle, n, p);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p)));
 }
 
 hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
@@ -11723,8 +16637,10 @@ hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        csrColInd,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort_buffer_size(
-        (rocsparse_handle)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort_buffer_size(
+        (rocsparse_handle)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
@@ -11737,15 +16653,18 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort((rocsparse_handle)handle,
-                                                                   m,
-                                                                   n,
-                                                                   nnz,
-                                                                   (rocsparse_mat_descr)descrA,
-                                                                   csrRowPtr,
-                                                                   csrColInd,
-                                                                   P,
-                                                                   pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, P, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_csrsort((rocsparse_handle)handle,
+                          m,
+                          n,
+                          nnz,
+                          (rocsparse_mat_descr)descrA,
+                          csrRowPtr,
+                          csrColInd,
+                          P,
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
@@ -11756,8 +16675,10 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
-        (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
+        (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
@@ -11770,15 +16691,18 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort((rocsparse_handle)handle,
-                                                                   m,
-                                                                   n,
-                                                                   nnz,
-                                                                   (rocsparse_mat_descr)descrA,
-                                                                   cscColPtr,
-                                                                   cscRowInd,
-                                                                   P,
-                                                                   pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, cscColPtr, cscRowInd, P, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_cscsort((rocsparse_handle)handle,
+                          m,
+                          n,
+                          nnz,
+                          (rocsparse_mat_descr)descrA,
+                          cscColPtr,
+                          cscRowInd,
+                          P,
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
@@ -11789,8 +16713,10 @@ hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cooCols,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_buffer_size(
-        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_buffer_size(
+        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
@@ -11802,8 +16728,10 @@ hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
                                          int*              P,
                                          void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_row(
-        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_row(
+        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
@@ -11815,8 +16743,10 @@ hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
                                             int*              P,
                                             void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_column(
-        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_column(
+        (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -11834,6 +16764,21 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11855,7 +16800,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
     {
         *pBufferSizeInBytes = bufSize;
     }
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -11873,6 +16818,21 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11893,7 +16853,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
     {
         *pBufferSizeInBytes = bufSize;
     }
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -11911,6 +16871,21 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11931,7 +16906,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
     {
         *pBufferSizeInBytes = bufSize;
     }
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -11949,6 +16924,21 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11969,7 +16959,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
     {
         *pBufferSizeInBytes = bufSize;
     }
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
@@ -11989,6 +16979,25 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                            int*                      nnzTotalDevHostPtr,
                                            void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrRowPtrC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkBlockingCapture(handle));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr_nnz((rocsparse_handle)handle,
                                                         hipsparse::hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -12005,7 +17014,7 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                                         colBlockDimC,
                                                         nnzTotalDevHostPtr,
                                                         buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
@@ -12027,6 +17036,25 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12045,7 +17073,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                                      rowBlockDimC,
                                                      colBlockDimC,
                                                      buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
@@ -12067,6 +17095,25 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12085,7 +17132,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                                      rowBlockDimC,
                                                      colBlockDimC,
                                                      buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
@@ -12107,6 +17154,25 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12125,7 +17191,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                                      rowBlockDimC,
                                                      colBlockDimC,
                                                      buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
@@ -12147,6 +17213,25 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12165,7 +17250,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                                      rowBlockDimC,
                                                      colBlockDimC,
                                                      buffer));
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -12178,16 +17263,18 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12196,19 +17283,19 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
         // nnz must be 0 and pBufferSizeInBytes must be valid
         if(nnz != 0 || pBufferSizeInBytes == nullptr)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
         *pBufferSizeInBytes = 4;
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr || info == nullptr
        || pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Determine required buffer size for CSR sort
@@ -12219,7 +17306,7 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
     size_t min_size     = nnz * sizeof(float);
     *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, min_size);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -12232,16 +17319,18 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12250,19 +17339,19 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
         // nnz must be 0 and pBufferSizeInBytes must be valid
         if(nnz != 0 || pBufferSizeInBytes == nullptr)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
         *pBufferSizeInBytes = 4;
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr || info == nullptr
        || pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Determine required buffer size for CSR sort
@@ -12273,7 +17362,7 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
     size_t min_size     = nnz * sizeof(double);
     *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, min_size);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -12286,16 +17375,18 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12304,19 +17395,19 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
         // nnz must be 0 and pBufferSizeInBytes must be valid
         if(nnz != 0 || pBufferSizeInBytes == nullptr)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
         *pBufferSizeInBytes = 4;
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr || info == nullptr
        || pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Determine required buffer size for CSR sort
@@ -12327,7 +17418,7 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
     size_t min_size     = nnz * sizeof(hipComplex);
     *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, min_size);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -12340,16 +17431,18 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12358,19 +17451,19 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
         // nnz must be 0 and pBufferSizeInBytes must be valid
         if(nnz != 0 || pBufferSizeInBytes == nullptr)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
         *pBufferSizeInBytes = 4;
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr || info == nullptr
        || pBufferSizeInBytes == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Determine required buffer size for CSR sort
@@ -12381,7 +17474,7 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
     size_t min_size     = nnz * sizeof(hipDoubleComplex);
     *pBufferSizeInBytes = std::max(*pBufferSizeInBytes, min_size);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
@@ -12395,16 +17488,18 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12413,38 +17508,39 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
+    // Grow the permutation array if it is too small, it is reused otherwise
+    if(info->capacity < nnz)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
 
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipsparse::internalFree(info->P));
+            info->P        = nullptr;
+            info->size     = 0;
+            info->capacity = 0;
+        }
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        RETURN_IF_HIP_ERROR(hipsparse::internalMalloc((void**)&info->P, sizeof(int) * nnz));
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12458,13 +17554,13 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Copy sorted values back to csrVal
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(float) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
@@ -12478,16 +17574,18 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12496,38 +17594,39 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
+    // Grow the permutation array if it is too small, it is reused otherwise
+    if(info->capacity < nnz)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
 
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipsparse::internalFree(info->P));
+            info->P        = nullptr;
+            info->size     = 0;
+            info->capacity = 0;
+        }
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        RETURN_IF_HIP_ERROR(hipsparse::internalMalloc((void**)&info->P, sizeof(int) * nnz));
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12541,13 +17640,13 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Copy sorted values back to csrVal
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(double) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
@@ -12561,16 +17660,18 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12579,38 +17680,39 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
+    // Grow the permutation array if it is too small, it is reused otherwise
+    if(info->capacity < nnz)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
 
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipsparse::internalFree(info->P));
+            info->P        = nullptr;
+            info->size     = 0;
+            info->capacity = 0;
+        }
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        RETURN_IF_HIP_ERROR(hipsparse::internalMalloc((void**)&info->P, sizeof(int) * nnz));
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12624,13 +17726,13 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Copy sorted values back to csrVal
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(hipComplex) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
@@ -12644,16 +17746,18 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12662,38 +17766,39 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
+    // Grow the permutation array if it is too small, it is reused otherwise
+    if(info->capacity < nnz)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
 
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipsparse::internalFree(info->P));
+            info->P        = nullptr;
+            info->size     = 0;
+            info->capacity = 0;
+        }
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        RETURN_IF_HIP_ERROR(hipsparse::internalMalloc((void**)&info->P, sizeof(int) * nnz));
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12707,13 +17812,13 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Copy sorted values back to csrVal
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
         csrVal, pBuffer, sizeof(hipDoubleComplex) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
@@ -12727,16 +17832,18 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12745,28 +17852,28 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Check for valid permutation array
     if(info->P == nullptr || info->size != nnz)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Unsort CSR column indices based on the given permutation
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
@@ -12788,7 +17895,7 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(float) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
@@ -12802,16 +17909,18 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12820,28 +17929,28 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Check for valid permutation array
     if(info->P == nullptr || info->size != nnz)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Unsort CSR column indices based on the given permutation
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
@@ -12863,7 +17972,7 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(double) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
@@ -12877,16 +17986,18 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12895,28 +18006,28 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Check for valid permutation array
     if(info->P == nullptr || info->size != nnz)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Unsort CSR column indices based on the given permutation
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
@@ -12938,7 +18049,7 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(csrVal, pBuffer, sizeof(hipComplex) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
@@ -12952,16 +18063,18 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Invalid sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Quick return
@@ -12970,28 +18083,28 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
         // nnz must be 0
         if(nnz != 0)
         {
-            return HIPSPARSE_STATUS_INVALID_VALUE;
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
         }
 
-        return HIPSPARSE_STATUS_SUCCESS;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
     }
 
     // Invalid pointers
     if(descrA == nullptr || csrVal == nullptr || csrRowPtr == nullptr || csrColInd == nullptr
        || info == nullptr || pBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Check for valid permutation array
     if(info->P == nullptr || info->size != nnz)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get stream
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     // Unsort CSR column indices based on the given permutation
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_isctr((rocsparse_handle)handle,
@@ -13013,7 +18126,7 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
         csrVal, pBuffer, sizeof(hipDoubleComplex) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 /* Generic API */
@@ -13026,7 +18139,11 @@ hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
                                        hipsparseIndexBase_t   idxBase,
                                        hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_spvec_descr((rocsparse_spvec_descr*)spVecDescr,
                                      size,
                                      nnz,
@@ -13034,7 +18151,7 @@ hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
                                      values,
                                      hipsparse::hipIndexTypeToHCCIndexType(idxType),
                                      hipsparse::hipBaseToHCCBase(idxBase),
-                                     hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                     hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDescr,
@@ -13046,7 +18163,11 @@ hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDes
                                             hipsparseIndexBase_t        idxBase,
                                             hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_spvec_descr((rocsparse_const_spvec_descr*)spVecDescr,
                                            size,
                                            nnz,
@@ -13054,13 +18175,15 @@ hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDes
                                            values,
                                            hipsparse::hipIndexTypeToHCCIndexType(idxType),
                                            hipsparse::hipBaseToHCCBase(idxBase),
-                                           hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                           hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseDestroySpVec(hipsparseConstSpVecDescr_t spVecDescr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_spvec_descr((rocsparse_const_spvec_descr)spVecDescr));
+    HIPSPARSE_TRACE(spVecDescr);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_spvec_descr((rocsparse_const_spvec_descr)spVecDescr)));
 }
 
 hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
@@ -13072,6 +18195,8 @@ hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
                                     hipsparseIndexBase_t*       idxBase,
                                     hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13089,7 +18214,7 @@ hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
     *idxBase   = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
@@ -13101,6 +18226,8 @@ hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
                                          hipsparseIndexBase_t*      idxBase,
                                          hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13119,12 +18246,14 @@ hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
     *idxBase   = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseConstSpVecDescr_t spVecDescr,
                                              hipsparseIndexBase_t*            idxBase)
 {
+    HIPSPARSE_TRACE(spVecDescr, idxBase);
+
     rocsparse_index_base hcc_index_base;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_spvec_get_index_base((const rocsparse_const_spvec_descr)spVecDescr,
@@ -13132,26 +18261,32 @@ hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseConstSpVecDescr_t sp
 
     *idxBase = hipsparse::HCCBaseToHIPBase(hcc_index_base);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spvec_get_values((const rocsparse_spvec_descr)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spvec_get_values((const rocsparse_spvec_descr)spVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseConstSpVecGetValues(hipsparseConstSpVecDescr_t spVecDescr,
                                                const void**               values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_const_spvec_get_values((rocsparse_const_spvec_descr)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_const_spvec_get_values((rocsparse_const_spvec_descr)spVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spvec_set_values((rocsparse_spvec_descr)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spvec_set_values((rocsparse_spvec_descr)spVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
@@ -13165,7 +18300,20 @@ hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_coo_descr((rocsparse_spmat_descr*)spMatDescr,
                                    rows,
                                    cols,
@@ -13175,7 +18323,7 @@ hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
                                    cooValues,
                                    hipsparse::hipIndexTypeToHCCIndexType(cooIdxType),
                                    hipsparse::hipBaseToHCCBase(idxBase),
-                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                   hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr,
@@ -13189,7 +18337,20 @@ hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_coo_descr((rocsparse_const_spmat_descr*)spMatDescr,
                                          rows,
                                          cols,
@@ -13199,7 +18360,7 @@ hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr
                                          cooValues,
                                          hipsparse::hipIndexTypeToHCCIndexType(cooIdxType),
                                          hipsparse::hipBaseToHCCBase(idxBase),
-                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                         hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
@@ -13213,7 +18374,20 @@ hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
                                             hipsparseIndexBase_t   idxBase,
                                             hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_bell_descr((rocsparse_spmat_descr*)spMatDescr,
                                     rows,
                                     cols,
@@ -13224,7 +18398,7 @@ hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
                                     ellValue,
                                     hipsparse::hipIndexTypeToHCCIndexType(ellIdxType),
                                     hipsparse::hipBaseToHCCBase(idxBase),
-                                    hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                    hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spMatDescr,
@@ -13238,7 +18412,20 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                                  hipsparseIndexBase_t        idxBase,
                                                  hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_bell_descr((rocsparse_const_spmat_descr*)spMatDescr,
                                           rows,
                                           cols,
@@ -13249,7 +18436,7 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                           ellValue,
                                           hipsparse::hipIndexTypeToHCCIndexType(ellIdxType),
                                           hipsparse::hipBaseToHCCBase(idxBase),
-                                          hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                          hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
@@ -13262,7 +18449,11 @@ hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
                                         hipsparseIndexBase_t   idxBase,
                                         hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, cooIdxType, idxBase, valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_coo_aos_descr((rocsparse_spmat_descr*)spMatDescr,
                                        rows,
                                        cols,
@@ -13271,7 +18462,7 @@ hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
                                        cooValues,
                                        hipsparse::hipIndexTypeToHCCIndexType(cooIdxType),
                                        hipsparse::hipBaseToHCCBase(idxBase),
-                                       hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                       hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 #ifdef __cplusplus
@@ -13305,7 +18496,21 @@ hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_create_csr_descr_SWDEV_453599(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_create_csr_descr_SWDEV_453599(
         (rocsparse_spmat_descr*)spMatDescr,
         rows,
         cols,
@@ -13316,7 +18521,7 @@ hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
         hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
         hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
         hipsparse::hipBaseToHCCBase(idxBase),
-        hipsparse::hipDataTypeToHCCDataType(valueType)));
+        hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr,
@@ -13331,7 +18536,21 @@ hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_csr_descr((rocsparse_const_spmat_descr*)spMatDescr,
                                          rows,
                                          cols,
@@ -13342,7 +18561,7 @@ hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr
                                          hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
                                          hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
                                          hipsparse::hipBaseToHCCBase(idxBase),
-                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                         hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
@@ -13357,7 +18576,21 @@ hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_csc_descr((rocsparse_spmat_descr*)spMatDescr,
                                    rows,
                                    cols,
@@ -13368,7 +18601,7 @@ hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
                                    hipsparse::hipIndexTypeToHCCIndexType(cscColOffsetsType),
                                    hipsparse::hipIndexTypeToHCCIndexType(cscRowIndType),
                                    hipsparse::hipBaseToHCCBase(idxBase),
-                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                   hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr,
@@ -13383,7 +18616,21 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_csc_descr((rocsparse_const_spmat_descr*)spMatDescr,
                                          rows,
                                          cols,
@@ -13394,13 +18641,15 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
                                          hipsparse::hipIndexTypeToHCCIndexType(cscColOffsetsType),
                                          hipsparse::hipIndexTypeToHCCIndexType(cscRowIndType),
                                          hipsparse::hipBaseToHCCBase(idxBase),
-                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                         hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_spmat_descr((rocsparse_const_spmat_descr)spMatDescr));
+    HIPSPARSE_TRACE(spMatDescr);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_spmat_descr((rocsparse_const_spmat_descr)spMatDescr)));
 }
 
 hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -13414,6 +18663,17 @@ hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
                                          hipsparseIndexBase_t*       idxBase,
                                          hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13435,7 +18695,7 @@ hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase    = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType  = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13449,6 +18709,17 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
                                               hipsparseIndexBase_t*      idxBase,
                                               hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13471,7 +18742,7 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
     *idxBase    = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType  = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -13485,6 +18756,17 @@ hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    idxType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13504,7 +18786,7 @@ hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13518,6 +18800,17 @@ hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    idxType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13538,7 +18831,7 @@ hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -13551,6 +18844,8 @@ hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
                                      hipsparseIndexBase_t*       idxBase,
                                      hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, idxType, idxBase, valueType);
+
     rocsparse_indextype  hcc_index_type;
     rocsparse_index_base hcc_index_base;
     rocsparse_datatype   hcc_data_type;
@@ -13570,7 +18865,7 @@ hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -13585,6 +18880,18 @@ hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_row_index_type;
     rocsparse_indextype  hcc_col_index_type;
     rocsparse_index_base hcc_index_base;
@@ -13608,7 +18915,7 @@ hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType         = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13623,6 +18930,18 @@ hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_row_index_type;
     rocsparse_indextype  hcc_col_index_type;
     rocsparse_index_base hcc_index_base;
@@ -13646,7 +18965,7 @@ hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType         = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
@@ -13654,8 +18973,10 @@ hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 csrColInd,
                                           void*                 csrValues)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csr_set_pointers(
-        (rocsparse_spmat_descr)spMatDescr, csrRowOffsets, csrColInd, csrValues));
+    HIPSPARSE_TRACE(spMatDescr, csrRowOffsets, csrColInd, csrValues);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csr_set_pointers(
+        (rocsparse_spmat_descr)spMatDescr, csrRowOffsets, csrColInd, csrValues)));
 }
 
 hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -13670,6 +18991,18 @@ hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_col_index_type;
     rocsparse_indextype  hcc_row_index_type;
     rocsparse_index_base hcc_index_base;
@@ -13693,7 +19026,7 @@ hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType         = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13708,6 +19041,18 @@ hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
     rocsparse_indextype  hcc_col_index_type;
     rocsparse_indextype  hcc_row_index_type;
     rocsparse_index_base hcc_index_base;
@@ -13731,7 +19076,7 @@ hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::HCCBaseToHIPBase(hcc_index_base);
     *valueType         = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
@@ -13739,8 +19084,10 @@ hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cscRowInd,
                                           void*                 cscValues)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csc_set_pointers(
-        (rocsparse_spmat_descr)spMatDescr, cscColOffsets, cscRowInd, cscValues));
+    HIPSPARSE_TRACE(spMatDescr, cscColOffsets, cscRowInd, cscValues);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csc_set_pointers(
+        (rocsparse_spmat_descr)spMatDescr, cscColOffsets, cscRowInd, cscValues)));
 }
 
 hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
@@ -13748,8 +19095,10 @@ hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cooColInd,
                                           void*                 cooValues)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_pointers(
-        (rocsparse_spmat_descr)spMatDescr, cooRowInd, cooColInd, cooValues));
+    HIPSPARSE_TRACE(spMatDescr, cooRowInd, cooColInd, cooValues);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_pointers(
+        (rocsparse_spmat_descr)spMatDescr, cooRowInd, cooColInd, cooValues)));
 }
 
 hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13757,25 +19106,31 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
                                         int64_t*                   cols,
                                         int64_t*                   nnz)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_get_size((rocsparse_const_spmat_descr)spMatDescr, rows, cols, nnz));
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_get_size((rocsparse_const_spmat_descr)spMatDescr, rows, cols, nnz)));
 }
 
 hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
                                           hipsparseFormat_t*         format)
 {
+    HIPSPARSE_TRACE(spMatDescr, format);
+
     rocsparse_format hcc_format;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_format(
         (const rocsparse_const_spmat_descr)spMatDescr, format != nullptr ? &hcc_format : nullptr));
 
     *format = hipsparse::HCCFormatToHIPFormat(hcc_format);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDescr,
                                              hipsparseIndexBase_t*      idxBase)
 {
+    HIPSPARSE_TRACE(spMatDescr, idxBase);
+
     rocsparse_index_base hcc_index_base;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_spmat_get_index_base((const rocsparse_const_spmat_descr)spMatDescr,
@@ -13783,47 +19138,59 @@ hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDes
 
     *idxBase = hipsparse::HCCBaseToHIPBase(hcc_index_base);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_get_values((rocsparse_spmat_descr)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_get_values((rocsparse_spmat_descr)spMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseConstSpMatGetValues(hipsparseConstSpMatDescr_t spMatDescr,
                                                const void**               values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_const_spmat_get_values((rocsparse_const_spmat_descr)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_const_spmat_get_values((rocsparse_const_spmat_descr)spMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_set_values((rocsparse_spmat_descr)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_set_values((rocsparse_spmat_descr)spMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseConstSpMatDescr_t spMatDescr,
                                                 int*                       batchCount)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_get_strided_batch((rocsparse_const_spmat_descr)spMatDescr, batchCount));
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_get_strided_batch((rocsparse_const_spmat_descr)spMatDescr, batchCount)));
 }
 
 hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_set_strided_batch((rocsparse_spmat_descr)spMatDescr, batchCount));
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_set_strided_batch((rocsparse_spmat_descr)spMatDescr, batchCount)));
 }
 
 hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                               int                   batchCount,
                                               int64_t               batchStride)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_strided_batch(
-        (rocsparse_spmat_descr)spMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(spMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_strided_batch(
+        (rocsparse_spmat_descr)spMatDescr, batchCount, batchStride)));
 }
 
 hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
@@ -13831,11 +19198,13 @@ hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                               int64_t               offsetsBatchStride,
                                               int64_t               columnsValuesBatchStride)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, batchCount, offsetsBatchStride, columnsValuesBatchStride);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr_set_strided_batch((rocsparse_spmat_descr)spMatDescr,
                                         batchCount,
                                         offsetsBatchStride,
-                                        columnsValuesBatchStride));
+                                        columnsValuesBatchStride)));
 }
 
 hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDescr,
@@ -13843,11 +19212,13 @@ hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDes
                                              void*                      data,
                                              size_t                     dataSize)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmat_get_attribute((rocsparse_const_spmat_descr)spMatDescr,
                                       (rocsparse_spmat_attribute)attribute,
                                       data,
-                                      dataSize));
+                                      dataSize)));
 }
 
 hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
@@ -13855,8 +19226,10 @@ hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDesc
                                              const void*               data,
                                              size_t                    dataSize)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_spmat_set_attribute(
-        (rocsparse_spmat_descr)spMatDescr, (rocsparse_spmat_attribute)attribute, data, dataSize));
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_spmat_set_attribute(
+        (rocsparse_spmat_descr)spMatDescr, (rocsparse_spmat_attribute)attribute, data, dataSize)));
 }
 
 hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
@@ -13864,11 +19237,15 @@ hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
                                        void*                  values,
                                        hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_dnvec_descr((rocsparse_dnvec_descr*)dnVecDescr,
                                      size,
                                      values,
-                                     hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                     hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDescr,
@@ -13876,17 +19253,23 @@ hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDes
                                             const void*                 values,
                                             hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_dnvec_descr((rocsparse_const_dnvec_descr*)dnVecDescr,
                                            size,
                                            values,
-                                           hipsparse::hipDataTypeToHCCDataType(valueType)));
+                                           hipsparse::hipDataTypeToHCCDataType(valueType))));
 }
 
 hipsparseStatus_t hipsparseDestroyDnVec(hipsparseConstDnVecDescr_t dnVecDescr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_dnvec_descr((rocsparse_const_dnvec_descr)dnVecDescr));
+    HIPSPARSE_TRACE(dnVecDescr);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_dnvec_descr((rocsparse_const_dnvec_descr)dnVecDescr)));
 }
 
 hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
@@ -13894,6 +19277,8 @@ hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
                                     void**                      values,
                                     hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
     rocsparse_datatype hcc_data_type;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_get((const rocsparse_dnvec_descr)dnVecDescr,
                                                   size,
@@ -13902,7 +19287,7 @@ hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
 
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
@@ -13910,6 +19295,8 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
                                          const void**               values,
                                          hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
     rocsparse_datatype hcc_data_type;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_const_dnvec_get((const rocsparse_const_dnvec_descr)dnVecDescr,
@@ -13919,26 +19306,32 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
 
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnvec_get_values((const rocsparse_dnvec_descr)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dnvec_get_values((const rocsparse_dnvec_descr)dnVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseConstDnVecGetValues(hipsparseConstDnVecDescr_t dnVecDescr,
                                                const void**               values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_const_dnvec_get_values((const rocsparse_const_dnvec_descr)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_const_dnvec_get_values((const rocsparse_const_dnvec_descr)dnVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnvec_set_values((rocsparse_dnvec_descr)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dnvec_set_values((rocsparse_dnvec_descr)dnVecDescr, values)));
 }
 
 hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
@@ -13949,14 +19342,18 @@ hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
                                        hipDataType            valueType,
                                        hipsparseOrder_t       order)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_dnmat_descr((rocsparse_dnmat_descr*)dnMatDescr,
                                      rows,
                                      cols,
                                      ld,
                                      values,
                                      hipsparse::hipDataTypeToHCCDataType(valueType),
-                                     hipsparse::hipOrderToHCCOrder(order)));
+                                     hipsparse::hipOrderToHCCOrder(order))));
 }
 
 hipsparseStatus_t hipsparseCreateConstDnMat(hipsparseConstDnMatDescr_t* dnMatDescr,
@@ -13967,20 +19364,26 @@ hipsparseStatus_t hipsparseCreateConstDnMat(hipsparseConstDnMatDescr_t* dnMatDes
                                             hipDataType                 valueType,
                                             hipsparseOrder_t            order)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(valueType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_const_dnmat_descr((rocsparse_const_dnmat_descr*)dnMatDescr,
                                            rows,
                                            cols,
                                            ld,
                                            values,
                                            hipsparse::hipDataTypeToHCCDataType(valueType),
-                                           hipsparse::hipOrderToHCCOrder(order)));
+                                           hipsparse::hipOrderToHCCOrder(order))));
 }
 
 hipsparseStatus_t hipsparseDestroyDnMat(hipsparseConstDnMatDescr_t dnMatDescr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_dnmat_descr((rocsparse_const_dnmat_descr)dnMatDescr));
+    HIPSPARSE_TRACE(dnMatDescr);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_destroy_dnmat_descr((rocsparse_const_dnmat_descr)dnMatDescr)));
 }
 
 hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
@@ -13991,6 +19394,8 @@ hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
                                     hipDataType*                valueType,
                                     hipsparseOrder_t*           order)
 {
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
     rocsparse_datatype hcc_data_type;
     rocsparse_order    hcc_order;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnmat_get((const rocsparse_dnmat_descr)dnMatDescr,
@@ -14004,7 +19409,7 @@ hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
     *order     = hipsparse::HCCOrderToHIPOrder(hcc_order);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
@@ -14015,6 +19420,8 @@ hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
                                          hipDataType*               valueType,
                                          hipsparseOrder_t*          order)
 {
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
     rocsparse_datatype hcc_data_type;
     rocsparse_order    hcc_order;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -14029,42 +19436,52 @@ hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
     *valueType = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
     *order     = hipsparse::HCCOrderToHIPOrder(hcc_order);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnmat_get_values((const rocsparse_dnmat_descr)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dnmat_get_values((const rocsparse_dnmat_descr)dnMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseConstDnMatGetValues(hipsparseConstDnMatDescr_t dnMatDescr,
                                                const void**               values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_const_dnmat_get_values((rocsparse_const_dnmat_descr)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_const_dnmat_get_values((rocsparse_const_dnmat_descr)dnMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnmat_set_values((rocsparse_dnmat_descr)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dnmat_set_values((rocsparse_dnmat_descr)dnMatDescr, values)));
 }
 
 hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseConstDnMatDescr_t dnMatDescr,
                                                 int*                       batchCount,
                                                 int64_t*                   batchStride)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dnmat_get_strided_batch(
-        (rocsparse_const_dnmat_descr)dnMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dnmat_get_strided_batch(
+        (rocsparse_const_dnmat_descr)dnMatDescr, batchCount, batchStride)));
 }
 
 hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
                                                 int                   batchCount,
                                                 int64_t               batchStride)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dnmat_set_strided_batch(
-        (const rocsparse_dnmat_descr)dnMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dnmat_set_strided_batch(
+        (const rocsparse_dnmat_descr)dnMatDescr, batchCount, batchStride)));
 }
 
 hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
@@ -14073,27 +19490,34 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
                                  const void*                beta,
                                  hipsparseDnVecDescr_t      vecY)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_axpby((rocsparse_handle)handle,
-                                                                 alpha,
-                                                                 (rocsparse_const_spvec_descr)vecX,
-                                                                 beta,
-                                                                 (rocsparse_dnvec_descr)vecY));
+    HIPSPARSE_TRACE(handle, alpha, vecX, beta, vecY);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_axpby((rocsparse_handle)handle,
+                        alpha,
+                        (rocsparse_const_spvec_descr)vecX,
+                        beta,
+                        (rocsparse_dnvec_descr)vecY)));
 }
 
 hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
                                   hipsparseConstDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t      vecX)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_gather(
-        (rocsparse_handle)handle, (rocsparse_const_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX));
+    HIPSPARSE_TRACE(handle, vecY, vecX);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_gather(
+        (rocsparse_handle)handle, (rocsparse_const_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX)));
 }
 
 hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
                                    hipsparseConstSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t      vecY)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scatter(
-        (rocsparse_handle)handle, (rocsparse_const_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY));
+    HIPSPARSE_TRACE(handle, vecX, vecY);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scatter(
+        (rocsparse_handle)handle, (rocsparse_const_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY)));
 }
 
 hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
@@ -14102,11 +19526,13 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
-                                                               c_coeff,
-                                                               s_coeff,
-                                                               (rocsparse_spvec_descr)vecX,
-                                                               (rocsparse_dnvec_descr)vecY));
+    HIPSPARSE_TRACE(handle, c_coeff, s_coeff, vecX, vecY);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
+                                                                     c_coeff,
+                                                                     s_coeff,
+                                                                     (rocsparse_spvec_descr)vecX,
+                                                                     (rocsparse_dnvec_descr)vecY)));
 }
 
 hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
@@ -14115,13 +19541,15 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
                                   (rocsparse_dnmat_descr)matB,
                                   hipsparse::hipSpToDnAlgToHCCSpToDnAlg(alg),
                                   pBufferSizeInBytes,
-                                  nullptr));
+                                  nullptr)));
 }
 
 hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
@@ -14130,13 +19558,15 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
                                   (rocsparse_dnmat_descr)matB,
                                   hipsparse::hipSpToDnAlgToHCCSpToDnAlg(alg),
                                   nullptr,
-                                  externalBuffer));
+                                  externalBuffer)));
 }
 
 hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
@@ -14145,13 +19575,15 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
                                   (rocsparse_spmat_descr)matB,
                                   hipsparse::hipDnToSpAlgToHCCDnToSpAlg(alg),
                                   pBufferSizeInBytes,
-                                  nullptr));
+                                  nullptr)));
 }
 
 hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
@@ -14160,13 +19592,15 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           ha
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void*                       externalBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
                                   (rocsparse_spmat_descr)matB,
                                   hipsparse::hipDnToSpAlgToHCCDnToSpAlg(alg),
                                   nullptr,
-                                  externalBuffer));
+                                  externalBuffer)));
 }
 
 hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
@@ -14175,14 +19609,16 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           han
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
     size_t bufferSize = 4;
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
                                   (rocsparse_spmat_descr)matB,
                                   hipsparse::hipDnToSpAlgToHCCDnToSpAlg(alg),
                                   externalBuffer != nullptr ? &bufferSize : nullptr,
-                                  externalBuffer));
+                                  externalBuffer)));
 }
 
 hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
@@ -14193,7 +19629,11 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                                            hipDataType                computeType,
                                            size_t*                    pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spvv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opX),
                        (rocsparse_const_spvec_descr)vecX,
@@ -14201,7 +19641,7 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                        result,
                        hipsparse::hipDataTypeToHCCDataType(computeType),
                        pBufferSizeInBytes,
-                       nullptr));
+                       nullptr)));
 }
 
 hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
@@ -14212,103 +19652,520 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
                                 hipDataType                computeType,
                                 void*                      externalBuffer)
 {
-    size_t bufferSize;
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    size_t bufferSize;
+
+    // Check for buffer == nullptr as this is not done in rocsparse
+    if(externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spvv((rocsparse_handle)handle,
+                       hipsparse::hipOperationToHCCOperation(opX),
+                       (rocsparse_const_spvec_descr)vecX,
+                       (rocsparse_const_dnvec_descr)vecY,
+                       result,
+                       hipsparse::hipDataTypeToHCCDataType(computeType),
+                       &bufferSize,
+                       externalBuffer)));
+}
+
+hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmv((rocsparse_handle)handle,
+                       hipsparse::hipOperationToHCCOperation(opA),
+                       alpha,
+                       (rocsparse_const_spmat_descr)matA,
+                       (rocsparse_const_dnvec_descr)vecX,
+                       beta,
+                       (const rocsparse_dnvec_descr)vecY,
+                       hipsparse::hipDataTypeToHCCDataType(computeType),
+                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                       rocsparse_spmv_stage_buffer_size,
+                       pBufferSizeInBytes,
+                       nullptr)));
+}
+
+hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    size_t bufferSize;
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmv((rocsparse_handle)handle,
+                       hipsparse::hipOperationToHCCOperation(opA),
+                       alpha,
+                       (rocsparse_const_spmat_descr)matA,
+                       (rocsparse_const_dnvec_descr)vecX,
+                       beta,
+                       (const rocsparse_dnvec_descr)vecY,
+                       hipsparse::hipDataTypeToHCCDataType(computeType),
+                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                       rocsparse_spmv_stage_preprocess,
+                       &bufferSize,
+                       externalBuffer)));
+}
+
+hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                const void*                 alpha,
+                                hipsparseConstSpMatDescr_t  matA,
+                                hipsparseConstDnVecDescr_t  vecX,
+                                const void*                 beta,
+                                const hipsparseDnVecDescr_t vecY,
+                                hipDataType                 computeType,
+                                hipsparseSpMVAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    size_t bufferSize;
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmv((rocsparse_handle)handle,
+                       hipsparse::hipOperationToHCCOperation(opA),
+                       alpha,
+                       (rocsparse_const_spmat_descr)matA,
+                       (rocsparse_const_dnvec_descr)vecX,
+                       beta,
+                       (const rocsparse_dnvec_descr)vecY,
+                       hipsparse::hipDataTypeToHCCDataType(computeType),
+                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
+                       rocsparse_spmv_stage_compute,
+                       &bufferSize,
+                       externalBuffer)));
+}
+
+namespace hipsparse
+{
+    // Offsets of the parts of the buffer of a group, the SpMV of each matrix uses its own part
+    // of the buffer, at offsets aligned on 256 bytes. The sizes are queried on the host by
+    // every stage, so that the parts always match the descriptors as they are at the call.
+    static hipsparseStatus_t spmvGroupedOffsets(hipsparseHandle_t                 handle,
+                                                hipsparseOperation_t              opA,
+                                                int                               groupCount,
+                                                const void*                       alpha,
+                                                const hipsparseConstSpMatDescr_t* matA,
+                                                const hipsparseConstDnVecDescr_t* vecX,
+                                                const void*                       beta,
+                                                const hipsparseDnVecDescr_t*      vecY,
+                                                hipDataType                       computeType,
+                                                hipsparseSpMVAlg_t                alg,
+                                                std::vector<size_t>&              offsets)
+    {
+        offsets.resize(size_t(groupCount) + 1);
+
+        offsets[0] = 0;
+        for(int i = 0; i < groupCount; ++i)
+        {
+            size_t           size;
+            rocsparse_status status
+                = rocsparse_spmv((rocsparse_handle)handle,
+                                 hipOperationToHCCOperation(opA),
+                                 alpha,
+                                 (rocsparse_const_spmat_descr)matA[i],
+                                 (rocsparse_const_dnvec_descr)vecX[i],
+                                 beta,
+                                 (const rocsparse_dnvec_descr)vecY[i],
+                                 hipDataTypeToHCCDataType(computeType),
+                                 hipSpMVAlgToHCCSpMVAlg(alg),
+                                 rocsparse_spmv_stage_buffer_size,
+                                 &size,
+                                 nullptr);
+            if(status != rocsparse_status_success)
+            {
+                return rocSPARSEStatusToHIPStatus(status);
+            }
+
+            offsets[i + 1] = offsets[i] + ((size + 255) / 256) * 256;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t spmvGrouped(hipsparseHandle_t                 handle,
+                                         hipsparseOperation_t              opA,
+                                         int                               groupCount,
+                                         const void*                       alpha,
+                                         const hipsparseConstSpMatDescr_t* matA,
+                                         const hipsparseConstDnVecDescr_t* vecX,
+                                         const void*                       beta,
+                                         const hipsparseDnVecDescr_t*      vecY,
+                                         hipDataType                       computeType,
+                                         hipsparseSpMVAlg_t                alg,
+                                         rocsparse_spmv_stage              stage,
+                                         size_t*                           bufferSize,
+                                         void*                             buffer)
+    {
+        if(handle == nullptr || groupCount < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(groupCount > 0 && (matA == nullptr || vecX == nullptr || vecY == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const hipsparseStatus_t type_status = checkDataType(computeType);
+        if(type_status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return type_status;
+        }
+
+        std::vector<size_t>     offsets;
+        const hipsparseStatus_t offsets_status = spmvGroupedOffsets(
+            handle, opA, groupCount, alpha, matA, vecX, beta, vecY, computeType, alg, offsets);
+        if(offsets_status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return offsets_status;
+        }
+
+        if(stage != rocsparse_spmv_stage_buffer_size)
+        {
+            const rocsparse_operation op       = hipOperationToHCCOperation(opA);
+            const rocsparse_datatype  datatype = hipDataTypeToHCCDataType(computeType);
+            const rocsparse_spmv_alg  spmv_alg = hipSpMVAlgToHCCSpMVAlg(alg);
+
+            for(int i = 0; i < groupCount; ++i)
+            {
+                size_t size = offsets[i + 1] - offsets[i];
+                void*  part = (buffer != nullptr) ? static_cast<char*>(buffer) + offsets[i]
+                                                  : nullptr;
+
+                rocsparse_status status = rocsparse_spmv((rocsparse_handle)handle,
+                                                         op,
+                                                         alpha,
+                                                         (rocsparse_const_spmat_descr)matA[i],
+                                                         (rocsparse_const_dnvec_descr)vecX[i],
+                                                         beta,
+                                                         (const rocsparse_dnvec_descr)vecY[i],
+                                                         datatype,
+                                                         spmv_alg,
+                                                         stage,
+                                                         &size,
+                                                         part);
+                if(status != rocsparse_status_success)
+                {
+                    return rocSPARSEStatusToHIPStatus(status);
+                }
+            }
+        }
+
+        if(bufferSize != nullptr)
+        {
+            *bufferSize = offsets[groupCount];
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_bufferSize(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  size_t* pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    if(pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spmvGrouped(handle,
+                                        opA,
+                                        groupCount,
+                                        alpha,
+                                        matA,
+                                        vecX,
+                                        beta,
+                                        vecY,
+                                        computeType,
+                                        alg,
+                                        rocsparse_spmv_stage_buffer_size,
+                                        pBufferSizeInBytes,
+                                        nullptr));
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_preprocess(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::spmvGrouped(handle,
+                                        opA,
+                                        groupCount,
+                                        alpha,
+                                        matA,
+                                        vecX,
+                                        beta,
+                                        vecY,
+                                        computeType,
+                                        alg,
+                                        rocsparse_spmv_stage_preprocess,
+                                        nullptr,
+                                        externalBuffer));
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped(hipsparseHandle_t                 handle,
+                                       hipsparseOperation_t              opA,
+                                       int                               groupCount,
+                                       const void*                       alpha,
+                                       const hipsparseConstSpMatDescr_t* matA,
+                                       const hipsparseConstDnVecDescr_t* vecX,
+                                       const void*                       beta,
+                                       const hipsparseDnVecDescr_t*      vecY,
+                                       hipDataType                       computeType,
+                                       hipsparseSpMVAlg_t                alg,
+                                       void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::spmvGrouped(handle,
+                                        opA,
+                                        groupCount,
+                                        alpha,
+                                        matA,
+                                        vecX,
+                                        beta,
+                                        vecY,
+                                        computeType,
+                                        alg,
+                                        rocsparse_spmv_stage_compute,
+                                        nullptr,
+                                        externalBuffer));
+}
+
+struct hipsparseSpMVPlan
+{
+    rocsparse_operation   op;
+    rocsparse_spmat_descr mat;
+    rocsparse_datatype    compute_type;
+    rocsparse_spmv_alg    alg;
+
+    // Buffer of the preprocessed data, freed by hipsparseDestroySpMVPlan
+    void*  buffer      = nullptr;
+    size_t buffer_size = 0;
+};
+
+hipsparseStatus_t hipsparseCreateSpMVPlan(hipsparseSpMVPlan_t*        plan,
+                                          hipsparseHandle_t           handle,
+                                          hipsparseOperation_t        opA,
+                                          const void*                 alpha,
+                                          hipsparseSpMatDescr_t       matA,
+                                          hipsparseConstDnVecDescr_t  vecX,
+                                          const void*                 beta,
+                                          const hipsparseDnVecDescr_t vecY,
+                                          hipDataType                 computeType,
+                                          hipsparseSpMVAlg_t          alg)
+{
+    HIPSPARSE_TRACE(plan, handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    if(plan == nullptr || handle == nullptr || alpha == nullptr || matA == nullptr
+       || vecX == nullptr || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The plan owns its buffer
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkCapture(handle));
+
+    hipsparseSpMVPlan p;
+    p.op           = hipsparse::hipOperationToHCCOperation(opA);
+    p.mat          = (rocsparse_spmat_descr)matA;
+    p.compute_type = hipsparse::hipDataTypeToHCCDataType(computeType);
+    p.alg          = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                             p.op,
+                                             alpha,
+                                             p.mat,
+                                             (rocsparse_const_dnvec_descr)vecX,
+                                             beta,
+                                             (const rocsparse_dnvec_descr)vecY,
+                                             p.compute_type,
+                                             p.alg,
+                                             rocsparse_spmv_stage_buffer_size,
+                                             &p.buffer_size,
+                                             nullptr));
+
+    if(p.buffer_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipsparse::internalMalloc(&p.buffer, p.buffer_size));
+    }
+
+    // The analysis of rocSPARSE is stored in the matrix descriptor, it only reads the
+    // sparsity pattern
+    rocsparse_status status = rocsparse_spmv((rocsparse_handle)handle,
+                                             p.op,
+                                             alpha,
+                                             p.mat,
+                                             (rocsparse_const_dnvec_descr)vecX,
+                                             beta,
+                                             (const rocsparse_dnvec_descr)vecY,
+                                             p.compute_type,
+                                             p.alg,
+                                             rocsparse_spmv_stage_preprocess,
+                                             &p.buffer_size,
+                                             p.buffer);
+    if(status != rocsparse_status_success)
+    {
+        hipsparse::internalFree(p.buffer);
+        return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
+    }
+
+    *plan = new hipsparseSpMVPlan(p);
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroySpMVPlan(hipsparseSpMVPlan_t plan)
+{
+    HIPSPARSE_TRACE(plan);
 
-    // Check for buffer == nullptr as this is not done in rocsparse
-    if(externalBuffer == nullptr)
+    if(plan == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spvv((rocsparse_handle)handle,
-                       hipsparse::hipOperationToHCCOperation(opX),
-                       (rocsparse_const_spvec_descr)vecX,
-                       (rocsparse_const_dnvec_descr)vecY,
-                       result,
-                       hipsparse::hipDataTypeToHCCDataType(computeType),
-                       &bufferSize,
-                       externalBuffer));
+    // hipFree waits for the pending work using the buffer
+    const hipError_t status = hipsparse::internalFree(plan->buffer);
+    delete plan;
+
+    return trace(hipsparse::hipErrorToHIPSPARSEStatus(status));
 }
 
-hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
-                                           const void*                 alpha,
-                                           hipsparseConstSpMatDescr_t  matA,
-                                           hipsparseConstDnVecDescr_t  vecX,
-                                           const void*                 beta,
-                                           const hipsparseDnVecDescr_t vecY,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMVAlg_t          alg,
-                                           size_t*                     pBufferSizeInBytes)
+hipsparseStatus_t
+    hipsparseSpMVPlanUpdateValues(hipsparseHandle_t handle, hipsparseSpMVPlan_t plan, void* values)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmv((rocsparse_handle)handle,
-                       hipsparse::hipOperationToHCCOperation(opA),
-                       alpha,
-                       (rocsparse_const_spmat_descr)matA,
-                       (rocsparse_const_dnvec_descr)vecX,
-                       beta,
-                       (const rocsparse_dnvec_descr)vecY,
-                       hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
-                       rocsparse_spmv_stage_buffer_size,
-                       pBufferSizeInBytes,
-                       nullptr));
+    HIPSPARSE_TRACE(handle, plan, values);
+
+    if(handle == nullptr || plan == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(
+        hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_spmat_set_values(plan->mat, values)));
 }
 
-hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
-                                           hipsparseOperation_t        opA,
+hipsparseStatus_t hipsparseSpMVPlanExecute(hipsparseHandle_t           handle,
+                                           hipsparseSpMVPlan_t         plan,
                                            const void*                 alpha,
-                                           hipsparseConstSpMatDescr_t  matA,
                                            hipsparseConstDnVecDescr_t  vecX,
                                            const void*                 beta,
-                                           const hipsparseDnVecDescr_t vecY,
-                                           hipDataType                 computeType,
-                                           hipsparseSpMVAlg_t          alg,
-                                           void*                       externalBuffer)
+                                           const hipsparseDnVecDescr_t vecY)
 {
-    size_t bufferSize;
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmv((rocsparse_handle)handle,
-                       hipsparse::hipOperationToHCCOperation(opA),
-                       alpha,
-                       (rocsparse_const_spmat_descr)matA,
-                       (rocsparse_const_dnvec_descr)vecX,
-                       beta,
-                       (const rocsparse_dnvec_descr)vecY,
-                       hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
-                       rocsparse_spmv_stage_preprocess,
-                       &bufferSize,
-                       externalBuffer));
-}
+    HIPSPARSE_TRACE(handle, plan, alpha, vecX, beta, vecY);
 
-hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
-                                hipsparseOperation_t        opA,
-                                const void*                 alpha,
-                                hipsparseConstSpMatDescr_t  matA,
-                                hipsparseConstDnVecDescr_t  vecX,
-                                const void*                 beta,
-                                const hipsparseDnVecDescr_t vecY,
-                                hipDataType                 computeType,
-                                hipsparseSpMVAlg_t          alg,
-                                void*                       externalBuffer)
-{
-    size_t bufferSize;
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmv((rocsparse_handle)handle,
-                       hipsparse::hipOperationToHCCOperation(opA),
-                       alpha,
-                       (rocsparse_const_spmat_descr)matA,
-                       (rocsparse_const_dnvec_descr)vecX,
-                       beta,
-                       (const rocsparse_dnvec_descr)vecY,
-                       hipsparse::hipDataTypeToHCCDataType(computeType),
-                       hipsparse::hipSpMVAlgToHCCSpMVAlg(alg),
-                       rocsparse_spmv_stage_compute,
-                       &bufferSize,
-                       externalBuffer));
+    if(handle == nullptr || plan == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    size_t           buffer_size = plan->buffer_size;
+    rocsparse_status status      = rocsparse_spmv((rocsparse_handle)handle,
+                                             plan->op,
+                                             alpha,
+                                             plan->mat,
+                                             (rocsparse_const_dnvec_descr)vecX,
+                                             beta,
+                                             (const rocsparse_dnvec_descr)vecY,
+                                             plan->compute_type,
+                                             plan->alg,
+                                             rocsparse_spmv_stage_compute,
+                                             &buffer_size,
+                                             plan->buffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(status));
 }
 
 hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
@@ -14323,7 +20180,21 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        hipsparse::hipOperationToHCCOperation(opB),
@@ -14336,7 +20207,7 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                        hipsparse::hipSpMMAlgToHCCSpMMAlg(alg),
                        rocsparse_spmm_stage_buffer_size,
                        pBufferSizeInBytes,
-                       nullptr));
+                       nullptr)));
 }
 
 hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
@@ -14351,8 +20222,22 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     size_t bufferSize;
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        hipsparse::hipOperationToHCCOperation(opB),
@@ -14365,7 +20250,7 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                        hipsparse::hipSpMMAlgToHCCSpMMAlg(alg),
                        rocsparse_spmm_stage_preprocess,
                        &bufferSize,
-                       externalBuffer));
+                       externalBuffer)));
 }
 
 hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
@@ -14380,8 +20265,22 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     size_t bufferSize;
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        hipsparse::hipOperationToHCCOperation(opB),
@@ -14394,7 +20293,7 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                        hipsparse::hipSpMMAlgToHCCSpMMAlg(alg),
                        rocsparse_spmm_stage_compute,
                        &bufferSize,
-                       externalBuffer));
+                       externalBuffer)));
 }
 
 struct hipsparseSpGEMMDescr
@@ -14414,12 +20313,16 @@ struct hipsparseSpGEMMDescr
 
 hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     *descr = new hipsparseSpGEMMDescr;
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     // Check if info structure has been created
     if(descr != nullptr)
     {
@@ -14431,7 +20334,7 @@ hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
         delete descr;
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 namespace hipsparse
@@ -14511,11 +20414,27 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                                  size_t*                    bufferSize1,
                                                  void*                      externalBuffer1)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     // Match cusparse error handling
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize1 == nullptr || spgemmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get data stored in C matrix
@@ -14596,7 +20515,7 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                              (static_cast<char*>(spgemmDescr->externalBuffer1) + byteOffset1)));
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
@@ -14613,10 +20532,26 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                           size_t*                    bufferSize2,
                                           void*                      externalBuffer2)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize2 == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get data stored in C matrix
@@ -14706,7 +20641,7 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                              (static_cast<char*>(spgemmDescr->externalBuffer1) + byteOffset1)));
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
@@ -14721,10 +20656,12 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                                        hipsparseSpGEMMAlg_t       alg,
                                        hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get data stored in C matrix
@@ -14766,23 +20703,20 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     byteOffset2 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
-    byteOffset2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
 
     // Get pointer mode
     hipsparsePointerMode_t pointer_mode;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getPointerMode(handle, &pointer_mode));
 
     hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
     float            host_sone = 1.0f;
     double           host_done = 1.0f;
     hipComplex       host_cone = make_hipComplex(1.0f, 0.0f);
     hipDoubleComplex host_zone = make_hipDoubleComplex(1.0, 0.0);
 
-    void* one = nullptr;
+    const void* one = nullptr;
     if(pointer_mode == HIPSPARSE_POINTER_MODE_HOST)
     {
         if(computeType == HIP_R_32F)
@@ -14796,28 +20730,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     }
     else
     {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
+        RETURN_IF_HIP_ERROR(hipsparse::getDeviceConstant(handle, computeType, 1, &one));
     }
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
@@ -14838,7 +20751,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     }
     else
     {
-        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
     }
 
     // Copy data from external1 buffer to row pointer array
@@ -14879,7 +20792,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     RETURN_IF_HIPSPARSE_ERROR(
         hipsparseCsrSetPointers(matC, csrRowOffsetsC, csrColIndC, csrValuesC));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t          handle,
@@ -14893,6 +20806,17 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                                       size_t*                    bufferSize1,
                                                       void*                      externalBuffer1)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
     const void* alpha = (const void*)0x4;
     const void* beta  = (const void*)0x4;
 
@@ -14919,19 +20843,19 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
 
     hipDataType computeType = csrValueTypeC;
 
-    return hipsparseSpGEMM_workEstimation(handle,
-                                          opA,
-                                          opB,
-                                          alpha,
-                                          matA,
-                                          matB,
-                                          beta,
-                                          matC,
-                                          computeType,
-                                          alg,
-                                          spgemmDescr,
-                                          bufferSize1,
-                                          externalBuffer1);
+    return trace(hipsparseSpGEMM_workEstimation(handle,
+                                                opA,
+                                                opB,
+                                                alpha,
+                                                matA,
+                                                matB,
+                                                beta,
+                                                matC,
+                                                computeType,
+                                                alg,
+                                                spgemmDescr,
+                                                bufferSize1,
+                                                externalBuffer1));
 }
 
 hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
@@ -14949,12 +20873,29 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                            size_t*                    bufferSize4,
                                            void*                      externalBuffer4)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2,
+                    bufferSize3,
+                    externalBuffer3,
+                    bufferSize4,
+                    externalBuffer4);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     // Match cusparse error handling
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
        || bufferSize3 == nullptr || bufferSize4 == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // If any external buffer is nullptr, they must all be nullptr.
@@ -14964,7 +20905,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                           | (externalBuffer4 == nullptr);
     if(anyBuffersNull && !allBuffersNull)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     const void* alpha = (const void*)0x4;
@@ -15016,7 +20957,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
     else
     {
         hipStream_t stream;
-        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
         spgemmDescr->externalBuffer2 = externalBuffer2;
         spgemmDescr->externalBuffer3 = externalBuffer3; // stores C column indices and values
@@ -15059,7 +21000,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                              static_cast<char*>(spgemmDescr->externalBuffer4) + byteOffset4));
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
@@ -15073,10 +21014,21 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                             size_t*                    bufferSize5,
                                             void*                      externalBuffer5)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize5,
+                    externalBuffer5);
+
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || bufferSize5 == nullptr || spgemmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get data stored in C matrix
@@ -15128,7 +21080,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
         spgemmDescr->externalBuffer5 = externalBuffer5;
 
         hipStream_t stream;
-        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::getStream(handle, &stream));
 
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrRowOffsetsC,
                                            spgemmDescr->externalBuffer4,
@@ -15145,7 +21097,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
             hipsparseCsrSetPointers(matC, csrRowOffsetsC, csrColIndC, csrValuesC));
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle,
@@ -15160,9 +21112,13 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                                hipsparseSpGEMMAlg_t       alg,
                                                hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || spgemmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     // Get data stored in C matrix
@@ -15201,9 +21157,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     byteOffset5 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
-    byteOffset5 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
 
     // Use external buffer for values array as the original values array may have data in it
     // that must be accounted for when multiplying by beta. See below.
@@ -15229,17 +21182,14 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
 
     // Get pointer mode
     hipsparsePointerMode_t pointer_mode;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
-
-    hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getPointerMode(handle, &pointer_mode));
 
     float            host_sone = 1.0f;
     double           host_done = 1.0f;
     hipComplex       host_cone = make_hipComplex(1.0f, 0.0f);
     hipDoubleComplex host_zone = make_hipDoubleComplex(1.0, 0.0);
 
-    void* one = nullptr;
+    const void* one = nullptr;
     if(pointer_mode == HIPSPARSE_POINTER_MODE_HOST)
     {
         if(computeType == HIP_R_32F)
@@ -15253,28 +21203,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     }
     else
     {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
+        RETURN_IF_HIP_ERROR(hipsparse::getDeviceConstant(handle, computeType, 1, &one));
     }
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
@@ -15295,7 +21224,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     }
     else
     {
-        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
     }
 
     hipsparseConstSpVecDescr_t vecX;
@@ -15322,7 +21251,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     RETURN_IF_HIPSPARSE_ERROR(
         hipsparseCsrSetPointers(matC, csrRowOffsetsC, csrColIndC, csrValuesC));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
@@ -15337,7 +21266,11 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                                  hipsparseSDDMMAlg_t        alg,
                                  void*                      tempBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm((rocsparse_handle)handle,
                         hipsparse::hipOperationToHCCOperation(opA),
                         hipsparse::hipOperationToHCCOperation(opB),
@@ -15348,7 +21281,7 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                         (const rocsparse_spmat_descr)matC,
                         hipsparse::hipDataTypeToHCCDataType(computeType),
                         hipsparse::hipSDDMMAlgToHCCSDDMMAlg(alg),
-                        tempBuffer));
+                        tempBuffer)));
 }
 
 hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
@@ -15363,7 +21296,21 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             size_t*                    pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
                                     hipsparse::hipOperationToHCCOperation(opA),
                                     hipsparse::hipOperationToHCCOperation(opB),
@@ -15374,7 +21321,7 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                     (const rocsparse_spmat_descr)matC,
                                     hipsparse::hipDataTypeToHCCDataType(computeType),
                                     hipsparse::hipSDDMMAlgToHCCSDDMMAlg(alg),
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
@@ -15389,7 +21336,11 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             void*                      tempBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_preprocess((rocsparse_handle)handle,
                                    hipsparse::hipOperationToHCCOperation(opA),
                                    hipsparse::hipOperationToHCCOperation(opB),
@@ -15400,29 +21351,36 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                    (const rocsparse_spmat_descr)matC,
                                    hipsparse::hipDataTypeToHCCDataType(computeType),
                                    hipsparse::hipSDDMMAlgToHCCSDDMMAlg(alg),
-                                   tempBuffer));
+                                   tempBuffer)));
 }
 
 struct hipsparseSpSVDescr
 {
     void* externalBuffer{};
+
+    // Matrix of the analysis, its values are replaced by hipsparseSpSV_updateMatrix
+    rocsparse_spmat_descr mat{};
 };
 
 hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     *descr = new hipsparseSpSVDescr;
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     if(descr != nullptr)
     {
         descr->externalBuffer = nullptr;
         delete descr;
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
@@ -15436,7 +21394,20 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    x,
+                    y,
+                    computeType,
+                    alg,
+                    spsvDescr,
+                    pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        alpha,
@@ -15447,7 +21418,7 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                        hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
                        rocsparse_spsv_stage_buffer_size,
                        pBufferSizeInBytes,
-                       nullptr));
+                       nullptr)));
 }
 
 hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
@@ -15461,10 +21432,13 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
 
     if(spsvDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)handle,
                                              hipsparse::hipOperationToHCCOperation(opA),
@@ -15478,7 +21452,8 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                              nullptr,
                                              externalBuffer));
     spsvDescr->externalBuffer = externalBuffer;
-    return HIPSPARSE_STATUS_SUCCESS;
+    spsvDescr->mat            = (rocsparse_spmat_descr)matA;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
@@ -15491,11 +21466,15 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVAlg_t          alg,
                                       hipsparseSpSVDescr_t        spsvDescr)
 {
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(spsvDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        alpha,
@@ -15506,29 +21485,110 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                        hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
                        rocsparse_spsv_stage_compute,
                        nullptr,
-                       spsvDescr->externalBuffer));
+                       spsvDescr->externalBuffer)));
+}
+
+hipsparseStatus_t hipsparseSpSV_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSVDescr_t  spsvDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSVUpdate_t updatePart)
+{
+    HIPSPARSE_TRACE(handle, spsvDescr, newValues, updatePart);
+
+    if(handle == nullptr || spsvDescr == nullptr || newValues == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The analysis only depends on the sparsity pattern, the solve reads the values of the
+    // matrix descriptor
+    if(spsvDescr->mat == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // rocSPARSE has no diagonal override of the analysed matrix
+    if(updatePart != HIPSPARSE_SPSV_UPDATE_GENERAL)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_set_values(spsvDescr->mat, newValues)));
+}
+
+hipsparseStatus_t hipsparseSpSV_solveBatched(hipsparseHandle_t                 handle,
+                                             hipsparseOperation_t              opA,
+                                             const void*                       alpha,
+                                             hipsparseConstSpMatDescr_t        matA,
+                                             int                               batchCount,
+                                             const hipsparseConstDnVecDescr_t* x,
+                                             const hipsparseDnVecDescr_t*      y,
+                                             hipDataType                       computeType,
+                                             hipsparseSpSVAlg_t                alg,
+                                             hipsparseSpSVDescr_t              spsvDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, batchCount, x, y, computeType, alg, spsvDescr);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
+    if(handle == nullptr || spsvDescr == nullptr || batchCount < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(batchCount > 0 && (x == nullptr || y == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // Each right-hand side reuses the analysis stored in the buffer of spsvDescr
+    for(int i = 0; i < batchCount; ++i)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spsv((rocsparse_handle)handle,
+                           hipsparse::hipOperationToHCCOperation(opA),
+                           alpha,
+                           (rocsparse_const_spmat_descr)matA,
+                           (rocsparse_const_dnvec_descr)x[i],
+                           (const rocsparse_dnvec_descr)y[i],
+                           hipsparse::hipDataTypeToHCCDataType(computeType),
+                           hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
+                           rocsparse_spsv_stage_compute,
+                           nullptr,
+                           spsvDescr->externalBuffer));
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 struct hipsparseSpSMDescr
 {
     void* externalBuffer{};
+
+    // Matrix of the analysis, its values are replaced by hipsparseSpSM_updateMatrix
+    rocsparse_spmat_descr mat{};
 };
 
 hipsparseStatus_t hipsparseSpSM_createDescr(hipsparseSpSMDescr_t* descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     *descr = new hipsparseSpSMDescr;
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSM_destroyDescr(hipsparseSpSMDescr_t descr)
 {
+    HIPSPARSE_TRACE(descr);
+
     if(descr != nullptr)
     {
         descr->externalBuffer = nullptr;
         delete descr;
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
@@ -15543,9 +21603,23 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    pBufferSizeInBytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(spsmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsm((rocsparse_handle)handle,
@@ -15563,7 +21637,7 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
 
     pBufferSizeInBytes[0] = std::max(pBufferSizeInBytes[0], sizeof(int32_t));
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
@@ -15578,9 +21652,23 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(spsmDescr == nullptr || externalBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsm((rocsparse_handle)handle,
@@ -15597,8 +21685,9 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                              externalBuffer));
 
     spsmDescr->externalBuffer = externalBuffer;
+    spsmDescr->mat            = (rocsparse_spmat_descr)matA;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
@@ -15613,12 +21702,26 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkDataType(computeType));
+
     if(spsmDescr == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        hipsparse::hipOperationToHCCOperation(opB),
@@ -15630,7 +21733,34 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                        hipsparse::hipSpSMAlgToHCCSpSMAlg(alg),
                        rocsparse_spsm_stage_compute,
                        nullptr,
-                       spsmDescr->externalBuffer));
+                       spsmDescr->externalBuffer)));
+}
+
+hipsparseStatus_t hipsparseSpSM_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSMDescr_t  spsmDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSMUpdate_t updatePart)
+{
+    HIPSPARSE_TRACE(handle, spsmDescr, newValues, updatePart);
+
+    if(handle == nullptr || spsmDescr == nullptr || newValues == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(spsmDescr->mat == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // rocSPARSE has no diagonal override of the analysed matrix
+    if(updatePart != HIPSPARSE_SPSM_UPDATE_GENERAL)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_spmat_set_values(spsmDescr->mat, newValues)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -15643,12 +21773,14 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const float* dummy = static_cast<const float*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_no_pivot_strided_batch_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            dummy,
@@ -15657,7 +21789,7 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                            dummy,
                                                            batchCount,
                                                            batchStride,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -15670,12 +21802,14 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const double* dummy = static_cast<const double*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_no_pivot_strided_batch_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            dummy,
@@ -15684,7 +21818,7 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                            dummy,
                                                            batchCount,
                                                            batchStride,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -15697,12 +21831,14 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipComplex* dummy = static_cast<const hipComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            (const rocsparse_float_complex*)dummy,
@@ -15711,7 +21847,7 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                            (const rocsparse_float_complex*)dummy,
                                                            batchCount,
                                                            batchStride,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -15724,12 +21860,14 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipDoubleComplex* dummy = static_cast<const hipDoubleComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch_buffer_size((rocsparse_handle)handle,
                                                            m,
                                                            (const rocsparse_double_complex*)dummy,
@@ -15738,7 +21876,7 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                            (const rocsparse_double_complex*)dummy,
                                                            batchCount,
                                                            batchStride,
-                                                           pBufferSizeInBytes));
+                                                           pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -15752,8 +21890,10 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
-        (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
+        (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -15767,8 +21907,10 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
-        (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
+        (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -15781,7 +21923,9 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
                                                (const rocsparse_float_complex*)dl,
@@ -15790,7 +21934,7 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                                (rocsparse_float_complex*)x,
                                                batchCount,
                                                batchStride,
-                                               pBuffer));
+                                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
@@ -15804,7 +21948,9 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
                                                (const rocsparse_double_complex*)dl,
@@ -15813,7 +21959,7 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                                (rocsparse_double_complex*)x,
                                                batchCount,
                                                batchStride,
-                                               pBuffer));
+                                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -15826,13 +21972,15 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const float* dummy = static_cast<const float*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_buffer_size(
-        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes));
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_buffer_size(
+        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -15845,13 +21993,15 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const double* dummy = static_cast<const double*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_buffer_size(
-        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes));
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_buffer_size(
+        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -15864,12 +22014,14 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipComplex* dummy = static_cast<const hipComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_buffer_size((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -15878,7 +22030,7 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                     (const rocsparse_float_complex*)dummy,
                                     (const rocsparse_float_complex*)dummy,
                                     ldb,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
@@ -15891,12 +22043,14 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipDoubleComplex* dummy = static_cast<const hipDoubleComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_buffer_size((rocsparse_handle)handle,
                                     m,
                                     n,
@@ -15905,7 +22059,7 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                     (const rocsparse_double_complex*)dummy,
                                     (const rocsparse_double_complex*)dummy,
                                     ldb,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
@@ -15919,8 +22073,10 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
@@ -15934,8 +22090,10 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
@@ -15948,15 +22106,18 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cgtsv((rocsparse_handle)handle,
-                                                                 m,
-                                                                 n,
-                                                                 (const rocsparse_float_complex*)dl,
-                                                                 (const rocsparse_float_complex*)d,
-                                                                 (const rocsparse_float_complex*)du,
-                                                                 (rocsparse_float_complex*)B,
-                                                                 ldb,
-                                                                 pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_cgtsv((rocsparse_handle)handle,
+                        m,
+                        n,
+                        (const rocsparse_float_complex*)dl,
+                        (const rocsparse_float_complex*)d,
+                        (const rocsparse_float_complex*)du,
+                        (rocsparse_float_complex*)B,
+                        ldb,
+                        pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
@@ -15970,7 +22131,9 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv((rocsparse_handle)handle,
                         m,
                         n,
@@ -15979,7 +22142,7 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                         (const rocsparse_double_complex*)du,
                         (rocsparse_double_complex*)B,
                         ldb,
-                        pBuffer));
+                        pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -15992,13 +22155,15 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const float* dummy = static_cast<const float*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_buffer_size(
-        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes));
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_buffer_size(
+        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -16011,13 +22176,15 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const double* dummy = static_cast<const double*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_buffer_size(
-        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes));
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_buffer_size(
+        (rocsparse_handle)handle, m, n, dummy, dummy, dummy, dummy, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -16030,12 +22197,14 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipComplex* dummy = static_cast<const hipComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -16044,7 +22213,7 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                              (const rocsparse_float_complex*)dummy,
                                              (const rocsparse_float_complex*)dummy,
                                              ldb,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t       handle,
@@ -16057,12 +22226,14 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                                         int                     ldb,
                                                         size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipDoubleComplex* dummy = static_cast<const hipDoubleComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_buffer_size((rocsparse_handle)handle,
                                              m,
                                              n,
@@ -16071,7 +22242,7 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                              (const rocsparse_double_complex*)dummy,
                                              (const rocsparse_double_complex*)dummy,
                                              ldb,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
@@ -16085,8 +22256,10 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_sgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_sgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
@@ -16100,8 +22273,10 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
@@ -16115,7 +22290,9 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
                                  n,
@@ -16124,7 +22301,7 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                  (const rocsparse_float_complex*)du,
                                  (rocsparse_float_complex*)B,
                                  ldb,
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
@@ -16138,7 +22315,9 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                           void*                   pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
                                  n,
@@ -16147,7 +22326,7 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                  (const rocsparse_double_complex*)du,
                                  (rocsparse_double_complex*)B,
                                  ldb,
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16160,12 +22339,14 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const float* dummy = static_cast<const float*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gtsv_interleaved_alg)algo,
                                                       m,
@@ -16175,7 +22356,7 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16188,12 +22369,14 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const double* dummy = static_cast<const double*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gtsv_interleaved_alg)algo,
                                                       m,
@@ -16203,7 +22386,7 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16216,12 +22399,14 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipComplex* dummy = static_cast<const hipComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gtsv_interleaved_alg)algo,
                                                       m,
@@ -16231,7 +22416,7 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       (const rocsparse_float_complex*)dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -16244,12 +22429,14 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipDoubleComplex* dummy = static_cast<const hipDoubleComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gtsv_interleaved_alg)algo,
                                                       m,
@@ -16259,7 +22446,7 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       (const rocsparse_double_complex*)dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16273,7 +22460,9 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
                                           m,
@@ -16283,7 +22472,7 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                           x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16297,7 +22486,9 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
                                           m,
@@ -16307,7 +22498,7 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                           x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16320,7 +22511,9 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
                                           m,
@@ -16330,7 +22523,7 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                           (rocsparse_float_complex*)x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16344,7 +22537,9 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
                                           m,
@@ -16354,7 +22549,7 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                           (rocsparse_double_complex*)x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16369,12 +22564,14 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const float* dummy = static_cast<const float*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gpsv_interleaved_alg)algo,
                                                       m,
@@ -16386,7 +22583,7 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16401,12 +22598,14 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const double* dummy = static_cast<const double*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gpsv_interleaved_alg)algo,
                                                       m,
@@ -16418,7 +22617,7 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -16433,12 +22632,14 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipComplex* dummy = static_cast<const hipComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gpsv_interleaved_alg)algo,
                                                       m,
@@ -16450,7 +22651,7 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       (const rocsparse_float_complex*)dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -16465,12 +22666,14 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
     // that a user chooses, just pass in non-null dummy pointer.
     const hipDoubleComplex* dummy = static_cast<const hipDoubleComplex*>((void*)0x4);
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch_buffer_size((rocsparse_handle)handle,
                                                       (rocsparse_gpsv_interleaved_alg)algo,
                                                       m,
@@ -16482,7 +22685,7 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                       (const rocsparse_double_complex*)dummy,
                                                       batchCount,
                                                       batchCount,
-                                                      pBufferSizeInBytes));
+                                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16497,7 +22700,9 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
                                           m,
@@ -16509,7 +22714,7 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                           x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16524,7 +22729,9 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
                                           m,
@@ -16536,7 +22743,7 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                           x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16551,7 +22758,9 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
                                           m,
@@ -16563,7 +22772,7 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                           (rocsparse_float_complex*)x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -16578,7 +22787,9 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
                                           m,
@@ -16590,7 +22801,7 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                           (rocsparse_double_complex*)x,
                                           batchCount,
                                           batchCount,
-                                          pBuffer));
+                                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
@@ -16606,7 +22817,20 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrcolor((rocsparse_handle)handle,
                             m,
                             nnz,
@@ -16618,7 +22842,7 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                             ncolors,
                             coloring,
                             reordering,
-                            (rocsparse_mat_info)info));
+                            (rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
@@ -16634,7 +22858,20 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrcolor((rocsparse_handle)handle,
                             m,
                             nnz,
@@ -16646,7 +22883,7 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                             ncolors,
                             coloring,
                             reordering,
-                            (rocsparse_mat_info)info));
+                            (rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
@@ -16662,7 +22899,20 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrcolor((rocsparse_handle)handle,
                             m,
                             nnz,
@@ -16674,7 +22924,7 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                             ncolors,
                             coloring,
                             reordering,
-                            (rocsparse_mat_info)info));
+                            (rocsparse_mat_info)info)));
 }
 
 hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
@@ -16690,7 +22940,20 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrcolor((rocsparse_handle)handle,
                             m,
                             nnz,
@@ -16702,5 +22965,5 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                             ncolors,
                             coloring,
                             reordering,
-                            (rocsparse_mat_info)info));
+                            (rocsparse_mat_info)info)));
 }
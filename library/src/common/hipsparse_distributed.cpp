@@ -0,0 +1,1427 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse.h"
+
+#include "hipsparse_memory.hpp"
+#include "hipsparse_trace.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string.h>
+#include <tuple>
+#include <vector>
+
+//
+// Distributed CSR matrices, built on the generic API of the backend.
+//
+// The rows of a rank are split into a local block, multiplied with the entries of x owned by the
+// rank, and a ghost block, multiplied with the compressed ghost entries received from the
+// neighbours. The messages are exchanged through the transport of the rank in host memory.
+//
+#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
+
+#define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                    \
+        hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
+        {                                                                \
+            return TMP_STATUS_FOR_CHECK;                                 \
+        }                                                                \
+    }
+
+#define RETURN_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                       \
+    {                                                                     \
+        hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;         \
+        if(TMP_STATUS_FOR_CHECK != hipSuccess)                            \
+        {                                                                 \
+            return hipsparse::distHipErrorToStatus(TMP_STATUS_FOR_CHECK); \
+        }                                                                 \
+    }
+
+// Local transport, a mailbox per rank
+struct hipsparseLocalTransport
+{
+    struct mailbox
+    {
+        std::mutex              mutex;
+        std::condition_variable arrived;
+
+        // Messages arrived, by source, tag and sequence number
+        std::map<std::tuple<int, int, uint64_t>, std::vector<char>> messages;
+
+        // Number of messages sent to the rank, and of receives posted by the rank, by source
+        // and tag
+        std::map<std::pair<int, int>, uint64_t> sent;
+        std::map<std::pair<int, int>, uint64_t> posted;
+    };
+
+    struct endpoint
+    {
+        hipsparseLocalTransport* group;
+        int                      rank;
+    };
+
+    struct receive
+    {
+        std::tuple<int, int, uint64_t> key;
+        void*                          buf;
+        size_t                         bytes;
+    };
+
+    explicit hipsparseLocalTransport(int size)
+        : mailboxes(size)
+        , endpoints(size)
+    {
+        for(int rank = 0; rank < size; ++rank)
+        {
+            this->endpoints[rank].group = this;
+            this->endpoints[rank].rank  = rank;
+        }
+    }
+
+    std::vector<mailbox>  mailboxes;
+    std::vector<endpoint> endpoints;
+};
+
+// Rows of a distributed CSR matrix owned by a rank
+struct hipsparseDistCsrDescr
+{
+    hipsparseTransport_t transport{};
+
+    int64_t     rows{};
+    int64_t     ghosts{};
+    int64_t     localNnz{};
+    int64_t     ghostNnz{};
+    hipDataType valueType{};
+
+    // Ranks receiving entries of x from this rank, and their offsets in the send list
+    std::vector<int>     sendRanks{};
+    std::vector<int64_t> sendOffsets{};
+
+    // Ranks sending ghost entries to this rank, and their offsets in the ghost entries
+    std::vector<int>     recvRanks{};
+    std::vector<int64_t> recvOffsets{};
+
+    // Blocks on the device, with 32 bit indices and a zero base
+    void*                 localRowPtr{};
+    void*                 localColInd{};
+    void*                 localVal{};
+    void*                 ghostRowPtr{};
+    void*                 ghostColInd{};
+    void*                 ghostVal{};
+    hipsparseSpMatDescr_t localMat{};
+    hipsparseSpMatDescr_t ghostMat{};
+
+    // Local indices of the entries of x sent to the neighbours, without duplicates, and the
+    // position of each entry of the send list among them
+    int64_t              gathered{};
+    void*                sendInd{};
+    std::vector<int32_t> sendMap{};
+
+    // Prepared by the first product, for the data type of x, the compute type and the algorithm
+    bool                  prepared{};
+    hipDataType           xType{};
+    hipDataType           computeType{};
+    hipsparseSpMVAlg_t    alg{};
+    void*                 sendX{};
+    void*                 ghostX{};
+    void*                 one{};
+    char                  hostOne[16]{};
+    hipsparseSpVecDescr_t sendVec{};
+    hipsparseDnVecDescr_t ghostVec{};
+    hipsparseSpMVPlan_t   localPlan{};
+    hipsparseSpMVPlan_t   ghostPlan{};
+    std::vector<char>     gatherHost{};
+    std::vector<char>     sendHost{};
+    std::vector<char>     recvHost{};
+};
+
+namespace hipsparse
+{
+    // Tags of the messages of the distributed matrices
+    static constexpr int dist_tag_count  = 0x4853;
+    static constexpr int dist_tag_ghosts = 0x4854;
+    static constexpr int dist_tag_halo   = 0x4855;
+    static constexpr int dist_tag_status = 0x4856;
+
+    static hipsparseStatus_t distHipErrorToStatus(hipError_t status)
+    {
+        switch(status)
+        {
+        case hipSuccess:
+            return HIPSPARSE_STATUS_SUCCESS;
+        case hipErrorMemoryAllocation:
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        default:
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    static size_t distDataTypeSize(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+            return sizeof(int8_t);
+        case HIP_R_16F:
+        case HIP_R_16BF:
+            return sizeof(uint16_t);
+        case HIP_R_32I:
+        case HIP_R_32F:
+            return sizeof(float);
+        case HIP_R_64F:
+        case HIP_C_32F:
+            return sizeof(double);
+        case HIP_C_64F:
+            return 2 * sizeof(double);
+        default:
+            return 0;
+        }
+    }
+
+    // The scalar one of a compute type, the product with the ghost block accumulates into y
+    static bool distOne(hipDataType type, char* one)
+    {
+        memset(one, 0, 16);
+        switch(type)
+        {
+        case HIP_R_32I:
+        {
+            const int32_t value = 1;
+            memcpy(one, &value, sizeof(value));
+            return true;
+        }
+        case HIP_R_32F:
+        case HIP_C_32F:
+        {
+            const float value = 1.0f;
+            memcpy(one, &value, sizeof(value));
+            return true;
+        }
+        case HIP_R_64F:
+        case HIP_C_64F:
+        {
+            const double value = 1.0;
+            memcpy(one, &value, sizeof(value));
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    static int64_t distIndex(const std::vector<char>& array, hipsparseIndexType_t type, int64_t i)
+    {
+        if(type == HIPSPARSE_INDEX_32I)
+        {
+            int32_t value;
+            memcpy(&value, array.data() + sizeof(int32_t) * i, sizeof(int32_t));
+            return value;
+        }
+
+        int64_t value;
+        memcpy(&value, array.data() + sizeof(int64_t) * i, sizeof(int64_t));
+        return value;
+    }
+
+    static hipError_t distMalloc(void** ptr, size_t size)
+    {
+        // Empty blocks still get an array, the descriptors reject null pointers
+        return internalMalloc(ptr, std::max(size, size_t(16)));
+    }
+
+    static hipError_t distUpload(void** ptr, const void* src, size_t size, hipStream_t stream)
+    {
+        hipError_t status = distMalloc(ptr, size);
+        if(status != hipSuccess || size == 0)
+        {
+            return status;
+        }
+
+        status = internalMemcpyAsync(*ptr, src, size, stream);
+        if(status != hipSuccess)
+        {
+            return status;
+        }
+        return internalStreamSynchronize(stream);
+    }
+
+    static hipsparseStatus_t distCheckCaptureSafe(hipsparseHandle_t handle)
+    {
+        hipsparseSyncMode_t mode;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetSyncMode(handle, &mode));
+        return (mode == HIPSPARSE_SYNC_MODE_CAPTURE_SAFE) ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                                          : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Local transport callbacks, userData is the endpoint of the rank.
+    //
+    static hipsparseStatus_t
+        localIsend(void* userData, const void* buf, size_t bytes, int dest, int tag, void** request)
+    {
+        hipsparseLocalTransport::endpoint* self
+            = static_cast<hipsparseLocalTransport::endpoint*>(userData);
+        if(request == nullptr || (buf == nullptr && bytes != 0) || dest < 0
+           || dest >= int(self->group->mailboxes.size()))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparseLocalTransport::mailbox& box = self->group->mailboxes[dest];
+        try
+        {
+            const char*                 data = static_cast<const char*>(buf);
+            std::vector<char>           message(data, data + bytes);
+            std::lock_guard<std::mutex> lock(box.mutex);
+
+            const uint64_t seq = box.sent[std::make_pair(self->rank, tag)]++;
+            box.messages[std::make_tuple(self->rank, tag, seq)] = std::move(message);
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+        box.arrived.notify_all();
+
+        // The message is copied, the send is complete
+        *request = nullptr;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t
+        localIrecv(void* userData, void* buf, size_t bytes, int source, int tag, void** request)
+    {
+        hipsparseLocalTransport::endpoint* self
+            = static_cast<hipsparseLocalTransport::endpoint*>(userData);
+        if(request == nullptr || (buf == nullptr && bytes != 0) || source < 0
+           || source >= int(self->group->mailboxes.size()))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparseLocalTransport::receive* recv = new(std::nothrow) hipsparseLocalTransport::receive;
+        if(recv == nullptr)
+        {
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+
+        hipsparseLocalTransport::mailbox& box = self->group->mailboxes[self->rank];
+        try
+        {
+            std::lock_guard<std::mutex> lock(box.mutex);
+
+            const uint64_t seq = box.posted[std::make_pair(source, tag)]++;
+            recv->key          = std::make_tuple(source, tag, seq);
+        }
+        catch(const std::bad_alloc&)
+        {
+            delete recv;
+            return HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+        recv->buf   = buf;
+        recv->bytes = bytes;
+
+        *request = recv;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t localWait(void* userData, void* request)
+    {
+        if(request == nullptr)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipsparseLocalTransport::endpoint* self
+            = static_cast<hipsparseLocalTransport::endpoint*>(userData);
+        hipsparseLocalTransport::receive* recv
+            = static_cast<hipsparseLocalTransport::receive*>(request);
+        hipsparseLocalTransport::mailbox& box = self->group->mailboxes[self->rank];
+
+        std::unique_lock<std::mutex> lock(box.mutex);
+        box.arrived.wait(lock, [&]() { return box.messages.count(recv->key) != 0; });
+
+        auto              it     = box.messages.find(recv->key);
+        hipsparseStatus_t status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+        if(it->second.size() == recv->bytes)
+        {
+            if(recv->bytes != 0)
+            {
+                memcpy(recv->buf, it->second.data(), recv->bytes);
+            }
+            status = HIPSPARSE_STATUS_SUCCESS;
+        }
+        box.messages.erase(it);
+        lock.unlock();
+
+        delete recv;
+        return status;
+    }
+
+    //
+    // Posted messages of a rank, every request is waited for even if an operation failed, so
+    // that no buffer is left in use.
+    //
+    struct distRequests
+    {
+        explicit distRequests(const hipsparseTransport_t& transport)
+            : transport(transport)
+        {
+        }
+
+        void isend(const void* buf, size_t bytes, int dest, int tag)
+        {
+            void*                   request = nullptr;
+            const hipsparseStatus_t posted = this->transport.isend(
+                this->transport.userData, buf, bytes, dest, tag, &request);
+            this->update(posted);
+            if(posted == HIPSPARSE_STATUS_SUCCESS)
+            {
+                this->requests.push_back(request);
+            }
+        }
+
+        void irecv(void* buf, size_t bytes, int source, int tag)
+        {
+            void*                   request = nullptr;
+            const hipsparseStatus_t posted = this->transport.irecv(
+                this->transport.userData, buf, bytes, source, tag, &request);
+            this->update(posted);
+            if(posted == HIPSPARSE_STATUS_SUCCESS)
+            {
+                this->requests.push_back(request);
+            }
+        }
+
+        hipsparseStatus_t waitAll()
+        {
+            for(void* request : this->requests)
+            {
+                this->update(this->transport.wait(this->transport.userData, request));
+            }
+            this->requests.clear();
+            return this->status;
+        }
+
+        void update(hipsparseStatus_t s)
+        {
+            if(this->status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                this->status = s;
+            }
+        }
+
+        const hipsparseTransport_t& transport;
+        std::vector<void*>          requests{};
+        hipsparseStatus_t           status = HIPSPARSE_STATUS_SUCCESS;
+    };
+
+    static void distReleasePlans(hipsparseDistCsrDescr* descr)
+    {
+        if(descr->localPlan != nullptr)
+        {
+            hipsparseDestroySpMVPlan(descr->localPlan);
+        }
+        if(descr->ghostPlan != nullptr)
+        {
+            hipsparseDestroySpMVPlan(descr->ghostPlan);
+        }
+        if(descr->sendVec != nullptr)
+        {
+            hipsparseDestroySpVec(descr->sendVec);
+        }
+        if(descr->ghostVec != nullptr)
+        {
+            hipsparseDestroyDnVec(descr->ghostVec);
+        }
+        internalFree(descr->sendX);
+        internalFree(descr->ghostX);
+        internalFree(descr->one);
+
+        descr->localPlan = nullptr;
+        descr->ghostPlan = nullptr;
+        descr->sendVec   = nullptr;
+        descr->ghostVec  = nullptr;
+        descr->sendX     = nullptr;
+        descr->ghostX    = nullptr;
+        descr->one       = nullptr;
+        descr->prepared  = false;
+    }
+
+    static void distDestroy(hipsparseDistCsrDescr* descr)
+    {
+        distReleasePlans(descr);
+
+        if(descr->localMat != nullptr)
+        {
+            hipsparseDestroySpMat(descr->localMat);
+        }
+        if(descr->ghostMat != nullptr)
+        {
+            hipsparseDestroySpMat(descr->ghostMat);
+        }
+        internalFree(descr->localRowPtr);
+        internalFree(descr->localColInd);
+        internalFree(descr->localVal);
+        internalFree(descr->ghostRowPtr);
+        internalFree(descr->ghostColInd);
+        internalFree(descr->ghostVal);
+        internalFree(descr->sendInd);
+
+        delete descr;
+    }
+
+    static hipsparseStatus_t distCheckCsr(hipsparseDistCsrDescr_t*    matA,
+                                          hipsparseHandle_t           handle,
+                                          const hipsparseTransport_t& transport,
+                                          const int64_t*              partition,
+                                          int64_t                     nnz,
+                                          const void*                 csrRowOffsets,
+                                          const void*                 csrColInd,
+                                          const void*                 csrValues,
+                                          hipsparseIndexType_t        csrRowOffsetsType,
+                                          hipsparseIndexType_t        csrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+    {
+        if(matA == nullptr || handle == nullptr || partition == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(partition[0] != 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+        for(int q = 0; q < transport.size; ++q)
+        {
+            if(partition[q + 1] < partition[q])
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+        }
+
+        const int64_t rows = partition[transport.rank + 1] - partition[transport.rank];
+        if(nnz < 0 || (rows > 0 && csrRowOffsets == nullptr)
+           || (nnz > 0 && (csrColInd == nullptr || csrValues == nullptr))
+           || (rows == 0 && nnz != 0))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(idxBase != HIPSPARSE_INDEX_BASE_ZERO && idxBase != HIPSPARSE_INDEX_BASE_ONE)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if((csrRowOffsetsType != HIPSPARSE_INDEX_32I && csrRowOffsetsType != HIPSPARSE_INDEX_64I)
+           || (csrColIndType != HIPSPARSE_INDEX_32I && csrColIndType != HIPSPARSE_INDEX_64I)
+           || distDataTypeSize(valueType) == 0)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // The blocks use 32 bit indices
+        if(rows > std::numeric_limits<int32_t>::max() || nnz > std::numeric_limits<int32_t>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Split the rows of the rank into the local and the ghost blocks, on the device, and list
+    // the ghost columns grouped by owner.
+    //
+    static hipsparseStatus_t distSplit(hipsparseDistCsrDescr* descr,
+                                       hipStream_t            stream,
+                                       const int64_t*         partition,
+                                       int64_t                nnz,
+                                       const void*            csrRowOffsets,
+                                       const void*            csrColInd,
+                                       const void*            csrValues,
+                                       hipsparseIndexType_t   csrRowOffsetsType,
+                                       hipsparseIndexType_t   csrColIndType,
+                                       hipsparseIndexBase_t   idxBase,
+                                       std::vector<int64_t>&  ghostCols)
+    {
+        const int     rank  = descr->transport.rank;
+        const int     size  = descr->transport.size;
+        const int64_t first = partition[rank];
+        const int64_t rows  = partition[rank + 1] - first;
+        const int64_t n     = partition[size];
+        const int64_t base  = (idxBase == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+        const size_t ptrSize = (csrRowOffsetsType == HIPSPARSE_INDEX_32I) ? 4 : 8;
+        const size_t colSize = (csrColIndType == HIPSPARSE_INDEX_32I) ? 4 : 8;
+        const size_t valSize = distDataTypeSize(descr->valueType);
+
+        // Rows of the rank on the host
+        std::vector<char> hptr(ptrSize * (rows + 1));
+        std::vector<char> hcol(colSize * nnz);
+        std::vector<char> hval(valSize * nnz);
+
+        if(rows > 0)
+        {
+            RETURN_IF_HIP_ERROR(
+                internalMemcpyAsync(hptr.data(), csrRowOffsets, hptr.size(), stream));
+        }
+        if(nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(internalMemcpyAsync(hcol.data(), csrColInd, hcol.size(), stream));
+            RETURN_IF_HIP_ERROR(internalMemcpyAsync(hval.data(), csrValues, hval.size(), stream));
+        }
+        RETURN_IF_HIP_ERROR(internalStreamSynchronize(stream));
+
+        const int64_t start = (rows > 0) ? distIndex(hptr, csrRowOffsetsType, 0) : base;
+        if(rows > 0 && distIndex(hptr, csrRowOffsetsType, rows) - start != nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Compressed ghost columns, in increasing global order
+        for(int64_t k = 0; k < nnz; ++k)
+        {
+            const int64_t col = distIndex(hcol, csrColIndType, k) - base;
+            if(col < 0 || col >= n)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+            if(col < first || col >= first + rows)
+            {
+                ghostCols.push_back(col);
+            }
+        }
+        std::sort(ghostCols.begin(), ghostCols.end());
+        ghostCols.erase(std::unique(ghostCols.begin(), ghostCols.end()), ghostCols.end());
+
+        if(ghostCols.size() > size_t(std::numeric_limits<int32_t>::max()))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // Local and ghost blocks
+        std::vector<int32_t> localPtr(rows + 1, 0);
+        std::vector<int32_t> ghostPtr(rows + 1, 0);
+        std::vector<int32_t> localCol;
+        std::vector<int32_t> ghostCol;
+        std::vector<char>    localVal;
+        std::vector<char>    ghostVal;
+
+        for(int64_t i = 0; i < rows; ++i)
+        {
+            const int64_t begin = distIndex(hptr, csrRowOffsetsType, i) - start;
+            const int64_t end   = distIndex(hptr, csrRowOffsetsType, i + 1) - start;
+            if(begin < 0 || end < begin || end > nnz)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            for(int64_t k = begin; k < end; ++k)
+            {
+                const int64_t col = distIndex(hcol, csrColIndType, k) - base;
+                const char*   val = hval.data() + valSize * k;
+                if(col >= first && col < first + rows)
+                {
+                    localCol.push_back(int32_t(col - first));
+                    localVal.insert(localVal.end(), val, val + valSize);
+                }
+                else
+                {
+                    const auto it = std::lower_bound(ghostCols.begin(), ghostCols.end(), col);
+                    ghostCol.push_back(int32_t(it - ghostCols.begin()));
+                    ghostVal.insert(ghostVal.end(), val, val + valSize);
+                }
+            }
+
+            localPtr[i + 1] = int32_t(localCol.size());
+            ghostPtr[i + 1] = int32_t(ghostCol.size());
+        }
+
+        descr->rows     = rows;
+        descr->ghosts   = int64_t(ghostCols.size());
+        descr->localNnz = int64_t(localCol.size());
+        descr->ghostNnz = int64_t(ghostCol.size());
+
+        // Owner of each ghost column, the ghost columns are grouped by owner
+        std::vector<int64_t> recvCount(size, 0);
+        for(int64_t col : ghostCols)
+        {
+            const int64_t* owner = std::upper_bound(partition, partition + size + 1, col) - 1;
+            ++recvCount[owner - partition];
+        }
+
+        descr->recvOffsets.push_back(0);
+        for(int q = 0; q < size; ++q)
+        {
+            if(recvCount[q] > 0)
+            {
+                descr->recvRanks.push_back(q);
+                descr->recvOffsets.push_back(descr->recvOffsets.back() + recvCount[q]);
+            }
+        }
+
+        if(rows == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_HIP_ERROR(distUpload(
+            &descr->localRowPtr, localPtr.data(), sizeof(int32_t) * localPtr.size(), stream));
+        RETURN_IF_HIP_ERROR(distUpload(
+            &descr->localColInd, localCol.data(), sizeof(int32_t) * localCol.size(), stream));
+        RETURN_IF_HIP_ERROR(distUpload(&descr->localVal, localVal.data(), localVal.size(), stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&descr->localMat,
+                                                     rows,
+                                                     rows,
+                                                     descr->localNnz,
+                                                     descr->localRowPtr,
+                                                     descr->localColInd,
+                                                     descr->localVal,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     descr->valueType));
+
+        if(descr->ghosts == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_HIP_ERROR(distUpload(
+            &descr->ghostRowPtr, ghostPtr.data(), sizeof(int32_t) * ghostPtr.size(), stream));
+        RETURN_IF_HIP_ERROR(distUpload(
+            &descr->ghostColInd, ghostCol.data(), sizeof(int32_t) * ghostCol.size(), stream));
+        RETURN_IF_HIP_ERROR(distUpload(&descr->ghostVal, ghostVal.data(), ghostVal.size(), stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&descr->ghostMat,
+                                                     rows,
+                                                     descr->ghosts,
+                                                     descr->ghostNnz,
+                                                     descr->ghostRowPtr,
+                                                     descr->ghostColInd,
+                                                     descr->ghostVal,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     descr->valueType));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Entries of x to send to the neighbours, from the global indices they requested.
+    //
+    static hipsparseStatus_t distSendList(hipsparseDistCsrDescr*      descr,
+                                          hipStream_t                 stream,
+                                          const int64_t*              partition,
+                                          const std::vector<int>&     sendRanks,
+                                          const std::vector<int64_t>& sendOffsets,
+                                          const std::vector<int64_t>& sendCols)
+    {
+        const int64_t first = partition[descr->transport.rank];
+
+        // An entry of x may be requested by several ranks, it is gathered once
+        std::vector<int32_t> sendInd(sendCols.size());
+        for(size_t k = 0; k < sendCols.size(); ++k)
+        {
+            if(sendCols[k] < first || sendCols[k] >= first + descr->rows)
+            {
+                return HIPSPARSE_STATUS_INTERNAL_ERROR;
+            }
+            sendInd[k] = int32_t(sendCols[k] - first);
+        }
+
+        std::vector<int32_t> gatherInd(sendInd);
+        std::sort(gatherInd.begin(), gatherInd.end());
+        gatherInd.erase(std::unique(gatherInd.begin(), gatherInd.end()), gatherInd.end());
+
+        descr->sendMap.resize(sendInd.size());
+        for(size_t k = 0; k < sendInd.size(); ++k)
+        {
+            const auto it     = std::lower_bound(gatherInd.begin(), gatherInd.end(), sendInd[k]);
+            descr->sendMap[k] = int32_t(it - gatherInd.begin());
+        }
+        descr->gathered    = int64_t(gatherInd.size());
+        descr->sendRanks   = sendRanks;
+        descr->sendOffsets = sendOffsets;
+
+        RETURN_IF_HIP_ERROR(distUpload(
+            &descr->sendInd, gatherInd.data(), sizeof(int32_t) * gatherInd.size(), stream));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Build the rows of the rank and exchange the ghost columns with the neighbours. status is
+    // the outcome of the checks of the arguments, descr is only used if it is a success.
+    //
+    // A rank that fails still takes part in every exchange: it requests no entry of x, receives
+    // the requests of the others, and the status of every rank is exchanged last, so that the
+    // creation fails on all the ranks and none of them waits for a message that is never sent.
+    //
+    static hipsparseStatus_t distBuild(hipsparseDistCsrDescr*      descr,
+                                       const hipsparseTransport_t& transport,
+                                       hipsparseStatus_t           status,
+                                       hipStream_t                 stream,
+                                       const int64_t*              partition,
+                                       int64_t                     nnz,
+                                       const void*                 csrRowOffsets,
+                                       const void*                 csrColInd,
+                                       const void*                 csrValues,
+                                       hipsparseIndexType_t        csrRowOffsetsType,
+                                       hipsparseIndexType_t        csrColIndType,
+                                       hipsparseIndexBase_t        idxBase)
+    {
+        const int rank = transport.rank;
+        const int size = transport.size;
+
+        distRequests messages(transport);
+        messages.update(status);
+
+        std::vector<int64_t> ghostCols;
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            try
+            {
+                messages.update(distSplit(descr,
+                                          stream,
+                                          partition,
+                                          nnz,
+                                          csrRowOffsets,
+                                          csrColInd,
+                                          csrValues,
+                                          csrRowOffsetsType,
+                                          csrColIndType,
+                                          idxBase,
+                                          ghostCols));
+            }
+            catch(const std::bad_alloc&)
+            {
+                messages.update(HIPSPARSE_STATUS_ALLOC_FAILED);
+            }
+        }
+
+        // Number of entries of x requested from each rank, none if this rank failed
+        std::vector<int64_t> recvCount(size, 0);
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            for(size_t j = 0; j < descr->recvRanks.size(); ++j)
+            {
+                recvCount[descr->recvRanks[j]] = descr->recvOffsets[j + 1] - descr->recvOffsets[j];
+            }
+        }
+
+        // Number of entries of x requested by each rank
+        std::vector<int64_t> sendCount(size, 0);
+        for(int q = 0; q < size; ++q)
+        {
+            if(q != rank)
+            {
+                messages.irecv(&sendCount[q], sizeof(int64_t), q, dist_tag_count);
+            }
+        }
+        for(int q = 0; q < size; ++q)
+        {
+            if(q != rank)
+            {
+                messages.isend(&recvCount[q], sizeof(int64_t), q, dist_tag_count);
+            }
+        }
+        messages.waitAll();
+
+        std::vector<int>     sendRanks;
+        std::vector<int64_t> sendOffsets(1, 0);
+        for(int q = 0; q < size; ++q)
+        {
+            if(sendCount[q] < 0)
+            {
+                messages.update(HIPSPARSE_STATUS_INTERNAL_ERROR);
+            }
+            else if(sendCount[q] > 0)
+            {
+                sendRanks.push_back(q);
+                sendOffsets.push_back(sendOffsets.back() + sendCount[q]);
+            }
+        }
+
+        // Global indices of the entries of x requested by each rank. Without the buffer, the
+        // requests are received empty, the transport reports the truncation
+        std::vector<int64_t> sendCols;
+        try
+        {
+            sendCols.resize(sendOffsets.back());
+        }
+        catch(const std::bad_alloc&)
+        {
+            messages.update(HIPSPARSE_STATUS_ALLOC_FAILED);
+        }
+
+        for(size_t j = 0; j < sendRanks.size(); ++j)
+        {
+            const int64_t offset = sendOffsets[j];
+            const int64_t count  = sendOffsets[j + 1] - offset;
+            if(sendCols.empty())
+            {
+                messages.irecv(nullptr, 0, sendRanks[j], dist_tag_ghosts);
+            }
+            else
+            {
+                messages.irecv(sendCols.data() + offset,
+                               sizeof(int64_t) * count,
+                               sendRanks[j],
+                               dist_tag_ghosts);
+            }
+        }
+
+        // The ghost columns are grouped by owner, a list is sent to each rank given a count
+        int64_t offset = 0;
+        for(int q = 0; q < size; ++q)
+        {
+            if(recvCount[q] > 0)
+            {
+                messages.isend(ghostCols.data() + offset,
+                               sizeof(int64_t) * recvCount[q],
+                               q,
+                               dist_tag_ghosts);
+                offset += recvCount[q];
+            }
+        }
+        messages.waitAll();
+
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            try
+            {
+                messages.update(
+                    distSendList(descr, stream, partition, sendRanks, sendOffsets, sendCols));
+            }
+            catch(const std::bad_alloc&)
+            {
+                messages.update(HIPSPARSE_STATUS_ALLOC_FAILED);
+            }
+        }
+
+        // Status of every rank
+        const int64_t        local = messages.status;
+        std::vector<int64_t> remote(size, HIPSPARSE_STATUS_SUCCESS);
+        for(int q = 0; q < size; ++q)
+        {
+            if(q != rank)
+            {
+                messages.irecv(&remote[q], sizeof(int64_t), q, dist_tag_status);
+            }
+        }
+        for(int q = 0; q < size; ++q)
+        {
+            if(q != rank)
+            {
+                messages.isend(&local, sizeof(int64_t), q, dist_tag_status);
+            }
+        }
+        messages.waitAll();
+
+        for(int q = 0; q < size; ++q)
+        {
+            if(remote[q] != HIPSPARSE_STATUS_SUCCESS)
+            {
+                messages.update(HIPSPARSE_STATUS_INTERNAL_ERROR);
+            }
+        }
+        return messages.status;
+    }
+
+    //
+    // Buffers of the halo exchange and plans of the two products, for the data type of x, the
+    // compute type and the algorithm.
+    //
+    static hipsparseStatus_t distPrepare(hipsparseHandle_t           handle,
+                                         hipsparseDistCsrDescr*      descr,
+                                         const void*                 alpha,
+                                         hipsparseConstDnVecDescr_t  vecX,
+                                         const void*                 beta,
+                                         const hipsparseDnVecDescr_t vecY,
+                                         hipDataType                 xType,
+                                         hipDataType                 computeType,
+                                         hipsparseSpMVAlg_t          alg)
+    {
+        distReleasePlans(descr);
+
+        const size_t xSize = distDataTypeSize(xType);
+        if(xSize == 0 || !distOne(computeType, descr->hostOne))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        descr->gatherHost.resize(xSize * descr->gathered);
+
+        if(descr->gathered > 0)
+        {
+            RETURN_IF_HIP_ERROR(distMalloc(&descr->sendX, xSize * descr->gathered));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpVec(&descr->sendVec,
+                                                           descr->rows,
+                                                           descr->gathered,
+                                                           descr->sendInd,
+                                                           descr->sendX,
+                                                           HIPSPARSE_INDEX_32I,
+                                                           HIPSPARSE_INDEX_BASE_ZERO,
+                                                           xType));
+        }
+
+        if(descr->rows > 0)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpMVPlan(&descr->localPlan,
+                                                              handle,
+                                                              HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                              alpha,
+                                                              descr->localMat,
+                                                              vecX,
+                                                              beta,
+                                                              vecY,
+                                                              computeType,
+                                                              alg));
+        }
+
+        if(descr->ghosts > 0)
+        {
+            hipsparsePointerMode_t mode;
+            hipStream_t            stream;
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+            RETURN_IF_HIP_ERROR(
+                distUpload(&descr->one, descr->hostOne, sizeof(descr->hostOne), stream));
+            RETURN_IF_HIP_ERROR(distMalloc(&descr->ghostX, xSize * descr->ghosts));
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseCreateDnVec(&descr->ghostVec, descr->ghosts, descr->ghostX, xType));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpMVPlan(
+                &descr->ghostPlan,
+                handle,
+                HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                alpha,
+                descr->ghostMat,
+                descr->ghostVec,
+                (mode == HIPSPARSE_POINTER_MODE_DEVICE) ? descr->one : descr->hostOne,
+                vecY,
+                computeType,
+                alg));
+        }
+
+        descr->prepared    = true;
+        descr->xType       = xType;
+        descr->computeType = computeType;
+        descr->alg         = alg;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Product of a rank, see hipsparseDistSpMV().
+    //
+    static hipsparseStatus_t distSpMV(hipsparseHandle_t           handle,
+                                      hipsparseDistCsrDescr_t     matA,
+                                      const void*                 alpha,
+                                      hipsparseConstDnVecDescr_t  vecX,
+                                      const void*                 beta,
+                                      const hipsparseDnVecDescr_t vecY,
+                                      hipDataType                 computeType,
+                                      hipsparseSpMVAlg_t          alg)
+    {
+        // Without the matrix, the rank does not know its neighbours
+        if(matA == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // A failure is recorded and the halo is still exchanged, with the status of the rank in the
+        // header of each message, so that the neighbours do not wait for this rank
+        distRequests messages(matA->transport);
+        if(handle == nullptr || alpha == nullptr || vecX == nullptr || beta == nullptr
+           || vecY == nullptr)
+        {
+            messages.update(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            messages.update(distCheckCaptureSafe(handle));
+        }
+
+        // The messages of a failed rank have the size expected for its last data type
+        hipDataType xType = matA->prepared ? matA->xType : matA->valueType;
+        hipStream_t stream;
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            int64_t     xSize, ySize;
+            const void* x;
+            void*       y;
+            hipDataType vecXType, vecYType;
+            messages.update(hipsparseConstDnVecGet(vecX, &xSize, &x, &vecXType));
+            messages.update(hipsparseDnVecGet(vecY, &ySize, &y, &vecYType));
+            messages.update(hipsparseGetStream(handle, &stream));
+            if(messages.status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                xType = vecXType;
+                if(xSize != matA->rows || ySize != matA->rows)
+                {
+                    messages.update(HIPSPARSE_STATUS_INVALID_VALUE);
+                }
+            }
+        }
+
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS
+           && (!matA->prepared || matA->xType != xType || matA->computeType != computeType
+               || matA->alg != alg))
+        {
+            try
+            {
+                messages.update(distPrepare(
+                    handle, matA, alpha, vecX, beta, vecY, xType, computeType, alg));
+            }
+            catch(const std::bad_alloc&)
+            {
+                messages.update(HIPSPARSE_STATUS_ALLOC_FAILED);
+            }
+        }
+
+        const size_t  size     = distDataTypeSize(xType);
+        const int64_t gathered = matA->gathered;
+
+        // Message j starts with the status of the sender, then its entries of x. Without the
+        // buffers, the messages are empty, the transport reports the truncation
+        const size_t header = sizeof(int64_t);
+        bool         halo   = true;
+        try
+        {
+            matA->sendHost.resize(header * matA->sendRanks.size() + size * matA->sendMap.size());
+            matA->recvHost.resize(header * matA->recvRanks.size() + size * matA->ghosts);
+        }
+        catch(const std::bad_alloc&)
+        {
+            messages.update(HIPSPARSE_STATUS_ALLOC_FAILED);
+            halo = false;
+        }
+
+        // Entries of x requested by the neighbours
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS && gathered > 0)
+        {
+            messages.update(hipsparseGather(handle, vecX, matA->sendVec));
+            messages.update(distHipErrorToStatus(internalMemcpyAsync(
+                matA->gatherHost.data(), matA->sendX, size * gathered, stream)));
+        }
+
+        for(size_t j = 0; j < matA->recvRanks.size(); ++j)
+        {
+            const int64_t offset = matA->recvOffsets[j];
+            const int64_t count  = matA->recvOffsets[j + 1] - offset;
+            messages.irecv(halo ? matA->recvHost.data() + header * j + size * offset : nullptr,
+                           halo ? header + size * count : 0,
+                           matA->recvRanks[j],
+                           dist_tag_halo);
+        }
+
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS && gathered > 0)
+        {
+            messages.update(
+                distHipErrorToStatus(internalStreamSynchronize(stream)));
+        }
+
+        // The product with the local block runs while the halo is exchanged
+        if(messages.status == HIPSPARSE_STATUS_SUCCESS && matA->rows > 0)
+        {
+            messages.update(
+                hipsparseSpMVPlanExecute(handle, matA->localPlan, alpha, vecX, beta, vecY));
+        }
+
+        const int64_t status = messages.status;
+        for(size_t j = 0; j < matA->sendRanks.size(); ++j)
+        {
+            const int64_t offset = matA->sendOffsets[j];
+            const int64_t count  = matA->sendOffsets[j + 1] - offset;
+            char*         buf
+                = halo ? matA->sendHost.data() + header * j + size * offset : nullptr;
+
+            if(halo)
+            {
+                memcpy(buf, &status, header);
+            }
+            if(halo && status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                for(int64_t k = offset; k < offset + count; ++k)
+                {
+                    memcpy(buf + header + size * (k - offset),
+                           matA->gatherHost.data() + size * matA->sendMap[k],
+                           size);
+                }
+            }
+
+            messages.isend(
+                buf, halo ? header + size * count : 0, matA->sendRanks[j], dist_tag_halo);
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(messages.waitAll());
+
+        // Status of the neighbours, then their entries of x packed in the ghost order
+        for(size_t j = 0; j < matA->recvRanks.size(); ++j)
+        {
+            const int64_t offset = matA->recvOffsets[j];
+            const int64_t count  = matA->recvOffsets[j + 1] - offset;
+            char*         buf    = matA->recvHost.data() + header * j + size * offset;
+
+            int64_t remote;
+            memcpy(&remote, buf, header);
+            if(remote != HIPSPARSE_STATUS_SUCCESS)
+            {
+                messages.update(HIPSPARSE_STATUS_INTERNAL_ERROR);
+            }
+            memmove(matA->recvHost.data() + size * offset, buf + header, size * count);
+        }
+        RETURN_IF_HIPSPARSE_ERROR(messages.status);
+
+        // Accumulate the product with the ghost block
+        if(matA->ghosts > 0)
+        {
+            hipsparsePointerMode_t mode;
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &mode));
+            RETURN_IF_HIP_ERROR(internalMemcpyAsync(
+                matA->ghostX, matA->recvHost.data(), size * matA->ghosts, stream));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVPlanExecute(
+                handle,
+                matA->ghostPlan,
+                alpha,
+                matA->ghostVec,
+                (mode == HIPSPARSE_POINTER_MODE_DEVICE) ? matA->one : matA->hostOne,
+                vecY));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseCreateLocalTransport(hipsparseLocalTransport_t* transport, int size)
+{
+    HIPSPARSE_TRACE(transport, size);
+
+    if(transport == nullptr || size <= 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    try
+    {
+        *transport = new hipsparseLocalTransport(size);
+    }
+    catch(const std::bad_alloc&)
+    {
+        return trace(HIPSPARSE_STATUS_ALLOC_FAILED);
+    }
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroyLocalTransport(hipsparseLocalTransport_t transport)
+{
+    HIPSPARSE_TRACE(transport);
+
+    delete transport;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseLocalTransportGet(hipsparseLocalTransport_t transport,
+                                             int                       rank,
+                                             hipsparseTransport_t*     rankTransport)
+{
+    HIPSPARSE_TRACE(transport, rank, rankTransport);
+
+    if(transport == nullptr || rankTransport == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const int size = int(transport->endpoints.size());
+    if(rank < 0 || rank >= size)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    rankTransport->userData = &transport->endpoints[rank];
+    rankTransport->rank     = rank;
+    rankTransport->size     = size;
+    rankTransport->isend    = hipsparse::localIsend;
+    rankTransport->irecv    = hipsparse::localIrecv;
+    rankTransport->wait     = hipsparse::localWait;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateDistCsr(hipsparseDistCsrDescr_t*    matA,
+                                         hipsparseHandle_t           handle,
+                                         const hipsparseTransport_t* transport,
+                                         const int64_t*              partition,
+                                         int64_t                     nnz,
+                                         const void*                 csrRowOffsets,
+                                         const void*                 csrColInd,
+                                         const void*                 csrValues,
+                                         hipsparseIndexType_t        csrRowOffsetsType,
+                                         hipsparseIndexType_t        csrColIndType,
+                                         hipsparseIndexBase_t        idxBase,
+                                         hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(matA,
+                    handle,
+                    transport,
+                    partition,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    // Without its transport, the rank cannot take part in the exchanges
+    if(transport == nullptr || transport->isend == nullptr || transport->irecv == nullptr
+       || transport->wait == nullptr || transport->size <= 0 || transport->rank < 0
+       || transport->rank >= transport->size)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipStream_t            stream = nullptr;
+    hipsparseDistCsrDescr* descr  = nullptr;
+
+    hipsparseStatus_t status = hipsparse::distCheckCsr(matA,
+                                                       handle,
+                                                       *transport,
+                                                       partition,
+                                                       nnz,
+                                                       csrRowOffsets,
+                                                       csrColInd,
+                                                       csrValues,
+                                                       csrRowOffsetsType,
+                                                       csrColIndType,
+                                                       idxBase,
+                                                       valueType);
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparse::distCheckCaptureSafe(handle);
+    }
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseGetStream(handle, &stream);
+    }
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        descr = new(std::nothrow) hipsparseDistCsrDescr;
+        if(descr == nullptr)
+        {
+            status = HIPSPARSE_STATUS_ALLOC_FAILED;
+        }
+        else
+        {
+            descr->transport = *transport;
+            descr->valueType = valueType;
+        }
+    }
+
+    // A failure of the checks is returned once the rank has taken part in the exchanges
+    try
+    {
+        status = hipsparse::distBuild(descr,
+                                      *transport,
+                                      status,
+                                      stream,
+                                      partition,
+                                      nnz,
+                                      csrRowOffsets,
+                                      csrColInd,
+                                      csrValues,
+                                      csrRowOffsetsType,
+                                      csrColIndType,
+                                      idxBase);
+    }
+    catch(const std::bad_alloc&)
+    {
+        status = HIPSPARSE_STATUS_ALLOC_FAILED;
+    }
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        if(descr != nullptr)
+        {
+            hipsparse::distDestroy(descr);
+        }
+        return trace(status);
+    }
+
+    *matA = descr;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroyDistCsr(hipsparseDistCsrDescr_t matA)
+{
+    HIPSPARSE_TRACE(matA);
+
+    if(matA != nullptr)
+    {
+        hipsparse::distDestroy(matA);
+    }
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDistCsrGet(hipsparseDistCsrDescr_t matA,
+                                      int64_t*                rows,
+                                      int64_t*                ghosts,
+                                      int64_t*                localNnz,
+                                      int64_t*                ghostNnz)
+{
+    HIPSPARSE_TRACE(matA, rows, ghosts, localNnz, ghostNnz);
+
+    if(matA == nullptr || rows == nullptr || ghosts == nullptr || localNnz == nullptr
+       || ghostNnz == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *rows     = matA->rows;
+    *ghosts   = matA->ghosts;
+    *localNnz = matA->localNnz;
+    *ghostNnz = matA->ghostNnz;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDistSpMV(hipsparseHandle_t           handle,
+                                    hipsparseDistCsrDescr_t     matA,
+                                    const void*                 alpha,
+                                    hipsparseConstDnVecDescr_t  vecX,
+                                    const void*                 beta,
+                                    const hipsparseDnVecDescr_t vecY,
+                                    hipDataType                 computeType,
+                                    hipsparseSpMVAlg_t          alg)
+{
+    HIPSPARSE_TRACE(handle, matA, alpha, vecX, beta, vecY, computeType, alg);
+
+    return trace(hipsparse::distSpMV(handle, matA, alpha, vecX, beta, vecY, computeType, alg));
+}
+
+#endif
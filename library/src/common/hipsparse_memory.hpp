@@ -0,0 +1,51 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include "hipsparse.h"
+
+//
+// Memory of the library, implemented by each backend for the code shared by the backends.
+//
+// The AMD and CUDA backends allocate device memory, counted by hipsparseGetProfile() and on the
+// AMD backend by hipsparseGetInternalMemoryUsage(). The host backend allocates host memory and
+// its copies are synchronous.
+//
+namespace hipsparse
+{
+    hipError_t internalMalloc(void** ptr, size_t size);
+    hipError_t internalFree(void* ptr);
+
+    //
+    // Copy between the host and the memory of the library or of the user, in stream order.
+    //
+    hipError_t internalMemcpyAsync(void* dst, const void* src, size_t size, hipStream_t stream);
+    hipError_t internalStreamSynchronize(hipStream_t stream);
+
+    //
+    // Copy to the host from host memory or from the memory of the device, whichever holds src.
+    //
+    hipError_t internalMemcpyToHost(void* dst, const void* src, size_t size);
+    hipError_t internalDeviceSynchronize();
+}
@@ -0,0 +1,371 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse_trace.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hipsparse
+{
+    static constexpr int profile_max_routines   = 1024;
+    static constexpr int profile_chunk_routines = 32;
+
+    //
+    // Counters of the routines called on a handle by one thread. The counters are allocated by
+    // chunks of routines when a routine of the chunk is first called, only by the owning thread.
+    //
+    struct profileBlock
+    {
+        static constexpr int max_chunks = profile_max_routines / profile_chunk_routines;
+
+        ~profileBlock()
+        {
+            for(int i = 0; i < max_chunks; ++i)
+            {
+                delete[] this->chunks[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        profileCounters* get(int routine)
+        {
+            std::atomic<profileCounters*>& chunk
+                = this->chunks[routine / profile_chunk_routines];
+
+            profileCounters* counters = chunk.load(std::memory_order_relaxed);
+            if(counters == nullptr)
+            {
+                counters = new(std::nothrow) profileCounters[profile_chunk_routines];
+                if(counters == nullptr)
+                {
+                    return nullptr;
+                }
+                chunk.store(counters, std::memory_order_release);
+            }
+            return &counters[routine % profile_chunk_routines];
+        }
+
+        // Set when the handle is destroyed, the owning thread then drops the block
+        std::atomic<bool>             released{false};
+        std::atomic<profileCounters*> chunks[max_chunks]{};
+    };
+
+    struct profileTotals
+    {
+        int64_t calls{};
+        int64_t time{};
+        int64_t buffer_bytes{};
+        int64_t allocations{};
+    };
+
+    class profileRegistry
+    {
+    public:
+        static profileRegistry& instance()
+        {
+            static profileRegistry registry;
+            return registry;
+        }
+
+        int add(const char* function)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if(this->m_routines.size() == profile_max_routines)
+            {
+                return -1;
+            }
+            this->m_routines.push_back(function);
+            return static_cast<int>(this->m_routines.size()) - 1;
+        }
+
+        std::shared_ptr<profileBlock> add(hipsparseHandle_t handle)
+        {
+            std::shared_ptr<profileBlock> block = std::make_shared<profileBlock>();
+
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_blocks[handle].push_back(block);
+            return block;
+        }
+
+        //
+        // Counters since the last reset, by routine.
+        //
+        std::vector<std::pair<const char*, profileTotals>> get(hipsparseHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+
+            std::vector<profileTotals> totals = this->sum(handle);
+            auto                       it     = this->m_baselines.find(handle);
+
+            std::vector<std::pair<const char*, profileTotals>> result;
+            for(size_t i = 0; i < totals.size(); ++i)
+            {
+                profileTotals t = totals[i];
+                if(it != this->m_baselines.end() && i < it->second.size())
+                {
+                    const profileTotals& b = it->second[i];
+                    t.calls -= b.calls;
+                    t.time -= b.time;
+                    t.buffer_bytes -= b.buffer_bytes;
+                    t.allocations -= b.allocations;
+                }
+
+                if(t.calls > 0)
+                {
+                    result.push_back(std::make_pair(this->m_routines[i], t));
+                }
+            }
+            return result;
+        }
+
+        //
+        // The counters are never written by another thread than their owner, a reset records
+        // the current values which are then subtracted.
+        //
+        void reset(hipsparseHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_baselines[handle] = this->sum(handle);
+        }
+
+        //
+        // Drop the counters of a destroyed handle. The blocks still cached by other threads are
+        // marked as released, so that a new handle with the same address does not get them.
+        //
+        void release(hipsparseHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+
+            auto it = this->m_blocks.find(handle);
+            if(it != this->m_blocks.end())
+            {
+                for(const std::shared_ptr<profileBlock>& block : it->second)
+                {
+                    block->released.store(true, std::memory_order_relaxed);
+                }
+                this->m_blocks.erase(it);
+            }
+            this->m_retired.erase(handle);
+            this->m_baselines.erase(handle);
+        }
+
+        //
+        // Fold the counters of a thread that exits into the totals of their handles.
+        //
+        void retire(const std::map<hipsparseHandle_t, std::shared_ptr<profileBlock>>& blocks)
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+
+            for(const auto& entry : blocks)
+            {
+                if(entry.second->released.load(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                std::vector<profileTotals>& retired = this->m_retired[entry.first];
+                retired.resize(this->m_routines.size());
+                add(retired, *entry.second);
+
+                std::vector<std::shared_ptr<profileBlock>>& owned = this->m_blocks[entry.first];
+                owned.erase(std::remove(owned.begin(), owned.end(), entry.second), owned.end());
+            }
+        }
+
+    private:
+        static void add(std::vector<profileTotals>& totals, const profileBlock& block)
+        {
+            for(size_t chunk = 0; chunk < profileBlock::max_chunks; ++chunk)
+            {
+                const profileCounters* counters
+                    = block.chunks[chunk].load(std::memory_order_acquire);
+                if(counters == nullptr)
+                {
+                    continue;
+                }
+
+                const size_t first = chunk * profile_chunk_routines;
+                for(size_t i = first; i < std::min(first + profile_chunk_routines, totals.size());
+                    ++i)
+                {
+                    const profileCounters& c = counters[i - first];
+                    totals[i].calls += c.calls.load(std::memory_order_relaxed);
+                    totals[i].time += c.time.load(std::memory_order_relaxed);
+                    totals[i].buffer_bytes += c.buffer_bytes.load(std::memory_order_relaxed);
+                    totals[i].allocations += c.allocations.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::vector<profileTotals> sum(hipsparseHandle_t handle) const
+        {
+            std::vector<profileTotals> totals(this->m_routines.size());
+
+            auto retired = this->m_retired.find(handle);
+            if(retired != this->m_retired.end())
+            {
+                std::copy(retired->second.begin(), retired->second.end(), totals.begin());
+            }
+
+            auto it = this->m_blocks.find(handle);
+            if(it != this->m_blocks.end())
+            {
+                for(const std::shared_ptr<profileBlock>& block : it->second)
+                {
+                    add(totals, *block);
+                }
+            }
+            return totals;
+        }
+
+        std::mutex                                                             m_mutex;
+        std::vector<const char*>                                               m_routines;
+        std::map<hipsparseHandle_t, std::vector<std::shared_ptr<profileBlock>>> m_blocks;
+        std::map<hipsparseHandle_t, std::vector<profileTotals>>                m_retired;
+        std::map<hipsparseHandle_t, std::vector<profileTotals>>                m_baselines;
+    };
+
+    //
+    // Blocks of the calling thread, by handle, retired when the thread exits.
+    //
+    struct profileThreadBlocks
+    {
+        ~profileThreadBlocks()
+        {
+            profileRegistry::instance().retire(this->blocks);
+        }
+
+        std::map<hipsparseHandle_t, std::shared_ptr<profileBlock>> blocks;
+    };
+
+    int profileRegister(const char* function)
+    {
+        return profileRegistry::instance().add(function);
+    }
+
+    profileCounters* profileGet(hipsparseHandle_t handle, int routine)
+    {
+        if(handle == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Most threads use a single handle, the last one is cached.
+        thread_local hipsparseHandle_t last_handle = nullptr;
+        thread_local profileBlock*     last_block  = nullptr;
+        if(handle != last_handle || last_block->released.load(std::memory_order_relaxed))
+        {
+            thread_local profileThreadBlocks owned;
+
+            std::map<hipsparseHandle_t, std::shared_ptr<profileBlock>>& blocks = owned.blocks;
+
+            // Drop the blocks of the destroyed handles
+            for(auto it = blocks.begin(); it != blocks.end();)
+            {
+                if(it->second->released.load(std::memory_order_relaxed))
+                {
+                    it = blocks.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            std::shared_ptr<profileBlock>& block = blocks[handle];
+            if(block == nullptr)
+            {
+                block = profileRegistry::instance().add(handle);
+            }
+            last_handle = handle;
+            last_block  = block.get();
+        }
+        return last_block->get(routine);
+    }
+
+    void profileRelease(hipsparseHandle_t handle)
+    {
+        profileRegistry::instance().release(handle);
+    }
+}
+
+hipsparseStatus_t
+    hipsparseGetProfile(hipsparseHandle_t handle, int* count, hipsparseProfileEntry_t* entries)
+{
+    HIPSPARSE_TRACE_UNPROFILED(handle, count, entries);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    if(count == nullptr || *count < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    std::vector<std::pair<const char*, hipsparse::profileTotals>> totals
+        = hipsparse::profileRegistry::instance().get(handle);
+
+    if(entries == nullptr)
+    {
+        *count = static_cast<int>(totals.size());
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    std::sort(totals.begin(),
+              totals.end(),
+              [](const std::pair<const char*, hipsparse::profileTotals>& a,
+                 const std::pair<const char*, hipsparse::profileTotals>& b) {
+                  return a.second.time > b.second.time;
+              });
+
+    const int n = std::min(*count, static_cast<int>(totals.size()));
+    for(int i = 0; i < n; ++i)
+    {
+        entries[i].routine     = totals[i].first;
+        entries[i].calls       = totals[i].second.calls;
+        entries[i].hostTimeNs  = totals[i].second.time;
+        entries[i].bufferBytes = totals[i].second.buffer_bytes;
+        entries[i].allocations = totals[i].second.allocations;
+    }
+    *count = n;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseResetProfile(hipsparseHandle_t handle)
+{
+    HIPSPARSE_TRACE_UNPROFILED(handle);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    hipsparse::profileRegistry::instance().reset(handle);
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
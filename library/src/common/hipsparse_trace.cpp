@@ -0,0 +1,345 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse_trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hipsparse
+{
+    static const char* traceStatusName(hipsparseStatus_t status)
+    {
+        // Names by value, HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES is not defined for every backend.
+        static const char* names[] = {"HIPSPARSE_STATUS_SUCCESS",
+                                      "HIPSPARSE_STATUS_NOT_INITIALIZED",
+                                      "HIPSPARSE_STATUS_ALLOC_FAILED",
+                                      "HIPSPARSE_STATUS_INVALID_VALUE",
+                                      "HIPSPARSE_STATUS_ARCH_MISMATCH",
+                                      "HIPSPARSE_STATUS_MAPPING_ERROR",
+                                      "HIPSPARSE_STATUS_EXECUTION_FAILED",
+                                      "HIPSPARSE_STATUS_INTERNAL_ERROR",
+                                      "HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED",
+                                      "HIPSPARSE_STATUS_ZERO_PIVOT",
+                                      "HIPSPARSE_STATUS_NOT_SUPPORTED",
+                                      "HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES"};
+        const int i = static_cast<int>(status);
+        return (i >= 0 && i < static_cast<int>(sizeof(names) / sizeof(names[0])))
+                   ? names[i]
+                   : "HIPSPARSE_STATUS_UNKNOWN";
+    }
+
+    int traceLayers()
+    {
+        static const int layers = []() {
+            const char* env = getenv("HIPSPARSE_LAYER");
+            return (env != nullptr) ? atoi(env) : 0;
+        }();
+        return layers;
+    }
+
+    //
+    // Single producer single consumer ring, the producer is the thread that owns the buffer and
+    // the consumer is the flushing thread.
+    //
+    struct traceBuffer
+    {
+        static constexpr size_t capacity = 1024;
+
+        std::vector<traceRecord> records;
+        std::atomic<size_t>      head{0}; // written by the producer
+        std::atomic<size_t>      tail{0}; // written by the consumer
+        std::atomic<uint64_t>    dropped{0};
+        std::atomic<bool>        retired{false}; // set when the producer exits
+        int                      thread{};
+
+        explicit traceBuffer(int thread_)
+            : records(capacity)
+            , thread(thread_)
+        {
+        }
+
+        bool push(const traceRecord& r)
+        {
+            const size_t h = this->head.load(std::memory_order_relaxed);
+            if(h - this->tail.load(std::memory_order_acquire) == capacity)
+            {
+                this->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            // Only the arguments in use are copied.
+            traceRecord& slot = this->records[h % capacity];
+            slot.function     = r.function;
+            slot.names        = r.names;
+            slot.status       = r.status;
+            slot.has_status   = r.has_status;
+            slot.nargs        = r.nargs;
+            slot.start        = r.start;
+            slot.duration     = r.duration;
+            std::copy(r.args, r.args + r.nargs, slot.args);
+
+            this->head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+    };
+
+    //
+    // Buffer of a thread, retired when the thread exits, the flushing thread then drains it a
+    // last time and frees it.
+    //
+    struct traceBufferOwner
+    {
+        ~traceBufferOwner()
+        {
+            if(this->buffer != nullptr)
+            {
+                this->buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+
+        std::shared_ptr<traceBuffer> buffer;
+    };
+
+    class traceLogger
+    {
+    public:
+        static traceLogger& instance()
+        {
+            static traceLogger logger;
+            return logger;
+        }
+
+        //
+        // Buffer of the calling thread, registered on first use.
+        //
+        traceBuffer* buffer()
+        {
+            thread_local traceBufferOwner owner;
+            std::shared_ptr<traceBuffer>& local = owner.buffer;
+            if(local == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                local = std::make_shared<traceBuffer>(this->m_threads++);
+                this->m_buffers.push_back(local);
+                if(false == this->m_flusher.joinable())
+                {
+                    this->m_flusher = std::thread(&traceLogger::run, this);
+                }
+            }
+            return local.get();
+        }
+
+        bool is_closed() const
+        {
+            return this->m_closed.load(std::memory_order_acquire);
+        }
+
+        ~traceLogger()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->m_mutex);
+                this->m_closed.store(true, std::memory_order_release);
+            }
+            this->m_cv.notify_one();
+            if(this->m_flusher.joinable())
+            {
+                this->m_flusher.join();
+            }
+
+            if(this->m_file != nullptr && this->m_file != stderr)
+            {
+                fclose(this->m_file);
+            }
+        }
+
+    private:
+        traceLogger()
+        {
+            const char* path = getenv("HIPSPARSE_LOG_TRACE_PATH");
+            this->m_file     = (path != nullptr) ? fopen(path, "w") : nullptr;
+            if(this->m_file == nullptr)
+            {
+                if(path != nullptr)
+                {
+                    fprintf(stderr,
+                            "hipSPARSE warning: cannot open HIPSPARSE_LOG_TRACE_PATH '%s', "
+                            "writing the trace to standard error\n",
+                            path);
+                }
+                this->m_file = stderr;
+            }
+        }
+
+        //
+        // Flushing thread, wakes up periodically and on close.
+        //
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(this->m_mutex);
+            while(true)
+            {
+                const bool closed = this->m_closed.load(std::memory_order_acquire);
+
+                // Buffers are only removed by this thread, they can be drained without the lock.
+                std::vector<std::shared_ptr<traceBuffer>> buffers(this->m_buffers);
+                lock.unlock();
+
+                // A buffer retired before it is drained gets no more records
+                std::vector<std::shared_ptr<traceBuffer>> retired;
+                for(auto& b : buffers)
+                {
+                    const bool last = b->retired.load(std::memory_order_acquire);
+                    this->drain(*b);
+                    if(last)
+                    {
+                        retired.push_back(b);
+                    }
+                }
+                fflush(this->m_file);
+                lock.lock();
+
+                for(auto& b : retired)
+                {
+                    this->m_buffers.erase(
+                        std::find(this->m_buffers.begin(), this->m_buffers.end(), b));
+                }
+
+                if(closed)
+                {
+                    break;
+                }
+                this->m_cv.wait_for(lock, std::chrono::milliseconds(50));
+            }
+        }
+
+        void drain(traceBuffer& b)
+        {
+            const size_t t = b.tail.load(std::memory_order_relaxed);
+            const size_t h = b.head.load(std::memory_order_acquire);
+            for(size_t i = t; i < h; ++i)
+            {
+                this->write(b.thread, b.records[i % traceBuffer::capacity]);
+            }
+            b.tail.store(h, std::memory_order_release);
+
+            const uint64_t dropped = b.dropped.exchange(0, std::memory_order_relaxed);
+            if(dropped > 0)
+            {
+                fprintf(this->m_file,
+                        "hipsparse trace: thread %d, %llu call(s) dropped, buffer full\n",
+                        b.thread,
+                        static_cast<unsigned long long>(dropped));
+            }
+        }
+
+        //
+        // function(name=value, ...) -> status, duration in microseconds, thread
+        //
+        void write(int thread, const traceRecord& r)
+        {
+            std::string line(r.function);
+            line += "(";
+
+            const char* names = r.names;
+            for(int i = 0; i < r.nargs; ++i)
+            {
+                while(*names == ' ' || *names == ',')
+                {
+                    ++names;
+                }
+                const char* end = names;
+                while(*end != '\0' && *end != ',')
+                {
+                    ++end;
+                }
+
+                if(i > 0)
+                {
+                    line += ", ";
+                }
+                line.append(names, end - names);
+                line += "=";
+                names = end;
+
+                char              value[64];
+                const traceValue& v = r.args[i];
+                switch(v.kind)
+                {
+                case traceValue::signed_kind:
+                    snprintf(value, sizeof(value), "%lld", static_cast<long long>(v.i));
+                    break;
+                case traceValue::unsigned_kind:
+                    snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(v.u));
+                    break;
+                case traceValue::real_kind:
+                    snprintf(value, sizeof(value), "%.17g", v.d[0]);
+                    break;
+                case traceValue::complex_kind:
+                    snprintf(value, sizeof(value), "(%.17g, %.17g)", v.d[0], v.d[1]);
+                    break;
+                case traceValue::pointer_kind:
+                    snprintf(value, sizeof(value), "%p", v.p);
+                    break;
+                default:
+                    snprintf(value, sizeof(value), "?");
+                    break;
+                }
+                line += value;
+            }
+
+            fprintf(this->m_file,
+                    "%s) -> %s, %.3f us, thread %d\n",
+                    line.c_str(),
+                    r.has_status ? traceStatusName(r.status) : "?",
+                    r.duration * 1.0e-3,
+                    thread);
+        }
+
+        std::mutex                                m_mutex;
+        std::condition_variable                   m_cv;
+        std::vector<std::shared_ptr<traceBuffer>> m_buffers;
+        int                                       m_threads{};
+        std::thread                               m_flusher;
+        std::atomic<bool>                         m_closed{false};
+        FILE*                                     m_file{};
+    };
+
+    void tracePush(const traceRecord& record)
+    {
+        traceLogger& logger = traceLogger::instance();
+        if(logger.is_closed())
+        {
+            return;
+        }
+        logger.buffer()->push(record);
+    }
+}
@@ -0,0 +1,511 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include "hipsparse.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <type_traits>
+
+//
+// API tracing layer.
+//
+// Layers are enabled with the environment variable HIPSPARSE_LAYER, a bit mask:
+//
+//   1  trace, every hipsparse* call with its arguments, returned status and host side duration.
+//   2  bench, every supported call as an equivalent hipsparse-bench command line.
+//
+// The trace is written to the file HIPSPARSE_LOG_TRACE_PATH, standard error if not set.
+//
+// Bench command lines are written to the file HIPSPARSE_LOG_BENCH_PATH, standard error if not set.
+// If the directory HIPSPARSE_LOG_BENCH_MATRIX_PATH is set, the CSR operand of each command is
+// copied to the host and written to that directory in the hipsparse-bench binary format, and the
+// command line reads it with --file.
+//
+// Calls are recorded as raw values into a buffer owned by the calling thread, a background thread
+// formats and writes them. Recording a call takes no lock and does no formatting, a call made
+// while the buffer is full is dropped and counted.
+//
+// Independently of the layers, the calls made on a handle are always profiled, see
+// hipsparseGetProfile(), which like hipsparseResetProfile() is traced but not profiled itself.
+// Each thread updates its own counters, which are only summed up when they
+// are queried.
+//
+// The API functions the library calls itself are part of the call of the user, they are neither
+// traced nor profiled.
+//
+namespace hipsparse
+{
+    typedef enum traceLayer_
+    {
+        TRACE_LAYER_NONE  = 0,
+        TRACE_LAYER_TRACE = 1,
+        TRACE_LAYER_BENCH = 2
+    } traceLayer;
+
+    //
+    // Layers enabled, HIPSPARSE_LAYER is read once.
+    //
+    int traceLayers();
+
+    struct traceValue
+    {
+        typedef enum kind_
+        {
+            none_kind,
+            signed_kind,
+            unsigned_kind,
+            real_kind,
+            complex_kind,
+            pointer_kind
+        } kind_t;
+
+        kind_t kind;
+        union
+        {
+            int64_t     i;
+            uint64_t    u;
+            double      d[2];
+            const void* p;
+        };
+    };
+
+    struct traceRecord
+    {
+        static constexpr int max_args = 32;
+
+        const char*       function;
+        const char*       names; // the argument list as written, e.g. "handle, m, n"
+        hipsparseStatus_t status;
+        bool              has_status;
+        int               nargs;
+        int64_t           start; // nanoseconds, steady clock
+        int64_t           duration; // nanoseconds
+        traceValue        args[max_args];
+    };
+
+    //
+    // Append a record to the buffer of the calling thread.
+    //
+    void tracePush(const traceRecord& record);
+
+    //
+    // Write the hipsparse-bench command line of a call, before the call is executed.
+    //
+    void traceBench(const traceRecord& record);
+
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                                   traceValue>::type
+        traceEncode(const T& x)
+    {
+        traceValue v;
+        v.kind = traceValue::signed_kind;
+        v.i    = x;
+        return v;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value,
+                                   traceValue>::type
+        traceEncode(const T& x)
+    {
+        traceValue v;
+        v.kind = traceValue::unsigned_kind;
+        v.u    = x;
+        return v;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_enum<T>::value, traceValue>::type
+        traceEncode(const T& x)
+    {
+        traceValue v;
+        v.kind = traceValue::signed_kind;
+        v.i    = static_cast<int64_t>(x);
+        return v;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_floating_point<T>::value, traceValue>::type
+        traceEncode(const T& x)
+    {
+        traceValue v;
+        v.kind = traceValue::real_kind;
+        v.d[0] = x;
+        return v;
+    }
+
+    template <typename T>
+    inline traceValue traceEncode(T* const& x)
+    {
+        traceValue v;
+        v.kind = traceValue::pointer_kind;
+        v.p    = x;
+        return v;
+    }
+
+    inline traceValue traceEncode(const hipComplex& x)
+    {
+        traceValue v;
+        v.kind = traceValue::complex_kind;
+        v.d[0] = x.x;
+        v.d[1] = x.y;
+        return v;
+    }
+
+    inline traceValue traceEncode(const hipDoubleComplex& x)
+    {
+        traceValue v;
+        v.kind = traceValue::complex_kind;
+        v.d[0] = x.x;
+        v.d[1] = x.y;
+        return v;
+    }
+
+    //
+    // Profiling counters of a routine on a handle, written by a single thread and read by
+    // hipsparseGetProfile().
+    //
+    struct profileCounters
+    {
+        std::atomic<int64_t> calls{0};
+        std::atomic<int64_t> time{0}; // nanoseconds
+        std::atomic<int64_t> buffer_bytes{0};
+        std::atomic<int64_t> allocations{0};
+    };
+
+    //
+    // Identifier of a routine for profiling, -1 if there are too many routines.
+    //
+    int profileRegister(const char* function);
+
+    //
+    // Counters of the calling thread for a routine on a handle, nullptr if handle is nullptr.
+    //
+    profileCounters* profileGet(hipsparseHandle_t handle, int routine);
+
+    //
+    // Free the counters of a destroyed handle, a new handle with the same address starts from zero.
+    //
+    void profileRelease(hipsparseHandle_t handle);
+
+    //
+    // Counters of the API call in progress on the calling thread, nullptr if none.
+    //
+    inline profileCounters*& profileCurrent()
+    {
+        static thread_local profileCounters* current = nullptr;
+        return current;
+    }
+
+    //
+    // Number of API calls in progress on the calling thread. The library calls some API functions
+    // itself, only the outermost call, the one made by the user, is traced and profiled.
+    //
+    inline int& traceDepth()
+    {
+        static thread_local int depth = 0;
+        return depth;
+    }
+
+    //
+    // Only the owning thread writes the counters, no read-modify-write is needed.
+    //
+    inline void profileAdd(std::atomic<int64_t>& counter, int64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    //
+    // Count an allocation made by the library in the API call in progress.
+    //
+    inline void profileAllocation()
+    {
+        profileCounters* current = profileCurrent();
+        if(current != nullptr)
+        {
+            profileAdd(current->allocations, 1);
+        }
+    }
+
+    //
+    // Position of the parameter name in a comma separated list of names, -1 if not found.
+    //
+    constexpr int traceArgIndex(const char* names, const char* name)
+    {
+        int index = 0;
+        while(*names != '\0')
+        {
+            while(*names == ' ')
+            {
+                ++names;
+            }
+
+            int i = 0;
+            while(name[i] != '\0' && names[i] == name[i])
+            {
+                ++i;
+            }
+            if(name[i] == '\0' && (names[i] == ',' || names[i] == ' ' || names[i] == '\0'))
+            {
+                return index;
+            }
+
+            while(*names != '\0' && *names != ',')
+            {
+                ++names;
+            }
+            if(*names == ',')
+            {
+                ++names;
+                ++index;
+            }
+        }
+        return -1;
+    }
+
+    //
+    // Static description of a traced API function, see HIPSPARSE_TRACE.
+    //
+    struct traceSite
+    {
+        const char* function;
+        const char* names;
+        int         routine;     // profiling identifier, -1 if not profiled
+        int         handle;      // position of the handle parameter, -1 if none
+        int         buffer_size; // position of the pBufferSizeInBytes parameter, -1 if none
+    };
+
+    //
+    // Argument at a position, the position is a constant of the call site.
+    //
+    struct traceArgRef
+    {
+        const void* p;
+        size_t      size; // size of the pointed type, 0 if not a pointer
+    };
+
+    inline hipsparseHandle_t traceHandleOf(const hipsparseHandle_t& handle)
+    {
+        return handle;
+    }
+
+    template <typename T>
+    inline hipsparseHandle_t traceHandleOf(const T&)
+    {
+        return nullptr;
+    }
+
+    // Size of a pointed type, 0 for void and opaque types such as ihipStream_t
+    template <typename T, typename = void>
+    struct traceSizeOf : std::integral_constant<size_t, 0>
+    {
+    };
+
+    template <typename T>
+    struct traceSizeOf<T, decltype(void(sizeof(T)))> : std::integral_constant<size_t, sizeof(T)>
+    {
+    };
+
+    template <typename T>
+    inline traceArgRef traceArgRefOf(T* const& x)
+    {
+        return {x, traceSizeOf<T>::value};
+    }
+
+    template <typename T>
+    inline traceArgRef traceArgRefOf(const T&)
+    {
+        return {nullptr, 0};
+    }
+
+    inline hipsparseHandle_t traceHandleAt(int)
+    {
+        return nullptr;
+    }
+
+    template <typename T, typename... Ts>
+    inline hipsparseHandle_t traceHandleAt(int i, const T& arg, const Ts&... args)
+    {
+        return (i == 0) ? traceHandleOf(arg) : traceHandleAt(i - 1, args...);
+    }
+
+    inline traceArgRef traceArgAt(int)
+    {
+        return {nullptr, 0};
+    }
+
+    template <typename T, typename... Ts>
+    inline traceArgRef traceArgAt(int i, const T& arg, const Ts&... args)
+    {
+        return (i == 0) ? traceArgRefOf(arg) : traceArgAt(i - 1, args...);
+    }
+
+    //
+    // Trace of an API call, see HIPSPARSE_TRACE. The returned status goes through operator().
+    //
+    class traceCall
+    {
+    public:
+        template <typename... Ts>
+        traceCall(const traceSite& site, const Ts&... args)
+        {
+            this->m_enabled           = false;
+            this->m_record.has_status = false;
+            this->m_profile           = nullptr;
+
+            if(traceDepth()++ > 0)
+            {
+                return;
+            }
+
+            const int layers = traceLayers();
+            this->m_enabled  = (layers & TRACE_LAYER_TRACE) != 0;
+
+            if(site.routine >= 0 && site.handle >= 0)
+            {
+                this->m_profile = profileGet(traceHandleAt(site.handle, args...), site.routine);
+            }
+
+            if(this->m_profile != nullptr)
+            {
+                this->m_buffer_size = traceArgAt(site.buffer_size, args...);
+                this->m_previous    = profileCurrent();
+                profileCurrent()    = this->m_profile;
+            }
+
+            if(layers != TRACE_LAYER_NONE)
+            {
+                this->m_record.function = site.function;
+                this->m_record.names    = site.names;
+                this->m_record.nargs    = 0;
+                this->encode(args...);
+                if(layers & TRACE_LAYER_BENCH)
+                {
+                    traceBench(this->m_record);
+                }
+            }
+
+            if(this->m_enabled || this->m_profile != nullptr)
+            {
+                this->m_record.start = now();
+            }
+        }
+
+        ~traceCall()
+        {
+            --traceDepth();
+
+            if(this->m_enabled || this->m_profile != nullptr)
+            {
+                this->m_record.duration = now() - this->m_record.start;
+            }
+
+            if(this->m_profile != nullptr)
+            {
+                profileAdd(this->m_profile->calls, 1);
+                profileAdd(this->m_profile->time, this->m_record.duration);
+                if(this->m_buffer_size.p != nullptr && this->m_record.has_status
+                   && this->m_record.status == HIPSPARSE_STATUS_SUCCESS)
+                {
+                    profileAdd(this->m_profile->buffer_bytes, this->bufferSize());
+                }
+                profileCurrent() = this->m_previous;
+            }
+
+            if(this->m_enabled)
+            {
+                tracePush(this->m_record);
+            }
+        }
+
+        traceCall(const traceCall&) = delete;
+        traceCall& operator=(const traceCall&) = delete;
+
+        hipsparseStatus_t operator()(hipsparseStatus_t status)
+        {
+            this->m_record.status     = status;
+            this->m_record.has_status = true;
+            return status;
+        }
+
+    private:
+        static int64_t now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        // pBufferSizeInBytes is an int or a size_t
+        int64_t bufferSize() const
+        {
+            return (this->m_buffer_size.size == sizeof(int))
+                       ? *static_cast<const int*>(this->m_buffer_size.p)
+                       : static_cast<int64_t>(*static_cast<const size_t*>(this->m_buffer_size.p));
+        }
+
+        void encode() {}
+
+        template <typename T, typename... Ts>
+        void encode(const T& arg, const Ts&... args)
+        {
+            if(this->m_record.nargs < traceRecord::max_args)
+            {
+                this->m_record.args[this->m_record.nargs++] = traceEncode(arg);
+            }
+            this->encode(args...);
+        }
+
+        bool             m_enabled;
+        profileCounters* m_profile;
+        profileCounters* m_previous;
+        traceArgRef      m_buffer_size;
+        traceRecord      m_record;
+    };
+}
+
+//
+// Trace and profile the enclosing API function, the arguments are the parameters of the function.
+// Every return statement of the function returns through trace(status).
+//
+#define HIPSPARSE_TRACE(...)                                              \
+    static const hipsparse::traceSite trace_site                          \
+        = {__func__,                                                      \
+           #__VA_ARGS__,                                                  \
+           hipsparse::profileRegister(__func__),                          \
+           hipsparse::traceArgIndex(#__VA_ARGS__, "handle"),              \
+           hipsparse::traceArgIndex(#__VA_ARGS__, "pBufferSizeInBytes")}; \
+    hipsparse::traceCall trace(trace_site, __VA_ARGS__)
+
+//
+// Trace the enclosing API function without profiling it, for the functions that read or reset the
+// profile.
+//
+#define HIPSPARSE_TRACE_UNPROFILED(...)                                                   \
+    static const hipsparse::traceSite trace_site = {__func__, #__VA_ARGS__, -1, -1, -1}; \
+    hipsparse::traceCall              trace(trace_site, __VA_ARGS__)
@@ -0,0 +1,484 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse_memory.hpp"
+#include "hipsparse_trace.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace hipsparse
+{
+    typedef enum benchArg_
+    {
+        bench_int,       // integer or enumeration, printed as is
+        bench_operation, // hipsparseOperation_t, N, T or C
+        bench_policy,    // hipsparseSolvePolicy_t, N or L
+        bench_action,    // hipsparseAction_t, hipsparse-bench uses 0 for numeric
+        bench_scalar,    // pointer to a host or device scalar of the routine precision
+        bench_base,      // index base of a matrix descriptor
+        bench_diag,      // diagonal type of a matrix descriptor, N or U
+        bench_uplo       // fill mode of a matrix descriptor, L or U
+    } benchArg;
+
+    struct benchOption
+    {
+        const char* option;
+        benchArg    kind;
+        int         arg;
+    };
+
+    //
+    // Positions of the CSR operand in the argument list, -1 if not available.
+    //
+    struct benchMatrix
+    {
+        int  m;
+        int  n;
+        int  nnz; // -1 to read it from the row pointer array
+        int  base;
+        bool base_is_descr;
+        int  val;
+        int  ptr;
+        int  ind;
+    };
+
+    struct benchRoutine
+    {
+        const char* suffix;  // function name without hipsparse and the precision letter
+        const char* routine; // hipsparse-bench routine
+        benchMatrix matrix;
+        benchOption options[10];
+    };
+
+    // clang-format off
+    static const benchRoutine s_bench_routines[] = {
+        {"csrmv", "csrmv", {2, 3, 4, 6, true, 7, 8, 9},
+         {{"--transposeA", bench_operation, 1}, {"-m", bench_int, 2}, {"-n", bench_int, 3},
+          {"--alpha", bench_scalar, 5}, {"--beta", bench_scalar, 11},
+          {"--indexbaseA", bench_base, 6}}},
+        {"csrmm", "csrmm", {2, 4, 5, 7, true, 8, 9, 10},
+         {{"--transposeA", bench_operation, 1}, {"-m", bench_int, 2}, {"-n", bench_int, 3},
+          {"-k", bench_int, 4}, {"--alpha", bench_scalar, 6}, {"--beta", bench_scalar, 13},
+          {"--indexbaseA", bench_base, 7}}},
+        {"csrmm2", "csrmm", {3, 5, 6, 8, true, 9, 10, 11},
+         {{"--transposeA", bench_operation, 1}, {"--transposeB", bench_operation, 2},
+          {"-m", bench_int, 3}, {"-n", bench_int, 4}, {"-k", bench_int, 5},
+          {"--alpha", bench_scalar, 7}, {"--beta", bench_scalar, 14},
+          {"--indexbaseA", bench_base, 8}}},
+        {"csrsv2_solve", "csrsv", {2, 2, 3, 5, true, 6, 7, 8},
+         {{"--transposeA", bench_operation, 1}, {"-m", bench_int, 2}, {"--alpha", bench_scalar, 4},
+          {"--indexbaseA", bench_base, 5}, {"--diag", bench_diag, 5}, {"--uplo", bench_uplo, 5},
+          {"--solve_policy", bench_policy, 12}}},
+        {"csrsm2_solve", "csrsm", {4, 4, 6, 8, true, 9, 10, 11},
+         {{"--transposeA", bench_operation, 2}, {"--transposeB", bench_operation, 3},
+          {"-m", bench_int, 4}, {"-n", bench_int, 5}, {"--alpha", bench_scalar, 7},
+          {"--indexbaseA", bench_base, 8}, {"--diag", bench_diag, 8}, {"--uplo", bench_uplo, 8},
+          {"--solve_policy", bench_policy, 15}}},
+        {"csrgemm", "csrgemm", {3, 5, 7, 6, true, 8, 9, 10},
+         {{"--transposeA", bench_operation, 1}, {"--transposeB", bench_operation, 2},
+          {"-m", bench_int, 3}, {"-n", bench_int, 4}, {"-k", bench_int, 5},
+          {"--indexbaseA", bench_base, 6}, {"--indexbaseB", bench_base, 11},
+          {"--indexbaseC", bench_base, 16}}},
+        {"csrgeam", "csrgeam", {1, 2, 5, 4, true, 6, 7, 8},
+         {{"-m", bench_int, 1}, {"-n", bench_int, 2}, {"--alpha", bench_scalar, 3},
+          {"--beta", bench_scalar, 9}, {"--indexbaseA", bench_base, 4},
+          {"--indexbaseB", bench_base, 10}, {"--indexbaseC", bench_base, 15}}},
+        {"csrgeam2", "csrgeam", {1, 2, 5, 4, true, 6, 7, 8},
+         {{"-m", bench_int, 1}, {"-n", bench_int, 2}, {"--alpha", bench_scalar, 3},
+          {"--beta", bench_scalar, 9}, {"--indexbaseA", bench_base, 4},
+          {"--indexbaseB", bench_base, 10}, {"--indexbaseC", bench_base, 15}}},
+        {"csrilu02", "csrilu02", {1, 1, 2, 3, true, 4, 5, 6},
+         {{"-m", bench_int, 1}, {"--indexbaseA", bench_base, 3},
+          {"--solve_policy", bench_policy, 8}}},
+        {"csric02", "csric02", {1, 1, 2, 3, true, 4, 5, 6},
+         {{"-m", bench_int, 1}, {"--indexbaseA", bench_base, 3},
+          {"--solve_policy", bench_policy, 8}}},
+        {"csr2csc", "csr2csc", {1, 2, 3, 11, false, 4, 5, 6},
+         {{"-m", bench_int, 1}, {"-n", bench_int, 2}, {"--action", bench_action, 10},
+          {"--indexbaseA", bench_int, 11}}},
+        {"csr2dense", "csr2dense", {1, 2, -1, 3, true, 4, 5, 6},
+         {{"-m", bench_int, 1}, {"-n", bench_int, 2}, {"--indexbaseA", bench_base, 3}}},
+        {"csr2hyb", "csr2hyb", {1, 2, -1, 3, true, 4, 5, 6},
+         {{"-m", bench_int, 1}, {"-n", bench_int, 2}, {"--indexbaseA", bench_base, 3},
+          {"--ell_width", bench_int, 8}, {"--hybpart", bench_int, 9}}},
+        {"csr2bsr", "csr2bsr", {2, 3, -1, 4, true, 5, 6, 7},
+         {{"--dirA", bench_int, 1}, {"-m", bench_int, 2}, {"-n", bench_int, 3},
+          {"--blockdim", bench_int, 8}, {"--indexbaseA", bench_base, 4},
+          {"--indexbaseB", bench_base, 9}}}};
+    // clang-format on
+
+    static const benchRoutine* findBenchRoutine(const char* function, char& precision)
+    {
+        static const size_t prefix = strlen("hipsparse");
+        if(strncmp(function, "hipsparse", prefix) != 0)
+        {
+            return nullptr;
+        }
+
+        switch(function[prefix])
+        {
+        case 'S':
+            precision = 's';
+            break;
+        case 'D':
+            precision = 'd';
+            break;
+        case 'C':
+            precision = 'c';
+            break;
+        case 'Z':
+            precision = 'z';
+            break;
+        default:
+            return nullptr;
+        }
+
+        for(const benchRoutine& r : s_bench_routines)
+        {
+            if(strcmp(function + prefix + 1, r.suffix) == 0)
+            {
+                return &r;
+            }
+        }
+        return nullptr;
+    }
+
+    //
+    // Copy size bytes from a host or device pointer.
+    //
+    static bool benchRead(void* dst, const void* src, size_t size)
+    {
+        if(src == nullptr)
+        {
+            return false;
+        }
+
+        return internalMemcpyToHost(dst, src, size) == hipSuccess;
+    }
+
+    //
+    // FNV-1a hash of size bytes, continued from hash.
+    //
+    static uint64_t benchHash(const void* data, size_t size, uint64_t hash)
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for(size_t i = 0; i < size; ++i)
+        {
+            hash = (hash ^ p[i]) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    //
+    // Real part of a scalar, hipsparse-bench has no option for the imaginary part.
+    //
+    static bool benchScalar(const void* p, char precision, double& value)
+    {
+        if(precision == 's' || precision == 'c')
+        {
+            float v;
+            if(!benchRead(&v, p, sizeof(float)))
+            {
+                return false;
+            }
+            value = v;
+            return true;
+        }
+        return benchRead(&value, p, sizeof(double));
+    }
+
+    class benchLogger
+    {
+    public:
+        static benchLogger& instance()
+        {
+            static benchLogger logger;
+            return logger;
+        }
+
+        void log(const traceRecord& r)
+        {
+            char                precision;
+            const benchRoutine* routine = findBenchRoutine(r.function, precision);
+            if(routine == nullptr)
+            {
+                return;
+            }
+
+            std::string line = std::string("hipsparse-bench -f ") + routine->routine + " -r ";
+            line += precision;
+
+            for(const benchOption& o : routine->options)
+            {
+                if(o.option == nullptr)
+                {
+                    break;
+                }
+
+                std::string value;
+                if(!this->value(r, o, precision, value))
+                {
+                    return;
+                }
+                line += std::string(" ") + o.option + " " + value;
+            }
+
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+
+            if(this->m_matrix_path != nullptr)
+            {
+                std::string filename;
+                if(this->dump(r, routine->matrix, precision, filename))
+                {
+                    line += " --file " + filename;
+                }
+            }
+
+            fprintf(this->m_file, "%s\n", line.c_str());
+            fflush(this->m_file);
+        }
+
+        ~benchLogger()
+        {
+            if(this->m_file != nullptr && this->m_file != stderr)
+            {
+                fclose(this->m_file);
+            }
+        }
+
+    private:
+        benchLogger()
+        {
+            const char* path    = getenv("HIPSPARSE_LOG_BENCH_PATH");
+            this->m_matrix_path = getenv("HIPSPARSE_LOG_BENCH_MATRIX_PATH");
+            this->m_file        = (path != nullptr) ? fopen(path, "w") : nullptr;
+            if(this->m_file == nullptr)
+            {
+                if(path != nullptr)
+                {
+                    fprintf(stderr,
+                            "hipSPARSE warning: cannot open HIPSPARSE_LOG_BENCH_PATH '%s', "
+                            "writing the bench commands to standard error\n",
+                            path);
+                }
+                this->m_file = stderr;
+            }
+        }
+
+        static bool
+            value(const traceRecord& r, const benchOption& o, char precision, std::string& s)
+        {
+            if(o.arg >= r.nargs)
+            {
+                return false;
+            }
+
+            const traceValue& v = r.args[o.arg];
+            switch(o.kind)
+            {
+            case bench_int:
+                s = std::to_string(v.i);
+                return true;
+            case bench_operation:
+                s = (v.i == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? "N"
+                    : (v.i == HIPSPARSE_OPERATION_TRANSPOSE)   ? "T"
+                                                               : "C";
+                return true;
+            case bench_policy:
+                s = (v.i == HIPSPARSE_SOLVE_POLICY_NO_LEVEL) ? "N" : "L";
+                return true;
+            case bench_action:
+                s = (v.i == HIPSPARSE_ACTION_NUMERIC) ? "0" : "1";
+                return true;
+            case bench_scalar:
+            {
+                double x;
+                if(!benchScalar(v.p, precision, x))
+                {
+                    return false;
+                }
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), "%.17g", x);
+                s = buffer;
+                return true;
+            }
+            case bench_base:
+                s = std::to_string(static_cast<int>(
+                    hipsparseGetMatIndexBase(static_cast<hipsparseMatDescr_t>(
+                        const_cast<void*>(v.p)))));
+                return true;
+            case bench_diag:
+                s = (hipsparseGetMatDiagType(
+                         static_cast<hipsparseMatDescr_t>(const_cast<void*>(v.p)))
+                     == HIPSPARSE_DIAG_TYPE_UNIT)
+                        ? "U"
+                        : "N";
+                return true;
+            case bench_uplo:
+                s = (hipsparseGetMatFillMode(
+                         static_cast<hipsparseMatDescr_t>(const_cast<void*>(v.p)))
+                     == HIPSPARSE_FILL_MODE_UPPER)
+                        ? "U"
+                        : "L";
+                return true;
+            }
+            return false;
+        }
+
+        //
+        // Write the CSR operand in the hipsparse-bench binary format: the int32 number of rows,
+        // columns and non-zeros, the zero based int32 row pointer and column index arrays and the
+        // values as double. The operand is read on every call, an operand with the same content
+        // as one already written, identified by its sizes and a hash of its arrays, is not
+        // written again.
+        //
+        bool dump(const traceRecord& r, const benchMatrix& a, char precision, std::string& filename)
+        {
+            if(a.ptr < 0 || a.ptr >= r.nargs || a.ind >= r.nargs || a.val >= r.nargs)
+            {
+                return false;
+            }
+
+            const int   m   = static_cast<int>(r.args[a.m].i);
+            const int   n   = static_cast<int>(r.args[a.n].i);
+            const void* ptr = r.args[a.ptr].p;
+            const void* ind = r.args[a.ind].p;
+            const void* val = r.args[a.val].p;
+
+            const int base
+                = a.base_is_descr
+                      ? static_cast<int>(hipsparseGetMatIndexBase(
+                          static_cast<hipsparseMatDescr_t>(const_cast<void*>(r.args[a.base].p))))
+                      : static_cast<int>(r.args[a.base].i);
+
+            if(m < 0 || n < 0 || ptr == nullptr)
+            {
+                return false;
+            }
+
+            // The operand may still be written by work queued on the handle stream.
+            if(internalDeviceSynchronize() != hipSuccess)
+            {
+                return false;
+            }
+
+            std::vector<int> hptr(m + 1);
+            if(!benchRead(hptr.data(), ptr, sizeof(int) * (m + 1)))
+            {
+                return false;
+            }
+
+            const int nnz = (a.nnz >= 0) ? static_cast<int>(r.args[a.nnz].i) : hptr[m] - hptr[0];
+
+            const size_t      size = (precision == 's') ? sizeof(float)
+                                     : (precision == 'z') ? 2 * sizeof(double)
+                                                          : sizeof(double);
+            std::vector<int>  hind(nnz);
+            std::vector<char> hval(size * nnz);
+            if(nnz > 0
+               && (!benchRead(hind.data(), ind, sizeof(int) * nnz)
+                   || !benchRead(hval.data(), val, size * nnz)))
+            {
+                return false;
+            }
+
+            std::vector<double> values(nnz);
+            for(int i = 0; i < nnz; ++i)
+            {
+                if(precision == 's' || precision == 'c')
+                {
+                    float x;
+                    memcpy(&x, hval.data() + size * i, sizeof(float));
+                    values[i] = x;
+                }
+                else
+                {
+                    memcpy(&values[i], hval.data() + size * i, sizeof(double));
+                }
+            }
+
+            for(int i = 0; i <= m; ++i)
+            {
+                hptr[i] -= base;
+            }
+            for(int i = 0; i < nnz; ++i)
+            {
+                hind[i] -= base;
+            }
+
+            uint64_t hash = benchHash(hptr.data(), sizeof(int) * (m + 1), 14695981039346656037ULL);
+            hash          = benchHash(hind.data(), sizeof(int) * nnz, hash);
+            hash          = benchHash(values.data(), sizeof(double) * nnz, hash);
+
+            const auto key = std::make_tuple(m, n, nnz, hash);
+            auto       it  = this->m_matrices.find(key);
+            if(it != this->m_matrices.end())
+            {
+                filename = it->second;
+                return true;
+            }
+
+            filename = std::string(this->m_matrix_path) + "/hipsparse_matrix_"
+                       + std::to_string(this->m_matrices.size()) + ".bin";
+
+            FILE* f = fopen(filename.c_str(), "wb");
+            if(f == nullptr)
+            {
+                return false;
+            }
+            const int  header[3] = {m, n, nnz};
+            const bool ok
+                = fwrite(header, sizeof(int), 3, f) == 3
+                  && fwrite(hptr.data(), sizeof(int), m + 1, f) == static_cast<size_t>(m + 1)
+                  && fwrite(hind.data(), sizeof(int), nnz, f) == static_cast<size_t>(nnz)
+                  && fwrite(values.data(), sizeof(double), nnz, f) == static_cast<size_t>(nnz);
+            fclose(f);
+            if(!ok)
+            {
+                return false;
+            }
+
+            this->m_matrices[key] = filename;
+            return true;
+        }
+
+        std::mutex  m_mutex;
+        FILE*       m_file{};
+        const char* m_matrix_path{};
+        std::map<std::tuple<int, int, int, uint64_t>, std::string> m_matrices;
+    };
+
+    void traceBench(const traceRecord& record)
+    {
+        benchLogger::instance().log(record);
+    }
+}
@@ -0,0 +1,192 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse.h"
+
+#include "hipsparse_trace.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Tuning database struct - to hold the entries written by hipsparse-bench --bench-tune
+struct hipsparseTuningDb
+{
+    struct entry
+    {
+        std::string routine{};
+        char        precision{};
+        int64_t     m{};
+        int64_t     n{};
+        int64_t     nnz{};
+        int         alg{};
+    };
+
+    std::vector<entry> entries{};
+};
+
+namespace hipsparse
+{
+    static char dataTypeToPrecision(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return 's';
+        case HIP_R_64F:
+            return 'd';
+        case HIP_C_32F:
+            return 'c';
+        case HIP_C_64F:
+            return 'z';
+        default:
+            return '\0';
+        }
+    }
+
+    //
+    // Distance between two matrices, on the logarithm of their features.
+    //
+    static double
+        tuningDistance(int64_t m0, int64_t n0, int64_t nnz0, int64_t m, int64_t n, int64_t nnz)
+    {
+        const double dm   = std::log1p(double(m0)) - std::log1p(double(m));
+        const double dn   = std::log1p(double(n0)) - std::log1p(double(n));
+        const double dnnz = std::log1p(double(nnz0)) - std::log1p(double(nnz));
+        return dm * dm + dn * dn + dnnz * dnnz;
+    }
+}
+
+hipsparseStatus_t hipsparseCreateTuningDb(hipsparseTuningDb_t* db, const char* filename)
+{
+    HIPSPARSE_TRACE(db, filename);
+
+    if(db == nullptr || filename == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    std::ifstream in(filename);
+    if(!in)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparseTuningDb* tdb = new(std::nothrow) hipsparseTuningDb;
+    if(tdb == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_ALLOC_FAILED);
+    }
+
+    try
+    {
+        std::string line;
+        while(std::getline(in, line))
+        {
+            std::istringstream iss(line);
+            std::string        routine;
+            if(!(iss >> routine) || routine[0] == '#')
+            {
+                continue;
+            }
+
+            hipsparseTuningDb::entry e;
+            std::string              precision, indextype, option;
+            e.routine = routine;
+            if(!(iss >> precision >> indextype >> e.m >> e.n >> e.nnz >> option >> e.alg)
+               || precision.size() != 1)
+            {
+                delete tdb;
+                return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+            }
+            e.precision = precision[0];
+            tdb->entries.push_back(e);
+        }
+    }
+    catch(const std::bad_alloc&)
+    {
+        delete tdb;
+        return trace(HIPSPARSE_STATUS_ALLOC_FAILED);
+    }
+
+    *db = tdb;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroyTuningDb(hipsparseTuningDb_t db)
+{
+    HIPSPARSE_TRACE(db);
+
+    delete db;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseTuningDbLookup(hipsparseTuningDb_t db,
+                                          const char*         routine,
+                                          hipDataType         valueType,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             nnz,
+                                          int*                alg)
+{
+    HIPSPARSE_TRACE(db, routine, valueType, m, n, nnz, alg);
+
+    if(db == nullptr || routine == nullptr || alg == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const char precision = hipsparse::dataTypeToPrecision(valueType);
+    if(precision == '\0')
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    *alg           = -1;
+    double closest = std::numeric_limits<double>::max();
+    for(const auto& e : db->entries)
+    {
+        if(e.precision != precision || e.routine != routine)
+        {
+            continue;
+        }
+
+        const double d = hipsparse::tuningDistance(e.m, e.n, e.nnz, m, n, nnz);
+        if(d < closest)
+        {
+            closest = d;
+            *alg    = e.alg;
+        }
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
@@ -0,0 +1,4924 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#include "hipsparse.h"
+
+#include "../common/hipsparse_memory.hpp"
+#include "../common/hipsparse_trace.hpp"
+#include "hipsparse_host_kernels.hpp"
+
+#include <hip/hip_complex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <vector>
+
+#define TO_STR2(x) #x
+#define TO_STR(x) TO_STR2(x)
+
+// Used in API functions only, the status is returned through the trace of the function, see
+// HIPSPARSE_TRACE.
+#define RETURN_IF_HIPSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                \
+    {                                                                    \
+        hipsparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK; \
+        if(TMP_STATUS_FOR_CHECK != HIPSPARSE_STATUS_SUCCESS)             \
+        {                                                                \
+            return trace(TMP_STATUS_FOR_CHECK);                          \
+        }                                                                \
+    }
+
+//
+// The host backend runs the routines on the calling thread, and on the OpenMP threads if
+// available, before returning. All arrays and scalars are in host memory, whatever the pointer
+// mode. The stream, the sync mode and the workspace of a handle are only recorded.
+//
+namespace hipsparse
+{
+    struct hostHandle
+    {
+        hipStream_t            stream         = nullptr;
+        hipsparsePointerMode_t pointer_mode   = HIPSPARSE_POINTER_MODE_HOST;
+        hipsparseSyncMode_t    sync_mode      = HIPSPARSE_SYNC_MODE_BLOCKING;
+        void*                  workspace      = nullptr;
+        size_t                 workspace_size = 0;
+    };
+
+    struct hostMatDescr
+    {
+        hipsparseMatrixType_t type = HIPSPARSE_MATRIX_TYPE_GENERAL;
+        hipsparseFillMode_t   fill = HIPSPARSE_FILL_MODE_LOWER;
+        hipsparseDiagType_t   diag = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+        hipsparseIndexBase_t  base = HIPSPARSE_INDEX_BASE_ZERO;
+    };
+
+    struct hostSpVec
+    {
+        int64_t              size;
+        int64_t              nnz;
+        void*                idx;
+        void*                val;
+        hipsparseIndexType_t idx_type;
+        hipsparseIndexBase_t base;
+        hipDataType          data_type;
+    };
+
+    struct hostSpMat
+    {
+        hipsparseFormat_t format;
+        int64_t           rows;
+        int64_t           cols;
+        int64_t           nnz;
+
+        // CSR: row offsets and column indices, CSC: row indices and column offsets, COO: row and
+        // column indices, COO AoS: index pairs in row_data, Blocked ELL: column indices in
+        // col_data
+        void*                row_data;
+        void*                col_data;
+        void*                val_data;
+        hipsparseIndexType_t row_type;
+        hipsparseIndexType_t col_type;
+        hipsparseIndexBase_t base;
+        hipDataType          data_type;
+
+        int64_t ell_block_dim = 0;
+        int64_t ell_cols      = 0;
+
+        hipsparseFillMode_t fill_mode = HIPSPARSE_FILL_MODE_LOWER;
+        hipsparseDiagType_t diag_type = HIPSPARSE_DIAG_TYPE_NON_UNIT;
+
+        int     batch_count                 = 1;
+        int64_t offsets_batch_stride        = 0;
+        int64_t columns_values_batch_stride = 0;
+
+        // Structure and values computed by SpGEMM for this matrix until they are copied, 0
+        // based, std::vector of the types of the matrix
+        std::shared_ptr<void> spgemm_ptr;
+        std::shared_ptr<void> spgemm_ind;
+        std::shared_ptr<void> spgemm_val;
+    };
+
+    struct hostDnVec
+    {
+        int64_t     size;
+        void*       values;
+        hipDataType data_type;
+    };
+
+    struct hostDnMat
+    {
+        int64_t          rows;
+        int64_t          cols;
+        int64_t          ld;
+        void*            values;
+        hipDataType      data_type;
+        hipsparseOrder_t order;
+        int              batch_count  = 1;
+        int64_t          batch_stride = 0;
+    };
+
+    template <typename T>
+    struct typeTag
+    {
+        typedef T type;
+    };
+
+    //
+    // Call f with the tag of an index type, 16 bit indices are not supported.
+    //
+    template <typename F>
+    hipsparseStatus_t dispatchIndex(hipsparseIndexType_t type, F f)
+    {
+        switch(type)
+        {
+        case HIPSPARSE_INDEX_32I:
+            return f(typeTag<int32_t>());
+        case HIPSPARSE_INDEX_64I:
+            return f(typeTag<int64_t>());
+        case HIPSPARSE_INDEX_16U:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    //
+    // Call f with the tag of a data type, only the single and double precision real and complex
+    // types are supported.
+    //
+    template <typename F>
+    hipsparseStatus_t dispatchData(hipDataType type, F f)
+    {
+        switch(type)
+        {
+        case HIP_R_32F:
+            return f(typeTag<float>());
+        case HIP_R_64F:
+            return f(typeTag<double>());
+        case HIP_C_32F:
+            return f(typeTag<hipComplex>());
+        case HIP_C_64F:
+            return f(typeTag<hipDoubleComplex>());
+        default:
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    inline hipsparseIndexType_t offsetsType(const hostSpMat* A)
+    {
+        return A->format == HIPSPARSE_FORMAT_CSC ? A->col_type : A->row_type;
+    }
+
+    inline hipsparseIndexType_t indicesType(const hostSpMat* A)
+    {
+        return A->format == HIPSPARSE_FORMAT_CSR ? A->col_type : A->row_type;
+    }
+
+    //
+    // Call f with the tags of the offsets and indices types of a sparse matrix. The Blocked ELL
+    // format is not supported.
+    //
+    template <typename F>
+    hipsparseStatus_t dispatchSpMatIndex(const hostSpMat* A, F f)
+    {
+        if(A->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return dispatchIndex(offsetsType(A), [&](auto i) {
+            return dispatchIndex(indicesType(A), [&](auto j) { return f(i, j); });
+        });
+    }
+
+    //
+    // Call f with the tags of the data, offsets and indices types of a sparse matrix.
+    //
+    template <typename F>
+    hipsparseStatus_t dispatchSpMat(const hostSpMat* A, F f)
+    {
+        return dispatchData(A->data_type, [&](auto t) {
+            return dispatchSpMatIndex(A, [&](auto i, auto j) { return f(t, i, j); });
+        });
+    }
+
+    //
+    // Call f with the tags of the input, output and compute types of a mixed precision product.
+    // int8 inputs are accumulated in int32 or float and give an output of the compute type, half
+    // and bfloat16 inputs are accumulated in float and give a float output or one of their type.
+    //
+    template <typename F>
+    hipsparseStatus_t dispatchMixed(hipDataType input_type,
+                                    hipDataType output_type,
+                                    hipDataType compute_type,
+                                    F           f)
+    {
+        switch(input_type)
+        {
+        case HIP_R_8I:
+            if(compute_type == HIP_R_32I && output_type == HIP_R_32I)
+            {
+                return f(typeTag<int8_t>(), typeTag<int32_t>(), typeTag<int32_t>());
+            }
+            if(compute_type == HIP_R_32F && output_type == HIP_R_32F)
+            {
+                return f(typeTag<int8_t>(), typeTag<float>(), typeTag<float>());
+            }
+            break;
+        case HIP_R_16F:
+            if(compute_type == HIP_R_32F && output_type == HIP_R_32F)
+            {
+                return f(typeTag<host::half>(), typeTag<float>(), typeTag<float>());
+            }
+            if(compute_type == HIP_R_32F && output_type == HIP_R_16F)
+            {
+                return f(typeTag<host::half>(), typeTag<host::half>(), typeTag<float>());
+            }
+            break;
+        case HIP_R_16BF:
+            if(compute_type == HIP_R_32F && output_type == HIP_R_32F)
+            {
+                return f(typeTag<host::bfloat16>(), typeTag<float>(), typeTag<float>());
+            }
+            if(compute_type == HIP_R_32F && output_type == HIP_R_16BF)
+            {
+                return f(typeTag<host::bfloat16>(), typeTag<host::bfloat16>(), typeTag<float>());
+            }
+            break;
+        default:
+            break;
+        }
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    //
+    // Types of a product, either all of the compute type or a mixed precision combination.
+    //
+    inline bool
+        productTypes(hipDataType input_type, hipDataType output_type, hipDataType compute_type)
+    {
+        if(input_type == compute_type && output_type == compute_type)
+        {
+            return true;
+        }
+        return dispatchMixed(input_type, output_type, compute_type, [](auto, auto, auto) {
+                   return HIPSPARSE_STATUS_SUCCESS;
+               })
+               == HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    inline T scalar(const void* x)
+    {
+        return *static_cast<const T*>(x);
+    }
+
+    //
+    // CSR matrix of op(A), op(A) = A^T if trans is set, for the batch b of A. Formats other than
+    // CSR, and transposed operations, are converted, except a transposed CSC matrix.
+    //
+    template <typename T, typename I, typename J>
+    void csrView(const hostSpMat* A, bool trans, int64_t b, host::csrMatrix<T, I, J>& B)
+    {
+        const int64_t offsets_shift = b * A->offsets_batch_stride;
+        const int64_t shift         = b * A->columns_values_batch_stride;
+        const T*      val           = static_cast<const T*>(A->val_data) + shift;
+
+        host::csrMatrix<T, I, J> V;
+        switch(A->format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            const bool csr = A->format == HIPSPARSE_FORMAT_CSR;
+
+            V.m    = csr ? A->rows : A->cols;
+            V.n    = csr ? A->cols : A->rows;
+            V.nnz  = A->nnz;
+            V.base = A->base;
+            V.ptr  = static_cast<const I*>(csr ? A->row_data : A->col_data) + offsets_shift;
+            V.ind  = static_cast<const J*>(csr ? A->col_data : A->row_data) + shift;
+            V.val  = val;
+
+            // V is A for CSR and A^T for CSC
+            if(trans == csr)
+            {
+                host::transpose(V, B);
+            }
+            else
+            {
+                B.m    = V.m;
+                B.n    = V.n;
+                B.nnz  = V.nnz;
+                B.base = V.base;
+                B.ptr  = V.ptr;
+                B.ind  = V.ind;
+                B.val  = V.val;
+            }
+            return;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+            const bool    aos    = A->format == HIPSPARSE_FORMAT_COO_AOS;
+            const int64_t stride = aos ? 2 : 1;
+            const J*      row    = static_cast<const J*>(A->row_data) + shift * stride;
+            const J*      col    = aos ? row + 1 : static_cast<const J*>(A->col_data) + shift;
+
+            host::cooToCsr(trans ? A->cols : A->rows,
+                           trans ? A->rows : A->cols,
+                           A->nnz,
+                           trans ? col : row,
+                           trans ? row : col,
+                           stride,
+                           val,
+                           static_cast<int64_t>(A->base),
+                           B);
+            return;
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+            return;
+        }
+    }
+
+    //
+    // Dense matrix of op(A), op(A) = A^T if trans is set, for the batch b of A.
+    //
+    template <typename T>
+    host::denseMatrix<T> denseView(const hostDnMat* A, bool trans, int64_t b)
+    {
+        const bool    col_major  = A->order == HIPSPARSE_ORDER_COL;
+        const int64_t row_stride = col_major ? 1 : A->ld;
+        const int64_t col_stride = col_major ? A->ld : 1;
+        T*            val        = static_cast<T*>(A->values) + b * A->batch_stride;
+
+        if(trans)
+        {
+            return {A->cols, A->rows, val, col_stride, row_stride};
+        }
+        return {A->rows, A->cols, val, row_stride, col_stride};
+    }
+
+    //
+    // Row and column, 0 based, of the entries of A in the order of its values.
+    //
+    template <typename I, typename J>
+    void spMatEntries(const hostSpMat* A, std::vector<int64_t>& row, std::vector<int64_t>& col)
+    {
+        const int64_t nnz  = A->nnz;
+        const int64_t base = A->base;
+
+        row.resize(nnz);
+        col.resize(nnz);
+        switch(A->format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        {
+            const I* ptr = static_cast<const I*>(A->row_data);
+            const J* ind = static_cast<const J*>(A->col_data);
+
+            row = host::expandRows<I, int64_t>(A->rows, ptr, base, nnz);
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                col[k] = ind[k] - base;
+            }
+            return;
+        }
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            const I* ptr = static_cast<const I*>(A->col_data);
+            const J* ind = static_cast<const J*>(A->row_data);
+
+            col = host::expandRows<I, int64_t>(A->cols, ptr, base, nnz);
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                row[k] = ind[k] - base;
+            }
+            return;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+            const bool    aos    = A->format == HIPSPARSE_FORMAT_COO_AOS;
+            const int64_t stride = aos ? 2 : 1;
+            const J*      r      = static_cast<const J*>(A->row_data);
+            const J*      c      = aos ? r + 1 : static_cast<const J*>(A->col_data);
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                row[k] = r[k * stride] - base;
+                col[k] = c[k * stride] - base;
+            }
+            return;
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+            return;
+        }
+    }
+
+    hipsparseStatus_t createSpVec(hipsparseSpVecDescr_t* descr,
+                                  int64_t                size,
+                                  int64_t                nnz,
+                                  const void*            indices,
+                                  const void*            values,
+                                  hipsparseIndexType_t   idx_type,
+                                  hipsparseIndexBase_t   base,
+                                  hipDataType            data_type)
+    {
+        if(descr == nullptr || size < 0 || nnz < 0 || nnz > size)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz > 0 && (indices == nullptr || values == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(base != HIPSPARSE_INDEX_BASE_ZERO && base != HIPSPARSE_INDEX_BASE_ONE)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hostSpVec* x = new hostSpVec;
+        x->size      = size;
+        x->nnz       = nnz;
+        x->idx       = const_cast<void*>(indices);
+        x->val       = const_cast<void*>(values);
+        x->idx_type  = idx_type;
+        x->base      = base;
+        x->data_type = data_type;
+
+        *descr = x;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t createSpMat(hipsparseSpMatDescr_t* descr,
+                                  hipsparseFormat_t      format,
+                                  int64_t                rows,
+                                  int64_t                cols,
+                                  int64_t                nnz,
+                                  const void*            row_data,
+                                  const void*            col_data,
+                                  const void*            val_data,
+                                  hipsparseIndexType_t   row_type,
+                                  hipsparseIndexType_t   col_type,
+                                  hipsparseIndexBase_t   base,
+                                  hipDataType            data_type)
+    {
+        if(descr == nullptr || rows < 0 || cols < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(base != HIPSPARSE_INDEX_BASE_ZERO && base != HIPSPARSE_INDEX_BASE_ONE)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz > 0 && (col_data == nullptr || val_data == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz > 0 && format != HIPSPARSE_FORMAT_BLOCKED_ELL && row_data == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hostSpMat* A = new hostSpMat;
+        A->format    = format;
+        A->rows      = rows;
+        A->cols      = cols;
+        A->nnz       = nnz;
+        A->row_data  = const_cast<void*>(row_data);
+        A->col_data  = const_cast<void*>(col_data);
+        A->val_data  = const_cast<void*>(val_data);
+        A->row_type  = row_type;
+        A->col_type  = col_type;
+        A->base      = base;
+        A->data_type = data_type;
+
+        *descr = A;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t createBlockedEll(hipsparseSpMatDescr_t* descr,
+                                       int64_t                rows,
+                                       int64_t                cols,
+                                       int64_t                block_dim,
+                                       int64_t                ell_cols,
+                                       const void*            ind,
+                                       const void*            val,
+                                       hipsparseIndexType_t   idx_type,
+                                       hipsparseIndexBase_t   base,
+                                       hipDataType            data_type)
+    {
+        if(block_dim <= 0 || ell_cols < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Matrices in Blocked ELL format can be described, the routines do not support them
+        hipsparseStatus_t status = createSpMat(descr,
+                                               HIPSPARSE_FORMAT_BLOCKED_ELL,
+                                               rows,
+                                               cols,
+                                               rows * ell_cols,
+                                               nullptr,
+                                               ind,
+                                               val,
+                                               idx_type,
+                                               idx_type,
+                                               base,
+                                               data_type);
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        hostSpMat* A     = (hostSpMat*)*descr;
+        A->ell_block_dim = block_dim;
+        A->ell_cols      = ell_cols;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t createDnMat(hipsparseDnMatDescr_t* descr,
+                                  int64_t                rows,
+                                  int64_t                cols,
+                                  int64_t                ld,
+                                  const void*            values,
+                                  hipDataType            data_type,
+                                  hipsparseOrder_t       order)
+    {
+        if(descr == nullptr || rows < 0 || cols < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(order != HIPSPARSE_ORDER_COL && order != HIPSPARSE_ORDER_ROW)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(ld < std::max<int64_t>(1, order == HIPSPARSE_ORDER_COL ? rows : cols))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(rows > 0 && cols > 0 && values == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hostDnMat* A = new hostDnMat;
+        A->rows      = rows;
+        A->cols      = cols;
+        A->ld        = ld;
+        A->values    = const_cast<void*>(values);
+        A->data_type = data_type;
+        A->order     = order;
+
+        *descr = A;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Getters of the descriptors, P is void* or const void*.
+    //
+    template <typename P>
+    hipsparseStatus_t spVecGet(const hostSpVec*      x,
+                               int64_t*              size,
+                               int64_t*              nnz,
+                               P*                    indices,
+                               P*                    values,
+                               hipsparseIndexType_t* idx_type,
+                               hipsparseIndexBase_t* base,
+                               hipDataType*          data_type)
+    {
+        if(x == nullptr || size == nullptr || nnz == nullptr || indices == nullptr
+           || values == nullptr || idx_type == nullptr || base == nullptr || data_type == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *size      = x->size;
+        *nnz       = x->nnz;
+        *indices   = x->idx;
+        *values    = x->val;
+        *idx_type  = x->idx_type;
+        *base      = x->base;
+        *data_type = x->data_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // COO arrays, the column indices are not returned for the AoS format.
+    //
+    template <typename P>
+    hipsparseStatus_t cooGet(const hostSpMat*      A,
+                             hipsparseFormat_t     format,
+                             int64_t*              rows,
+                             int64_t*              cols,
+                             int64_t*              nnz,
+                             P*                    row_ind,
+                             P*                    col_ind,
+                             P*                    values,
+                             hipsparseIndexType_t* idx_type,
+                             hipsparseIndexBase_t* base,
+                             hipDataType*          data_type)
+    {
+        if(A == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+           || row_ind == nullptr || values == nullptr || idx_type == nullptr || base == nullptr
+           || data_type == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->format != format || (format == HIPSPARSE_FORMAT_COO && col_ind == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *rows    = A->rows;
+        *cols    = A->cols;
+        *nnz     = A->nnz;
+        *row_ind = A->row_data;
+        if(col_ind != nullptr)
+        {
+            *col_ind = A->col_data;
+        }
+        *values    = A->val_data;
+        *idx_type  = A->row_type;
+        *base      = A->base;
+        *data_type = A->data_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // CSR arrays of a CSR matrix, or of the transpose of a CSC matrix.
+    //
+    template <typename P>
+    hipsparseStatus_t csrGet(const hostSpMat*      A,
+                             hipsparseFormat_t     format,
+                             int64_t*              rows,
+                             int64_t*              cols,
+                             int64_t*              nnz,
+                             P*                    offsets,
+                             P*                    indices,
+                             P*                    values,
+                             hipsparseIndexType_t* offsets_type,
+                             hipsparseIndexType_t* indices_type,
+                             hipsparseIndexBase_t* base,
+                             hipDataType*          data_type)
+    {
+        if(A == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+           || offsets == nullptr || indices == nullptr || values == nullptr
+           || offsets_type == nullptr || indices_type == nullptr || base == nullptr
+           || data_type == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->format != format)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const bool csr = format == HIPSPARSE_FORMAT_CSR;
+
+        *rows         = A->rows;
+        *cols         = A->cols;
+        *nnz          = A->nnz;
+        *offsets      = csr ? A->row_data : A->col_data;
+        *indices      = csr ? A->col_data : A->row_data;
+        *values       = A->val_data;
+        *offsets_type = offsetsType(A);
+        *indices_type = indicesType(A);
+        *base         = A->base;
+        *data_type    = A->data_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename P>
+    hipsparseStatus_t blockedEllGet(const hostSpMat*      A,
+                                    int64_t*              rows,
+                                    int64_t*              cols,
+                                    int64_t*              block_dim,
+                                    int64_t*              ell_cols,
+                                    P*                    ind,
+                                    P*                    val,
+                                    hipsparseIndexType_t* idx_type,
+                                    hipsparseIndexBase_t* base,
+                                    hipDataType*          data_type)
+    {
+        if(A == nullptr || rows == nullptr || cols == nullptr || block_dim == nullptr
+           || ell_cols == nullptr || ind == nullptr || val == nullptr || idx_type == nullptr
+           || base == nullptr || data_type == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->format != HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *rows      = A->rows;
+        *cols      = A->cols;
+        *block_dim = A->ell_block_dim;
+        *ell_cols  = A->ell_cols;
+        *ind       = A->col_data;
+        *val       = A->val_data;
+        *idx_type  = A->col_type;
+        *base      = A->base;
+        *data_type = A->data_type;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename P>
+    hipsparseStatus_t dnMatGet(const hostDnMat*  A,
+                               int64_t*          rows,
+                               int64_t*          cols,
+                               int64_t*          ld,
+                               P*                values,
+                               hipDataType*      data_type,
+                               hipsparseOrder_t* order)
+    {
+        if(A == nullptr || rows == nullptr || cols == nullptr || ld == nullptr || values == nullptr
+           || data_type == nullptr || order == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *rows      = A->rows;
+        *cols      = A->cols;
+        *ld        = A->ld;
+        *values    = A->values;
+        *data_type = A->data_type;
+        *order     = A->order;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Size of the buffers, the host routines allocate their temporary storage themselves.
+    //
+    static constexpr size_t buffer_size = 4;
+
+    hipError_t internalMalloc(void** ptr, size_t size)
+    {
+        *ptr = malloc(size);
+        if(*ptr == nullptr && size != 0)
+        {
+            return hipErrorMemoryAllocation;
+        }
+
+        profileAllocation();
+        return hipSuccess;
+    }
+
+    hipError_t internalFree(void* ptr)
+    {
+        free(ptr);
+        return hipSuccess;
+    }
+
+    // The stream is only recorded, the copy is done before returning
+    hipError_t internalMemcpyAsync(void* dst, const void* src, size_t size, hipStream_t stream)
+    {
+        if(size != 0)
+        {
+            memcpy(dst, src, size);
+        }
+        return hipSuccess;
+    }
+
+    hipError_t internalStreamSynchronize(hipStream_t stream)
+    {
+        return hipSuccess;
+    }
+
+    hipError_t internalMemcpyToHost(void* dst, const void* src, size_t size)
+    {
+        memcpy(dst, src, size);
+        return hipSuccess;
+    }
+
+    hipError_t internalDeviceSynchronize()
+    {
+        return hipSuccess;
+    }
+}
+
+hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
+{
+    HIPSPARSE_TRACE(handle);
+
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *handle = new hipsparse::hostHandle;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
+{
+    HIPSPARSE_TRACE(handle);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // Free the counters before the address of the handle can be reused
+    hipsparse::profileRelease(handle);
+
+    delete(hipsparse::hostHandle*)handle;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetInternalMemoryUsage(size_t* currentBytes, size_t* peakBytes)
+{
+    HIPSPARSE_TRACE(currentBytes, peakBytes);
+
+    // The host backend does not allocate device memory
+    if(currentBytes != nullptr)
+    {
+        *currentBytes = 0;
+    }
+    if(peakBytes != nullptr)
+    {
+        *peakBytes = 0;
+    }
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseResetInternalMemoryUsage(void)
+{
+    static const hipsparse::traceSite trace_site = {__func__, "", -1, -1, -1};
+    hipsparse::traceCall              trace(trace_site);
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t
+    hipsparseSetWorkspace(hipsparseHandle_t handle, void* workspace, size_t workspaceSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, workspace, workspaceSizeInBytes);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(workspace == nullptr && workspaceSizeInBytes != 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostHandle*)handle)->workspace      = workspace;
+    ((hipsparse::hostHandle*)handle)->workspace_size = workspaceSizeInBytes;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+const char* hipsparseGetErrorName(hipsparseStatus_t status)
+{
+    switch(status)
+    {
+    case HIPSPARSE_STATUS_SUCCESS:
+        return "HIPSPARSE_STATUS_SUCCESS";
+    case HIPSPARSE_STATUS_NOT_INITIALIZED:
+        return "HIPSPARSE_STATUS_NOT_INITIALIZED";
+    case HIPSPARSE_STATUS_ALLOC_FAILED:
+        return "HIPSPARSE_STATUS_ALLOC_FAILED";
+    case HIPSPARSE_STATUS_INVALID_VALUE:
+        return "HIPSPARSE_STATUS_INVALID_VALUE";
+    case HIPSPARSE_STATUS_ARCH_MISMATCH:
+        return "HIPSPARSE_STATUS_ARCH_MISMATCH";
+    case HIPSPARSE_STATUS_MAPPING_ERROR:
+        return "HIPSPARSE_STATUS_MAPPING_ERROR";
+    case HIPSPARSE_STATUS_EXECUTION_FAILED:
+        return "HIPSPARSE_STATUS_EXECUTION_FAILED";
+    case HIPSPARSE_STATUS_INTERNAL_ERROR:
+        return "HIPSPARSE_STATUS_INTERNAL_ERROR";
+    case HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED:
+        return "HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED";
+    case HIPSPARSE_STATUS_ZERO_PIVOT:
+        return "HIPSPARSE_STATUS_ZERO_PIVOT";
+    case HIPSPARSE_STATUS_NOT_SUPPORTED:
+        return "HIPSPARSE_STATUS_NOT_SUPPORTED";
+    case HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES:
+        return "HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES";
+    }
+    return "Unrecognized status code";
+}
+
+const char* hipsparseGetErrorString(hipsparseStatus_t status)
+{
+    switch(status)
+    {
+    case HIPSPARSE_STATUS_SUCCESS:
+        return "Function succeeds";
+    case HIPSPARSE_STATUS_NOT_INITIALIZED:
+        return "hipSPARSE was not initialized";
+    case HIPSPARSE_STATUS_ALLOC_FAILED:
+        return "Resource allocation failed";
+    case HIPSPARSE_STATUS_INVALID_VALUE:
+        return "Unsupported value was passed to the function";
+    case HIPSPARSE_STATUS_ARCH_MISMATCH:
+        return "Device architecture not supported";
+    case HIPSPARSE_STATUS_MAPPING_ERROR:
+        return "Access to GPU memory space failed";
+    case HIPSPARSE_STATUS_EXECUTION_FAILED:
+        return "GPU program failed to execute";
+    case HIPSPARSE_STATUS_INTERNAL_ERROR:
+        return "An internal hipSPARSE operation failed";
+    case HIPSPARSE_STATUS_MATRIX_TYPE_NOT_SUPPORTED:
+        return "Matrix type not supported";
+    case HIPSPARSE_STATUS_ZERO_PIVOT:
+        return "Zero pivot was computed";
+    case HIPSPARSE_STATUS_NOT_SUPPORTED:
+        return "Operation is not supported";
+    case HIPSPARSE_STATUS_INSUFFICIENT_RESOURCES:
+        return "Resources are insufficient";
+    }
+    return "Unrecognized status code";
+}
+
+hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
+{
+    HIPSPARSE_TRACE(handle, version);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
+{
+    HIPSPARSE_TRACE(handle, rev);
+
+    // Get hipSPARSE revision
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    if(rev == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    static constexpr char v[] = TO_STR(hipsparseVersionTweak);
+
+    sprintf(rev, "%s (host)", v);
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
+{
+    HIPSPARSE_TRACE(handle, streamId);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostHandle*)handle)->stream = streamId;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
+{
+    HIPSPARSE_TRACE(handle, streamId);
+
+    if(handle == nullptr || streamId == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *streamId = ((hipsparse::hostHandle*)handle)->stream;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(mode != HIPSPARSE_POINTER_MODE_HOST && mode != HIPSPARSE_POINTER_MODE_DEVICE)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostHandle*)handle)->pointer_mode = mode;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr || mode == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *mode = ((hipsparse::hostHandle*)handle)->pointer_mode;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // There is no stream to capture on the host, the routines never synchronize
+    if(mode != HIPSPARSE_SYNC_MODE_BLOCKING && mode != HIPSPARSE_SYNC_MODE_NON_BLOCKING
+       && mode != HIPSPARSE_SYNC_MODE_CAPTURE_SAFE)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostHandle*)handle)->sync_mode = mode;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr || mode == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *mode = ((hipsparse::hostHandle*)handle)->sync_mode;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
+{
+    HIPSPARSE_TRACE(descrA);
+
+    if(descrA == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *descrA = new hipsparse::hostMatDescr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
+{
+    HIPSPARSE_TRACE(descrA);
+
+    delete(hipsparse::hostMatDescr*)descrA;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
+{
+    HIPSPARSE_TRACE(dest, src);
+
+    if(dest == nullptr || src == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *(hipsparse::hostMatDescr*)dest = *(const hipsparse::hostMatDescr*)src;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
+{
+    HIPSPARSE_TRACE(descrA, type);
+
+    if(descrA == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(type != HIPSPARSE_MATRIX_TYPE_GENERAL && type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+       && type != HIPSPARSE_MATRIX_TYPE_HERMITIAN && type != HIPSPARSE_MATRIX_TYPE_TRIANGULAR)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostMatDescr*)descrA)->type = type;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
+{
+    return descrA != nullptr ? ((const hipsparse::hostMatDescr*)descrA)->type
+                             : HIPSPARSE_MATRIX_TYPE_GENERAL;
+}
+
+hipsparseStatus_t hipsparseSetMatFillMode(hipsparseMatDescr_t descrA, hipsparseFillMode_t fillMode)
+{
+    HIPSPARSE_TRACE(descrA, fillMode);
+
+    if(descrA == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(fillMode != HIPSPARSE_FILL_MODE_LOWER && fillMode != HIPSPARSE_FILL_MODE_UPPER)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostMatDescr*)descrA)->fill = fillMode;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
+{
+    return descrA != nullptr ? ((const hipsparse::hostMatDescr*)descrA)->fill
+                             : HIPSPARSE_FILL_MODE_LOWER;
+}
+
+hipsparseStatus_t hipsparseSetMatDiagType(hipsparseMatDescr_t descrA, hipsparseDiagType_t diagType)
+{
+    HIPSPARSE_TRACE(descrA, diagType);
+
+    if(descrA == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(diagType != HIPSPARSE_DIAG_TYPE_NON_UNIT && diagType != HIPSPARSE_DIAG_TYPE_UNIT)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostMatDescr*)descrA)->diag = diagType;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
+{
+    return descrA != nullptr ? ((const hipsparse::hostMatDescr*)descrA)->diag
+                             : HIPSPARSE_DIAG_TYPE_NON_UNIT;
+}
+
+hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparseIndexBase_t base)
+{
+    HIPSPARSE_TRACE(descrA, base);
+
+    if(descrA == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(base != HIPSPARSE_INDEX_BASE_ZERO && base != HIPSPARSE_INDEX_BASE_ONE)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostMatDescr*)descrA)->base = base;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
+{
+    return descrA != nullptr ? ((const hipsparse::hostMatDescr*)descrA)->base
+                             : HIPSPARSE_INDEX_BASE_ZERO;
+}
+
+/* Conversion routines used by the generic API examples */
+
+hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
+                                    const int*           csrRowPtr,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 cooRowInd,
+                                    hipsparseIndexBase_t idxBase)
+{
+    HIPSPARSE_TRACE(handle, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(m < 0 || nnz < 0 || (m > 0 && csrRowPtr == nullptr) || (nnz > 0 && cooRowInd == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const std::vector<int> rows = hipsparse::host::expandRows<int, int>(m, csrRowPtr, idxBase, nnz);
+
+#pragma omp parallel for schedule(static) if(nnz > hipsparse::host::min_parallel_size)
+    for(int k = 0; k < nnz; ++k)
+    {
+        cooRowInd[k] = rows[k] + idxBase;
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
+                                    const int*           cooRowInd,
+                                    int                  nnz,
+                                    int                  m,
+                                    int*                 csrRowPtr,
+                                    hipsparseIndexBase_t idxBase)
+{
+    HIPSPARSE_TRACE(handle, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(m < 0 || nnz < 0 || csrRowPtr == nullptr || (nnz > 0 && cooRowInd == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The row indices are sorted, the offset of a row is the position of its first entry
+#pragma omp parallel for schedule(static) if(m > hipsparse::host::min_parallel_size)
+    for(int i = 0; i <= m; ++i)
+    {
+        csrRowPtr[i] = static_cast<int>(std::lower_bound(cooRowInd, cooRowInd + nnz, i + idxBase)
+                                        - cooRowInd)
+                       + idxBase;
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
+{
+    HIPSPARSE_TRACE(handle, n, p);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(n < 0 || (n > 0 && p == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+#pragma omp parallel for schedule(static) if(n > hipsparse::host::min_parallel_size)
+    for(int i = 0; i < n; ++i)
+    {
+        p[i] = i;
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
+                                                 int                   m,
+                                                 int                   n,
+                                                 int                   nnz,
+                                                 const void*           csrVal,
+                                                 const int*            csrRowPtr,
+                                                 const int*            csrColInd,
+                                                 void*                 cscVal,
+                                                 int*                  cscColPtr,
+                                                 int*                  cscRowInd,
+                                                 hipDataType           valType,
+                                                 hipsparseAction_t     copyValues,
+                                                 hipsparseIndexBase_t  idxBase,
+                                                 hipsparseCsr2CscAlg_t alg,
+                                                 size_t*               pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    pBufferSizeInBytes);
+
+    if(handle == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(m < 0 || n < 0 || nnz < 0 || csrRowPtr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(nnz > 0 && csrColInd == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
+                                      int                   m,
+                                      int                   n,
+                                      int                   nnz,
+                                      const void*           csrVal,
+                                      const int*            csrRowPtr,
+                                      const int*            csrColInd,
+                                      void*                 cscVal,
+                                      int*                  cscColPtr,
+                                      int*                  cscRowInd,
+                                      hipDataType           valType,
+                                      hipsparseAction_t     copyValues,
+                                      hipsparseIndexBase_t  idxBase,
+                                      hipsparseCsr2CscAlg_t alg,
+                                      void*                 buffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    buffer);
+
+    if(handle == nullptr || buffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(m < 0 || n < 0 || nnz < 0 || csrRowPtr == nullptr || cscColPtr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(nnz > 0 && (csrColInd == nullptr || cscRowInd == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const bool numeric = copyValues == HIPSPARSE_ACTION_NUMERIC;
+    if(numeric && nnz > 0 && (csrVal == nullptr || cscVal == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The values are moved as bytes, any data type can be converted
+    size_t value_size;
+    switch(valType)
+    {
+    case HIP_R_32F:
+        value_size = sizeof(float);
+        break;
+    case HIP_R_64F:
+        value_size = sizeof(double);
+        break;
+    case HIP_C_32F:
+        value_size = sizeof(hipComplex);
+        break;
+    case HIP_C_64F:
+        value_size = sizeof(hipDoubleComplex);
+        break;
+    default:
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    const std::vector<int> rows = hipsparse::host::expandRows<int, int>(m, csrRowPtr, idxBase, nnz);
+
+    std::vector<int> ptr;
+    std::vector<int> ind;
+    std::vector<int> perm;
+    hipsparse::host::sortByRow(
+        n,
+        nnz,
+        [&](int64_t k) { return csrColInd[k] - idxBase; },
+        [&](int64_t k) { return rows[k]; },
+        ptr,
+        ind,
+        perm);
+
+#pragma omp parallel for schedule(static) if(n > hipsparse::host::min_parallel_size)
+    for(int j = 0; j <= n; ++j)
+    {
+        cscColPtr[j] = ptr[j] + idxBase;
+    }
+
+#pragma omp parallel for schedule(static) if(nnz > hipsparse::host::min_parallel_size)
+    for(int k = 0; k < nnz; ++k)
+    {
+        cscRowInd[k] = ind[k] + idxBase;
+        if(numeric)
+        {
+            memcpy(static_cast<char*>(cscVal) + k * value_size,
+                   static_cast<const char*>(csrVal) + perm[k] * value_size,
+                   value_size);
+        }
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+/* Generic API */
+
+hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
+                                       int64_t                size,
+                                       int64_t                nnz,
+                                       void*                  indices,
+                                       void*                  values,
+                                       hipsparseIndexType_t   idxType,
+                                       hipsparseIndexBase_t   idxBase,
+                                       hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::createSpVec(
+        spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType));
+}
+
+hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDescr,
+                                            int64_t                     size,
+                                            int64_t                     nnz,
+                                            const void*                 indices,
+                                            const void*                 values,
+                                            hipsparseIndexType_t        idxType,
+                                            hipsparseIndexBase_t        idxBase,
+                                            hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::createSpVec((hipsparseSpVecDescr_t*)spVecDescr,
+                                        size,
+                                        nnz,
+                                        indices,
+                                        values,
+                                        idxType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseDestroySpVec(hipsparseConstSpVecDescr_t spVecDescr)
+{
+    HIPSPARSE_TRACE(spVecDescr);
+
+    if(spVecDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    delete(const hipsparse::hostSpVec*)spVecDescr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
+                                    int64_t*                    size,
+                                    int64_t*                    nnz,
+                                    void**                      indices,
+                                    void**                      values,
+                                    hipsparseIndexType_t*       idxType,
+                                    hipsparseIndexBase_t*       idxBase,
+                                    hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::spVecGet((const hipsparse::hostSpVec*)spVecDescr,
+                                     size,
+                                     nnz,
+                                     indices,
+                                     values,
+                                     idxType,
+                                     idxBase,
+                                     valueType));
+}
+
+hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
+                                         int64_t*                   size,
+                                         int64_t*                   nnz,
+                                         const void**               indices,
+                                         const void**               values,
+                                         hipsparseIndexType_t*      idxType,
+                                         hipsparseIndexBase_t*      idxBase,
+                                         hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::spVecGet((const hipsparse::hostSpVec*)spVecDescr,
+                                     size,
+                                     nnz,
+                                     indices,
+                                     values,
+                                     idxType,
+                                     idxBase,
+                                     valueType));
+}
+
+hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseConstSpVecDescr_t spVecDescr,
+                                             hipsparseIndexBase_t*            idxBase)
+{
+    HIPSPARSE_TRACE(spVecDescr, idxBase);
+
+    if(spVecDescr == nullptr || idxBase == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *idxBase = ((const hipsparse::hostSpVec*)spVecDescr)->base;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
+{
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostSpVec*)spVecDescr)->val;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseConstSpVecGetValues(hipsparseConstSpVecDescr_t spVecDescr,
+                                               const void**               values)
+{
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostSpVec*)spVecDescr)->val;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
+{
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    if(spVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostSpVec*)spVecDescr)->val = values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cooRowInd,
+                                     void*                  cooColInd,
+                                     void*                  cooValues,
+                                     hipsparseIndexType_t   cooIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat(spMatDescr,
+                                        HIPSPARSE_FORMAT_COO,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        cooRowInd,
+                                        cooColInd,
+                                        cooValues,
+                                        cooIdxType,
+                                        cooIdxType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 cooRowInd,
+                                          const void*                 cooColInd,
+                                          const void*                 cooValues,
+                                          hipsparseIndexType_t        cooIdxType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat((hipsparseSpMatDescr_t*)spMatDescr,
+                                        HIPSPARSE_FORMAT_COO,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        cooRowInd,
+                                        cooColInd,
+                                        cooValues,
+                                        cooIdxType,
+                                        cooIdxType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
+                                        int64_t                rows,
+                                        int64_t                cols,
+                                        int64_t                nnz,
+                                        void*                  cooInd,
+                                        void*                  cooValues,
+                                        hipsparseIndexType_t   cooIdxType,
+                                        hipsparseIndexBase_t   idxBase,
+                                        hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, cooIdxType, idxBase, valueType);
+
+    // The column indices are interleaved with the row indices
+    return trace(hipsparse::createSpMat(spMatDescr,
+                                        HIPSPARSE_FORMAT_COO_AOS,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        cooInd,
+                                        cooInd,
+                                        cooValues,
+                                        cooIdxType,
+                                        cooIdxType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  csrRowOffsets,
+                                     void*                  csrColInd,
+                                     void*                  csrValues,
+                                     hipsparseIndexType_t   csrRowOffsetsType,
+                                     hipsparseIndexType_t   csrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat(spMatDescr,
+                                        HIPSPARSE_FORMAT_CSR,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        csrRowOffsets,
+                                        csrColInd,
+                                        csrValues,
+                                        csrRowOffsetsType,
+                                        csrColIndType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 csrRowOffsets,
+                                          const void*                 csrColInd,
+                                          const void*                 csrValues,
+                                          hipsparseIndexType_t        csrRowOffsetsType,
+                                          hipsparseIndexType_t        csrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat((hipsparseSpMatDescr_t*)spMatDescr,
+                                        HIPSPARSE_FORMAT_CSR,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        csrRowOffsets,
+                                        csrColInd,
+                                        csrValues,
+                                        csrRowOffsetsType,
+                                        csrColIndType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cscColOffsets,
+                                     void*                  cscRowInd,
+                                     void*                  cscValues,
+                                     hipsparseIndexType_t   cscColOffsetsType,
+                                     hipsparseIndexType_t   cscRowIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat(spMatDescr,
+                                        HIPSPARSE_FORMAT_CSC,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        cscRowInd,
+                                        cscColOffsets,
+                                        cscValues,
+                                        cscRowIndType,
+                                        cscColOffsetsType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 cscColOffsets,
+                                          const void*                 cscRowInd,
+                                          const void*                 cscValues,
+                                          hipsparseIndexType_t        cscColOffsetsType,
+                                          hipsparseIndexType_t        cscRowIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createSpMat((hipsparseSpMatDescr_t*)spMatDescr,
+                                        HIPSPARSE_FORMAT_CSC,
+                                        rows,
+                                        cols,
+                                        nnz,
+                                        cscRowInd,
+                                        cscColOffsets,
+                                        cscValues,
+                                        cscRowIndType,
+                                        cscColOffsetsType,
+                                        idxBase,
+                                        valueType));
+}
+
+hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
+                                            int64_t                rows,
+                                            int64_t                cols,
+                                            int64_t                ellBlockSize,
+                                            int64_t                ellCols,
+                                            void*                  ellColInd,
+                                            void*                  ellValue,
+                                            hipsparseIndexType_t   ellIdxType,
+                                            hipsparseIndexBase_t   idxBase,
+                                            hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createBlockedEll(spMatDescr,
+                                             rows,
+                                             cols,
+                                             ellBlockSize,
+                                             ellCols,
+                                             ellColInd,
+                                             ellValue,
+                                             ellIdxType,
+                                             idxBase,
+                                             valueType));
+}
+
+hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                                 int64_t                     rows,
+                                                 int64_t                     cols,
+                                                 int64_t                     ellBlockSize,
+                                                 int64_t                     ellCols,
+                                                 const void*                 ellColInd,
+                                                 const void*                 ellValue,
+                                                 hipsparseIndexType_t        ellIdxType,
+                                                 hipsparseIndexBase_t        idxBase,
+                                                 hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::createBlockedEll((hipsparseSpMatDescr_t*)spMatDescr,
+                                             rows,
+                                             cols,
+                                             ellBlockSize,
+                                             ellCols,
+                                             ellColInd,
+                                             ellValue,
+                                             ellIdxType,
+                                             idxBase,
+                                             valueType));
+}
+
+hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
+{
+    HIPSPARSE_TRACE(spMatDescr);
+
+    if(spMatDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    delete(const hipsparse::hostSpMat*)spMatDescr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cooRowInd,
+                                  void**                      cooColInd,
+                                  void**                      cooValues,
+                                  hipsparseIndexType_t*       idxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(
+        spMatDescr, rows, cols, nnz, cooRowInd, cooColInd, cooValues, idxType, idxBase, valueType);
+
+    return trace(hipsparse::cooGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_COO,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cooRowInd,
+                                   cooColInd,
+                                   cooValues,
+                                   idxType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               cooRowInd,
+                                       const void**               cooColInd,
+                                       const void**               cooValues,
+                                       hipsparseIndexType_t*      idxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(
+        spMatDescr, rows, cols, nnz, cooRowInd, cooColInd, cooValues, idxType, idxBase, valueType);
+
+    return trace(hipsparse::cooGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_COO,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cooRowInd,
+                                   cooColInd,
+                                   cooValues,
+                                   idxType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
+                                     int64_t*                    rows,
+                                     int64_t*                    cols,
+                                     int64_t*                    nnz,
+                                     void**                      cooInd,
+                                     void**                      cooValues,
+                                     hipsparseIndexType_t*       idxType,
+                                     hipsparseIndexBase_t*       idxBase,
+                                     hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, idxType, idxBase, valueType);
+
+    return trace(hipsparse::cooGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_COO_AOS,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cooInd,
+                                   (void**)nullptr,
+                                   cooValues,
+                                   idxType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      csrRowOffsets,
+                                  void**                      csrColInd,
+                                  void**                      csrValues,
+                                  hipsparseIndexType_t*       csrRowOffsetsType,
+                                  hipsparseIndexType_t*       csrColIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::csrGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_CSR,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   csrRowOffsets,
+                                   csrColInd,
+                                   csrValues,
+                                   csrRowOffsetsType,
+                                   csrColIndType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               csrRowOffsets,
+                                       const void**               csrColInd,
+                                       const void**               csrValues,
+                                       hipsparseIndexType_t*      csrRowOffsetsType,
+                                       hipsparseIndexType_t*      csrColIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::csrGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_CSR,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   csrRowOffsets,
+                                   csrColInd,
+                                   csrValues,
+                                   csrRowOffsetsType,
+                                   csrColIndType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    nnz,
+                                  void**                      cscColOffsets,
+                                  void**                      cscRowInd,
+                                  void**                      cscValues,
+                                  hipsparseIndexType_t*       cscColOffsetsType,
+                                  hipsparseIndexType_t*       cscRowIndType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::csrGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_CSC,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cscColOffsets,
+                                   cscRowInd,
+                                   cscValues,
+                                   cscColOffsetsType,
+                                   cscRowIndType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   nnz,
+                                       const void**               cscColOffsets,
+                                       const void**               cscRowInd,
+                                       const void**               cscValues,
+                                       hipsparseIndexType_t*      cscColOffsetsType,
+                                       hipsparseIndexType_t*      cscRowIndType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::csrGet((const hipsparse::hostSpMat*)spMatDescr,
+                                   HIPSPARSE_FORMAT_CSC,
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cscColOffsets,
+                                   cscRowInd,
+                                   cscValues,
+                                   cscColOffsetsType,
+                                   cscRowIndType,
+                                   idxBase,
+                                   valueType));
+}
+
+hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                         int64_t*                    rows,
+                                         int64_t*                    cols,
+                                         int64_t*                    ellBlockSize,
+                                         int64_t*                    ellCols,
+                                         void**                      ellColInd,
+                                         void**                      ellValue,
+                                         hipsparseIndexType_t*       ellIdxType,
+                                         hipsparseIndexBase_t*       idxBase,
+                                         hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::blockedEllGet((const hipsparse::hostSpMat*)spMatDescr,
+                                          rows,
+                                          cols,
+                                          ellBlockSize,
+                                          ellCols,
+                                          ellColInd,
+                                          ellValue,
+                                          ellIdxType,
+                                          idxBase,
+                                          valueType));
+}
+
+hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                              int64_t*                   rows,
+                                              int64_t*                   cols,
+                                              int64_t*                   ellBlockSize,
+                                              int64_t*                   ellCols,
+                                              const void**               ellColInd,
+                                              const void**               ellValue,
+                                              hipsparseIndexType_t*      ellIdxType,
+                                              hipsparseIndexBase_t*      idxBase,
+                                              hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::blockedEllGet((const hipsparse::hostSpMat*)spMatDescr,
+                                          rows,
+                                          cols,
+                                          ellBlockSize,
+                                          ellCols,
+                                          ellColInd,
+                                          ellValue,
+                                          ellIdxType,
+                                          idxBase,
+                                          valueType));
+}
+
+hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 csrRowOffsets,
+                                          void*                 csrColInd,
+                                          void*                 csrValues)
+{
+    HIPSPARSE_TRACE(spMatDescr, csrRowOffsets, csrColInd, csrValues);
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    if(A == nullptr || A->format != HIPSPARSE_FORMAT_CSR || csrRowOffsets == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(A->nnz > 0 && (csrColInd == nullptr || csrValues == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    A->row_data = csrRowOffsets;
+    A->col_data = csrColInd;
+    A->val_data = csrValues;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cscColOffsets,
+                                          void*                 cscRowInd,
+                                          void*                 cscValues)
+{
+    HIPSPARSE_TRACE(spMatDescr, cscColOffsets, cscRowInd, cscValues);
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    if(A == nullptr || A->format != HIPSPARSE_FORMAT_CSC || cscColOffsets == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(A->nnz > 0 && (cscRowInd == nullptr || cscValues == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    A->row_data = cscRowInd;
+    A->col_data = cscColOffsets;
+    A->val_data = cscValues;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
+                                          void*                 cooRowInd,
+                                          void*                 cooColInd,
+                                          void*                 cooValues)
+{
+    HIPSPARSE_TRACE(spMatDescr, cooRowInd, cooColInd, cooValues);
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    if(A == nullptr || A->format != HIPSPARSE_FORMAT_COO)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(A->nnz > 0 && (cooRowInd == nullptr || cooColInd == nullptr || cooValues == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    A->row_data = cooRowInd;
+    A->col_data = cooColInd;
+    A->val_data = cooValues;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
+                                        int64_t*                   rows,
+                                        int64_t*                   cols,
+                                        int64_t*                   nnz)
+{
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz);
+
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)spMatDescr;
+
+    *rows = A->rows;
+    *cols = A->cols;
+    *nnz  = A->nnz;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
+                                          hipsparseFormat_t*         format)
+{
+    HIPSPARSE_TRACE(spMatDescr, format);
+
+    if(spMatDescr == nullptr || format == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *format = ((const hipsparse::hostSpMat*)spMatDescr)->format;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDescr,
+                                             hipsparseIndexBase_t*      idxBase)
+{
+    HIPSPARSE_TRACE(spMatDescr, idxBase);
+
+    if(spMatDescr == nullptr || idxBase == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *idxBase = ((const hipsparse::hostSpMat*)spMatDescr)->base;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
+{
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostSpMat*)spMatDescr)->val_data;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseConstSpMatGetValues(hipsparseConstSpMatDescr_t spMatDescr,
+                                               const void**               values)
+{
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostSpMat*)spMatDescr)->val_data;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
+{
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    if(spMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostSpMat*)spMatDescr)->val_data = values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseConstSpMatDescr_t spMatDescr,
+                                                int*                       batchCount)
+{
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    if(spMatDescr == nullptr || batchCount == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *batchCount = ((const hipsparse::hostSpMat*)spMatDescr)->batch_count;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
+{
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    if(spMatDescr == nullptr || batchCount <= 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostSpMat*)spMatDescr)->batch_count = batchCount;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               batchStride)
+{
+    HIPSPARSE_TRACE(spMatDescr, batchCount, batchStride);
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    if(A == nullptr || A->format != HIPSPARSE_FORMAT_COO || batchCount <= 0 || batchStride < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    A->batch_count                 = batchCount;
+    A->offsets_batch_stride        = 0;
+    A->columns_values_batch_stride = batchStride;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
+                                              int                   batchCount,
+                                              int64_t               offsetsBatchStride,
+                                              int64_t               columnsValuesBatchStride)
+{
+    HIPSPARSE_TRACE(spMatDescr, batchCount, offsetsBatchStride, columnsValuesBatchStride);
+
+    // The offsets of a CSC matrix are its column offsets
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    if(A == nullptr || (A->format != HIPSPARSE_FORMAT_CSR && A->format != HIPSPARSE_FORMAT_CSC)
+       || batchCount <= 0 || offsetsBatchStride < 0 || columnsValuesBatchStride < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    A->batch_count                 = batchCount;
+    A->offsets_batch_stride        = offsetsBatchStride;
+    A->columns_values_batch_stride = columnsValuesBatchStride;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDescr,
+                                             hipsparseSpMatAttribute_t  attribute,
+                                             void*                      data,
+                                             size_t                     dataSize)
+{
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)spMatDescr;
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+        if(dataSize != sizeof(hipsparseFillMode_t))
+        {
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+        *(hipsparseFillMode_t*)data = A->fill_mode;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+        if(dataSize != sizeof(hipsparseDiagType_t))
+        {
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+        *(hipsparseDiagType_t*)data = A->diag_type;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+    return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+}
+
+hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDescr,
+                                             hipsparseSpMatAttribute_t attribute,
+                                             const void*               data,
+                                             size_t                    dataSize)
+{
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)spMatDescr;
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+        if(dataSize != sizeof(hipsparseFillMode_t))
+        {
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+        A->fill_mode = *(const hipsparseFillMode_t*)data;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+        if(dataSize != sizeof(hipsparseDiagType_t))
+        {
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+        A->diag_type = *(const hipsparseDiagType_t*)data;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+    return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+}
+
+hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
+                                       int64_t                size,
+                                       void*                  values,
+                                       hipDataType            valueType)
+{
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    if(dnVecDescr == nullptr || size < 0 || (size > 0 && values == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::hostDnVec* x = new hipsparse::hostDnVec;
+    x->size                 = size;
+    x->values               = values;
+    x->data_type            = valueType;
+
+    *dnVecDescr = x;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDescr,
+                                            int64_t                     size,
+                                            const void*                 values,
+                                            hipDataType                 valueType)
+{
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    if(dnVecDescr == nullptr || size < 0 || (size > 0 && values == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::hostDnVec* x = new hipsparse::hostDnVec;
+    x->size                 = size;
+    x->values               = const_cast<void*>(values);
+    x->data_type            = valueType;
+
+    *dnVecDescr = x;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroyDnVec(hipsparseConstDnVecDescr_t dnVecDescr)
+{
+    HIPSPARSE_TRACE(dnVecDescr);
+
+    if(dnVecDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    delete(const hipsparse::hostDnVec*)dnVecDescr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
+                                    int64_t*                    size,
+                                    void**                      values,
+                                    hipDataType*                valueType)
+{
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    if(dnVecDescr == nullptr || size == nullptr || values == nullptr || valueType == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnVec* x = (const hipsparse::hostDnVec*)dnVecDescr;
+
+    *size      = x->size;
+    *values    = x->values;
+    *valueType = x->data_type;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
+                                         int64_t*                   size,
+                                         const void**               values,
+                                         hipDataType*               valueType)
+{
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    if(dnVecDescr == nullptr || size == nullptr || values == nullptr || valueType == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnVec* x = (const hipsparse::hostDnVec*)dnVecDescr;
+
+    *size      = x->size;
+    *values    = x->values;
+    *valueType = x->data_type;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
+{
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostDnVec*)dnVecDescr)->values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseConstDnVecGetValues(hipsparseConstDnVecDescr_t dnVecDescr,
+                                               const void**               values)
+{
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostDnVec*)dnVecDescr)->values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
+{
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    if(dnVecDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostDnVec*)dnVecDescr)->values = values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
+                                       int64_t                rows,
+                                       int64_t                cols,
+                                       int64_t                ld,
+                                       void*                  values,
+                                       hipDataType            valueType,
+                                       hipsparseOrder_t       order)
+{
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::createDnMat(dnMatDescr, rows, cols, ld, values, valueType, order));
+}
+
+hipsparseStatus_t hipsparseCreateConstDnMat(hipsparseConstDnMatDescr_t* dnMatDescr,
+                                            int64_t                     rows,
+                                            int64_t                     cols,
+                                            int64_t                     ld,
+                                            const void*                 values,
+                                            hipDataType                 valueType,
+                                            hipsparseOrder_t            order)
+{
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::createDnMat(
+        (hipsparseDnMatDescr_t*)dnMatDescr, rows, cols, ld, values, valueType, order));
+}
+
+hipsparseStatus_t hipsparseDestroyDnMat(hipsparseConstDnMatDescr_t dnMatDescr)
+{
+    HIPSPARSE_TRACE(dnMatDescr);
+
+    if(dnMatDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    delete(const hipsparse::hostDnMat*)dnMatDescr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
+                                    int64_t*                    rows,
+                                    int64_t*                    cols,
+                                    int64_t*                    ld,
+                                    void**                      values,
+                                    hipDataType*                valueType,
+                                    hipsparseOrder_t*           order)
+{
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::dnMatGet(
+        (const hipsparse::hostDnMat*)dnMatDescr, rows, cols, ld, values, valueType, order));
+}
+
+hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
+                                         int64_t*                   rows,
+                                         int64_t*                   cols,
+                                         int64_t*                   ld,
+                                         const void**               values,
+                                         hipDataType*               valueType,
+                                         hipsparseOrder_t*          order)
+{
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::dnMatGet(
+        (const hipsparse::hostDnMat*)dnMatDescr, rows, cols, ld, values, valueType, order));
+}
+
+hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
+{
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostDnMat*)dnMatDescr)->values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseConstDnMatGetValues(hipsparseConstDnMatDescr_t dnMatDescr,
+                                               const void**               values)
+{
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *values = ((const hipsparse::hostDnMat*)dnMatDescr)->values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
+{
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    if(dnMatDescr == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    ((hipsparse::hostDnMat*)dnMatDescr)->values = values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseConstDnMatDescr_t dnMatDescr,
+                                                int*                       batchCount,
+                                                int64_t*                   batchStride)
+{
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    if(dnMatDescr == nullptr || batchCount == nullptr || batchStride == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnMat* A = (const hipsparse::hostDnMat*)dnMatDescr;
+
+    *batchCount  = A->batch_count;
+    *batchStride = A->batch_stride;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride)
+{
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    if(dnMatDescr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::hostDnMat* A = (hipsparse::hostDnMat*)dnMatDescr;
+
+    A->batch_count  = batchCount;
+    A->batch_stride = batchStride;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+namespace hipsparse
+{
+    template <typename F>
+    hipsparseStatus_t dispatchSpVec(const hostSpVec* x, F f)
+    {
+        return dispatchData(x->data_type, [&](auto t) {
+            return dispatchIndex(x->idx_type, [&](auto i) { return f(t, i); });
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
+                                 const void*                alpha,
+                                 hipsparseConstSpVecDescr_t vecX,
+                                 const void*                beta,
+                                 hipsparseDnVecDescr_t      vecY)
+{
+    HIPSPARSE_TRACE(handle, alpha, vecX, beta, vecY);
+
+    if(handle == nullptr || alpha == nullptr || vecX == nullptr || beta == nullptr
+       || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpVec* x = (const hipsparse::hostSpVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    if(x->size != y->size)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(x->data_type != y->data_type)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::dispatchSpVec(x, [&](auto t, auto i) {
+        typedef typename decltype(t)::type T;
+        typedef typename decltype(i)::type I;
+
+        hipsparse::host::axpby(x->nnz,
+                               hipsparse::scalar<T>(alpha),
+                               static_cast<const I*>(x->idx),
+                               static_cast<const T*>(x->val),
+                               x->base,
+                               hipsparse::scalar<T>(beta),
+                               y->size,
+                               static_cast<T*>(y->values));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }));
+}
+
+hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
+                                  hipsparseConstDnVecDescr_t vecY,
+                                  hipsparseSpVecDescr_t      vecX)
+{
+    HIPSPARSE_TRACE(handle, vecY, vecX);
+
+    if(handle == nullptr || vecY == nullptr || vecX == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+    const hipsparse::hostSpVec* x = (const hipsparse::hostSpVec*)vecX;
+
+    if(x->data_type != y->data_type)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::dispatchSpVec(x, [&](auto t, auto i) {
+        typedef typename decltype(t)::type T;
+        typedef typename decltype(i)::type I;
+
+        hipsparse::host::gather(x->nnz,
+                                static_cast<const T*>(y->values),
+                                static_cast<const I*>(x->idx),
+                                static_cast<T*>(x->val),
+                                x->base);
+        return HIPSPARSE_STATUS_SUCCESS;
+    }));
+}
+
+hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
+                                   hipsparseConstSpVecDescr_t vecX,
+                                   hipsparseDnVecDescr_t      vecY)
+{
+    HIPSPARSE_TRACE(handle, vecX, vecY);
+
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpVec* x = (const hipsparse::hostSpVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    if(x->data_type != y->data_type)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::dispatchSpVec(x, [&](auto t, auto i) {
+        typedef typename decltype(t)::type T;
+        typedef typename decltype(i)::type I;
+
+        hipsparse::host::scatter(x->nnz,
+                                 static_cast<const I*>(x->idx),
+                                 static_cast<const T*>(x->val),
+                                 x->base,
+                                 static_cast<T*>(y->values));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }));
+}
+
+hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
+                               const void*           c_coeff,
+                               const void*           s_coeff,
+                               hipsparseSpVecDescr_t vecX,
+                               hipsparseDnVecDescr_t vecY)
+{
+    HIPSPARSE_TRACE(handle, c_coeff, s_coeff, vecX, vecY);
+
+    if(handle == nullptr || c_coeff == nullptr || s_coeff == nullptr || vecX == nullptr
+       || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpVec* x = (const hipsparse::hostSpVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    if(x->data_type != y->data_type)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::dispatchSpVec(x, [&](auto t, auto i) {
+        typedef typename decltype(t)::type T;
+        typedef typename decltype(i)::type I;
+
+        hipsparse::host::rot(x->nnz,
+                             hipsparse::scalar<T>(c_coeff),
+                             hipsparse::scalar<T>(s_coeff),
+                             static_cast<const I*>(x->idx),
+                             static_cast<T*>(x->val),
+                             x->base,
+                             static_cast<T*>(y->values));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }));
+}
+
+hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
+                                           hipsparseOperation_t       opX,
+                                           hipsparseConstSpVecDescr_t vecX,
+                                           hipsparseConstDnVecDescr_t vecY,
+                                           void*                      result,
+                                           hipDataType                computeType,
+                                           size_t*                    pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, pBufferSizeInBytes);
+
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
+                                hipsparseOperation_t       opX,
+                                hipsparseConstSpVecDescr_t vecX,
+                                hipsparseConstDnVecDescr_t vecY,
+                                void*                      result,
+                                hipDataType                computeType,
+                                void*                      externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
+    if(handle == nullptr || vecX == nullptr || vecY == nullptr || result == nullptr
+       || externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(opX != HIPSPARSE_OPERATION_NON_TRANSPOSE && opX != HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpVec* x = (const hipsparse::hostSpVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    if(x->data_type != y->data_type || x->data_type != computeType)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    }
+
+    return trace(hipsparse::dispatchSpVec(x, [&](auto t, auto i) {
+        typedef typename decltype(t)::type T;
+        typedef typename decltype(i)::type I;
+
+        *static_cast<T*>(result) = hipsparse::host::doti(x->nnz,
+                                                         static_cast<const I*>(x->idx),
+                                                         static_cast<const T*>(x->val),
+                                                         x->base,
+                                                         opX != HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                         static_cast<const T*>(y->values));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }));
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSpMV(hipsparseOperation_t op,
+                                const hostSpMat*     A,
+                                const hostDnVec*     x,
+                                const hostDnVec*     y,
+                                hipDataType          compute_type)
+    {
+        const bool trans = op != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        if(x->size != (trans ? A->rows : A->cols) || y->size != (trans ? A->cols : A->rows))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(x->data_type != A->data_type || !productTypes(A->data_type, y->data_type, compute_type))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return A->format == HIPSPARSE_FORMAT_BLOCKED_ELL ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                                         : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Mixed precision y = alpha * op(A) * x + beta * y, see dispatchMixed.
+    //
+    hipsparseStatus_t spmvMixed(hipsparseOperation_t op,
+                                const void*          alpha,
+                                const hostSpMat*     A,
+                                const hostDnVec*     x,
+                                const void*          beta,
+                                const hostDnVec*     y,
+                                hipDataType          compute_type)
+    {
+        return dispatchMixed(A->data_type, y->data_type, compute_type, [&](auto t, auto u, auto c) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(u)::type Y;
+            typedef typename decltype(c)::type C;
+
+            return dispatchSpMatIndex(A, [&](auto i, auto j) {
+                typedef typename decltype(i)::type I;
+                typedef typename decltype(j)::type J;
+
+                host::csrMatrix<T, I, J> opA;
+                csrView(A, op != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opA);
+
+                host::csrmvMixed(opA,
+                                 scalar<C>(alpha),
+                                 static_cast<const T*>(x->values),
+                                 scalar<C>(beta),
+                                 static_cast<Y*>(y->values));
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        });
+    }
+
+    //
+    // y = alpha * op(A) * x + beta * y, a transposed matrix is converted, except in CSC format.
+    //
+    hipsparseStatus_t spmv(hipsparseOperation_t op,
+                           const void*          alpha,
+                           const hostSpMat*     A,
+                           const hostDnVec*     x,
+                           const void*          beta,
+                           const hostDnVec*     y,
+                           hipDataType          compute_type)
+    {
+        if(A->data_type != compute_type)
+        {
+            return spmvMixed(op, alpha, A, x, beta, y, compute_type);
+        }
+
+        return dispatchSpMat(A, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            host::csrMatrix<T, I, J> opA;
+            csrView(A, op != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opA);
+
+            host::csrmv(opA,
+                        op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                        scalar<T>(alpha),
+                        static_cast<const T*>(x->values),
+                        scalar<T>(beta),
+                        static_cast<T*>(y->values));
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMV(opA,
+                                                   (const hipsparse::hostSpMat*)matA,
+                                                   (const hipsparse::hostDnVec*)vecX,
+                                                   (const hipsparse::hostDnVec*)vecY,
+                                                   computeType));
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMVAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::checkSpMV(opA,
+                                      (const hipsparse::hostSpMat*)matA,
+                                      (const hipsparse::hostDnVec*)vecX,
+                                      (const hipsparse::hostDnVec*)vecY,
+                                      computeType));
+}
+
+hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                const void*                 alpha,
+                                hipsparseConstSpMatDescr_t  matA,
+                                hipsparseConstDnVecDescr_t  vecX,
+                                const void*                 beta,
+                                const hipsparseDnVecDescr_t vecY,
+                                hipDataType                 computeType,
+                                hipsparseSpMVAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostDnVec* x = (const hipsparse::hostDnVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMV(opA, A, x, y, computeType));
+
+    return trace(hipsparse::spmv(opA, alpha, A, x, beta, y, computeType));
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSpMVGrouped(hipsparseHandle_t                 handle,
+                                       hipsparseOperation_t              op,
+                                       int                               group_count,
+                                       const void*                       alpha,
+                                       const hipsparseConstSpMatDescr_t* A,
+                                       const hipsparseConstDnVecDescr_t* x,
+                                       const void*                       beta,
+                                       const hipsparseDnVecDescr_t*      y,
+                                       hipDataType                       compute_type)
+    {
+        if(handle == nullptr || group_count < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(group_count > 0
+           && (alpha == nullptr || A == nullptr || x == nullptr || beta == nullptr
+               || y == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        for(int i = 0; i < group_count; ++i)
+        {
+            if(A[i] == nullptr || x[i] == nullptr || y[i] == nullptr)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            hipsparseStatus_t status = checkSpMV(op,
+                                                 (const hostSpMat*)A[i],
+                                                 (const hostDnVec*)x[i],
+                                                 (const hostDnVec*)y[i],
+                                                 compute_type);
+            if(status != HIPSPARSE_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_bufferSize(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  size_t* pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    if(pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMVGrouped(
+        handle, opA, groupCount, alpha, matA, vecX, beta, vecY, computeType));
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_preprocess(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::checkSpMVGrouped(
+        handle, opA, groupCount, alpha, matA, vecX, beta, vecY, computeType));
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped(hipsparseHandle_t                 handle,
+                                       hipsparseOperation_t              opA,
+                                       int                               groupCount,
+                                       const void*                       alpha,
+                                       const hipsparseConstSpMatDescr_t* matA,
+                                       const hipsparseConstDnVecDescr_t* vecX,
+                                       const void*                       beta,
+                                       const hipsparseDnVecDescr_t*      vecY,
+                                       hipDataType                       computeType,
+                                       hipsparseSpMVAlg_t                alg,
+                                       void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMVGrouped(
+        handle, opA, groupCount, alpha, matA, vecX, beta, vecY, computeType));
+
+    // The matrices of a group are small, they are distributed over the threads rather than
+    // their rows. The kernels do not start a nested parallel region below their threshold.
+    std::vector<hipsparseStatus_t> status(groupCount, HIPSPARSE_STATUS_SUCCESS);
+
+#pragma omp parallel for schedule(dynamic) if(groupCount > 1)
+    for(int i = 0; i < groupCount; ++i)
+    {
+        status[i] = hipsparse::spmv(opA,
+                                    alpha,
+                                    (const hipsparse::hostSpMat*)matA[i],
+                                    (const hipsparse::hostDnVec*)vecX[i],
+                                    beta,
+                                    (const hipsparse::hostDnVec*)vecY[i],
+                                    computeType);
+    }
+
+    for(int i = 0; i < groupCount; ++i)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(status[i]);
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+struct hipsparseSpMVPlan
+{
+    hipsparseOperation_t  op;
+    hipsparse::hostSpMat* mat;
+    hipDataType           compute_type;
+
+    // op(A) is a view of A, see hipsparse::csrView, otherwise its structure is built once.
+    // Entries of op(A), 0 based CSR, the value of entry k is the value perm[k] of A.
+    bool                 direct;
+    std::vector<int64_t> ptr;
+    std::vector<int64_t> ind;
+    std::vector<int64_t> perm;
+};
+
+namespace hipsparse
+{
+    //
+    // Structure of op(A) for the formats and operations converted by csrView.
+    //
+    hipsparseStatus_t spmvPlanAnalysis(hipsparseSpMVPlan* plan)
+    {
+        const hostSpMat* A     = plan->mat;
+        const bool       trans = plan->op != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+        plan->direct = (A->format == HIPSPARSE_FORMAT_CSR && !trans)
+                       || (A->format == HIPSPARSE_FORMAT_CSC && trans);
+        if(plan->direct)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        std::vector<int64_t> row;
+        std::vector<int64_t> col;
+
+        hipsparseStatus_t status = dispatchIndex(offsetsType(A), [&](auto i) {
+            return dispatchIndex(indicesType(A), [&](auto j) {
+                typedef typename decltype(i)::type I;
+                typedef typename decltype(j)::type J;
+
+                spMatEntries<I, J>(A, row, col);
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        });
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        host::sortByRow(
+            trans ? A->cols : A->rows,
+            A->nnz,
+            [&](int64_t k) { return trans ? col[k] : row[k]; },
+            [&](int64_t k) { return trans ? row[k] : col[k]; },
+            plan->ptr,
+            plan->ind,
+            plan->perm);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // op(A) with the structure of the plan and the current values of A.
+    //
+    template <typename T>
+    void spmvPlanMatrix(const hipsparseSpMVPlan* plan, host::csrMatrix<T, int64_t, int64_t>& B)
+    {
+        const hostSpMat* A     = plan->mat;
+        const bool       trans = plan->op != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        const T*         val   = static_cast<const T*>(A->val_data);
+
+        B.m    = trans ? A->cols : A->rows;
+        B.n    = trans ? A->rows : A->cols;
+        B.nnz  = A->nnz;
+        B.base = 0;
+        B.ptr  = plan->ptr.data();
+        B.ind  = plan->ind.data();
+
+        B.val_storage.resize(A->nnz);
+
+#pragma omp parallel for schedule(static) if(A->nnz > host::min_parallel_size)
+        for(int64_t k = 0; k < A->nnz; ++k)
+        {
+            B.val_storage[k] = val[plan->perm[k]];
+        }
+        B.val = B.val_storage.data();
+    }
+
+    hipsparseStatus_t spmvPlanExecute(const hipsparseSpMVPlan* plan,
+                                      const void*              alpha,
+                                      const hostDnVec*         x,
+                                      const void*              beta,
+                                      const hostDnVec*         y)
+    {
+        const hostSpMat* A = plan->mat;
+        if(plan->direct)
+        {
+            return spmv(plan->op, alpha, A, x, beta, y, plan->compute_type);
+        }
+
+        if(A->data_type != plan->compute_type)
+        {
+            return dispatchMixed(
+                A->data_type, y->data_type, plan->compute_type, [&](auto t, auto u, auto c) {
+                    typedef typename decltype(t)::type T;
+                    typedef typename decltype(u)::type Y;
+                    typedef typename decltype(c)::type C;
+
+                    host::csrMatrix<T, int64_t, int64_t> opA;
+                    spmvPlanMatrix(plan, opA);
+
+                    host::csrmvMixed(opA,
+                                     scalar<C>(alpha),
+                                     static_cast<const T*>(x->values),
+                                     scalar<C>(beta),
+                                     static_cast<Y*>(y->values));
+                    return HIPSPARSE_STATUS_SUCCESS;
+                });
+        }
+
+        return dispatchData(A->data_type, [&](auto t) {
+            typedef typename decltype(t)::type T;
+
+            host::csrMatrix<T, int64_t, int64_t> opA;
+            spmvPlanMatrix(plan, opA);
+
+            host::csrmv(opA,
+                        plan->op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                        scalar<T>(alpha),
+                        static_cast<const T*>(x->values),
+                        scalar<T>(beta),
+                        static_cast<T*>(y->values));
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseCreateSpMVPlan(hipsparseSpMVPlan_t*        plan,
+                                          hipsparseHandle_t           handle,
+                                          hipsparseOperation_t        opA,
+                                          const void*                 alpha,
+                                          hipsparseSpMatDescr_t       matA,
+                                          hipsparseConstDnVecDescr_t  vecX,
+                                          const void*                 beta,
+                                          const hipsparseDnVecDescr_t vecY,
+                                          hipDataType                 computeType,
+                                          hipsparseSpMVAlg_t          alg)
+{
+    HIPSPARSE_TRACE(plan, handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg);
+
+    if(plan == nullptr || handle == nullptr || alpha == nullptr || matA == nullptr
+       || vecX == nullptr || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparse::hostSpMat* A = (hipsparse::hostSpMat*)matA;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMV(opA,
+                                                   A,
+                                                   (const hipsparse::hostDnVec*)vecX,
+                                                   (const hipsparse::hostDnVec*)vecY,
+                                                   computeType));
+
+    hipsparseSpMVPlan* p = new hipsparseSpMVPlan;
+    p->op                = opA;
+    p->mat               = A;
+    p->compute_type      = computeType;
+
+    hipsparseStatus_t status = hipsparse::spmvPlanAnalysis(p);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        delete p;
+        return trace(status);
+    }
+
+    *plan = p;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroySpMVPlan(hipsparseSpMVPlan_t plan)
+{
+    HIPSPARSE_TRACE(plan);
+
+    if(plan == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    delete plan;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t
+    hipsparseSpMVPlanUpdateValues(hipsparseHandle_t handle, hipsparseSpMVPlan_t plan, void* values)
+{
+    HIPSPARSE_TRACE(handle, plan, values);
+
+    if(handle == nullptr || plan == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The structure of the plan stays valid, the values are read by each execution
+    plan->mat->val_data = values;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMVPlanExecute(hipsparseHandle_t           handle,
+                                           hipsparseSpMVPlan_t         plan,
+                                           const void*                 alpha,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY)
+{
+    HIPSPARSE_TRACE(handle, plan, alpha, vecX, beta, vecY);
+
+    if(handle == nullptr || plan == nullptr || alpha == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnVec* x = (const hipsparse::hostDnVec*)vecX;
+    const hipsparse::hostDnVec* y = (const hipsparse::hostDnVec*)vecY;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMV(plan->op, plan->mat, x, y, plan->compute_type));
+
+    return trace(hipsparse::spmvPlanExecute(plan, alpha, x, beta, y));
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSpMM(hipsparseOperation_t op_A,
+                                hipsparseOperation_t op_B,
+                                const hostSpMat*     A,
+                                const hostDnMat*     B,
+                                const hostDnMat*     C,
+                                hipDataType          compute_type)
+    {
+        const bool    trans_A = op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        const bool    trans_B = op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        const int64_t m       = trans_A ? A->cols : A->rows;
+        const int64_t k       = trans_A ? A->rows : A->cols;
+
+        if((trans_B ? B->cols : B->rows) != k || (trans_B ? B->rows : B->cols) != C->cols
+           || C->rows != m)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The batches of A and B are either shared or one per batch of C
+        if((A->batch_count != 1 && A->batch_count != C->batch_count)
+           || (B->batch_count != 1 && B->batch_count != C->batch_count))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(B->data_type != A->data_type || !productTypes(A->data_type, C->data_type, compute_type))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return A->format == HIPSPARSE_FORMAT_BLOCKED_ELL ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                                         : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Mixed precision C = alpha * op(A) * op(B) + beta * C, see dispatchMixed.
+    //
+    hipsparseStatus_t spmmMixed(hipsparseOperation_t op_A,
+                                hipsparseOperation_t op_B,
+                                const void*          alpha,
+                                const hostSpMat*     A,
+                                const hostDnMat*     B,
+                                const void*          beta,
+                                const hostDnMat*     C,
+                                hipDataType          compute_type)
+    {
+        return dispatchMixed(A->data_type, C->data_type, compute_type, [&](auto t, auto y, auto u) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(y)::type Y;
+            typedef typename decltype(u)::type U;
+
+            return dispatchSpMatIndex(A, [&](auto i, auto j) {
+                typedef typename decltype(i)::type I;
+                typedef typename decltype(j)::type J;
+
+                const bool trans_A = op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+                const bool trans_B = op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+                host::csrMatrix<T, I, J> opA;
+                for(int b = 0; b < C->batch_count; ++b)
+                {
+                    if(b == 0 || A->batch_count > 1)
+                    {
+                        csrView(A, trans_A, b, opA);
+                    }
+
+                    host::csrmmMixed(opA,
+                                     scalar<U>(alpha),
+                                     denseView<const T>(B, trans_B, B->batch_count > 1 ? b : 0),
+                                     scalar<U>(beta),
+                                     denseView<Y>(C, false, b));
+                }
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        });
+    }
+
+    //
+    // C = alpha * op(A) * op(B) + beta * C for each batch of C.
+    //
+    hipsparseStatus_t spmm(hipsparseOperation_t op_A,
+                           hipsparseOperation_t op_B,
+                           const void*          alpha,
+                           const hostSpMat*     A,
+                           const hostDnMat*     B,
+                           const void*          beta,
+                           const hostDnMat*     C,
+                           hipDataType          compute_type)
+    {
+        if(A->data_type != compute_type)
+        {
+            return spmmMixed(op_A, op_B, alpha, A, B, beta, C, compute_type);
+        }
+
+        return dispatchSpMat(A, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            const bool trans_A = op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+            const bool trans_B = op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+            // A shared matrix is converted once
+            host::csrMatrix<T, I, J> opA;
+            for(int b = 0; b < C->batch_count; ++b)
+            {
+                if(b == 0 || A->batch_count > 1)
+                {
+                    csrView(A, trans_A, b, opA);
+                }
+
+                host::csrmm(opA,
+                            op_A == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                            scalar<T>(alpha),
+                            denseView<const T>(B, trans_B, B->batch_count > 1 ? b : 0),
+                            op_B == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                            scalar<T>(beta),
+                            denseView<T>(C, false, b));
+            }
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnMatDescr_t  matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMM(opA,
+                                                   opB,
+                                                   (const hipsparse::hostSpMat*)matA,
+                                                   (const hipsparse::hostDnMat*)matB,
+                                                   (const hipsparse::hostDnMat*)matC,
+                                                   computeType));
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           hipsparseOperation_t        opB,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnMatDescr_t  matB,
+                                           const void*                 beta,
+                                           const hipsparseDnMatDescr_t matC,
+                                           hipDataType                 computeType,
+                                           hipsparseSpMMAlg_t          alg,
+                                           void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, externalBuffer);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::checkSpMM(opA,
+                                      opB,
+                                      (const hipsparse::hostSpMat*)matA,
+                                      (const hipsparse::hostDnMat*)matB,
+                                      (const hipsparse::hostDnMat*)matC,
+                                      computeType));
+}
+
+hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
+                                hipsparseOperation_t        opA,
+                                hipsparseOperation_t        opB,
+                                const void*                 alpha,
+                                hipsparseConstSpMatDescr_t  matA,
+                                hipsparseConstDnMatDescr_t  matB,
+                                const void*                 beta,
+                                const hipsparseDnMatDescr_t matC,
+                                hipDataType                 computeType,
+                                hipsparseSpMMAlg_t          alg,
+                                void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, externalBuffer);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || matB == nullptr
+       || beta == nullptr || matC == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostDnMat* B = (const hipsparse::hostDnMat*)matB;
+    const hipsparse::hostDnMat* C = (const hipsparse::hostDnMat*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpMM(opA, opB, A, B, C, computeType));
+
+    return trace(hipsparse::spmm(opA, opB, alpha, A, B, beta, C, computeType));
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSparseDense(const hostSpMat* A, const hostDnMat* B)
+    {
+        if(A->rows != B->rows || A->cols != B->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->data_type != B->data_type || A->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // B = A, a CSC matrix is written through the transpose of B.
+    //
+    hipsparseStatus_t sparseToDense(const hostSpMat* A, const hostDnMat* B)
+    {
+        return dispatchSpMat(A, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            const bool trans = A->format == HIPSPARSE_FORMAT_CSC;
+
+            host::csrMatrix<T, I, J> V;
+            csrView(A, trans, 0, V);
+            host::csrToDense(V, denseView<T>(B, trans, 0));
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+
+    //
+    // The structure of B, the offsets of a CSR or CSC matrix are stored in B, those of a COO
+    // matrix in the buffer.
+    //
+    hipsparseStatus_t denseToSparseAnalysis(const hostDnMat* A, hostSpMat* B, void* buffer)
+    {
+        return dispatchSpMat(B, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+
+            switch(B->format)
+            {
+            case HIPSPARSE_FORMAT_CSR:
+            case HIPSPARSE_FORMAT_CSC:
+            {
+                const bool csr = B->format == HIPSPARSE_FORMAT_CSR;
+                I*         ptr = static_cast<I*>(csr ? B->row_data : B->col_data);
+
+                host::denseRowPtr(denseView<const T>(A, !csr, 0), ptr, B->base);
+                B->nnz = ptr[csr ? B->rows : B->cols] - B->base;
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            case HIPSPARSE_FORMAT_COO:
+            {
+                int64_t* ptr = static_cast<int64_t*>(buffer);
+
+                host::denseRowPtr(denseView<const T>(A, false, 0), ptr, 0);
+                B->nnz = ptr[B->rows];
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            default:
+                return HIPSPARSE_STATUS_NOT_SUPPORTED;
+            }
+        });
+    }
+
+    hipsparseStatus_t denseToSparseConvert(const hostDnMat* A, hostSpMat* B, const void* buffer)
+    {
+        return dispatchSpMat(B, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            switch(B->format)
+            {
+            case HIPSPARSE_FORMAT_CSR:
+            case HIPSPARSE_FORMAT_CSC:
+            {
+                const bool csr = B->format == HIPSPARSE_FORMAT_CSR;
+
+                host::denseToSparse(denseView<const T>(A, !csr, 0),
+                                    static_cast<const I*>(csr ? B->row_data : B->col_data),
+                                    B->base,
+                                    static_cast<J*>(nullptr),
+                                    static_cast<J*>(csr ? B->col_data : B->row_data),
+                                    static_cast<T*>(B->val_data),
+                                    B->base);
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            case HIPSPARSE_FORMAT_COO:
+            {
+                host::denseToSparse(denseView<const T>(A, false, 0),
+                                    static_cast<const int64_t*>(buffer),
+                                    0,
+                                    static_cast<J*>(B->row_data),
+                                    static_cast<J*>(B->col_data),
+                                    static_cast<T*>(B->val_data),
+                                    B->base);
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            default:
+                return HIPSPARSE_STATUS_NOT_SUPPORTED;
+            }
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseConstSpMatDescr_t  matA,
+                                                    hipsparseDnMatDescr_t       matB,
+                                                    hipsparseSparseToDenseAlg_t alg,
+                                                    size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
+                                         hipsparseConstSpMatDescr_t  matA,
+                                         hipsparseDnMatDescr_t       matB,
+                                         hipsparseSparseToDenseAlg_t alg,
+                                         void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostDnMat* B = (const hipsparse::hostDnMat*)matB;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSparseDense(A, B));
+
+    return trace(hipsparse::sparseToDense(A, B));
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t           handle,
+                                                    hipsparseConstDnMatDescr_t  matA,
+                                                    hipsparseSpMatDescr_t       matB,
+                                                    hipsparseDenseToSparseAlg_t alg,
+                                                    size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The row offsets of a COO matrix are kept in the buffer between analysis and conversion
+    const hipsparse::hostSpMat* B = (const hipsparse::hostSpMat*)matB;
+    *pBufferSizeInBytes           = B->format == HIPSPARSE_FORMAT_COO
+                                        ? sizeof(int64_t) * (B->rows + 1)
+                                        : hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           handle,
+                                                  hipsparseConstDnMatDescr_t  matA,
+                                                  hipsparseSpMatDescr_t       matB,
+                                                  hipsparseDenseToSparseAlg_t alg,
+                                                  void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnMat* A = (const hipsparse::hostDnMat*)matA;
+    hipsparse::hostSpMat*       B = (hipsparse::hostSpMat*)matB;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSparseDense(B, A));
+
+    if(B->format != HIPSPARSE_FORMAT_COO
+       && (B->format == HIPSPARSE_FORMAT_CSR ? B->row_data : B->col_data) == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::denseToSparseAnalysis(A, B, externalBuffer));
+}
+
+hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           handle,
+                                                 hipsparseConstDnMatDescr_t  matA,
+                                                 hipsparseSpMatDescr_t       matB,
+                                                 hipsparseDenseToSparseAlg_t alg,
+                                                 void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostDnMat* A = (const hipsparse::hostDnMat*)matA;
+    hipsparse::hostSpMat*       B = (hipsparse::hostSpMat*)matB;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSparseDense(B, A));
+
+    if(B->nnz > 0 && (B->row_data == nullptr || B->col_data == nullptr || B->val_data == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::denseToSparseConvert(A, B, externalBuffer));
+}
+
+// The products are stored with the matrix C, see hipsparse::hostSpMat
+struct hipsparseSpGEMMDescr
+{
+};
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSpGEMM(hipsparseOperation_t op_A,
+                                  hipsparseOperation_t op_B,
+                                  const hostSpMat*     A,
+                                  const hostSpMat*     B,
+                                  const hostSpMat*     C,
+                                  hipDataType          compute_type)
+    {
+        const bool    trans_A = op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        const bool    trans_B = op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+        const int64_t k       = trans_A ? A->rows : A->cols;
+
+        if((trans_A ? A->cols : A->rows) != C->rows || (trans_B ? B->cols : B->rows) != k
+           || (trans_B ? B->rows : B->cols) != C->cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The conjugation is not applied to the products
+        if(op_A == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
+           || op_B == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(C->format != HIPSPARSE_FORMAT_CSR || A->data_type != C->data_type
+           || B->data_type != C->data_type || C->data_type != compute_type)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(offsetsType(A) != offsetsType(C) || indicesType(A) != indicesType(C)
+           || offsetsType(B) != offsetsType(C) || indicesType(B) != indicesType(C))
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return (A->format == HIPSPARSE_FORMAT_BLOCKED_ELL
+                || B->format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+                   ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                   : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Structure of C = op(A) * op(B), and the values of alpha * op(A) * op(B) if alpha is not
+    // nullptr. The result is kept in C until it is copied.
+    //
+    hipsparseStatus_t spgemm(hipsparseOperation_t op_A,
+                             hipsparseOperation_t op_B,
+                             const void*          alpha,
+                             const hostSpMat*     A,
+                             const hostSpMat*     B,
+                             hostSpMat*           C)
+    {
+        return dispatchSpMat(C, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            host::csrMatrix<T, I, J> opA;
+            host::csrMatrix<T, I, J> opB;
+            csrView(A, op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opA);
+            csrView(B, op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opB);
+
+            std::shared_ptr<std::vector<I>> ptr = std::make_shared<std::vector<I>>();
+            std::shared_ptr<std::vector<J>> ind = std::make_shared<std::vector<J>>();
+            host::csrgemmSymbolic(opA, opB, *ptr, *ind);
+
+            C->nnz        = static_cast<int64_t>(ind->size());
+            C->spgemm_ptr = ptr;
+            C->spgemm_ind = ind;
+            C->spgemm_val = nullptr;
+
+            if(alpha != nullptr)
+            {
+                std::shared_ptr<std::vector<T>> val = std::make_shared<std::vector<T>>(ind->size());
+                host::csrgemmNumeric(
+                    opA, opB, scalar<T>(alpha), T{}, ptr->data(), ind->data(), 0, val->data());
+                C->spgemm_val = val;
+            }
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+
+    //
+    // Copy the structure computed by spgemm to the arrays of C, and the values if beta is not
+    // nullptr, as the values of the product plus beta times the values of C.
+    //
+    hipsparseStatus_t spgemmCopy(hostSpMat* C, const void* beta)
+    {
+        if(C->spgemm_ptr == nullptr || (beta != nullptr && C->spgemm_val == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(C->row_data == nullptr
+           || (C->nnz > 0
+               && (C->col_data == nullptr || (beta != nullptr && C->val_data == nullptr))))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipsparseStatus_t status = dispatchSpMat(C, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            const std::vector<I>& ptr  = *static_cast<const std::vector<I>*>(C->spgemm_ptr.get());
+            const std::vector<J>& ind  = *static_cast<const std::vector<J>*>(C->spgemm_ind.get());
+            const int64_t         base = C->base;
+
+            I* ptr_C = static_cast<I*>(C->row_data);
+            J* ind_C = static_cast<J*>(C->col_data);
+            T* val_C = static_cast<T*>(C->val_data);
+
+            for(int64_t r = 0; r <= C->rows; ++r)
+            {
+                ptr_C[r] = static_cast<I>(ptr[r] + base);
+            }
+
+#pragma omp parallel for schedule(static) if(C->nnz > host::min_parallel_size)
+            for(int64_t k = 0; k < C->nnz; ++k)
+            {
+                ind_C[k] = static_cast<J>(ind[k] + base);
+            }
+
+            if(beta != nullptr)
+            {
+                const std::vector<T>& val
+                    = *static_cast<const std::vector<T>*>(C->spgemm_val.get());
+                const T    b   = scalar<T>(beta);
+                const bool b_0 = host::isZero(b);
+
+#pragma omp parallel for schedule(static) if(C->nnz > host::min_parallel_size)
+                for(int64_t k = 0; k < C->nnz; ++k)
+                {
+                    val_C[k] = b_0 ? val[k] : val[k] + host::multiply(b, val_C[k]);
+                }
+            }
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+
+        // The result is released once it is copied
+        if(status == HIPSPARSE_STATUS_SUCCESS && beta != nullptr)
+        {
+            C->spgemm_ptr = nullptr;
+            C->spgemm_ind = nullptr;
+            C->spgemm_val = nullptr;
+        }
+        return status;
+    }
+
+    //
+    // Values of C = alpha * op(A) * op(B) + beta * C in the structure of C.
+    //
+    hipsparseStatus_t spgemmNumeric(hipsparseOperation_t op_A,
+                                    hipsparseOperation_t op_B,
+                                    const void*          alpha,
+                                    const hostSpMat*     A,
+                                    const hostSpMat*     B,
+                                    const void*          beta,
+                                    const hostSpMat*     C)
+    {
+        if(C->row_data == nullptr
+           || (C->nnz > 0 && (C->col_data == nullptr || C->val_data == nullptr)))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return dispatchSpMat(C, [&](auto t, auto i, auto j) {
+            typedef typename decltype(t)::type T;
+            typedef typename decltype(i)::type I;
+            typedef typename decltype(j)::type J;
+
+            host::csrMatrix<T, I, J> opA;
+            host::csrMatrix<T, I, J> opB;
+            csrView(A, op_A != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opA);
+            csrView(B, op_B != HIPSPARSE_OPERATION_NON_TRANSPOSE, 0, opB);
+
+            host::csrgemmNumeric(opA,
+                                 opB,
+                                 scalar<T>(alpha),
+                                 scalar<T>(beta),
+                                 static_cast<const I*>(C->row_data),
+                                 static_cast<const J*>(C->col_data),
+                                 C->base,
+                                 static_cast<T*>(C->val_data));
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
+{
+    HIPSPARSE_TRACE(descr);
+
+    if(descr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *descr = new hipsparseSpGEMMDescr;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
+{
+    HIPSPARSE_TRACE(descr);
+
+    delete descr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          handle,
+                                                 hipsparseOperation_t       opA,
+                                                 hipsparseOperation_t       opB,
+                                                 const void*                alpha,
+                                                 hipsparseConstSpMatDescr_t matA,
+                                                 hipsparseConstSpMatDescr_t matB,
+                                                 const void*                beta,
+                                                 hipsparseSpMatDescr_t      matC,
+                                                 hipDataType                computeType,
+                                                 hipsparseSpGEMMAlg_t       alg,
+                                                 hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                 size_t*                    bufferSize1,
+                                                 void*                      externalBuffer1)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
+       || matB == nullptr || matC == nullptr || spgemmDescr == nullptr || bufferSize1 == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpGEMM(opA,
+                                                     opB,
+                                                     (const hipsparse::hostSpMat*)matA,
+                                                     (const hipsparse::hostSpMat*)matB,
+                                                     (const hipsparse::hostSpMat*)matC,
+                                                     computeType));
+
+    if(externalBuffer1 == nullptr)
+    {
+        *bufferSize1 = hipsparse::buffer_size;
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
+                                          hipsparseOperation_t       opA,
+                                          hipsparseOperation_t       opB,
+                                          const void*                alpha,
+                                          hipsparseConstSpMatDescr_t matA,
+                                          hipsparseConstSpMatDescr_t matB,
+                                          const void*                beta,
+                                          hipsparseSpMatDescr_t      matC,
+                                          hipDataType                computeType,
+                                          hipsparseSpGEMMAlg_t       alg,
+                                          hipsparseSpGEMMDescr_t     spgemmDescr,
+                                          size_t*                    bufferSize2,
+                                          void*                      externalBuffer2)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2);
+
+    if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
+       || matB == nullptr || matC == nullptr || spgemmDescr == nullptr || bufferSize2 == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostSpMat* B = (const hipsparse::hostSpMat*)matB;
+    hipsparse::hostSpMat*       C = (hipsparse::hostSpMat*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpGEMM(opA, opB, A, B, C, computeType));
+
+    if(externalBuffer2 == nullptr)
+    {
+        *bufferSize2 = hipsparse::buffer_size;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    return trace(hipsparse::spgemm(opA, opB, alpha, A, B, C));
+}
+
+hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
+                                       hipsparseOperation_t       opA,
+                                       hipsparseOperation_t       opB,
+                                       const void*                alpha,
+                                       hipsparseConstSpMatDescr_t matA,
+                                       hipsparseConstSpMatDescr_t matB,
+                                       const void*                beta,
+                                       hipsparseSpMatDescr_t      matC,
+                                       hipDataType                computeType,
+                                       hipsparseSpGEMMAlg_t       alg,
+                                       hipsparseSpGEMMDescr_t     spgemmDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
+       || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spgemmCopy((hipsparse::hostSpMat*)matC, beta));
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t          handle,
+                                                      hipsparseOperation_t       opA,
+                                                      hipsparseOperation_t       opB,
+                                                      hipsparseConstSpMatDescr_t matA,
+                                                      hipsparseConstSpMatDescr_t matB,
+                                                      hipsparseSpMatDescr_t      matC,
+                                                      hipsparseSpGEMMAlg_t       alg,
+                                                      hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                      size_t*                    bufferSize1,
+                                                      void*                      externalBuffer1)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, opB, matA, matB, matC, alg, spgemmDescr, bufferSize1, externalBuffer1);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize1 == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* C = (const hipsparse::hostSpMat*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpGEMM(opA,
+                                                     opB,
+                                                     (const hipsparse::hostSpMat*)matA,
+                                                     (const hipsparse::hostSpMat*)matB,
+                                                     C,
+                                                     C->data_type));
+
+    if(externalBuffer1 == nullptr)
+    {
+        *bufferSize1 = hipsparse::buffer_size;
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
+                                           hipsparseOperation_t       opA,
+                                           hipsparseOperation_t       opB,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipsparseConstSpMatDescr_t matB,
+                                           hipsparseSpMatDescr_t      matC,
+                                           hipsparseSpGEMMAlg_t       alg,
+                                           hipsparseSpGEMMDescr_t     spgemmDescr,
+                                           size_t*                    bufferSize2,
+                                           void*                      externalBuffer2,
+                                           size_t*                    bufferSize3,
+                                           void*                      externalBuffer3,
+                                           size_t*                    bufferSize4,
+                                           void*                      externalBuffer4)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2,
+                    bufferSize3,
+                    externalBuffer3,
+                    bufferSize4,
+                    externalBuffer4);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
+       || bufferSize4 == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostSpMat* B = (const hipsparse::hostSpMat*)matB;
+    hipsparse::hostSpMat*       C = (hipsparse::hostSpMat*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpGEMM(opA, opB, A, B, C, C->data_type));
+
+    if(externalBuffer2 == nullptr || externalBuffer3 == nullptr || externalBuffer4 == nullptr)
+    {
+        *bufferSize2 = hipsparse::buffer_size;
+        *bufferSize3 = hipsparse::buffer_size;
+        *bufferSize4 = hipsparse::buffer_size;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    return trace(hipsparse::spgemm(opA, opB, nullptr, A, B, C));
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
+                                            hipsparseOperation_t       opA,
+                                            hipsparseOperation_t       opB,
+                                            hipsparseConstSpMatDescr_t matA,
+                                            hipsparseConstSpMatDescr_t matB,
+                                            hipsparseSpMatDescr_t      matC,
+                                            hipsparseSpGEMMAlg_t       alg,
+                                            hipsparseSpGEMMDescr_t     spgemmDescr,
+                                            size_t*                    bufferSize5,
+                                            void*                      externalBuffer5)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, opB, matA, matB, matC, alg, spgemmDescr, bufferSize5, externalBuffer5);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
+       || spgemmDescr == nullptr || bufferSize5 == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(externalBuffer5 == nullptr)
+    {
+        *bufferSize5 = hipsparse::buffer_size;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    return trace(hipsparse::spgemmCopy((hipsparse::hostSpMat*)matC, nullptr));
+}
+
+hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle,
+                                               hipsparseOperation_t       opA,
+                                               hipsparseOperation_t       opB,
+                                               const void*                alpha,
+                                               hipsparseConstSpMatDescr_t matA,
+                                               hipsparseConstSpMatDescr_t matB,
+                                               const void*                beta,
+                                               hipsparseSpMatDescr_t      matC,
+                                               hipDataType                computeType,
+                                               hipsparseSpGEMMAlg_t       alg,
+                                               hipsparseSpGEMMDescr_t     spgemmDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
+       || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostSpMat* B = (const hipsparse::hostSpMat*)matB;
+    hipsparse::hostSpMat*       C = (hipsparse::hostSpMat*)matC;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpGEMM(opA, opB, A, B, C, computeType));
+
+    // The structure copied by hipsparseSpGEMMreuse_copy() is not needed anymore
+    C->spgemm_ptr = nullptr;
+    C->spgemm_ind = nullptr;
+
+    return trace(hipsparse::spgemmNumeric(opA, opB, alpha, A, B, beta, C));
+}
+
+struct hipsparseSpSVDescr
+{
+    // Entries of op(A), 0 based CSR, the value of entry k is the value perm[k] of A
+    std::vector<int64_t> ptr;
+    std::vector<int64_t> ind;
+    std::vector<int64_t> perm;
+
+    // Rows of op(A) grouped by level, see hipsparse::host::levelSchedule
+    std::vector<int64_t> level_ptr;
+    std::vector<int64_t> level_rows;
+
+    bool analysed = false;
+    bool lower    = true;
+
+    // Matrix of the analysis, and the diagonal set by hipsparseSpSV_updateMatrix that replaces
+    // its own when not null
+    hipsparse::hostSpMat* mat  = nullptr;
+    const void*           diag = nullptr;
+};
+
+namespace hipsparse
+{
+    hipsparseStatus_t checkSpSV(const hostSpMat* A,
+                                const hostDnVec* x,
+                                const hostDnVec* y,
+                                hipDataType      compute_type)
+    {
+        if(A->rows != A->cols || x->size != A->rows || y->size != A->rows)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(A->data_type != compute_type || x->data_type != compute_type
+           || y->data_type != compute_type)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return A->format == HIPSPARSE_FORMAT_BLOCKED_ELL ? HIPSPARSE_STATUS_NOT_SUPPORTED
+                                                         : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Structure and level schedule of the triangular part of op(A) referenced by the fill mode.
+    //
+    hipsparseStatus_t
+        spsvAnalysis(hipsparseOperation_t op, const hostSpMat* A, hipsparseSpSVDescr* descr)
+    {
+        std::vector<int64_t> row;
+        std::vector<int64_t> col;
+
+        hipsparseStatus_t status = dispatchIndex(offsetsType(A), [&](auto i) {
+            return dispatchIndex(indicesType(A), [&](auto j) {
+                typedef typename decltype(i)::type I;
+                typedef typename decltype(j)::type J;
+
+                spMatEntries<I, J>(A, row, col);
+                return HIPSPARSE_STATUS_SUCCESS;
+            });
+        });
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const bool trans = op != HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+        host::sortByRow(
+            A->rows,
+            A->nnz,
+            [&](int64_t k) { return trans ? col[k] : row[k]; },
+            [&](int64_t k) { return trans ? row[k] : col[k]; },
+            descr->ptr,
+            descr->ind,
+            descr->perm);
+
+        // The lower part of A is the upper part of A^T
+        descr->lower = (A->fill_mode == HIPSPARSE_FILL_MODE_LOWER) != trans;
+
+        host::levelSchedule(A->rows,
+                            descr->ptr.data(),
+                            descr->ind.data(),
+                            descr->lower,
+                            descr->level_ptr,
+                            descr->level_rows);
+
+        descr->mat      = const_cast<hostSpMat*>(A);
+        descr->diag     = nullptr;
+        descr->analysed = true;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Solve op(A) * y_j = alpha * x_j for the nrhs right-hand sides, the rows of a level are
+    // solved for all of them at once.
+    //
+    hipsparseStatus_t spsvSolve(hipsparseOperation_t      op,
+                                const void*               alpha,
+                                const hostSpMat*          A,
+                                int64_t                   nrhs,
+                                const hostDnVec* const*   x,
+                                const hostDnVec* const*   y,
+                                const hipsparseSpSVDescr* descr)
+    {
+        return dispatchData(A->data_type, [&](auto t) {
+            typedef typename decltype(t)::type T;
+
+            std::vector<const T*> xval(nrhs);
+            std::vector<T*>       yval(nrhs);
+            for(int64_t j = 0; j < nrhs; ++j)
+            {
+                xval[j] = static_cast<const T*>(x[j]->values);
+                yval[j] = static_cast<T*>(y[j]->values);
+            }
+
+            host::csrsm(A->rows,
+                        descr->ptr.data(),
+                        descr->ind.data(),
+                        descr->perm.data(),
+                        static_cast<const T*>(A->val_data),
+                        static_cast<const T*>(descr->diag),
+                        op == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                        descr->lower,
+                        A->diag_type == HIPSPARSE_DIAG_TYPE_UNIT,
+                        descr->level_ptr,
+                        descr->level_rows,
+                        scalar<T>(alpha),
+                        nrhs,
+                        xval.data(),
+                        yval.data());
+            return HIPSPARSE_STATUS_SUCCESS;
+        });
+    }
+}
+
+hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
+{
+    HIPSPARSE_TRACE(descr);
+
+    if(descr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *descr = new hipsparseSpSVDescr;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
+{
+    HIPSPARSE_TRACE(descr);
+
+    delete descr;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
+                                           hipsparseOperation_t        opA,
+                                           const void*                 alpha,
+                                           hipsparseConstSpMatDescr_t  matA,
+                                           hipsparseConstDnVecDescr_t  x,
+                                           const hipsparseDnVecDescr_t y,
+                                           hipDataType                 computeType,
+                                           hipsparseSpSVAlg_t          alg,
+                                           hipsparseSpSVDescr_t        spsvDescr,
+                                           size_t*                     pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(
+        handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, pBufferSizeInBytes);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr || pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpSV((const hipsparse::hostSpMat*)matA,
+                                                   (const hipsparse::hostDnVec*)x,
+                                                   (const hipsparse::hostDnVec*)y,
+                                                   computeType));
+
+    *pBufferSizeInBytes = hipsparse::buffer_size;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
+                                         hipsparseOperation_t        opA,
+                                         const void*                 alpha,
+                                         hipsparseConstSpMatDescr_t  matA,
+                                         hipsparseConstDnVecDescr_t  x,
+                                         const hipsparseDnVecDescr_t y,
+                                         hipDataType                 computeType,
+                                         hipsparseSpSVAlg_t          alg,
+                                         hipsparseSpSVDescr_t        spsvDescr,
+                                         void*                       externalBuffer)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, externalBuffer);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr || externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A = (const hipsparse::hostSpMat*)matA;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpSV(
+        A, (const hipsparse::hostDnVec*)x, (const hipsparse::hostDnVec*)y, computeType));
+
+    return trace(hipsparse::spsvAnalysis(opA, A, spsvDescr));
+}
+
+hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
+                                      hipsparseOperation_t        opA,
+                                      const void*                 alpha,
+                                      hipsparseConstSpMatDescr_t  matA,
+                                      hipsparseConstDnVecDescr_t  x,
+                                      const hipsparseDnVecDescr_t y,
+                                      hipDataType                 computeType,
+                                      hipsparseSpSVAlg_t          alg,
+                                      hipsparseSpSVDescr_t        spsvDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || x == nullptr || y == nullptr
+       || spsvDescr == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat* A    = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostDnVec* xvec = (const hipsparse::hostDnVec*)x;
+    const hipsparse::hostDnVec* yvec = (const hipsparse::hostDnVec*)y;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpSV(A, xvec, yvec, computeType));
+
+    // The structure of A is analysed once, its values are read by each solve
+    if(!spsvDescr->analysed)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spsvSolve(opA, alpha, A, 1, &xvec, &yvec, spsvDescr));
+}
+
+hipsparseStatus_t hipsparseSpSV_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSVDescr_t  spsvDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSVUpdate_t updatePart)
+{
+    HIPSPARSE_TRACE(handle, spsvDescr, newValues, updatePart);
+
+    if(handle == nullptr || spsvDescr == nullptr || newValues == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(!spsvDescr->analysed)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // The structure and the level schedule are kept, the solves read the new values
+    switch(updatePart)
+    {
+    case HIPSPARSE_SPSV_UPDATE_GENERAL:
+        spsvDescr->mat->val_data = newValues;
+        spsvDescr->diag          = nullptr;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    case HIPSPARSE_SPSV_UPDATE_DIAGONAL:
+        spsvDescr->diag = newValues;
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+}
+
+hipsparseStatus_t hipsparseSpSV_solveBatched(hipsparseHandle_t                 handle,
+                                             hipsparseOperation_t              opA,
+                                             const void*                       alpha,
+                                             hipsparseConstSpMatDescr_t        matA,
+                                             int                               batchCount,
+                                             const hipsparseConstDnVecDescr_t* x,
+                                             const hipsparseDnVecDescr_t*      y,
+                                             hipDataType                       computeType,
+                                             hipsparseSpSVAlg_t                alg,
+                                             hipsparseSpSVDescr_t              spsvDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, batchCount, x, y, computeType, alg, spsvDescr);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || spsvDescr == nullptr
+       || batchCount < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(batchCount == 0)
+    {
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    }
+
+    if(x == nullptr || y == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    const hipsparse::hostSpMat*        A    = (const hipsparse::hostSpMat*)matA;
+    const hipsparse::hostDnVec* const* xvec = (const hipsparse::hostDnVec* const*)x;
+    const hipsparse::hostDnVec* const* yvec = (const hipsparse::hostDnVec* const*)y;
+
+    for(int i = 0; i < batchCount; ++i)
+    {
+        if(xvec[i] == nullptr || yvec[i] == nullptr)
+        {
+            return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::checkSpSV(A, xvec[i], yvec[i], computeType));
+    }
+
+    if(!spsvDescr->analysed)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spsvSolve(opA, alpha, A, batchCount, xvec, yvec, spsvDescr));
+}
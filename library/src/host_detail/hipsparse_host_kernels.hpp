@@ -0,0 +1,1034 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+#pragma once
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+// Kernels of the host backend.
+//
+// Matrices are processed row by row, the rows are distributed over the OpenMP threads. The inner
+// loops run over contiguous arrays and do not branch on the data, so that the compiler can
+// vectorize them. A matrix in another format, or used transposed, is converted to CSR first, see
+// csrMatrix.
+//
+namespace hipsparse
+{
+    namespace host
+    {
+        // Loops shorter than this run on the calling thread only
+        static constexpr int64_t min_parallel_size = 1024;
+
+        inline int maxThreads()
+        {
+#ifdef _OPENMP
+            return omp_get_max_threads();
+#else
+            return 1;
+#endif
+        }
+
+        inline int threadNum()
+        {
+#ifdef _OPENMP
+            return omp_get_thread_num();
+#else
+            return 0;
+#endif
+        }
+
+        //
+        // Arithmetic, operator* of the complex types is elementwise.
+        //
+        inline float multiply(float a, float b)
+        {
+            return a * b;
+        }
+
+        inline double multiply(double a, double b)
+        {
+            return a * b;
+        }
+
+        inline hipComplex multiply(hipComplex a, hipComplex b)
+        {
+            return hipCmulf(a, b);
+        }
+
+        inline hipDoubleComplex multiply(hipDoubleComplex a, hipDoubleComplex b)
+        {
+            return hipCmul(a, b);
+        }
+
+        inline float divide(float a, float b)
+        {
+            return a / b;
+        }
+
+        inline double divide(double a, double b)
+        {
+            return a / b;
+        }
+
+        inline hipComplex divide(hipComplex a, hipComplex b)
+        {
+            return hipCdivf(a, b);
+        }
+
+        inline hipDoubleComplex divide(hipDoubleComplex a, hipDoubleComplex b)
+        {
+            return hipCdiv(a, b);
+        }
+
+        inline float conjugate(float x)
+        {
+            return x;
+        }
+
+        inline double conjugate(double x)
+        {
+            return x;
+        }
+
+        inline hipComplex conjugate(hipComplex x)
+        {
+            return hipConjf(x);
+        }
+
+        inline hipDoubleComplex conjugate(hipDoubleComplex x)
+        {
+            return hipConj(x);
+        }
+
+        inline bool isZero(float x)
+        {
+            return x == 0.0f;
+        }
+
+        inline bool isZero(double x)
+        {
+            return x == 0.0;
+        }
+
+        inline bool isZero(hipComplex x)
+        {
+            return x.x == 0.0f && x.y == 0.0f;
+        }
+
+        inline bool isZero(hipDoubleComplex x)
+        {
+            return x.x == 0.0 && x.y == 0.0;
+        }
+
+        template <typename T>
+        inline T conjugateIf(bool conj, T x)
+        {
+            return conj ? conjugate(x) : x;
+        }
+
+        //
+        // Half and bfloat16 values of the mixed precision products, stored as their bit patterns.
+        // They are widened to float for the arithmetic, the results are rounded to nearest even.
+        //
+        struct half
+        {
+            uint16_t bits;
+        };
+
+        struct bfloat16
+        {
+            uint16_t bits;
+        };
+
+        inline float bitsToFloat(uint32_t bits)
+        {
+            float x;
+            std::memcpy(&x, &bits, sizeof(x));
+            return x;
+        }
+
+        inline uint32_t floatToBits(float x)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            return bits;
+        }
+
+        inline float widen(half x)
+        {
+            const uint32_t sign     = static_cast<uint32_t>(x.bits & 0x8000u) << 16;
+            const uint32_t exponent = (x.bits >> 10) & 0x1fu;
+            const uint32_t mantissa = x.bits & 0x3ffu;
+
+            if(exponent == 0)
+            {
+                // Zero or subnormal, mantissa * 2^-24
+                const float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+                return sign ? -value : value;
+            }
+
+            // Infinity and NaN keep their mantissa, the exponent of the others is rebiased
+            return bitsToFloat(sign | (exponent == 0x1fu ? 0x7f800000u : (exponent + 112) << 23)
+                               | (mantissa << 13));
+        }
+
+        inline float widen(bfloat16 x)
+        {
+            return bitsToFloat(static_cast<uint32_t>(x.bits) << 16);
+        }
+
+        inline int32_t widen(int8_t x)
+        {
+            return x;
+        }
+
+        inline int32_t widen(int32_t x)
+        {
+            return x;
+        }
+
+        inline float widen(float x)
+        {
+            return x;
+        }
+
+        template <typename T, typename C>
+        inline T narrow(C x)
+        {
+            return static_cast<T>(x);
+        }
+
+        template <>
+        inline half narrow<half, float>(float x)
+        {
+            const uint32_t bits = floatToBits(x);
+            const uint16_t sign = (bits >> 16) & 0x8000u;
+            const uint32_t abs  = bits & 0x7fffffffu;
+
+            if(abs > 0x7f800000u)
+            {
+                return {static_cast<uint16_t>(sign | 0x7e00u)};
+            }
+
+            // 65520 and above round to infinity
+            if(abs >= 0x477ff000u)
+            {
+                return {static_cast<uint16_t>(sign | 0x7c00u)};
+            }
+
+            if(abs >= 0x38800000u)
+            {
+                const uint32_t rebiased = abs - 0x38000000u;
+                return {static_cast<uint16_t>(
+                    sign | ((rebiased + 0xfffu + ((rebiased >> 13) & 1u)) >> 13))};
+            }
+
+            // Subnormal, the scaling by 2^24 is exact and nearbyint rounds to nearest even
+            return {static_cast<uint16_t>(sign | static_cast<uint16_t>(std::nearbyint(
+                                                     std::fabs(x) * 16777216.0f)))};
+        }
+
+        template <>
+        inline bfloat16 narrow<bfloat16, float>(float x)
+        {
+            const uint32_t bits = floatToBits(x);
+
+            if((bits & 0x7fffffffu) > 0x7f800000u)
+            {
+                return {static_cast<uint16_t>((bits >> 16) | 0x40u)};
+            }
+            return {static_cast<uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16)};
+        }
+
+        //
+        // y = beta * y, y is not read if beta is zero.
+        //
+        template <typename T>
+        void scale(int64_t n, T beta, T* y)
+        {
+            if(isZero(beta))
+            {
+#pragma omp parallel for schedule(static) if(n > min_parallel_size)
+                for(int64_t i = 0; i < n; ++i)
+                {
+                    y[i] = T{};
+                }
+            }
+            else
+            {
+#pragma omp parallel for schedule(static) if(n > min_parallel_size)
+                for(int64_t i = 0; i < n; ++i)
+                {
+                    y[i] = multiply(beta, y[i]);
+                }
+            }
+        }
+
+        //
+        // Sum of f(k) for k in [0, n). The partial sums of the threads are added in thread order,
+        // the result does not depend on the scheduling.
+        //
+        template <typename T, typename F>
+        T reduce(int64_t n, F f)
+        {
+            std::vector<T> partial(maxThreads(), T{});
+
+#pragma omp parallel if(n > min_parallel_size)
+            {
+                T sum{};
+
+#pragma omp for schedule(static)
+                for(int64_t k = 0; k < n; ++k)
+                {
+                    sum = sum + f(k);
+                }
+
+                partial[threadNum()] = sum;
+            }
+
+            T sum{};
+            for(const T& p : partial)
+            {
+                sum = sum + p;
+            }
+            return sum;
+        }
+
+        //
+        // y = alpha * x + beta * y, x is sparse.
+        //
+        template <typename T, typename I>
+        void axpby(int64_t  nnz,
+                   T        alpha,
+                   const I* x_ind,
+                   const T* x_val,
+                   int64_t  base,
+                   T        beta,
+                   int64_t  n,
+                   T*       y)
+        {
+            scale(n, beta, y);
+
+#pragma omp parallel for schedule(static) if(nnz > min_parallel_size)
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                const int64_t i = x_ind[k] - base;
+                y[i]            = y[i] + multiply(alpha, x_val[k]);
+            }
+        }
+
+        //
+        // x = y(x_ind), x is sparse.
+        //
+        template <typename T, typename I>
+        void gather(int64_t nnz, const T* y, const I* x_ind, T* x_val, int64_t base)
+        {
+#pragma omp parallel for schedule(static) if(nnz > min_parallel_size)
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                x_val[k] = y[x_ind[k] - base];
+            }
+        }
+
+        //
+        // y(x_ind) = x, x is sparse.
+        //
+        template <typename T, typename I>
+        void scatter(int64_t nnz, const I* x_ind, const T* x_val, int64_t base, T* y)
+        {
+#pragma omp parallel for schedule(static) if(nnz > min_parallel_size)
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                y[x_ind[k] - base] = x_val[k];
+            }
+        }
+
+        //
+        // Givens rotation of a sparse x and a dense y.
+        //
+        template <typename T, typename I>
+        void rot(int64_t nnz, T c, T s, const I* x_ind, T* x_val, int64_t base, T* y)
+        {
+#pragma omp parallel for schedule(static) if(nnz > min_parallel_size)
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                const int64_t i  = x_ind[k] - base;
+                const T       xk = x_val[k];
+                const T       yk = y[i];
+
+                x_val[k] = multiply(c, xk) + multiply(s, yk);
+                y[i]     = multiply(c, yk) - multiply(s, xk);
+            }
+        }
+
+        //
+        // Dot product of a sparse x, conjugated or not, and a dense y.
+        //
+        template <typename T, typename I>
+        T doti(int64_t nnz, const I* x_ind, const T* x_val, int64_t base, bool conj, const T* y)
+        {
+            return reduce<T>(nnz, [&](int64_t k) {
+                return multiply(conjugateIf(conj, x_val[k]), y[x_ind[k] - base]);
+            });
+        }
+
+        //
+        // CSR matrix, the arrays are either the arrays of the user or the storage of a converted
+        // matrix.
+        //
+        template <typename T, typename I, typename J>
+        struct csrMatrix
+        {
+            int64_t  m    = 0;
+            int64_t  n    = 0;
+            int64_t  nnz  = 0;
+            int64_t  base = 0;
+            const I* ptr  = nullptr;
+            const J* ind  = nullptr;
+            const T* val  = nullptr;
+
+            std::vector<I> ptr_storage;
+            std::vector<J> ind_storage;
+            std::vector<T> val_storage;
+        };
+
+        //
+        // Dense matrix, element (i, j) is val[i * row_stride + j * col_stride].
+        //
+        template <typename T>
+        struct denseMatrix
+        {
+            int64_t m;
+            int64_t n;
+            T*      val;
+            int64_t row_stride;
+            int64_t col_stride;
+        };
+
+        //
+        // Sort the entries (row(k), col(k)), k in [0, nnz), of a matrix with m rows by row into a
+        // 0 based CSR structure. The entries of a row keep their order, perm[j] is the position of
+        // the j-th sorted entry.
+        //
+        template <typename I, typename J, typename ROW, typename COL>
+        void sortByRow(int64_t         m,
+                       int64_t         nnz,
+                       ROW             row,
+                       COL             col,
+                       std::vector<I>& ptr,
+                       std::vector<J>& ind,
+                       std::vector<I>& perm)
+        {
+            ptr.assign(m + 1, 0);
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                ++ptr[row(k) + 1];
+            }
+            for(int64_t i = 0; i < m; ++i)
+            {
+                ptr[i + 1] += ptr[i];
+            }
+
+            std::vector<I> next(ptr.begin(), ptr.end() - 1);
+            ind.resize(nnz);
+            perm.resize(nnz);
+            for(int64_t k = 0; k < nnz; ++k)
+            {
+                const I j = next[row(k)]++;
+                ind[j]    = static_cast<J>(col(k));
+                perm[j]   = static_cast<I>(k);
+            }
+        }
+
+        //
+        // Row of each entry of a CSR matrix, 0 based.
+        //
+        template <typename I, typename J>
+        std::vector<J> expandRows(int64_t m, const I* ptr, int64_t base, int64_t nnz)
+        {
+            std::vector<J> rows(nnz);
+
+#pragma omp parallel for schedule(dynamic, 256) if(nnz > min_parallel_size)
+            for(int64_t i = 0; i < m; ++i)
+            {
+                for(int64_t k = ptr[i] - base; k < ptr[i + 1] - base; ++k)
+                {
+                    rows[k] = static_cast<J>(i);
+                }
+            }
+            return rows;
+        }
+
+        //
+        // B = A^T, B is 0 based.
+        //
+        template <typename T, typename I, typename J>
+        void transpose(const csrMatrix<T, I, J>& A, csrMatrix<T, I, J>& B)
+        {
+            const std::vector<J> rows = expandRows<I, J>(A.m, A.ptr, A.base, A.nnz);
+
+            std::vector<I> perm;
+            sortByRow(
+                A.n,
+                A.nnz,
+                [&](int64_t k) { return A.ind[k] - A.base; },
+                [&](int64_t k) { return rows[k]; },
+                B.ptr_storage,
+                B.ind_storage,
+                perm);
+
+            B.val_storage.resize(A.nnz);
+
+#pragma omp parallel for schedule(static) if(A.nnz > min_parallel_size)
+            for(int64_t j = 0; j < A.nnz; ++j)
+            {
+                B.val_storage[j] = A.val[perm[j]];
+            }
+
+            B.m    = A.n;
+            B.n    = A.m;
+            B.nnz  = A.nnz;
+            B.base = 0;
+            B.ptr  = B.ptr_storage.data();
+            B.ind  = B.ind_storage.data();
+            B.val  = B.val_storage.data();
+        }
+
+        //
+        // CSR matrix of a m x n COO matrix, the indices of entry k are row[k * stride] and
+        // col[k * stride]. B is 0 based.
+        //
+        template <typename T, typename I, typename J>
+        void cooToCsr(int64_t             m,
+                      int64_t             n,
+                      int64_t             nnz,
+                      const J*            row,
+                      const J*            col,
+                      int64_t             stride,
+                      const T*            val,
+                      int64_t             base,
+                      csrMatrix<T, I, J>& B)
+        {
+            std::vector<I> perm;
+            sortByRow(
+                m,
+                nnz,
+                [&](int64_t k) { return row[k * stride] - base; },
+                [&](int64_t k) { return col[k * stride] - base; },
+                B.ptr_storage,
+                B.ind_storage,
+                perm);
+
+            B.val_storage.resize(nnz);
+
+#pragma omp parallel for schedule(static) if(nnz > min_parallel_size)
+            for(int64_t j = 0; j < nnz; ++j)
+            {
+                B.val_storage[j] = val[perm[j]];
+            }
+
+            B.m    = m;
+            B.n    = n;
+            B.nnz  = nnz;
+            B.base = 0;
+            B.ptr  = B.ptr_storage.data();
+            B.ind  = B.ind_storage.data();
+            B.val  = B.val_storage.data();
+        }
+
+        //
+        // y = alpha * A * x + beta * y, the values of A are conjugated if conj is set.
+        //
+        template <typename T, typename I, typename J>
+        void csrmv(const csrMatrix<T, I, J>& A, bool conj, T alpha, const T* x, T beta, T* y)
+        {
+            const bool beta_zero = isZero(beta);
+
+#pragma omp parallel for schedule(dynamic, 256) if(A.nnz > min_parallel_size)
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                const int64_t start = A.ptr[i] - A.base;
+                const int64_t end   = A.ptr[i + 1] - A.base;
+
+                T sum{};
+                for(int64_t k = start; k < end; ++k)
+                {
+                    sum = sum + multiply(conjugateIf(conj, A.val[k]), x[A.ind[k] - A.base]);
+                }
+
+                y[i] = beta_zero ? multiply(alpha, sum)
+                                 : multiply(alpha, sum) + multiply(beta, y[i]);
+            }
+        }
+
+        //
+        // C = alpha * A * B + beta * C, the values of A and B are conjugated if conj_A and conj_B
+        // are set.
+        //
+        template <typename T, typename I, typename J>
+        void csrmm(const csrMatrix<T, I, J>&   A,
+                   bool                        conj_A,
+                   T                           alpha,
+                   const denseMatrix<const T>& B,
+                   bool                        conj_B,
+                   T                           beta,
+                   const denseMatrix<T>&       C)
+        {
+            const bool    beta_zero = isZero(beta);
+            const int64_t n         = C.n;
+
+#pragma omp parallel if(A.nnz * n > min_parallel_size)
+            {
+                std::vector<T> sum(n);
+
+#pragma omp for schedule(dynamic, 64)
+                for(int64_t i = 0; i < A.m; ++i)
+                {
+                    std::fill(sum.begin(), sum.end(), T{});
+
+                    for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                    {
+                        const T  a = multiply(alpha, conjugateIf(conj_A, A.val[k]));
+                        const T* b = B.val + (A.ind[k] - A.base) * B.row_stride;
+                        for(int64_t j = 0; j < n; ++j)
+                        {
+                            sum[j] = sum[j] + multiply(a, conjugateIf(conj_B, b[j * B.col_stride]));
+                        }
+                    }
+
+                    T* c = C.val + i * C.row_stride;
+                    for(int64_t j = 0; j < n; ++j)
+                    {
+                        c[j * C.col_stride] = beta_zero
+                                                  ? sum[j]
+                                                  : sum[j] + multiply(beta, c[j * C.col_stride]);
+                    }
+                }
+            }
+        }
+
+        //
+        // y = alpha * A * x + beta * y with the values of A and x, and y, widened to the compute
+        // type C. The result is narrowed to the type of y.
+        //
+        template <typename C, typename T, typename I, typename J, typename Y>
+        void csrmvMixed(const csrMatrix<T, I, J>& A, C alpha, const T* x, C beta, Y* y)
+        {
+            const bool beta_zero = beta == C(0);
+
+#pragma omp parallel for schedule(dynamic, 256) if(A.nnz > min_parallel_size)
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                const int64_t start = A.ptr[i] - A.base;
+                const int64_t end   = A.ptr[i + 1] - A.base;
+
+                C sum = 0;
+                for(int64_t k = start; k < end; ++k)
+                {
+                    sum += static_cast<C>(widen(A.val[k]))
+                           * static_cast<C>(widen(x[A.ind[k] - A.base]));
+                }
+
+                y[i] = narrow<Y>(beta_zero ? alpha * sum
+                                           : alpha * sum + beta * static_cast<C>(widen(y[i])));
+            }
+        }
+
+        //
+        // C = alpha * A * B + beta * C with the values widened to the compute type U, see
+        // csrmvMixed.
+        //
+        template <typename U, typename T, typename I, typename J, typename Y>
+        void csrmmMixed(const csrMatrix<T, I, J>&   A,
+                        U                           alpha,
+                        const denseMatrix<const T>& B,
+                        U                           beta,
+                        const denseMatrix<Y>&       C)
+        {
+            const bool    beta_zero = beta == U(0);
+            const int64_t n         = C.n;
+
+#pragma omp parallel if(A.nnz * n > min_parallel_size)
+            {
+                std::vector<U> sum(n);
+
+#pragma omp for schedule(dynamic, 64)
+                for(int64_t i = 0; i < A.m; ++i)
+                {
+                    std::fill(sum.begin(), sum.end(), U(0));
+
+                    for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                    {
+                        const U  a = static_cast<U>(widen(A.val[k]));
+                        const T* b = B.val + (A.ind[k] - A.base) * B.row_stride;
+                        for(int64_t j = 0; j < n; ++j)
+                        {
+                            sum[j] += a * static_cast<U>(widen(b[j * B.col_stride]));
+                        }
+                    }
+
+                    Y* c = C.val + i * C.row_stride;
+                    for(int64_t j = 0; j < n; ++j)
+                    {
+                        const U old = beta_zero ? U(0) : static_cast<U>(widen(c[j * C.col_stride]));
+
+                        c[j * C.col_stride] = narrow<Y>(alpha * sum[j] + beta * old);
+                    }
+                }
+            }
+        }
+
+        //
+        // Structure of C = A * B, 0 based, the columns of each row are sorted.
+        //
+        template <typename T, typename I, typename J>
+        void csrgemmSymbolic(const csrMatrix<T, I, J>& A,
+                             const csrMatrix<T, I, J>& B,
+                             std::vector<I>&           ptr,
+                             std::vector<J>&           ind)
+        {
+            const int64_t m = A.m;
+            const int64_t n = B.n;
+
+            ptr.assign(m + 1, 0);
+
+#pragma omp parallel if(A.nnz > min_parallel_size)
+            {
+                std::vector<int64_t> mark(n, -1);
+
+#pragma omp for schedule(dynamic, 64)
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    I count = 0;
+                    for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                    {
+                        const int64_t r = A.ind[k] - A.base;
+                        for(int64_t l = B.ptr[r] - B.base; l < B.ptr[r + 1] - B.base; ++l)
+                        {
+                            const int64_t c = B.ind[l] - B.base;
+                            if(mark[c] != i)
+                            {
+                                mark[c] = i;
+                                ++count;
+                            }
+                        }
+                    }
+                    ptr[i + 1] = count;
+                }
+            }
+
+            for(int64_t i = 0; i < m; ++i)
+            {
+                ptr[i + 1] += ptr[i];
+            }
+
+            ind.resize(ptr[m]);
+
+#pragma omp parallel if(A.nnz > min_parallel_size)
+            {
+                std::vector<int64_t> mark(n, -1);
+
+#pragma omp for schedule(dynamic, 64)
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    J*      row   = ind.data() + ptr[i];
+                    int64_t count = 0;
+                    for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                    {
+                        const int64_t r = A.ind[k] - A.base;
+                        for(int64_t l = B.ptr[r] - B.base; l < B.ptr[r + 1] - B.base; ++l)
+                        {
+                            const int64_t c = B.ind[l] - B.base;
+                            if(mark[c] != i)
+                            {
+                                mark[c]      = i;
+                                row[count++] = static_cast<J>(c);
+                            }
+                        }
+                    }
+                    std::sort(row, row + count);
+                }
+            }
+        }
+
+        //
+        // Values of C = alpha * A * B + beta * C for a given structure of C, products outside of
+        // the structure of C are dropped.
+        //
+        template <typename T, typename I, typename J>
+        void csrgemmNumeric(const csrMatrix<T, I, J>& A,
+                            const csrMatrix<T, I, J>& B,
+                            T                         alpha,
+                            T                         beta,
+                            const I*                  ptr_C,
+                            const J*                  ind_C,
+                            int64_t                   base_C,
+                            T*                        val_C)
+        {
+            const bool    beta_zero = isZero(beta);
+            const int64_t m         = A.m;
+            const int64_t n         = B.n;
+
+#pragma omp parallel if(A.nnz > min_parallel_size)
+            {
+                std::vector<int64_t> pos(n, -1);
+
+#pragma omp for schedule(dynamic, 64)
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    const int64_t start = ptr_C[i] - base_C;
+                    const int64_t end   = ptr_C[i + 1] - base_C;
+
+                    for(int64_t j = start; j < end; ++j)
+                    {
+                        pos[ind_C[j] - base_C] = j;
+                        val_C[j]               = beta_zero ? T{} : multiply(beta, val_C[j]);
+                    }
+
+                    for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                    {
+                        const int64_t r = A.ind[k] - A.base;
+                        const T       a = multiply(alpha, A.val[k]);
+                        for(int64_t l = B.ptr[r] - B.base; l < B.ptr[r + 1] - B.base; ++l)
+                        {
+                            const int64_t p = pos[B.ind[l] - B.base];
+                            if(p >= 0)
+                            {
+                                val_C[p] = val_C[p] + multiply(a, B.val[l]);
+                            }
+                        }
+                    }
+
+                    for(int64_t j = start; j < end; ++j)
+                    {
+                        pos[ind_C[j] - base_C] = -1;
+                    }
+                }
+            }
+        }
+
+        //
+        // Rows of a 0 based triangular matrix grouped by level, a row only depends on rows of
+        // previous levels. Only the entries of the lower, or upper, triangular part are used.
+        //
+        template <typename I, typename J>
+        void levelSchedule(int64_t               m,
+                           const I*              ptr,
+                           const J*              ind,
+                           bool                  lower,
+                           std::vector<int64_t>& level_ptr,
+                           std::vector<int64_t>& level_rows)
+        {
+            std::vector<int64_t> level(m, 0);
+            int64_t              nlevels = 0;
+
+            for(int64_t r = 0; r < m; ++r)
+            {
+                const int64_t i = lower ? r : m - 1 - r;
+
+                int64_t l = 0;
+                for(int64_t k = ptr[i]; k < ptr[i + 1]; ++k)
+                {
+                    const int64_t c = ind[k];
+                    if(lower ? c < i : c > i)
+                    {
+                        l = std::max(l, level[c] + 1);
+                    }
+                }
+
+                level[i] = l;
+                nlevels  = std::max(nlevels, l + 1);
+            }
+
+            level_ptr.assign(nlevels + 1, 0);
+            for(int64_t i = 0; i < m; ++i)
+            {
+                ++level_ptr[level[i] + 1];
+            }
+            for(int64_t l = 0; l < nlevels; ++l)
+            {
+                level_ptr[l + 1] += level_ptr[l];
+            }
+
+            std::vector<int64_t> next(level_ptr.begin(), level_ptr.end() - 1);
+            level_rows.resize(m);
+            for(int64_t i = 0; i < m; ++i)
+            {
+                level_rows[next[level[i]]++] = i;
+            }
+        }
+
+        //
+        // Solve A * y_j = alpha * x_j level by level for the nrhs right-hand sides, A is a 0
+        // based triangular matrix whose value k is val[perm[k]], conjugated if conj is set.
+        // When diag is not null, diag[i] replaces the diagonal entry of row i.
+        //
+        template <typename T, typename I, typename J>
+        void csrsm(int64_t                     m,
+                   const I*                    ptr,
+                   const J*                    ind,
+                   const I*                    perm,
+                   const T*                    val,
+                   const T*                    diag,
+                   bool                        conj,
+                   bool                        lower,
+                   bool                        unit,
+                   const std::vector<int64_t>& level_ptr,
+                   const std::vector<int64_t>& level_rows,
+                   T                           alpha,
+                   int64_t                     nrhs,
+                   const T* const*             x,
+                   T* const*                   y)
+        {
+            const int64_t nlevels = static_cast<int64_t>(level_ptr.size()) - 1;
+
+            // The rows of a level and the right-hand sides are independent, the implicit
+            // barrier of the loop over them orders the levels
+#pragma omp parallel if(m * nrhs > min_parallel_size)
+            for(int64_t l = 0; l < nlevels; ++l)
+            {
+#pragma omp for collapse(2) schedule(dynamic, 32)
+                for(int64_t r = level_ptr[l]; r < level_ptr[l + 1]; ++r)
+                {
+                    for(int64_t j = 0; j < nrhs; ++j)
+                    {
+                        const int64_t i  = level_rows[r];
+                        T*            yj = y[j];
+
+                        T sum = multiply(alpha, x[j][i]);
+                        T d   = (diag != nullptr) ? conjugateIf(conj, diag[i]) : T{};
+                        for(int64_t k = ptr[i]; k < ptr[i + 1]; ++k)
+                        {
+                            const int64_t c = ind[k];
+                            const T       v = conjugateIf(conj, val[perm[k]]);
+                            if(c == i)
+                            {
+                                d = (diag != nullptr) ? d : v;
+                            }
+                            else if(lower ? c < i : c > i)
+                            {
+                                sum = sum - multiply(v, yj[c]);
+                            }
+                        }
+
+                        yj[i] = unit ? sum : divide(sum, d);
+                    }
+                }
+            }
+        }
+
+        //
+        // B = A, B is dense.
+        //
+        template <typename T, typename I, typename J>
+        void csrToDense(const csrMatrix<T, I, J>& A, const denseMatrix<T>& B)
+        {
+#pragma omp parallel for schedule(dynamic, 64) if(B.m * B.n > min_parallel_size)
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                T* row = B.val + i * B.row_stride;
+                for(int64_t j = 0; j < B.n; ++j)
+                {
+                    row[j * B.col_stride] = T{};
+                }
+                for(int64_t k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+                {
+                    row[(A.ind[k] - A.base) * B.col_stride] = A.val[k];
+                }
+            }
+        }
+
+        //
+        // Number of nonzeros of the rows of a dense matrix as offsets starting at base.
+        //
+        template <typename T, typename I>
+        void denseRowPtr(const denseMatrix<const T>& A, I* ptr, int64_t base)
+        {
+#pragma omp parallel for schedule(dynamic, 64) if(A.m * A.n > min_parallel_size)
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                const T* row   = A.val + i * A.row_stride;
+                I        count = 0;
+                for(int64_t j = 0; j < A.n; ++j)
+                {
+                    count += isZero(row[j * A.col_stride]) ? 0 : 1;
+                }
+                ptr[i + 1] = count;
+            }
+
+            ptr[0] = static_cast<I>(base);
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                ptr[i + 1] += ptr[i];
+            }
+        }
+
+        //
+        // Nonzeros of a dense matrix, the nonzeros of row i start at ptr[i] - ptr_base. The row
+        // indices are written if row_ind is not nullptr.
+        //
+        template <typename T, typename I, typename J>
+        void denseToSparse(const denseMatrix<const T>& A,
+                           const I*                    ptr,
+                           int64_t                     ptr_base,
+                           J*                          row_ind,
+                           J*                          col_ind,
+                           T*                          val,
+                           int64_t                     base)
+        {
+#pragma omp parallel for schedule(dynamic, 64) if(A.m * A.n > min_parallel_size)
+            for(int64_t i = 0; i < A.m; ++i)
+            {
+                const T* row = A.val + i * A.row_stride;
+                int64_t  k   = ptr[i] - ptr_base;
+                for(int64_t j = 0; j < A.n; ++j)
+                {
+                    const T v = row[j * A.col_stride];
+                    if(!isZero(v))
+                    {
+                        if(row_ind != nullptr)
+                        {
+                            row_ind[k] = static_cast<J>(i + base);
+                        }
+                        col_ind[k] = static_cast<J>(j + base);
+                        val[k]     = v;
+                        ++k;
+                    }
+                }
+            }
+        }
+    }
+}
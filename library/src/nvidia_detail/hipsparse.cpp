@@ -22,25 +22,78 @@
 * ************************************************************************ */
 #include "hipsparse.h"
 
+#include "../common/hipsparse_memory.hpp"
+#include "../common/hipsparse_trace.hpp"
+
 #include <cuda_runtime_api.h>
 #include <cusparse_v2.h>
 #include <hip/hip_runtime_api.h>
 #include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
 
-#define RETURN_IF_CUSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                          \
-    {                                                                             \
-        cusparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;           \
-        if(TMP_STATUS_FOR_CHECK != CUSPARSE_STATUS_SUCCESS)                       \
-        {                                                                         \
-            return hipsparse::hipCUSPARSEStatusToHIPStatus(TMP_STATUS_FOR_CHECK); \
-        }                                                                         \
+// Used in API functions only, the status is returned through the trace of the function, see
+// HIPSPARSE_TRACE.
+#define RETURN_IF_CUSPARSE_ERROR(INPUT_STATUS_FOR_CHECK)                                 \
+    {                                                                                    \
+        cusparseStatus_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                  \
+        if(TMP_STATUS_FOR_CHECK != CUSPARSE_STATUS_SUCCESS)                              \
+        {                                                                                \
+            return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(TMP_STATUS_FOR_CHECK)); \
+        }                                                                                \
     }
 
 namespace hipsparse
 {
+    hipError_t internalMalloc(void** ptr, size_t size)
+    {
+        hipError_t status = hipMalloc(ptr, size);
+        if(status == hipSuccess)
+        {
+            profileAllocation();
+        }
+        return status;
+    }
+
+    hipError_t internalFree(void* ptr)
+    {
+        return hipFree(ptr);
+    }
+
+    hipError_t internalMemcpyAsync(void* dst, const void* src, size_t size, hipStream_t stream)
+    {
+        return hipMemcpyAsync(dst, src, size, hipMemcpyDefault, stream);
+    }
+
+    hipError_t internalStreamSynchronize(hipStream_t stream)
+    {
+        return hipStreamSynchronize(stream);
+    }
+
+    hipError_t internalMemcpyToHost(void* dst, const void* src, size_t size)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, src) == hipSuccess && attr.type == hipMemoryTypeDevice)
+        {
+            return hipMemcpy(dst, src, size, hipMemcpyDeviceToHost);
+        }
+
+        // Unregistered host memory is reported as an error by some runtimes, clear it.
+        (void)hipGetLastError();
+        memcpy(dst, src, size);
+        return hipSuccess;
+    }
+
+    hipError_t internalDeviceSynchronize()
+    {
+        return hipDeviceSynchronize();
+    }
+
     hipsparseStatus_t hipCUSPARSEStatusToHIPStatus(cusparseStatus_t cuStatus)
     {
 #if(CUDART_VERSION >= 11003)
@@ -462,6 +515,20 @@ namespace hipsparse
             return CUDA_C_32F;
         case HIP_C_64F:
             return CUDA_C_64F;
+        case HIP_R_16F:
+            return CUDA_R_16F;
+#if CUDART_VERSION >= 11000
+        case HIP_R_16BF:
+            return CUDA_R_16BF;
+#endif
+        case HIP_R_8I:
+            return CUDA_R_8I;
+        case HIP_R_8U:
+            return CUDA_R_8U;
+        case HIP_R_32I:
+            return CUDA_R_32I;
+        case HIP_R_32U:
+            return CUDA_R_32U;
         default:
             throw "Non existent hipDataType";
         }
@@ -479,6 +546,20 @@ namespace hipsparse
             return HIP_C_32F;
         case CUDA_C_64F:
             return HIP_C_64F;
+        case CUDA_R_16F:
+            return HIP_R_16F;
+#if CUDART_VERSION >= 11000
+        case CUDA_R_16BF:
+            return HIP_R_16BF;
+#endif
+        case CUDA_R_8I:
+            return HIP_R_8I;
+        case CUDA_R_8U:
+            return HIP_R_8U;
+        case CUDA_R_32I:
+            return HIP_R_32I;
+        case CUDA_R_32U:
+            return HIP_R_32U;
         default:
             throw "Non existent cudaDataType";
         }
@@ -488,12 +569,21 @@ namespace hipsparse
 
 hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreate((cusparseHandle_t*)handle));
+    HIPSPARSE_TRACE(handle);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreate((cusparseHandle_t*)handle)));
 }
 
 hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroy((cusparseHandle_t)handle));
+    HIPSPARSE_TRACE(handle);
+
+    // Free the counters before the address of the handle can be reused
+    hipsparse::profileRelease(handle);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroy((cusparseHandle_t)handle)));
 }
 
 #if CUDART_VERSION > 10000
@@ -510,27 +600,31 @@ const char* hipsparseGetErrorString(hipsparseStatus_t status)
 
 hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 {
+    HIPSPARSE_TRACE(handle, version);
+
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
     }
 
     *version = hipsparseVersionMajor * 100000 + hipsparseVersionMinor * 100 + hipsparseVersionPatch;
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 {
+    HIPSPARSE_TRACE(handle, rev);
+
     // Get hipSPARSE revision
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
     }
 
     if(rev == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     static constexpr char v[] = TO_STR(hipsparseVersionTweak);
@@ -550,56 +644,157 @@ hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
             cusparse_ver / 100 % 1000,
             cusparse_ver % 100);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSetStream((cusparseHandle_t)handle, streamId));
+    HIPSPARSE_TRACE(handle, streamId);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSetStream((cusparseHandle_t)handle, streamId)));
 }
 
 hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseGetStream((cusparseHandle_t)handle, streamId));
+    HIPSPARSE_TRACE(handle, streamId);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseGetStream((cusparseHandle_t)handle, streamId)));
 }
 
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetPointerMode(
-        (cusparseHandle_t)handle, hipsparse::hipPointerModeToCudaPointerMode(mode)));
+    HIPSPARSE_TRACE(handle, mode);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetPointerMode(
+        (cusparseHandle_t)handle, hipsparse::hipPointerModeToCudaPointerMode(mode))));
 }
 
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
 {
+    HIPSPARSE_TRACE(handle, mode);
+
     cusparsePointerMode_t cusparseMode;
     cusparseStatus_t      status = cusparseGetPointerMode((cusparseHandle_t)handle, &cusparseMode);
     *mode                        = hipsparse::CudaPointerModeToHIPPointerMode(cusparseMode);
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(status);
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(status));
+}
+
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    switch(mode)
+    {
+    case HIPSPARSE_SYNC_MODE_BLOCKING:
+        return trace(HIPSPARSE_STATUS_SUCCESS);
+    case HIPSPARSE_SYNC_MODE_NON_BLOCKING:
+    case HIPSPARSE_SYNC_MODE_CAPTURE_SAFE:
+        // The blocking cuSPARSE routines synchronize by themselves
+        return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+    default:
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+}
+
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode)
+{
+    HIPSPARSE_TRACE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    if(mode == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    *mode = HIPSPARSE_SYNC_MODE_BLOCKING;
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseGetInternalMemoryUsage(size_t* currentBytes, size_t* peakBytes)
+{
+    HIPSPARSE_TRACE(currentBytes, peakBytes);
+
+    // hipSPARSE does not track its device memory on top of cuSPARSE, the buffers of the SpMV
+    // plans
+    if(currentBytes != nullptr)
+    {
+        *currentBytes = 0;
+    }
+    if(peakBytes != nullptr)
+    {
+        *peakBytes = 0;
+    }
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseResetInternalMemoryUsage(void)
+{
+    static const hipsparse::traceSite trace_site = {__func__, "", -1, -1, -1};
+    hipsparse::traceCall              trace(trace_site);
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t
+    hipsparseSetWorkspace(hipsparseHandle_t handle, void* workspace, size_t workspaceSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle, workspace, workspaceSizeInBytes);
+
+    if(handle == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_NOT_INITIALIZED);
+    }
+
+    if(workspace == nullptr && workspaceSizeInBytes != 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // cuSPARSE routines do not need temporary buffers from hipSPARSE
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateMatDescr((cusparseMatDescr_t*)descrA));
+    HIPSPARSE_TRACE(descrA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateMatDescr((cusparseMatDescr_t*)descrA)));
 }
 
 hipsparseStatus_t hipsparseDestroyMatDescr(hipsparseMatDescr_t descrA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyMatDescr((cusparseMatDescr_t)descrA));
+    HIPSPARSE_TRACE(descrA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyMatDescr((cusparseMatDescr_t)descrA)));
 }
 
 hipsparseStatus_t hipsparseCopyMatDescr(hipsparseMatDescr_t dest, const hipsparseMatDescr_t src)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(dest, src);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseSetMatType(hipsparseMatDescr_t descrA, hipsparseMatrixType_t type)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatType(
-        (cusparseMatDescr_t)descrA, hipsparse::hipMatrixTypeToCudaMatrixType(type)));
+    HIPSPARSE_TRACE(descrA, type);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatType(
+        (cusparseMatDescr_t)descrA, hipsparse::hipMatrixTypeToCudaMatrixType(type))));
 }
 
 hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
@@ -610,8 +805,11 @@ hipsparseMatrixType_t hipsparseGetMatType(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatFillMode(hipsparseMatDescr_t descrA, hipsparseFillMode_t fillMode)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSetMatFillMode((cusparseMatDescr_t)descrA, hipsparse::hipFillToCudaFill(fillMode)));
+    HIPSPARSE_TRACE(descrA, fillMode);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSetMatFillMode((cusparseMatDescr_t)descrA,
+                               hipsparse::hipFillToCudaFill(fillMode))));
 }
 
 hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
@@ -621,8 +819,10 @@ hipsparseFillMode_t hipsparseGetMatFillMode(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatDiagType(hipsparseMatDescr_t descrA, hipsparseDiagType_t diagType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatDiagType(
-        (cusparseMatDescr_t)descrA, hipsparse::hipDiagonalToCudaDiagonal(diagType)));
+    HIPSPARSE_TRACE(descrA, diagType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatDiagType(
+        (cusparseMatDescr_t)descrA, hipsparse::hipDiagonalToCudaDiagonal(diagType))));
 }
 
 hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
@@ -633,8 +833,10 @@ hipsparseDiagType_t hipsparseGetMatDiagType(const hipsparseMatDescr_t descrA)
 
 hipsparseStatus_t hipsparseSetMatIndexBase(hipsparseMatDescr_t descrA, hipsparseIndexBase_t base)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatIndexBase(
-        (cusparseMatDescr_t)descrA, hipsparse::hipIndexBaseToCudaIndexBase(base)));
+    HIPSPARSE_TRACE(descrA, base);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSetMatIndexBase(
+        (cusparseMatDescr_t)descrA, hipsparse::hipIndexBaseToCudaIndexBase(base))));
 }
 
 hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
@@ -646,161 +848,229 @@ hipsparseIndexBase_t hipsparseGetMatIndexBase(const hipsparseMatDescr_t descrA)
 #if CUDART_VERSION < 11000
 hipsparseStatus_t hipsparseCreateHybMat(hipsparseHybMat_t* hybA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateHybMat((cusparseHybMat_t*)hybA));
+    HIPSPARSE_TRACE(hybA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateHybMat((cusparseHybMat_t*)hybA)));
 }
 
 hipsparseStatus_t hipsparseDestroyHybMat(hipsparseHybMat_t hybA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyHybMat((cusparseHybMat_t)hybA));
+    HIPSPARSE_TRACE(hybA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyHybMat((cusparseHybMat_t)hybA)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateBsrsv2Info(bsrsv2Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateBsrsv2Info((bsrsv2Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBsrsv2Info((bsrsv2Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrsv2Info(bsrsv2Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyBsrsv2Info((bsrsv2Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyBsrsv2Info((bsrsv2Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateBsrsm2Info(bsrsm2Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateBsrsm2Info((bsrsm2Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBsrsm2Info((bsrsm2Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrsm2Info(bsrsm2Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyBsrsm2Info((bsrsm2Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyBsrsm2Info((bsrsm2Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateBsrilu02Info(bsrilu02Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateBsrilu02Info((bsrilu02Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBsrilu02Info((bsrilu02Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsrilu02Info(bsrilu02Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyBsrilu02Info((bsrilu02Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyBsrilu02Info((bsrilu02Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 12000
 hipsparseStatus_t hipsparseCreateCsrsv2Info(csrsv2Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateCsrsv2Info((csrsv2Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCsrsv2Info((csrsv2Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrsv2Info(csrsv2Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsrsv2Info((csrsv2Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyCsrsv2Info((csrsv2Info_t)info)));
 }
 
 hipsparseStatus_t hipsparseCreateCsrsm2Info(csrsm2Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateCsrsm2Info((csrsm2Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCsrsm2Info((csrsm2Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrsm2Info(csrsm2Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsrsm2Info((csrsm2Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyCsrsm2Info((csrsm2Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateColorInfo(hipsparseColorInfo_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateColorInfo((cusparseColorInfo_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateColorInfo((cusparseColorInfo_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyColorInfo(hipsparseColorInfo_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyColorInfo((cusparseColorInfo_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyColorInfo((cusparseColorInfo_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateCsrilu02Info(csrilu02Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateCsrilu02Info((csrilu02Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCsrilu02Info((csrilu02Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrilu02Info(csrilu02Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyCsrilu02Info((csrilu02Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyCsrilu02Info((csrilu02Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateBsric02Info(bsric02Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateBsric02Info((bsric02Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateBsric02Info((bsric02Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyBsric02Info(bsric02Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyBsric02Info((bsric02Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyBsric02Info((bsric02Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateCsric02Info(csric02Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateCsric02Info((csric02Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCsric02Info((csric02Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsric02Info(csric02Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsric02Info((csric02Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyCsric02Info((csric02Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 12000
 hipsparseStatus_t hipsparseCreateCsrgemm2Info(csrgemm2Info_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateCsrgemm2Info((csrgemm2Info_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateCsrgemm2Info((csrgemm2Info_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsrgemm2Info(csrgemm2Info_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyCsrgemm2Info((csrgemm2Info_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyCsrgemm2Info((csrgemm2Info_t)info)));
 }
 #endif
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreatePruneInfo(pruneInfo_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreatePruneInfo((pruneInfo_t*)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreatePruneInfo((pruneInfo_t*)info)));
 }
 
 hipsparseStatus_t hipsparseDestroyPruneInfo(pruneInfo_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyPruneInfo((pruneInfo_t)info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyPruneInfo((pruneInfo_t)info)));
 }
 #endif
 
 hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateCsru2csrInfo(info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCreateCsru2csrInfo(info)));
 }
 
 hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsru2csrInfo(info));
+    HIPSPARSE_TRACE(info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDestroyCsru2csrInfo(info)));
 }
 
 #if CUDART_VERSION < 12000
@@ -812,14 +1082,16 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSaxpyi((cusparseHandle_t)handle,
                        nnz,
                        alpha,
                        xVal,
                        xInd,
                        y,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
@@ -830,14 +1102,16 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDaxpyi((cusparseHandle_t)handle,
                        nnz,
                        alpha,
                        xVal,
                        xInd,
                        y,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
@@ -848,14 +1122,16 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCaxpyi((cusparseHandle_t)handle,
                        nnz,
                        (const cuComplex*)alpha,
                        (const cuComplex*)xVal,
                        xInd,
                        (cuComplex*)y,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
@@ -866,14 +1142,16 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZaxpyi((cusparseHandle_t)handle,
                        nnz,
                        (const cuDoubleComplex*)alpha,
                        (const cuDoubleComplex*)xVal,
                        xInd,
                        (cuDoubleComplex*)y,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -886,14 +1164,16 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSdoti((cusparseHandle_t)handle,
                       nnz,
                       xVal,
                       xInd,
                       y,
                       result,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
@@ -904,14 +1184,16 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDdoti((cusparseHandle_t)handle,
                       nnz,
                       xVal,
                       xInd,
                       y,
                       result,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
@@ -922,14 +1204,16 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCdoti((cusparseHandle_t)handle,
                       nnz,
                       (const cuComplex*)xVal,
                       xInd,
                       (const cuComplex*)y,
                       (cuComplex*)result,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
@@ -940,14 +1224,16 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZdoti((cusparseHandle_t)handle,
                       nnz,
                       (const cuDoubleComplex*)xVal,
                       xInd,
                       (const cuDoubleComplex*)y,
                       (cuDoubleComplex*)result,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -960,14 +1246,16 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCdotci((cusparseHandle_t)handle,
                        nnz,
                        (const cuComplex*)xVal,
                        xInd,
                        (const cuComplex*)y,
                        (cuComplex*)result,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
@@ -978,14 +1266,16 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, result, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZdotci((cusparseHandle_t)handle,
                        nnz,
                        (const cuDoubleComplex*)xVal,
                        xInd,
                        (const cuDoubleComplex*)y,
                        (cuDoubleComplex*)result,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -997,13 +1287,15 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgthr((cusparseHandle_t)handle,
                       nnz,
                       y,
                       xVal,
                       xInd,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
@@ -1013,13 +1305,15 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgthr((cusparseHandle_t)handle,
                       nnz,
                       y,
                       xVal,
                       xInd,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
@@ -1029,13 +1323,15 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgthr((cusparseHandle_t)handle,
                       nnz,
                       (const cuComplex*)y,
                       (cuComplex*)xVal,
                       xInd,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
@@ -1045,13 +1341,15 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgthr((cusparseHandle_t)handle,
                       nnz,
                       (const cuDoubleComplex*)y,
                       (cuDoubleComplex*)xVal,
                       xInd,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -1063,13 +1361,15 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgthrz((cusparseHandle_t)handle,
                        nnz,
                        y,
                        xVal,
                        xInd,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
@@ -1079,13 +1379,15 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgthrz((cusparseHandle_t)handle,
                        nnz,
                        y,
                        xVal,
                        xInd,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
@@ -1095,13 +1397,15 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgthrz((cusparseHandle_t)handle,
                        nnz,
                        (cuComplex*)y,
                        (cuComplex*)xVal,
                        xInd,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
@@ -1111,13 +1415,15 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, y, xVal, xInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgthrz((cusparseHandle_t)handle,
                        nnz,
                        (cuDoubleComplex*)y,
                        (cuDoubleComplex*)xVal,
                        xInd,
-                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -1131,7 +1437,9 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                                  const float*         s,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSroti((cusparseHandle_t)handle,
                       nnz,
                       xVal,
@@ -1139,7 +1447,7 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                       y,
                       c,
                       s,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
@@ -1151,7 +1459,9 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                                  const double*        s,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDroti((cusparseHandle_t)handle,
                       nnz,
                       xVal,
@@ -1159,7 +1469,7 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                       y,
                       c,
                       s,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -1171,13 +1481,15 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSsctr((cusparseHandle_t)handle,
                       nnz,
                       xVal,
                       xInd,
                       y,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
@@ -1187,13 +1499,15 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDsctr((cusparseHandle_t)handle,
                       nnz,
                       xVal,
                       xInd,
                       y,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
@@ -1203,13 +1517,15 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCsctr((cusparseHandle_t)handle,
                       nnz,
                       (const cuComplex*)xVal,
                       xInd,
                       (cuComplex*)y,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
@@ -1219,13 +1535,15 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, nnz, xVal, xInd, y, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZsctr((cusparseHandle_t)handle,
                       nnz,
                       (const cuDoubleComplex*)xVal,
                       xInd,
                       (cuDoubleComplex*)y,
-                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                      hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -1244,7 +1562,21 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -1257,7 +1589,7 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                        csrSortedColIndA,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
@@ -1274,7 +1606,21 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -1287,7 +1633,7 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                        csrSortedColIndA,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
@@ -1304,7 +1650,21 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -1317,7 +1677,7 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                        csrSortedColIndA,
                        (const cuComplex*)x,
                        (const cuComplex*)beta,
-                       (cuComplex*)y));
+                       (cuComplex*)y)));
 }
 
 hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
@@ -1334,7 +1694,21 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -1347,7 +1721,7 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                        csrSortedColIndA,
                        (const cuDoubleComplex*)x,
                        (const cuDoubleComplex*)beta,
-                       (cuDoubleComplex*)y));
+                       (cuDoubleComplex*)y)));
 }
 #endif
 
@@ -1355,8 +1729,10 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXcsrsv2_zeroPivot((cusparseHandle_t)handle, (csrsv2Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXcsrsv2_zeroPivot((cusparseHandle_t)handle, (csrsv2Info_t)info, position)));
 }
 #endif
 
@@ -1372,7 +1748,18 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipOperationToCudaOperation(transA),
                                    m,
@@ -1382,7 +1769,7 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (csrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1396,7 +1783,18 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipOperationToCudaOperation(transA),
                                    m,
@@ -1406,7 +1804,7 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (csrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1420,7 +1818,18 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipOperationToCudaOperation(transA),
                                    m,
@@ -1430,7 +1839,7 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (csrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -1444,7 +1853,18 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipOperationToCudaOperation(transA),
                                    m,
@@ -1454,7 +1874,7 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    csrSortedRowPtrA,
                                    csrSortedColIndA,
                                    (csrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 #endif
 
@@ -1469,7 +1889,18 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1483,7 +1914,18 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1497,7 +1939,18 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -1511,7 +1964,18 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 #if CUDART_VERSION < 12000
@@ -1527,7 +1991,19 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(transA),
                                  m,
@@ -1538,7 +2014,7 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                  csrSortedColIndA,
                                  (csrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1553,7 +2029,19 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(transA),
                                  m,
@@ -1564,7 +2052,7 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                  csrSortedColIndA,
                                  (csrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1579,7 +2067,19 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(transA),
                                  m,
@@ -1590,7 +2090,7 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                  csrSortedColIndA,
                                  (csrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
@@ -1605,7 +2105,19 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(transA),
                                  m,
@@ -1616,7 +2128,7 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                  csrSortedColIndA,
                                  (csrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 #endif
 
@@ -1636,7 +2148,22 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(transA),
                               m,
@@ -1650,7 +2177,7 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                               f,
                               x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
@@ -1668,7 +2195,22 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(transA),
                               m,
@@ -1682,7 +2224,7 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                               f,
                               x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
@@ -1700,7 +2242,22 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(transA),
                               m,
@@ -1714,7 +2271,7 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                               (const cuComplex*)f,
                               (cuComplex*)x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
@@ -1732,7 +2289,22 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(transA),
                               m,
@@ -1746,7 +2318,7 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                               (const cuDoubleComplex*)f,
                               (cuDoubleComplex*)x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 #endif
 
@@ -1760,7 +2332,9 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseShybmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        alpha,
@@ -1768,7 +2342,7 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                        (const cusparseHybMat_t)hybA,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
@@ -1780,7 +2354,9 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDhybmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        alpha,
@@ -1788,7 +2364,7 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                        (const cusparseHybMat_t)hybA,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
@@ -1800,7 +2376,9 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseChybmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        (const cuComplex*)alpha,
@@ -1808,7 +2386,7 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                        (const cusparseHybMat_t)hybA,
                        (const cuComplex*)x,
                        (const cuComplex*)beta,
-                       (cuComplex*)y));
+                       (cuComplex*)y)));
 }
 
 hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
@@ -1820,7 +2398,9 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZhybmv((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        (const cuDoubleComplex*)alpha,
@@ -1828,7 +2408,7 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                        (const cusparseHybMat_t)hybA,
                        (const cuDoubleComplex*)x,
                        (const cuDoubleComplex*)beta,
-                       (cuDoubleComplex*)y));
+                       (cuDoubleComplex*)y)));
 }
 #endif
 
@@ -1848,7 +2428,23 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrmv((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -1863,7 +2459,7 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                        blockDim,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
@@ -1882,7 +2478,23 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrmv((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -1897,7 +2509,7 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                        blockDim,
                        x,
                        beta,
-                       y));
+                       y)));
 }
 
 hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
@@ -1916,7 +2528,23 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrmv((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -1931,7 +2559,7 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                        blockDim,
                        (const cuComplex*)x,
                        (const cuComplex*)beta,
-                       (cuComplex*)y));
+                       (cuComplex*)y)));
 }
 
 hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
@@ -1950,7 +2578,23 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrmv((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -1965,7 +2609,7 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                        blockDim,
                        (const cuDoubleComplex*)x,
                        (const cuDoubleComplex*)beta,
-                       (cuDoubleComplex*)y));
+                       (cuDoubleComplex*)y)));
 }
 
 #if CUDART_VERSION < 13000
@@ -1988,7 +2632,26 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrxmv((cusparseHandle_t)handle,
                         hipsparse::hipDirectionToCudaDirection(dir),
                         hipsparse::hipOperationToCudaOperation(trans),
@@ -2006,7 +2669,7 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                         blockDim,
                         x,
                         beta,
-                        y));
+                        y)));
 }
 
 hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
@@ -2028,7 +2691,26 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrxmv((cusparseHandle_t)handle,
                         hipsparse::hipDirectionToCudaDirection(dir),
                         hipsparse::hipOperationToCudaOperation(trans),
@@ -2046,7 +2728,7 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                         blockDim,
                         x,
                         beta,
-                        y));
+                        y)));
 }
 
 hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
@@ -2068,7 +2750,26 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrxmv((cusparseHandle_t)handle,
                         hipsparse::hipDirectionToCudaDirection(dir),
                         hipsparse::hipOperationToCudaOperation(trans),
@@ -2086,7 +2787,7 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                         blockDim,
                         (const cuComplex*)x,
                         (const cuComplex*)beta,
-                        (cuComplex*)y));
+                        (cuComplex*)y)));
 }
 
 hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
@@ -2108,7 +2809,26 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    trans,
+                    sizeOfMask,
+                    mb,
+                    nb,
+                    nnzb,
+                    alpha,
+                    descr,
+                    bsrVal,
+                    bsrMaskPtr,
+                    bsrRowPtr,
+                    bsrEndPtr,
+                    bsrColInd,
+                    blockDim,
+                    x,
+                    beta,
+                    y);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrxmv((cusparseHandle_t)handle,
                         hipsparse::hipDirectionToCudaDirection(dir),
                         hipsparse::hipOperationToCudaOperation(trans),
@@ -2126,7 +2846,7 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                         blockDim,
                         (const cuDoubleComplex*)x,
                         (const cuDoubleComplex*)beta,
-                        (cuDoubleComplex*)y));
+                        (cuDoubleComplex*)y)));
 }
 #endif
 
@@ -2134,8 +2854,10 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXbsrsv2_zeroPivot((cusparseHandle_t)handle, (bsrsv2Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXbsrsv2_zeroPivot((cusparseHandle_t)handle, (bsrsv2Info_t)info, position)));
 }
 #endif
 
@@ -2153,7 +2875,20 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dir),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -2165,7 +2900,7 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2181,7 +2916,20 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dir),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -2193,7 +2941,7 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2209,7 +2957,20 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dir),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -2221,7 +2982,7 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
@@ -2237,7 +2998,20 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsv2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dir),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -2249,7 +3023,7 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsv2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 #endif
 
@@ -2266,7 +3040,20 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2282,7 +3069,20 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2298,7 +3098,20 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -2314,7 +3127,20 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 #if CUDART_VERSION < 13000
@@ -2332,7 +3158,21 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dir),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -2345,7 +3185,7 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2362,7 +3202,21 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dir),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -2375,7 +3229,7 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2392,7 +3246,21 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dir),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -2405,7 +3273,7 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
@@ -2422,7 +3290,21 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsv2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dir),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -2435,7 +3317,7 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsv2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 #endif
 
@@ -2457,7 +3339,24 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dir),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -2473,7 +3372,7 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                               f,
                               x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2493,7 +3392,24 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dir),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -2509,7 +3425,7 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                               f,
                               x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2529,7 +3445,24 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dir),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -2545,7 +3478,7 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                               (const cuComplex*)f,
                               (cuComplex*)x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
@@ -2565,7 +3498,24 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    transA,
+                    mb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    f,
+                    x,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsv2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dir),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -2581,7 +3531,7 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                               (const cuDoubleComplex*)f,
                               (cuDoubleComplex*)x,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 #endif
 
@@ -2593,13 +3543,15 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgemvi_bufferSize((cusparseHandle_t)handle,
                                   hipsparse::hipOperationToCudaOperation(transA),
                                   m,
                                   n,
                                   nnz,
-                                  pBufferSizeInBytes));
+                                  pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -2609,13 +3561,15 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgemvi_bufferSize((cusparseHandle_t)handle,
                                   hipsparse::hipOperationToCudaOperation(transA),
                                   m,
                                   n,
                                   nnz,
-                                  pBufferSizeInBytes));
+                                  pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -2625,13 +3579,15 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgemvi_bufferSize((cusparseHandle_t)handle,
                                   hipsparse::hipOperationToCudaOperation(transA),
                                   m,
                                   n,
                                   nnz,
-                                  pBufferSizeInBytes));
+                                  pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
@@ -2641,13 +3597,15 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgemvi_bufferSize((cusparseHandle_t)handle,
                                   hipsparse::hipOperationToCudaOperation(transA),
                                   m,
                                   n,
                                   nnz,
-                                  pBufferSizeInBytes));
+                                  pBufferSizeInBytes)));
 }
 #endif
 
@@ -2667,7 +3625,9 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgemvi((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -2681,7 +3641,7 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                        beta,
                        y,
                        hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                       pBuffer));
+                       pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
@@ -2699,7 +3659,9 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgemvi((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -2713,7 +3675,7 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                        beta,
                        y,
                        hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                       pBuffer));
+                       pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
@@ -2731,7 +3693,9 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgemvi((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -2745,7 +3709,7 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                        (const cuComplex*)beta,
                        (cuComplex*)y,
                        hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                       pBuffer));
+                       pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
@@ -2763,7 +3727,9 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgemvi((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -2777,7 +3743,7 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                        (const cuDoubleComplex*)beta,
                        (cuDoubleComplex*)y,
                        hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                       pBuffer));
+                       pBuffer)));
 }
 #endif
 
@@ -2801,7 +3767,27 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrmm((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -2820,7 +3806,7 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                        ldb,
                        beta,
                        C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
@@ -2843,7 +3829,27 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrmm((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -2862,7 +3868,7 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                        ldb,
                        beta,
                        C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
@@ -2885,7 +3891,27 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrmm((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -2904,7 +3930,7 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                        ldb,
                        (const cuComplex*)beta,
                        (cuComplex*)C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
@@ -2927,7 +3953,27 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transB,
+                    mb,
+                    n,
+                    kb,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrmm((cusparseHandle_t)handle,
                        hipsparse::hipDirectionToCudaDirection(dirA),
                        hipsparse::hipOperationToCudaOperation(transA),
@@ -2946,7 +3992,7 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                        ldb,
                        (const cuDoubleComplex*)beta,
                        (cuDoubleComplex*)C,
-                       ldc));
+                       ldc)));
 }
 
 #if CUDART_VERSION < 11000
@@ -2967,7 +4013,24 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrmm((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -2983,7 +4046,7 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                        ldb,
                        beta,
                        C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
@@ -3003,7 +4066,24 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrmm((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -3019,7 +4099,7 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                        ldb,
                        beta,
                        C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
@@ -3039,7 +4119,24 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrmm((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -3055,7 +4152,7 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                        ldb,
                        (const cuComplex*)beta,
                        (cuComplex*)C,
-                       ldc));
+                       ldc)));
 }
 
 hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
@@ -3075,7 +4172,24 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrmm((cusparseHandle_t)handle,
                        hipsparse::hipOperationToCudaOperation(transA),
                        m,
@@ -3091,7 +4205,7 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                        ldb,
                        (const cuDoubleComplex*)beta,
                        (cuDoubleComplex*)C,
-                       ldc));
+                       ldc)));
 }
 #endif
 
@@ -3114,7 +4228,25 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrmm2((cusparseHandle_t)handle,
                         hipsparse::hipOperationToCudaOperation(transA),
                         hipsparse::hipOperationToCudaOperation(transB),
@@ -3131,7 +4263,7 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                         ldb,
                         beta,
                         C,
-                        ldc));
+                        ldc)));
 }
 
 hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
@@ -3152,7 +4284,25 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrmm2((cusparseHandle_t)handle,
                         hipsparse::hipOperationToCudaOperation(transA),
                         hipsparse::hipOperationToCudaOperation(transB),
@@ -3169,7 +4319,7 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                         ldb,
                         beta,
                         C,
-                        ldc));
+                        ldc)));
 }
 
 hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
@@ -3190,7 +4340,25 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrmm2((cusparseHandle_t)handle,
                         hipsparse::hipOperationToCudaOperation(transA),
                         hipsparse::hipOperationToCudaOperation(transB),
@@ -3207,7 +4375,7 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                         ldb,
                         (const cuComplex*)beta,
                         (cuComplex*)C,
-                        ldc));
+                        ldc)));
 }
 
 hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
@@ -3228,7 +4396,25 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrmm2((cusparseHandle_t)handle,
                         hipsparse::hipOperationToCudaOperation(transA),
                         hipsparse::hipOperationToCudaOperation(transB),
@@ -3245,7 +4431,7 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                         ldb,
                         (const cuDoubleComplex*)beta,
                         (cuDoubleComplex*)C,
-                        ldc));
+                        ldc)));
 }
 #endif
 
@@ -3253,8 +4439,10 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXbsrsm2_zeroPivot((cusparseHandle_t)handle, (bsrsm2Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXbsrsm2_zeroPivot((cusparseHandle_t)handle, (bsrsm2Info_t)info, position)));
 }
 #endif
 
@@ -3274,7 +4462,22 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsm2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -3288,7 +4491,7 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsm2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3306,7 +4509,22 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsm2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -3320,7 +4538,7 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsm2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3338,7 +4556,22 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsm2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -3352,7 +4585,7 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsm2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
@@ -3370,7 +4603,22 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsm2_bufferSize((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    hipsparse::hipOperationToCudaOperation(transA),
@@ -3384,7 +4632,7 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                    bsrSortedColIndA,
                                    blockDim,
                                    (bsrsm2Info_t)info,
-                                   pBufferSizeInBytes));
+                                   pBufferSizeInBytes)));
 }
 #endif
 
@@ -3405,7 +4653,23 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsm2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dirA),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3420,7 +4684,7 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3439,7 +4703,23 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsm2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dirA),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3454,7 +4734,7 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3473,7 +4753,23 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsm2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dirA),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3488,7 +4784,7 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3507,7 +4803,23 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsm2_analysis((cusparseHandle_t)handle,
                                  hipsparse::hipDirectionToCudaDirection(dirA),
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3522,7 +4834,7 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                  blockDim,
                                  (bsrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 #endif
 
@@ -3548,7 +4860,28 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrsm2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dirA),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -3568,7 +4901,7 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                               X,
                               ldx,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
@@ -3592,7 +4925,28 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrsm2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dirA),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -3612,7 +4966,7 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                               X,
                               ldx,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
@@ -3636,7 +4990,28 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrsm2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dirA),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -3656,7 +5031,7 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                               (cuComplex*)X,
                               ldx,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
@@ -3680,7 +5055,28 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    transA,
+                    transX,
+                    mb,
+                    nrhs,
+                    nnzb,
+                    alpha,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    B,
+                    ldb,
+                    X,
+                    ldx,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrsm2_solve((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dirA),
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -3700,7 +5096,7 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                               (cuDoubleComplex*)X,
                               ldx,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 #endif
 
@@ -3708,8 +5104,10 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXcsrsm2_zeroPivot((cusparseHandle_t)handle, (csrsm2Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXcsrsm2_zeroPivot((cusparseHandle_t)handle, (csrsm2Info_t)info, position)));
 }
 #endif
 
@@ -3732,7 +5130,25 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsm2_bufferSizeExt((cusparseHandle_t)handle,
                                       algo,
                                       hipsparse::hipOperationToCudaOperation(transA),
@@ -3749,7 +5165,7 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                       ldb,
                                       (csrsm2Info_t)info,
                                       hipsparse::hipPolicyToCudaPolicy(policy),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -3770,7 +5186,25 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsm2_bufferSizeExt((cusparseHandle_t)handle,
                                       algo,
                                       hipsparse::hipOperationToCudaOperation(transA),
@@ -3787,7 +5221,7 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                       ldb,
                                       (csrsm2Info_t)info,
                                       hipsparse::hipPolicyToCudaPolicy(policy),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -3808,7 +5242,25 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsm2_bufferSizeExt((cusparseHandle_t)handle,
                                       algo,
                                       hipsparse::hipOperationToCudaOperation(transA),
@@ -3825,7 +5277,7 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                       ldb,
                                       (csrsm2Info_t)info,
                                       hipsparse::hipPolicyToCudaPolicy(policy),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -3846,7 +5298,25 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsm2_bufferSizeExt((cusparseHandle_t)handle,
                                       algo,
                                       hipsparse::hipOperationToCudaOperation(transA),
@@ -3863,7 +5333,7 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                       ldb,
                                       (csrsm2Info_t)info,
                                       hipsparse::hipPolicyToCudaPolicy(policy),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 #endif
 
@@ -3886,7 +5356,25 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsm2_analysis((cusparseHandle_t)handle,
                                  algo,
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3903,7 +5391,7 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                  ldb,
                                  (csrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3924,7 +5412,25 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsm2_analysis((cusparseHandle_t)handle,
                                  algo,
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3941,7 +5447,7 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                  ldb,
                                  (csrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -3962,7 +5468,25 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsm2_analysis((cusparseHandle_t)handle,
                                  algo,
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -3979,7 +5503,7 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                  ldb,
                                  (csrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
@@ -4000,7 +5524,25 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsm2_analysis((cusparseHandle_t)handle,
                                  algo,
                                  hipsparse::hipOperationToCudaOperation(transA),
@@ -4017,7 +5559,7 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                  ldb,
                                  (csrsm2Info_t)info,
                                  hipsparse::hipPolicyToCudaPolicy(policy),
-                                 pBuffer));
+                                 pBuffer)));
 }
 #endif
 
@@ -4040,7 +5582,25 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrsm2_solve((cusparseHandle_t)handle,
                               algo,
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -4057,7 +5617,7 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                               ldb,
                               (csrsm2Info_t)info,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4078,7 +5638,25 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrsm2_solve((cusparseHandle_t)handle,
                               algo,
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -4095,7 +5673,7 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                               ldb,
                               (csrsm2Info_t)info,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4116,7 +5694,25 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrsm2_solve((cusparseHandle_t)handle,
                               algo,
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -4133,7 +5729,7 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                               ldb,
                               (csrsm2Info_t)info,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
@@ -4154,7 +5750,25 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    algo,
+                    transA,
+                    transB,
+                    m,
+                    nrhs,
+                    nnz,
+                    alpha,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    B,
+                    ldb,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrsm2_solve((cusparseHandle_t)handle,
                               algo,
                               hipsparse::hipOperationToCudaOperation(transA),
@@ -4171,7 +5785,7 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                               ldb,
                               (csrsm2Info_t)info,
                               hipsparse::hipPolicyToCudaPolicy(policy),
-                              pBuffer));
+                              pBuffer)));
 }
 #endif
 
@@ -4191,20 +5805,35 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgemmi((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  nnz,
-                                                                  alpha,
-                                                                  A,
-                                                                  lda,
-                                                                  cscValB,
-                                                                  cscColPtrB,
-                                                                  cscRowIndB,
-                                                                  beta,
-                                                                  C,
-                                                                  ldc));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgemmi((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        k,
+                                                                        nnz,
+                                                                        alpha,
+                                                                        A,
+                                                                        lda,
+                                                                        cscValB,
+                                                                        cscColPtrB,
+                                                                        cscRowIndB,
+                                                                        beta,
+                                                                        C,
+                                                                        ldc)));
 }
 
 hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
@@ -4222,20 +5851,35 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgemmi((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  nnz,
-                                                                  alpha,
-                                                                  A,
-                                                                  lda,
-                                                                  cscValB,
-                                                                  cscColPtrB,
-                                                                  cscRowIndB,
-                                                                  beta,
-                                                                  C,
-                                                                  ldc));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgemmi((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        k,
+                                                                        nnz,
+                                                                        alpha,
+                                                                        A,
+                                                                        lda,
+                                                                        cscValB,
+                                                                        cscColPtrB,
+                                                                        cscRowIndB,
+                                                                        beta,
+                                                                        C,
+                                                                        ldc)));
 }
 
 hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
@@ -4253,20 +5897,35 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgemmi((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  nnz,
-                                                                  (const cuComplex*)alpha,
-                                                                  (const cuComplex*)A,
-                                                                  lda,
-                                                                  (const cuComplex*)cscValB,
-                                                                  cscColPtrB,
-                                                                  cscRowIndB,
-                                                                  (const cuComplex*)beta,
-                                                                  (cuComplex*)C,
-                                                                  ldc));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgemmi((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        k,
+                                                                        nnz,
+                                                                        (const cuComplex*)alpha,
+                                                                        (const cuComplex*)A,
+                                                                        lda,
+                                                                        (const cuComplex*)cscValB,
+                                                                        cscColPtrB,
+                                                                        cscRowIndB,
+                                                                        (const cuComplex*)beta,
+                                                                        (cuComplex*)C,
+                                                                        ldc)));
 }
 
 hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
@@ -4284,20 +5943,36 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgemmi((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  k,
-                                                                  nnz,
-                                                                  (const cuDoubleComplex*)alpha,
-                                                                  (const cuDoubleComplex*)A,
-                                                                  lda,
-                                                                  (const cuDoubleComplex*)cscValB,
-                                                                  cscColPtrB,
-                                                                  cscRowIndB,
-                                                                  (const cuDoubleComplex*)beta,
-                                                                  (cuDoubleComplex*)C,
-                                                                  ldc));
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    A,
+                    lda,
+                    cscValB,
+                    cscColPtrB,
+                    cscRowIndB,
+                    beta,
+                    C,
+                    ldc);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseZgemmi((cusparseHandle_t)handle,
+                       m,
+                       n,
+                       k,
+                       nnz,
+                       (const cuDoubleComplex*)alpha,
+                       (const cuDoubleComplex*)A,
+                       lda,
+                       (const cuDoubleComplex*)cscValB,
+                       cscColPtrB,
+                       cscRowIndB,
+                       (const cuDoubleComplex*)beta,
+                       (cuDoubleComplex*)C,
+                       ldc)));
 }
 #endif
 
@@ -4317,7 +5992,22 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsrgeamNnz((cusparseHandle_t)handle,
                             m,
                             n,
@@ -4331,7 +6021,7 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                             csrColIndB,
                             (const cusparseMatDescr_t)descrC,
                             csrRowPtrC,
-                            nnzTotalDevHostPtr));
+                            nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
@@ -4354,7 +6044,27 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgeam((cusparseHandle_t)handle,
                          m,
                          n,
@@ -4373,7 +6083,7 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
@@ -4396,7 +6106,27 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgeam((cusparseHandle_t)handle,
                          m,
                          n,
@@ -4415,7 +6145,7 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
@@ -4438,7 +6168,27 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgeam((cusparseHandle_t)handle,
                          m,
                          n,
@@ -4457,7 +6207,7 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
@@ -4480,7 +6230,27 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgeam((cusparseHandle_t)handle,
                          m,
                          n,
@@ -4499,7 +6269,7 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuDoubleComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 #endif
 
@@ -4524,7 +6294,28 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -4544,7 +6335,7 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                         csrSortedValC,
                                         csrSortedRowPtrC,
                                         csrSortedColIndC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4568,7 +6359,28 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -4588,7 +6400,7 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                         csrSortedValC,
                                         csrSortedRowPtrC,
                                         csrSortedColIndC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4612,7 +6424,28 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -4632,7 +6465,7 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                         (cuComplex*)csrSortedValC,
                                         csrSortedRowPtrC,
                                         csrSortedColIndC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -4656,7 +6489,28 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgeam2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -4676,7 +6530,7 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                         (cuDoubleComplex*)csrSortedValC,
                                         csrSortedRowPtrC,
                                         csrSortedColIndC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
@@ -4695,7 +6549,23 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    nnzA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    descrB,
+                    nnzB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedRowPtrC,
+                    nnzTotalDevHostPtr,
+                    workspace);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsrgeam2Nnz((cusparseHandle_t)handle,
                              m,
                              n,
@@ -4710,7 +6580,7 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                              (const cusparseMatDescr_t)descrC,
                              csrSortedRowPtrC,
                              nnzTotalDevHostPtr,
-                             workspace));
+                             workspace)));
 }
 
 hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
@@ -4734,7 +6604,28 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgeam2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -4754,7 +6645,7 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                           csrSortedValC,
                           csrSortedRowPtrC,
                           csrSortedColIndC,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
@@ -4778,7 +6669,28 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgeam2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -4798,7 +6710,7 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                           csrSortedValC,
                           csrSortedRowPtrC,
                           csrSortedColIndC,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
@@ -4822,7 +6734,28 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgeam2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -4842,7 +6775,7 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                           (cuComplex*)csrSortedValC,
                           csrSortedRowPtrC,
                           csrSortedColIndC,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
@@ -4866,7 +6799,28 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    beta,
+                    descrB,
+                    nnzB,
+                    csrSortedValB,
+                    csrSortedRowPtrB,
+                    csrSortedColIndB,
+                    descrC,
+                    csrSortedValC,
+                    csrSortedRowPtrC,
+                    csrSortedColIndC,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgeam2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -4886,7 +6840,7 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                           (cuDoubleComplex*)csrSortedValC,
                           csrSortedRowPtrC,
                           csrSortedColIndC,
-                          pBuffer));
+                          pBuffer)));
 }
 
 #if CUDART_VERSION < 11000
@@ -4908,7 +6862,25 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsrgemmNnz((cusparseHandle_t)handle,
                             hipsparse::hipOperationToCudaOperation(transA),
                             hipsparse::hipOperationToCudaOperation(transB),
@@ -4925,7 +6897,7 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                             csrColIndB,
                             (const cusparseMatDescr_t)descrC,
                             csrRowPtrC,
-                            nnzTotalDevHostPtr));
+                            nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
@@ -4949,7 +6921,28 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgemm((cusparseHandle_t)handle,
                          hipsparse::hipOperationToCudaOperation(transA),
                          hipsparse::hipOperationToCudaOperation(transB),
@@ -4969,7 +6962,7 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
@@ -4993,7 +6986,28 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgemm((cusparseHandle_t)handle,
                          hipsparse::hipOperationToCudaOperation(transA),
                          hipsparse::hipOperationToCudaOperation(transB),
@@ -5013,7 +7027,7 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
@@ -5037,7 +7051,28 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgemm((cusparseHandle_t)handle,
                          hipsparse::hipOperationToCudaOperation(transA),
                          hipsparse::hipOperationToCudaOperation(transB),
@@ -5057,7 +7092,7 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
@@ -5081,7 +7116,28 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgemm((cusparseHandle_t)handle,
                          hipsparse::hipOperationToCudaOperation(transA),
                          hipsparse::hipOperationToCudaOperation(transB),
@@ -5101,7 +7157,7 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuDoubleComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 #endif
 
@@ -5127,7 +7183,28 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgemm2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -5147,7 +7224,7 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                         csrRowPtrD,
                                         csrColIndD,
                                         (csrgemm2Info_t)info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5171,7 +7248,28 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgemm2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -5191,7 +7289,7 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                         csrRowPtrD,
                                         csrColIndD,
                                         (csrgemm2Info_t)info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5215,7 +7313,28 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgemm2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -5235,7 +7354,7 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                         csrRowPtrD,
                                         csrColIndD,
                                         (csrgemm2Info_t)info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         handle,
@@ -5259,7 +7378,28 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgemm2_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -5279,7 +7419,7 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                         csrRowPtrD,
                                         csrColIndD,
                                         (csrgemm2Info_t)info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
@@ -5304,7 +7444,29 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    descrA,
+                    nnzA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    descrD,
+                    nnzD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsrgemm2Nnz((cusparseHandle_t)handle,
                              m,
                              n,
@@ -5325,7 +7487,7 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                              csrRowPtrC,
                              nnzTotalDevHostPtr,
                              (const csrgemm2Info_t)info,
-                             pBuffer));
+                             pBuffer)));
 }
 
 hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
@@ -5356,7 +7518,35 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrgemm2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -5383,7 +7573,7 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                           csrRowPtrC,
                           csrColIndC,
                           (const csrgemm2Info_t)info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
@@ -5414,7 +7604,35 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrgemm2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -5441,7 +7659,7 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                           csrRowPtrC,
                           csrColIndC,
                           (const csrgemm2Info_t)info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
@@ -5472,7 +7690,35 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrgemm2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -5499,7 +7745,7 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                           csrRowPtrC,
                           csrColIndC,
                           (const csrgemm2Info_t)info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
@@ -5530,7 +7776,35 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    descrA,
+                    nnzA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    descrB,
+                    nnzB,
+                    csrValB,
+                    csrRowPtrB,
+                    csrColIndB,
+                    beta,
+                    descrD,
+                    nnzD,
+                    csrValD,
+                    csrRowPtrD,
+                    csrColIndD,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrgemm2((cusparseHandle_t)handle,
                           m,
                           n,
@@ -5557,7 +7831,7 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                           csrRowPtrC,
                           csrColIndC,
                           (const csrgemm2Info_t)info,
-                          pBuffer));
+                          pBuffer)));
 }
 #endif
 
@@ -5565,8 +7839,10 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXbsrilu02_zeroPivot((cusparseHandle_t)handle, (bsrilu02Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXbsrilu02_zeroPivot((cusparseHandle_t)handle, (bsrilu02Info_t)info, position)));
 }
 #endif
 
@@ -5574,15 +7850,19 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSbsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSbsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDbsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDbsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -5591,8 +7871,10 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCbsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, (cuComplex*)boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCbsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (bsrilu02Info_t)info, enable_boost, tol, (cuComplex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -5601,12 +7883,14 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrilu02_numericBoost((cusparseHandle_t)handle,
                                        (bsrilu02Info_t)info,
                                        enable_boost,
                                        tol,
-                                       (cuDoubleComplex*)boost_val));
+                                       (cuDoubleComplex*)boost_val)));
 }
 #endif
 
@@ -5623,7 +7907,19 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrilu02_bufferSize((cusparseHandle_t)handle,
                                      hipsparse::hipDirectionToCudaDirection(dirA),
                                      mb,
@@ -5634,7 +7930,7 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                      bsrSortedColIndA,
                                      blockDim,
                                      (bsrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -5649,7 +7945,19 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrilu02_bufferSize((cusparseHandle_t)handle,
                                      hipsparse::hipDirectionToCudaDirection(dirA),
                                      mb,
@@ -5660,7 +7968,7 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                      bsrSortedColIndA,
                                      blockDim,
                                      (bsrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -5675,7 +7983,19 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrilu02_bufferSize((cusparseHandle_t)handle,
                                      hipsparse::hipDirectionToCudaDirection(dirA),
                                      mb,
@@ -5686,7 +8006,7 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                      bsrSortedColIndA,
                                      blockDim,
                                      (bsrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -5701,7 +8021,19 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrilu02_bufferSize((cusparseHandle_t)handle,
                                      hipsparse::hipDirectionToCudaDirection(dirA),
                                      mb,
@@ -5712,7 +8044,7 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                      bsrSortedColIndA,
                                      blockDim,
                                      (bsrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 #endif
 
@@ -5730,7 +8062,20 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrilu02_analysis((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    mb,
@@ -5742,7 +8087,7 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                    blockDim,
                                    (bsrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -5758,7 +8103,20 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrilu02_analysis((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    mb,
@@ -5770,7 +8128,7 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                    blockDim,
                                    (bsrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -5786,7 +8144,20 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrilu02_analysis((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    mb,
@@ -5798,7 +8169,7 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                    blockDim,
                                    (bsrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
@@ -5814,7 +8185,20 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrilu02_analysis((cusparseHandle_t)handle,
                                    hipsparse::hipDirectionToCudaDirection(dirA),
                                    mb,
@@ -5826,7 +8210,7 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                    blockDim,
                                    (bsrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 #endif
 
@@ -5846,7 +8230,20 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA_valM,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsrilu02((cusparseHandle_t)handle,
                           hipsparse::hipDirectionToCudaDirection(dirA),
                           mb,
@@ -5858,7 +8255,7 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                           blockDim,
                           (bsrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
@@ -5876,7 +8273,20 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA_valM,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsrilu02((cusparseHandle_t)handle,
                           hipsparse::hipDirectionToCudaDirection(dirA),
                           mb,
@@ -5888,7 +8298,7 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                           blockDim,
                           (bsrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
@@ -5906,7 +8316,20 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA_valM,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsrilu02((cusparseHandle_t)handle,
                           hipsparse::hipDirectionToCudaDirection(dirA),
                           mb,
@@ -5918,7 +8341,7 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                           blockDim,
                           (bsrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
@@ -5936,7 +8359,20 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrSortedValA_valM,
+                    bsrSortedRowPtrA,
+                    bsrSortedColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsrilu02((cusparseHandle_t)handle,
                           hipsparse::hipDirectionToCudaDirection(dirA),
                           mb,
@@ -5948,7 +8384,7 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                           blockDim,
                           (bsrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 #endif
 
@@ -5956,8 +8392,10 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXcsrilu02_zeroPivot((cusparseHandle_t)handle, (csrilu02Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXcsrilu02_zeroPivot((cusparseHandle_t)handle, (csrilu02Info_t)info, position)));
 }
 #endif
 
@@ -5965,15 +8403,19 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDcsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDcsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, boost_val)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -5982,8 +8424,10 @@ hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCcsrilu02_numericBoost(
-        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, (cuComplex*)boost_val));
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCcsrilu02_numericBoost(
+        (cusparseHandle_t)handle, (csrilu02Info_t)info, enable_boost, tol, (cuComplex*)boost_val)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
@@ -5992,12 +8436,14 @@ hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, info, enable_boost, tol, boost_val);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrilu02_numericBoost((cusparseHandle_t)handle,
                                        (csrilu02Info_t)info,
                                        enable_boost,
                                        tol,
-                                       (cuDoubleComplex*)boost_val));
+                                       (cuDoubleComplex*)boost_val)));
 }
 #endif
 
@@ -6012,7 +8458,17 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrilu02_bufferSize((cusparseHandle_t)handle,
                                      m,
                                      nnz,
@@ -6021,7 +8477,7 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (csrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6034,7 +8490,17 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrilu02_bufferSize((cusparseHandle_t)handle,
                                      m,
                                      nnz,
@@ -6043,7 +8509,7 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (csrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6056,7 +8522,17 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrilu02_bufferSize((cusparseHandle_t)handle,
                                      m,
                                      nnz,
@@ -6065,7 +8541,7 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (csrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle,
@@ -6078,7 +8554,17 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrilu02_bufferSize((cusparseHandle_t)handle,
                                      m,
                                      nnz,
@@ -6087,7 +8573,7 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                      csrSortedRowPtrA,
                                      csrSortedColIndA,
                                      (csrilu02Info_t)info,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 #endif
 
@@ -6101,7 +8587,17 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6114,7 +8610,17 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6127,7 +8633,17 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6140,7 +8656,17 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 #if CUDART_VERSION < 13000
@@ -6155,7 +8681,18 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrilu02_analysis((cusparseHandle_t)handle,
                                    m,
                                    nnz,
@@ -6165,7 +8702,7 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                    csrSortedColIndA,
                                    (csrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6179,7 +8716,18 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrilu02_analysis((cusparseHandle_t)handle,
                                    m,
                                    nnz,
@@ -6189,7 +8737,7 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                    csrSortedColIndA,
                                    (csrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6203,7 +8751,18 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrilu02_analysis((cusparseHandle_t)handle,
                                    m,
                                    nnz,
@@ -6213,7 +8772,7 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                    csrSortedColIndA,
                                    (csrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
@@ -6227,7 +8786,18 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrilu02_analysis((cusparseHandle_t)handle,
                                    m,
                                    nnz,
@@ -6237,7 +8807,7 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                    csrSortedColIndA,
                                    (csrilu02Info_t)info,
                                    hipsparse::hipPolicyToCudaPolicy(policy),
-                                   pBuffer));
+                                   pBuffer)));
 }
 #endif
 
@@ -6255,7 +8825,18 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrilu02((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -6265,7 +8846,7 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (csrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
@@ -6281,7 +8862,18 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrilu02((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -6291,7 +8883,7 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (csrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
@@ -6307,7 +8899,18 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrilu02((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -6317,7 +8920,7 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (csrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
@@ -6333,7 +8936,18 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrilu02((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -6343,7 +8957,7 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                           csrSortedColIndA,
                           (csrilu02Info_t)info,
                           hipsparse::hipPolicyToCudaPolicy(policy),
-                          pBuffer));
+                          pBuffer)));
 }
 #endif
 
@@ -6351,8 +8965,10 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXbsric02_zeroPivot((cusparseHandle_t)handle, (bsric02Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXbsric02_zeroPivot((cusparseHandle_t)handle, (bsric02Info_t)info, position)));
 }
 #endif
 
@@ -6369,7 +8985,19 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsric02_bufferSize((cusparseHandle_t)handle,
                                     hipsparse::hipDirectionToCudaDirection(dirA),
                                     mb,
@@ -6380,7 +9008,7 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                     bsrColIndA,
                                     blockDim,
                                     (bsric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6395,7 +9023,19 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsric02_bufferSize((cusparseHandle_t)handle,
                                     hipsparse::hipDirectionToCudaDirection(dirA),
                                     mb,
@@ -6406,7 +9046,7 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                     bsrColIndA,
                                     blockDim,
                                     (bsric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6421,7 +9061,19 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsric02_bufferSize((cusparseHandle_t)handle,
                                     hipsparse::hipDirectionToCudaDirection(dirA),
                                     mb,
@@ -6432,7 +9084,7 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                     bsrColIndA,
                                     blockDim,
                                     (bsric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6447,7 +9099,19 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsric02_bufferSize((cusparseHandle_t)handle,
                                     hipsparse::hipDirectionToCudaDirection(dirA),
                                     mb,
@@ -6458,7 +9122,7 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                     bsrColIndA,
                                     blockDim,
                                     (bsric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 #endif
 
@@ -6476,7 +9140,20 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsric02_analysis((cusparseHandle_t)handle,
                                   hipsparse::hipDirectionToCudaDirection(dirA),
                                   mb,
@@ -6488,7 +9165,7 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                   blockDim,
                                   (bsric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
@@ -6504,7 +9181,20 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsric02_analysis((cusparseHandle_t)handle,
                                   hipsparse::hipDirectionToCudaDirection(dirA),
                                   mb,
@@ -6516,7 +9206,7 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                   blockDim,
                                   (bsric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
@@ -6532,7 +9222,20 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsric02_analysis((cusparseHandle_t)handle,
                                   hipsparse::hipDirectionToCudaDirection(dirA),
                                   mb,
@@ -6544,7 +9247,7 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                   blockDim,
                                   (bsric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
@@ -6560,7 +9263,20 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsric02_analysis((cusparseHandle_t)handle,
                                   hipsparse::hipDirectionToCudaDirection(dirA),
                                   mb,
@@ -6572,7 +9288,7 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                   blockDim,
                                   (bsric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 #endif
 
@@ -6590,7 +9306,20 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsric02((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -6602,7 +9331,7 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                          blockDim,
                          (bsric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
@@ -6618,7 +9347,20 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsric02((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -6630,7 +9372,7 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                          blockDim,
                          (bsric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
@@ -6646,7 +9388,20 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsric02((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -6658,7 +9413,7 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                          blockDim,
                          (bsric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
@@ -6674,7 +9429,20 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsric02((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -6686,7 +9454,7 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                          blockDim,
                          (bsric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 #endif
 
@@ -6694,8 +9462,10 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXcsric02_zeroPivot((cusparseHandle_t)handle, (csric02Info_t)info, position));
+    HIPSPARSE_TRACE(handle, info, position);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXcsric02_zeroPivot((cusparseHandle_t)handle, (csric02Info_t)info, position)));
 }
 #endif
 
@@ -6710,7 +9480,17 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsric02_bufferSize((cusparseHandle_t)handle,
                                     m,
                                     nnz,
@@ -6719,7 +9499,7 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (csric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6732,7 +9512,17 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsric02_bufferSize((cusparseHandle_t)handle,
                                     m,
                                     nnz,
@@ -6741,7 +9531,7 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (csric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6754,7 +9544,17 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsric02_bufferSize((cusparseHandle_t)handle,
                                     m,
                                     nnz,
@@ -6763,7 +9563,7 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (csric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
@@ -6776,7 +9576,17 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsric02_bufferSize((cusparseHandle_t)handle,
                                     m,
                                     nnz,
@@ -6785,7 +9595,7 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                     csrSortedRowPtrA,
                                     csrSortedColIndA,
                                     (csric02Info_t)info,
-                                    pBufferSizeInBytes));
+                                    pBufferSizeInBytes)));
 }
 #endif
 
@@ -6799,7 +9609,17 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6812,7 +9632,17 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6825,7 +9655,17 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         handle,
@@ -6838,7 +9678,17 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
-    return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(HIPSPARSE_STATUS_INTERNAL_ERROR);
 }
 
 #if CUDART_VERSION < 13000
@@ -6853,7 +9703,18 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsric02_analysis((cusparseHandle_t)handle,
                                   m,
                                   nnz,
@@ -6863,7 +9724,7 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                   csrSortedColIndA,
                                   (csric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
@@ -6877,7 +9738,18 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsric02_analysis((cusparseHandle_t)handle,
                                   m,
                                   nnz,
@@ -6887,7 +9759,7 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                   csrSortedColIndA,
                                   (csric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
@@ -6901,7 +9773,18 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsric02_analysis((cusparseHandle_t)handle,
                                   m,
                                   nnz,
@@ -6911,7 +9794,7 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                   csrSortedColIndA,
                                   (csric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
@@ -6925,7 +9808,18 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsric02_analysis((cusparseHandle_t)handle,
                                   m,
                                   nnz,
@@ -6935,7 +9829,7 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                   csrSortedColIndA,
                                   (csric02Info_t)info,
                                   hipsparse::hipPolicyToCudaPolicy(policy),
-                                  pBuffer));
+                                  pBuffer)));
 }
 #endif
 
@@ -6953,7 +9847,18 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsric02((cusparseHandle_t)handle,
                          m,
                          nnz,
@@ -6963,7 +9868,7 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (csric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
@@ -6979,7 +9884,18 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsric02((cusparseHandle_t)handle,
                          m,
                          nnz,
@@ -6989,7 +9905,7 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (csric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
@@ -7005,7 +9921,18 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsric02((cusparseHandle_t)handle,
                          m,
                          nnz,
@@ -7015,7 +9942,7 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (csric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
@@ -7031,7 +9958,18 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrSortedValA_valM,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    info,
+                    policy,
+                    pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsric02((cusparseHandle_t)handle,
                          m,
                          nnz,
@@ -7041,7 +9979,7 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (csric02Info_t)info,
                          hipsparse::hipPolicyToCudaPolicy(policy),
-                         pBuffer));
+                         pBuffer)));
 }
 #endif
 
@@ -7055,7 +9993,9 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSnnz((cusparseHandle_t)handle,
                      hipsparse::hipDirectionToCudaDirection(dirA),
                      m,
@@ -7064,7 +10004,7 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                      A,
                      lda,
                      nnzPerRowColumn,
-                     nnzTotalDevHostPtr));
+                     nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
@@ -7077,7 +10017,9 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDnnz((cusparseHandle_t)handle,
                      hipsparse::hipDirectionToCudaDirection(dirA),
                      m,
@@ -7086,7 +10028,7 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                      A,
                      lda,
                      nnzPerRowColumn,
-                     nnzTotalDevHostPtr));
+                     nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
@@ -7099,7 +10041,9 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCnnz((cusparseHandle_t)handle,
                      hipsparse::hipDirectionToCudaDirection(dirA),
                      m,
@@ -7108,7 +10052,7 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                      (const cuComplex*)A,
                      lda,
                      nnzPerRowColumn,
-                     nnzTotalDevHostPtr));
+                     nnzTotalDevHostPtr)));
 }
 
 hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
@@ -7121,7 +10065,9 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZnnz((cusparseHandle_t)handle,
                      hipsparse::hipDirectionToCudaDirection(dirA),
                      m,
@@ -7130,7 +10076,7 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                      (const cuDoubleComplex*)A,
                      lda,
                      nnzPerRowColumn,
-                     nnzTotalDevHostPtr));
+                     nnzTotalDevHostPtr)));
 }
 
 #if CUDART_VERSION < 12000
@@ -7145,7 +10091,9 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSdense2csr((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7155,7 +10103,7 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                            nnzPerRow,
                            csrVal,
                            csrRowPtr,
-                           csrColInd));
+                           csrColInd)));
 }
 
 hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
@@ -7169,7 +10117,9 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDdense2csr((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7179,7 +10129,7 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                            nnzPerRow,
                            csrVal,
                            csrRowPtr,
-                           csrColInd));
+                           csrColInd)));
 }
 
 hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
@@ -7193,7 +10143,9 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCdense2csr((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7203,7 +10155,7 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                            nnzPerRow,
                            (cuComplex*)csrVal,
                            csrRowPtr,
-                           csrColInd));
+                           csrColInd)));
 }
 
 hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
@@ -7217,7 +10169,9 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZdense2csr((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7227,7 +10181,7 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                            nnzPerRow,
                            (cuDoubleComplex*)csrVal,
                            csrRowPtr,
-                           csrColInd));
+                           csrColInd)));
 }
 #endif
 
@@ -7244,7 +10198,19 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
                                               m,
                                               n,
@@ -7255,7 +10221,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                               csrVal,
                                               csrRowPtr,
                                               csrColInd,
-                                              pBufferSizeInBytes));
+                                              pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t         handle,
@@ -7270,7 +10236,19 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
                                               m,
                                               n,
@@ -7281,7 +10259,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                               csrVal,
                                               csrRowPtr,
                                               csrColInd,
-                                              pBufferSizeInBytes));
+                                              pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7296,7 +10274,19 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
                                               m,
                                               n,
@@ -7307,7 +10297,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                               csrVal,
                                               csrRowPtr,
                                               csrColInd,
-                                              pBufferSizeInBytes));
+                                              pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -7322,7 +10312,19 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    threshold,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csr_bufferSizeExt((cusparseHandle_t)handle,
                                               m,
                                               n,
@@ -7333,7 +10335,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                               csrVal,
                                               csrRowPtr,
                                               csrColInd,
-                                              pBufferSizeInBytes));
+                                              pBufferSizeInBytes)));
 }
 #endif
 
@@ -7349,7 +10351,9 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csrNnz((cusparseHandle_t)handle,
                                    m,
                                    n,
@@ -7359,7 +10363,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                    (const cusparseMatDescr_t)descr,
                                    csrRowPtr,
                                    nnzTotalDevHostPtr,
-                                   buffer));
+                                   buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
@@ -7373,7 +10377,9 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csrNnz((cusparseHandle_t)handle,
                                    m,
                                    n,
@@ -7383,7 +10389,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                    (const cusparseMatDescr_t)descr,
                                    csrRowPtr,
                                    nnzTotalDevHostPtr,
-                                   buffer));
+                                   buffer)));
 }
 #endif
 
@@ -7400,7 +10406,9 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csr((cusparseHandle_t)handle,
                                 m,
                                 n,
@@ -7411,7 +10419,7 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                 csrVal,
                                 csrRowPtr,
                                 csrColInd,
-                                buffer));
+                                buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
@@ -7426,7 +10434,9 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csr((cusparseHandle_t)handle,
                                 m,
                                 n,
@@ -7437,7 +10447,7 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                 csrVal,
                                 csrRowPtr,
                                 csrColInd,
-                                buffer));
+                                buffer)));
 }
 #endif
 
@@ -7455,7 +10465,20 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -7467,7 +10490,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                           csrRowPtr,
                                                           csrColInd,
                                                           (pruneInfo_t)info,
-                                                          pBufferSizeInBytes));
+                                                          pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandle_t handle,
@@ -7483,7 +10506,20 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -7495,7 +10531,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                           csrRowPtr,
                                                           csrColInd,
                                                           (pruneInfo_t)info,
-                                                          pBufferSizeInBytes));
+                                                          pBufferSizeInBytes)));
 }
 #endif
 
@@ -7514,7 +10550,20 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -7526,7 +10575,7 @@ hipsparseStatus_t
                                                           csrRowPtr,
                                                           csrColInd,
                                                           (pruneInfo_t)info,
-                                                          pBufferSizeInBytes));
+                                                          pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t
@@ -7543,7 +10592,20 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                           m,
                                                           n,
@@ -7555,7 +10617,7 @@ hipsparseStatus_t
                                                           csrRowPtr,
                                                           csrColInd,
                                                           (pruneInfo_t)info,
-                                                          pBufferSizeInBytes));
+                                                          pBufferSizeInBytes)));
 }
 #endif
 
@@ -7572,7 +10634,19 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrRowPtr,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
                                                m,
                                                n,
@@ -7583,7 +10657,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                csrRowPtr,
                                                nnzTotalDevHostPtr,
                                                (pruneInfo_t)info,
-                                               buffer));
+                                               buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -7598,7 +10672,19 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrRowPtr,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csrNnzByPercentage((cusparseHandle_t)handle,
                                                m,
                                                n,
@@ -7609,7 +10695,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                csrRowPtr,
                                                nnzTotalDevHostPtr,
                                                (pruneInfo_t)info,
-                                               buffer));
+                                               buffer)));
 }
 #endif
 
@@ -7627,7 +10713,20 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneDense2csrByPercentage((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -7639,7 +10738,7 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                             csrRowPtr,
                                             csrColInd,
                                             (pruneInfo_t)info,
-                                            buffer));
+                                            buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t         handle,
@@ -7655,7 +10754,20 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    A,
+                    lda,
+                    percentage,
+                    descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneDense2csrByPercentage((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -7667,7 +10779,7 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                             csrRowPtr,
                                             csrColInd,
                                             (pruneInfo_t)info,
-                                            buffer));
+                                            buffer)));
 }
 #endif
 
@@ -7683,7 +10795,9 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSdense2csc((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7693,7 +10807,7 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                            nnzPerColumn,
                            cscVal,
                            cscRowInd,
-                           cscColPtr));
+                           cscColPtr)));
 }
 
 hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
@@ -7707,7 +10821,9 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDdense2csc((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7717,7 +10833,7 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                            nnzPerColumn,
                            cscVal,
                            cscRowInd,
-                           cscColPtr));
+                           cscColPtr)));
 }
 
 hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
@@ -7731,7 +10847,9 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCdense2csc((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7741,7 +10859,7 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                            nnzPerColumn,
                            (cuComplex*)cscVal,
                            cscRowInd,
-                           cscColPtr));
+                           cscColPtr)));
 }
 
 hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
@@ -7755,7 +10873,9 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, A, ld, nnzPerColumn, cscVal, cscRowInd, cscColPtr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZdense2csc((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7765,7 +10885,7 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                            nnzPerColumn,
                            (cuDoubleComplex*)cscVal,
                            cscRowInd,
-                           cscColPtr));
+                           cscColPtr)));
 }
 #endif
 
@@ -7780,7 +10900,9 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7789,7 +10911,7 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                            csrRowPtr,
                            csrColInd,
                            A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
@@ -7802,7 +10924,9 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7811,7 +10935,7 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                            csrRowPtr,
                            csrColInd,
                            A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
@@ -7824,7 +10948,9 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7833,7 +10959,7 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                            csrRowPtr,
                            csrColInd,
                            (hipComplex*)A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
@@ -7846,7 +10972,9 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7855,7 +10983,7 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                            csrRowPtr,
                            csrColInd,
                            (cuDoubleComplex*)A,
-                           ld));
+                           ld)));
 }
 #endif
 
@@ -7870,7 +10998,9 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsc2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7879,7 +11009,7 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                            cscRowInd,
                            cscColPtr,
                            A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
@@ -7892,7 +11022,9 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsc2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7901,7 +11033,7 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                            cscRowInd,
                            cscColPtr,
                            A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
@@ -7914,7 +11046,9 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsc2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7923,7 +11057,7 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                            cscRowInd,
                            cscColPtr,
                            (cuComplex*)A,
-                           ld));
+                           ld)));
 }
 
 hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
@@ -7936,7 +11070,9 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsc2dense((cusparseHandle_t)handle,
                            m,
                            n,
@@ -7945,7 +11081,7 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                            cscRowInd,
                            cscColPtr,
                            (cuDoubleComplex*)A,
-                           ld));
+                           ld)));
 }
 #endif
 
@@ -7960,6 +11096,17 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
@@ -7973,7 +11120,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                         colBlockDim,
                                         &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
@@ -7987,6 +11134,17 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
@@ -8000,7 +11158,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                         colBlockDim,
                                         &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
@@ -8014,6 +11172,17 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
@@ -8027,7 +11196,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                         colBlockDim,
                                         &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handle,
@@ -8041,6 +11210,17 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     colBlockDim,
                                                    size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgebsr2gebsc_bufferSize((cusparseHandle_t)handle,
@@ -8054,7 +11234,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                         colBlockDim,
                                         &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
@@ -8073,7 +11253,23 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idxBase,
                                         void*                temp_buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idxBase,
+                    temp_buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgebsr2gebsc((cusparseHandle_t)handle,
                              mb,
                              nb,
@@ -8088,7 +11284,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                              bscColPtr,
                              hipsparse::hipActionToCudaAction(copyValues),
                              hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                             temp_buffer));
+                             temp_buffer)));
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
@@ -8107,8 +11303,23 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idxBase,
                                         void*                temp_buffer)
 {
-
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idxBase,
+                    temp_buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgebsr2gebsc((cusparseHandle_t)handle,
                              mb,
                              nb,
@@ -8123,7 +11334,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                              bscColPtr,
                              hipsparse::hipActionToCudaAction(copyValues),
                              hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                             temp_buffer));
+                             temp_buffer)));
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
@@ -8142,7 +11353,23 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idxBase,
                                         void*                temp_buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idxBase,
+                    temp_buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgebsr2gebsc((cusparseHandle_t)handle,
                              mb,
                              nb,
@@ -8157,7 +11384,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                              bscColPtr,
                              hipsparse::hipActionToCudaAction(copyValues),
                              hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                             temp_buffer));
+                             temp_buffer)));
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
@@ -8176,7 +11403,23 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idxBase,
                                         void*                   temp_buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    mb,
+                    nb,
+                    nnzb,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    bscVal,
+                    bscRowInd,
+                    bscColPtr,
+                    copyValues,
+                    idxBase,
+                    temp_buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgebsr2gebsc((cusparseHandle_t)handle,
                              mb,
                              nb,
@@ -8191,7 +11434,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                              bscColPtr,
                              hipsparse::hipActionToCudaAction(copyValues),
                              hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                             temp_buffer));
+                             temp_buffer)));
 }
 
 hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -8206,6 +11449,18 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2gebsr_bufferSize((cusparseHandle_t)handle,
@@ -8220,7 +11475,7 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                       colBlockDim,
                                       &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -8235,6 +11490,18 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2gebsr_bufferSize((cusparseHandle_t)handle,
@@ -8249,7 +11516,7 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                       colBlockDim,
                                       &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -8264,6 +11531,17 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
 
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
@@ -8279,7 +11557,7 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                       colBlockDim,
                                       &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -8294,6 +11572,18 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pBufferSizeInBytes);
+
     int               cu_buffer_size;
     hipsparseStatus_t status = hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2gebsr_bufferSize((cusparseHandle_t)handle,
@@ -8308,7 +11598,7 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                       colBlockDim,
                                       &cu_buffer_size));
     pBufferSizeInBytes[0] = cu_buffer_size;
-    return status;
+    return trace(status);
 }
 
 hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
@@ -8325,8 +11615,21 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsrNnzDevhost,
                                          void*                     pbuffer)
 {
-
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrRowPtr,
+                    rowBlockDim,
+                    colBlockDim,
+                    bsrNnzDevhost,
+                    pbuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsr2gebsrNnz((cusparseHandle_t)handle,
                               hipsparse::hipDirectionToCudaDirection(dir),
                               m,
@@ -8339,7 +11642,7 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                               rowBlockDim,
                               colBlockDim,
                               bsrNnzDevhost,
-                              pbuffer));
+                              pbuffer)));
 }
 
 hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
@@ -8358,7 +11661,23 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2gebsr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dir),
                            m,
@@ -8373,7 +11692,7 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                            bsrColInd,
                            rowBlockDim,
                            colBlockDim,
-                           pbuffer));
+                           pbuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
@@ -8392,7 +11711,23 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2gebsr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dir),
                            m,
@@ -8407,7 +11742,7 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                            bsrColInd,
                            rowBlockDim,
                            colBlockDim,
-                           pbuffer));
+                           pbuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
@@ -8426,7 +11761,23 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2gebsr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dir),
                            m,
@@ -8441,7 +11792,7 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                            bsrColInd,
                            rowBlockDim,
                            colBlockDim,
-                           pbuffer));
+                           pbuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
@@ -8460,7 +11811,23 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dir,
+                    m,
+                    n,
+                    csr_descr,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    bsr_descr,
+                    bsrVal,
+                    bsrRowPtr,
+                    bsrColInd,
+                    rowBlockDim,
+                    colBlockDim,
+                    pbuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2gebsr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dir),
                            m,
@@ -8475,7 +11842,7 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                            bsrColInd,
                            rowBlockDim,
                            colBlockDim,
-                           pbuffer));
+                           pbuffer)));
 }
 
 hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
@@ -8490,7 +11857,19 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrRowPtrC,
+                    bsrNnzb);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsr2bsrNnz((cusparseHandle_t)handle,
                             hipsparse::hipDirectionToCudaDirection(dirA),
                             m,
@@ -8501,7 +11880,7 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                             blockDim,
                             (const cusparseMatDescr_t)descrC,
                             bsrRowPtrC,
-                            bsrNnzb));
+                            bsrNnzb)));
 }
 
 #if CUDART_VERSION < 13000
@@ -8514,7 +11893,9 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          float                     tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSnnz_compress((cusparseHandle_t)handle,
                               m,
                               (const cusparseMatDescr_t)descrA,
@@ -8522,7 +11903,7 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                               csrRowPtrA,
                               nnzPerRow,
                               nnzC,
-                              tol));
+                              tol)));
 }
 
 hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
@@ -8534,7 +11915,9 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          double                    tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDnnz_compress((cusparseHandle_t)handle,
                               m,
                               (const cusparseMatDescr_t)descrA,
@@ -8542,7 +11925,7 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                               csrRowPtrA,
                               nnzPerRow,
                               nnzC,
-                              tol));
+                              tol)));
 }
 
 hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
@@ -8554,7 +11937,9 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipComplex                tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCnnz_compress((cusparseHandle_t)handle,
                               m,
                               (const cusparseMatDescr_t)descrA,
@@ -8562,7 +11947,7 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                               csrRowPtrA,
                               nnzPerRow,
                               nnzC,
-                              {cuCrealf(tol), cuCimagf(tol)}));
+                              {cuCrealf(tol), cuCimagf(tol)})));
 }
 
 hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
@@ -8574,7 +11959,9 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipDoubleComplex          tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZnnz_compress((cusparseHandle_t)handle,
                               m,
                               (const cusparseMatDescr_t)descrA,
@@ -8582,7 +11969,7 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                               csrRowPtrA,
                               nnzPerRow,
                               nnzC,
-                              {cuCreal(tol), cuCimag(tol)}));
+                              {cuCreal(tol), cuCimag(tol)})));
 }
 #endif
 
@@ -8593,13 +11980,15 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsr2coo((cusparseHandle_t)handle,
                          csrRowPtr,
                          nnz,
                          m,
                          cooRowInd,
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 #if CUDART_VERSION < 11000
@@ -8616,7 +12005,20 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2csc((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8628,7 +12030,7 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                          cscSortedRowInd,
                          cscSortedColPtr,
                          hipsparse::hipActionToCudaAction(copyValues),
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
@@ -8644,7 +12046,20 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2csc((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8656,7 +12071,7 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                          cscSortedRowInd,
                          cscSortedColPtr,
                          hipsparse::hipActionToCudaAction(copyValues),
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
@@ -8672,7 +12087,20 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2csc((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8684,7 +12112,7 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                          cscSortedRowInd,
                          cscSortedColPtr,
                          hipsparse::hipActionToCudaAction(copyValues),
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
@@ -8700,7 +12128,20 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrSortedVal,
+                    csrSortedRowPtr,
+                    csrSortedColInd,
+                    cscSortedVal,
+                    cscSortedRowInd,
+                    cscSortedColPtr,
+                    copyValues,
+                    idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2csc((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8712,7 +12153,7 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                          cscSortedRowInd,
                          cscSortedColPtr,
                          hipsparse::hipActionToCudaAction(copyValues),
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 #endif
 
@@ -8761,7 +12202,23 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                                  hipsparseCsr2CscAlg_t alg,
                                                  size_t*               pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCsr2cscEx2_bufferSize((cusparseHandle_t)handle,
                                       m,
                                       n,
@@ -8776,7 +12233,7 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                       hipsparse::hipActionToCudaAction(copyValues),
                                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
                                       hipCsr2CscAlgToCudaCsr2CscAlg(alg),
-                                      pBufferSizeInBytes));
+                                      pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
@@ -8795,7 +12252,23 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                       hipsparseCsr2CscAlg_t alg,
                                       void*                 buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnz,
+                    csrVal,
+                    csrRowPtr,
+                    csrColInd,
+                    cscVal,
+                    cscColPtr,
+                    cscRowInd,
+                    valType,
+                    copyValues,
+                    idxBase,
+                    alg,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCsr2cscEx2((cusparseHandle_t)handle,
                            m,
                            n,
@@ -8810,7 +12283,7 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                            hipsparse::hipActionToCudaAction(copyValues),
                            hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
                            hipCsr2CscAlgToCudaCsr2CscAlg(alg),
-                           buffer));
+                           buffer)));
 }
 #endif
 
@@ -8826,7 +12299,18 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2hyb((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8836,7 +12320,7 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (const cusparseHybMat_t)hybA,
                          userEllWidth,
-                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType)));
+                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType))));
 }
 
 hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
@@ -8850,7 +12334,18 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2hyb((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8860,7 +12355,7 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (const cusparseHybMat_t)hybA,
                          userEllWidth,
-                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType)));
+                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType))));
 }
 
 hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
@@ -8874,7 +12369,18 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2hyb((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8884,7 +12390,7 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (const cusparseHybMat_t)hybA,
                          userEllWidth,
-                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType)));
+                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType))));
 }
 
 hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
@@ -8898,7 +12404,18 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrSortedValA,
+                    csrSortedRowPtrA,
+                    csrSortedColIndA,
+                    hybA,
+                    userEllWidth,
+                    partitionType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2hyb((cusparseHandle_t)handle,
                          m,
                          n,
@@ -8908,7 +12425,7 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                          csrSortedColIndA,
                          (const cusparseHybMat_t)hybA,
                          userEllWidth,
-                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType)));
+                         hipsparse::hipHybPartitionToCudaHybPartition(partitionType))));
 }
 #endif
 
@@ -8926,7 +12443,21 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2bsr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          m,
@@ -8939,7 +12470,7 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          bsrValC,
                          bsrRowPtrC,
-                         bsrColIndC));
+                         bsrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
@@ -8956,7 +12487,21 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2bsr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          m,
@@ -8969,7 +12514,7 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          bsrValC,
                          bsrRowPtrC,
-                         bsrColIndC));
+                         bsrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
@@ -8986,7 +12531,21 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2bsr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          m,
@@ -8999,7 +12558,7 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuComplex*)bsrValC,
                          bsrRowPtrC,
-                         bsrColIndC));
+                         bsrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
@@ -9016,7 +12575,21 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    blockDim,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2bsr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          m,
@@ -9029,7 +12602,7 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuDoubleComplex*)bsrValC,
                          bsrRowPtrC,
-                         bsrColIndC));
+                         bsrColIndC)));
 }
 
 hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
@@ -9046,7 +12619,21 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSbsr2csr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -9059,7 +12646,7 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
@@ -9076,7 +12663,21 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDbsr2csr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -9089,7 +12690,7 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
@@ -9106,7 +12707,21 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCbsr2csr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -9119,7 +12734,7 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
@@ -9136,7 +12751,21 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    blockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZbsr2csr((cusparseHandle_t)handle,
                          hipsparse::hipDirectionToCudaDirection(dirA),
                          mb,
@@ -9149,7 +12778,7 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                          (const cusparseMatDescr_t)descrC,
                          (cuDoubleComplex*)csrValC,
                          csrRowPtrC,
-                         csrColIndC));
+                         csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
@@ -9167,7 +12796,22 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgebsr2csr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dirA),
                            mb,
@@ -9181,7 +12825,7 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                            (const cusparseMatDescr_t)descrC,
                            csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
@@ -9199,7 +12843,22 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgebsr2csr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dirA),
                            mb,
@@ -9213,7 +12872,7 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                            (const cusparseMatDescr_t)descrC,
                            csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
@@ -9231,7 +12890,22 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgebsr2csr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dirA),
                            mb,
@@ -9245,7 +12919,7 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                            (const cusparseMatDescr_t)descrC,
                            (cuComplex*)csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
@@ -9263,7 +12937,22 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDim,
+                    colBlockDim,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgebsr2csr((cusparseHandle_t)handle,
                            hipsparse::hipDirectionToCudaDirection(dirA),
                            mb,
@@ -9277,7 +12966,7 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                            (const cusparseMatDescr_t)descrC,
                            (cuDoubleComplex*)csrValC,
                            csrRowPtrC,
-                           csrColIndC));
+                           csrColIndC)));
 }
 
 hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
@@ -9294,7 +12983,21 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2csr_compress((cusparseHandle_t)handle,
                                   m,
                                   n,
@@ -9307,7 +13010,7 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                   csrValC,
                                   csrColIndC,
                                   csrRowPtrC,
-                                  tol));
+                                  tol)));
 }
 
 hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
@@ -9324,7 +13027,21 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2csr_compress((cusparseHandle_t)handle,
                                   m,
                                   n,
@@ -9337,7 +13054,7 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                   csrValC,
                                   csrColIndC,
                                   csrRowPtrC,
-                                  tol));
+                                  tol)));
 }
 
 hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
@@ -9354,7 +13071,21 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2csr_compress((cusparseHandle_t)handle,
                                   m,
                                   n,
@@ -9367,7 +13098,7 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                   (cuComplex*)csrValC,
                                   csrColIndC,
                                   csrRowPtrC,
-                                  {cuCrealf(tol), cuCimagf(tol)}));
+                                  {cuCrealf(tol), cuCimagf(tol)})));
 }
 
 hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
@@ -9384,7 +13115,21 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    descrA,
+                    csrValA,
+                    csrColIndA,
+                    csrRowPtrA,
+                    nnzA,
+                    nnzPerRow,
+                    csrValC,
+                    csrColIndC,
+                    csrRowPtrC,
+                    tol);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2csr_compress((cusparseHandle_t)handle,
                                   m,
                                   n,
@@ -9397,7 +13142,7 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                   (cuDoubleComplex*)csrValC,
                                   csrColIndC,
                                   csrRowPtrC,
-                                  {cuCreal(tol), cuCimag(tol)}));
+                                  {cuCreal(tol), cuCimag(tol)})));
 }
 
 hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
@@ -9415,7 +13160,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -9429,7 +13189,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                             csrValC,
                                             csrRowPtrC,
                                             csrColIndC,
-                                            pBufferSizeInBytes));
+                                            pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         handle,
@@ -9447,7 +13207,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -9461,7 +13236,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                             csrValC,
                                             csrRowPtrC,
                                             csrColIndC,
-                                            pBufferSizeInBytes));
+                                            pBufferSizeInBytes)));
 }
 
 #if CUDART_VERSION < 13000
@@ -9480,7 +13255,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -9494,7 +13284,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                             csrValC,
                                             csrRowPtrC,
                                             csrColIndC,
-                                            pBufferSizeInBytes));
+                                            pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t         handle,
@@ -9512,7 +13302,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csr_bufferSizeExt((cusparseHandle_t)handle,
                                             m,
                                             n,
@@ -9526,7 +13331,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                             csrValC,
                                             csrRowPtrC,
                                             csrColIndC,
-                                            pBufferSizeInBytes));
+                                            pBufferSizeInBytes)));
 }
 #endif
 
@@ -9545,7 +13350,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csrNnz((cusparseHandle_t)handle,
                                  m,
                                  n,
@@ -9558,7 +13377,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                  (const cusparseMatDescr_t)descrC,
                                  csrRowPtrC,
                                  nnzTotalDevHostPtr,
-                                 buffer));
+                                 buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
@@ -9575,7 +13394,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csrNnz((cusparseHandle_t)handle,
                                  m,
                                  n,
@@ -9588,7 +13421,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                  (const cusparseMatDescr_t)descrC,
                                  csrRowPtrC,
                                  nnzTotalDevHostPtr,
-                                 buffer));
+                                 buffer)));
 }
 #endif
 
@@ -9608,7 +13441,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csr((cusparseHandle_t)handle,
                               m,
                               n,
@@ -9622,7 +13470,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                               csrValC,
                               csrRowPtrC,
                               csrColIndC,
-                              buffer));
+                              buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
@@ -9640,7 +13488,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    threshold,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csr((cusparseHandle_t)handle,
                               m,
                               n,
@@ -9654,7 +13517,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                               csrValC,
                               csrRowPtrC,
                               csrColIndC,
-                              buffer));
+                              buffer)));
 }
 #endif
 
@@ -9675,7 +13538,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                         m,
                                                         n,
@@ -9690,7 +13569,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                         csrRowPtrC,
                                                         csrColIndC,
                                                         (pruneInfo_t)info,
-                                                        pBufferSizeInBytes));
+                                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_t         handle,
@@ -9709,7 +13588,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                         m,
                                                         n,
@@ -9724,7 +13619,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                         csrRowPtrC,
                                                         csrColIndC,
                                                         (pruneInfo_t)info,
-                                                        pBufferSizeInBytes));
+                                                        pBufferSizeInBytes)));
 }
 #endif
 
@@ -9745,7 +13640,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                         m,
                                                         n,
@@ -9760,7 +13671,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                         csrRowPtrC,
                                                         csrColIndC,
                                                         (pruneInfo_t)info,
-                                                        pBufferSizeInBytes));
+                                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHandle_t         handle,
@@ -9779,7 +13690,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csrByPercentage_bufferSizeExt((cusparseHandle_t)handle,
                                                         m,
                                                         n,
@@ -9794,7 +13721,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                         csrRowPtrC,
                                                         csrColIndC,
                                                         (pruneInfo_t)info,
-                                                        pBufferSizeInBytes));
+                                                        pBufferSizeInBytes)));
 }
 #endif
 
@@ -9814,7 +13741,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
                                              m,
                                              n,
@@ -9828,7 +13770,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                              csrRowPtrC,
                                              nnzTotalDevHostPtr,
                                              (pruneInfo_t)info,
-                                             buffer));
+                                             buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t         handle,
@@ -9846,7 +13788,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrRowPtrC,
+                    nnzTotalDevHostPtr,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csrNnzByPercentage((cusparseHandle_t)handle,
                                              m,
                                              n,
@@ -9860,7 +13817,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                              csrRowPtrC,
                                              nnzTotalDevHostPtr,
                                              (pruneInfo_t)info,
-                                             buffer));
+                                             buffer)));
 }
 #endif
 
@@ -9881,7 +13838,23 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpruneCsr2csrByPercentage((cusparseHandle_t)handle,
                                           m,
                                           n,
@@ -9896,7 +13869,7 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                           csrRowPtrC,
                                           csrColIndC,
                                           (pruneInfo_t)info,
-                                          buffer));
+                                          buffer)));
 }
 
 hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         handle,
@@ -9915,7 +13888,23 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    n,
+                    nnzA,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    percentage,
+                    descrC,
+                    csrValC,
+                    csrRowPtrC,
+                    csrColIndC,
+                    info,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDpruneCsr2csrByPercentage((cusparseHandle_t)handle,
                                           m,
                                           n,
@@ -9930,7 +13919,7 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                           csrRowPtrC,
                                           csrColIndC,
                                           (pruneInfo_t)info,
-                                          buffer));
+                                          buffer)));
 }
 #endif
 
@@ -9942,13 +13931,15 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseShyb2csr((cusparseHandle_t)handle,
                          (const cusparseMatDescr_t)descrA,
                          (const cusparseHybMat_t)hybA,
                          csrSortedValA,
                          csrSortedRowPtrA,
-                         csrSortedColIndA));
+                         csrSortedColIndA)));
 }
 
 hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
@@ -9958,13 +13949,15 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDhyb2csr((cusparseHandle_t)handle,
                          (const cusparseMatDescr_t)descrA,
                          (const cusparseHybMat_t)hybA,
                          csrSortedValA,
                          csrSortedRowPtrA,
-                         csrSortedColIndA));
+                         csrSortedColIndA)));
 }
 
 hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
@@ -9974,13 +13967,15 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseChyb2csr((cusparseHandle_t)handle,
                          (const cusparseMatDescr_t)descrA,
                          (const cusparseHybMat_t)hybA,
                          csrSortedValA,
                          csrSortedRowPtrA,
-                         csrSortedColIndA));
+                         csrSortedColIndA)));
 }
 
 hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
@@ -9990,13 +13985,15 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZhyb2csr((cusparseHandle_t)handle,
                          (const cusparseMatDescr_t)descrA,
                          (const cusparseHybMat_t)hybA,
                          csrSortedValA,
                          csrSortedRowPtrA,
-                         csrSortedColIndA));
+                         csrSortedColIndA)));
 }
 #endif
 
@@ -10007,20 +14004,24 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcoo2csr((cusparseHandle_t)handle,
                          cooRowInd,
                          nnz,
                          m,
                          csrRowPtr,
-                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase)));
+                         hipsparse::hipIndexBaseToCudaIndexBase(idxBase))));
 }
 
 #if CUDART_VERSION < 13000
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCreateIdentityPermutation((cusparseHandle_t)handle, n, p));
+    HIPSPARSE_TRACE(handle, n, p);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCreateIdentityPermutation((cusparseHandle_t)handle, n, p)));
 }
 #endif
 
@@ -10032,8 +14033,10 @@ hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        csrColInd,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcsrsort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
@@ -10046,7 +14049,9 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, P, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcsrsort((cusparseHandle_t)handle,
                          m,
                          n,
@@ -10055,7 +14060,7 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                          csrRowPtr,
                          csrColInd,
                          P,
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
@@ -10066,8 +14071,10 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcscsort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcscsort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
@@ -10080,7 +14087,9 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, cscColPtr, cscRowInd, P, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXcscsort((cusparseHandle_t)handle,
                          m,
                          n,
@@ -10089,7 +14098,7 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                          cscColPtr,
                          cscRowInd,
                          P,
-                         pBuffer));
+                         pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
@@ -10100,8 +14109,10 @@ hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cooCols,
                                                   size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcoosort_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcoosort_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
@@ -10113,8 +14124,10 @@ hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
                                          int*              P,
                                          void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseXcoosortByRow((cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseXcoosortByRow((cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
@@ -10126,8 +14139,10 @@ hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
                                             int*              P,
                                             void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcoosortByColumn(
-        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseXcoosortByColumn(
+        (cusparseHandle_t)handle, m, n, nnz, cooRows, cooCols, P, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -10145,7 +14160,22 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
                                         hipsparse::hipDirectionToCudaDirection(dirA),
                                         mb,
@@ -10159,7 +14189,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                         colBlockDimA,
                                         rowBlockDimC,
                                         colBlockDimC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -10177,7 +14207,22 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
                                         hipsparse::hipDirectionToCudaDirection(dirA),
                                         mb,
@@ -10191,7 +14236,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                         colBlockDimA,
                                         rowBlockDimC,
                                         colBlockDimC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -10209,7 +14254,22 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
                                         hipsparse::hipDirectionToCudaDirection(dirA),
                                         mb,
@@ -10223,7 +14283,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                         colBlockDimA,
                                         rowBlockDimC,
                                         colBlockDimC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         handle,
@@ -10241,7 +14301,22 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgebsr2gebsr_bufferSize((cusparseHandle_t)handle,
                                         hipsparse::hipDirectionToCudaDirection(dirA),
                                         mb,
@@ -10255,7 +14330,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                         colBlockDimA,
                                         rowBlockDimC,
                                         colBlockDimC,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
@@ -10275,7 +14350,24 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                            int*                      nnzTotalDevHostPtr,
                                            void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrRowPtrC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    nnzTotalDevHostPtr,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseXgebsr2gebsrNnz((cusparseHandle_t)handle,
                                 hipsparse::hipDirectionToCudaDirection(dirA),
                                 mb,
@@ -10291,7 +14383,7 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                 rowBlockDimC,
                                 colBlockDimC,
                                 nnzTotalDevHostPtr,
-                                buffer));
+                                buffer)));
 }
 
 hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
@@ -10313,7 +14405,26 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSgebsr2gebsr((cusparseHandle_t)handle,
                              hipsparse::hipDirectionToCudaDirection(dirA),
                              mb,
@@ -10331,7 +14442,7 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                              bsrColIndC,
                              rowBlockDimC,
                              colBlockDimC,
-                             buffer));
+                             buffer)));
 }
 
 hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
@@ -10353,7 +14464,26 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDgebsr2gebsr((cusparseHandle_t)handle,
                              hipsparse::hipDirectionToCudaDirection(dirA),
                              mb,
@@ -10371,7 +14501,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                              bsrColIndC,
                              rowBlockDimC,
                              colBlockDimC,
-                             buffer));
+                             buffer)));
 }
 
 hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
@@ -10393,7 +14523,26 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgebsr2gebsr((cusparseHandle_t)handle,
                              hipsparse::hipDirectionToCudaDirection(dirA),
                              mb,
@@ -10411,7 +14560,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                              bsrColIndC,
                              rowBlockDimC,
                              colBlockDimC,
-                             buffer));
+                             buffer)));
 }
 
 hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
@@ -10433,7 +14582,26 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    dirA,
+                    mb,
+                    nb,
+                    nnzb,
+                    descrA,
+                    bsrValA,
+                    bsrRowPtrA,
+                    bsrColIndA,
+                    rowBlockDimA,
+                    colBlockDimA,
+                    descrC,
+                    bsrValC,
+                    bsrRowPtrC,
+                    bsrColIndC,
+                    rowBlockDimC,
+                    colBlockDimC,
+                    buffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgebsr2gebsr((cusparseHandle_t)handle,
                              hipsparse::hipDirectionToCudaDirection(dirA),
                              mb,
@@ -10451,7 +14619,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                              bsrColIndC,
                              rowBlockDimC,
                              colBlockDimC,
-                             buffer));
+                             buffer)));
 }
 
 #if CUDART_VERSION < 13000
@@ -10465,7 +14633,9 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsru2csr_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -10474,7 +14644,7 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                         csrRowPtr,
                                         csrColInd,
                                         info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -10487,7 +14657,9 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -10496,7 +14668,7 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                         csrRowPtr,
                                         csrColInd,
                                         info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -10509,7 +14681,9 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -10518,7 +14692,7 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                         csrRowPtr,
                                         csrColInd,
                                         info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
@@ -10531,7 +14705,9 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsru2csr_bufferSizeExt((cusparseHandle_t)handle,
                                         m,
                                         n,
@@ -10540,7 +14716,7 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                         csrRowPtr,
                                         csrColInd,
                                         info,
-                                        pBufferSizeInBytes));
+                                        pBufferSizeInBytes)));
 }
 #endif
 
@@ -10556,7 +14732,9 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsru2csr((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10566,7 +14744,7 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
@@ -10580,7 +14758,9 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsru2csr((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10590,7 +14770,7 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
@@ -10604,7 +14784,9 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsru2csr((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10614,7 +14796,7 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
@@ -10628,7 +14810,9 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsru2csr((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10638,7 +14822,7 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 #endif
 
@@ -10654,7 +14838,9 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsr2csru((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10664,7 +14850,7 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
@@ -10678,7 +14864,9 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsr2csru((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10688,7 +14876,7 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
@@ -10702,7 +14890,9 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsr2csru((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10712,7 +14902,7 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
@@ -10726,7 +14916,9 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsr2csru((cusparseHandle_t)handle,
                           m,
                           n,
@@ -10736,7 +14928,7 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                           csrRowPtr,
                           csrColInd,
                           info,
-                          pBuffer));
+                          pBuffer)));
 }
 #endif
 
@@ -11237,6 +15429,36 @@ namespace hipsparse
         }
     }
 #endif
+
+#if(CUDART_VERSION >= 12010)
+    cusparseSpSVUpdate_t hipSpSVUpdateToCudaSpSVUpdate(hipsparseSpSVUpdate_t update)
+    {
+        switch(update)
+        {
+        case HIPSPARSE_SPSV_UPDATE_GENERAL:
+            return CUSPARSE_SPSV_UPDATE_GENERAL;
+        case HIPSPARSE_SPSV_UPDATE_DIAGONAL:
+            return CUSPARSE_SPSV_UPDATE_DIAGONAL;
+        default:
+            throw "Non existent cusparseSpSVUpdate_t";
+        }
+    }
+#endif
+
+#if(CUDART_VERSION >= 12040)
+    cusparseSpSMUpdate_t hipSpSMUpdateToCudaSpSMUpdate(hipsparseSpSMUpdate_t update)
+    {
+        switch(update)
+        {
+        case HIPSPARSE_SPSM_UPDATE_GENERAL:
+            return CUSPARSE_SPSM_UPDATE_GENERAL;
+        case HIPSPARSE_SPSM_UPDATE_DIAGONAL:
+            return CUSPARSE_SPSM_UPDATE_DIAGONAL;
+        default:
+            throw "Non existent cusparseSpSMUpdate_t";
+        }
+    }
+#endif
 }
 
 #if(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
@@ -11249,7 +15471,9 @@ hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
                                        hipsparseIndexBase_t   idxBase,
                                        hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateSpVec((cusparseSpVecDescr_t*)spVecDescr,
                             size,
                             nnz,
@@ -11257,7 +15481,7 @@ hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
                             values,
                             hipsparse::hipIndexTypeToCudaIndexType(idxType),
                             hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                            hipsparse::hipDataTypeToCudaDataType(valueType)));
+                            hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11271,7 +15495,9 @@ hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDes
                                             hipsparseIndexBase_t        idxBase,
                                             hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstSpVec((cusparseConstSpVecDescr_t*)spVecDescr,
                                  size,
                                  nnz,
@@ -11279,21 +15505,25 @@ hipsparseStatus_t hipsparseCreateConstSpVec(hipsparseConstSpVecDescr_t* spVecDes
                                  values,
                                  hipsparse::hipIndexTypeToCudaIndexType(idxType),
                                  hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                                 hipsparse::hipDataTypeToCudaDataType(valueType)));
+                                 hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseDestroySpVec(hipsparseConstSpVecDescr_t spVecDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroySpVec((cusparseConstSpVecDescr_t)spVecDescr));
+    HIPSPARSE_TRACE(spVecDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroySpVec((cusparseConstSpVecDescr_t)spVecDescr)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseDestroySpVec(hipsparseSpVecDescr_t spVecDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroySpVec((cusparseSpVecDescr_t)spVecDescr));
+    HIPSPARSE_TRACE(spVecDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroySpVec((cusparseSpVecDescr_t)spVecDescr)));
 }
 #endif
 
@@ -11307,6 +15537,8 @@ hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
                                     hipsparseIndexBase_t*       idxBase,
                                     hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11324,7 +15556,7 @@ hipsparseStatus_t hipsparseSpVecGet(const hipsparseSpVecDescr_t spVecDescr,
     *idxBase   = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11338,6 +15570,8 @@ hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
                                          hipsparseIndexBase_t*      idxBase,
                                          hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spVecDescr, size, nnz, indices, values, idxType, idxBase, valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11356,7 +15590,7 @@ hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
     *idxBase   = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11364,23 +15598,29 @@ hipsparseStatus_t hipsparseConstSpVecGet(hipsparseConstSpVecDescr_t spVecDescr,
 hipsparseStatus_t hipsparseSpVecGetIndexBase(hipsparseConstSpVecDescr_t spVecDescr,
                                              hipsparseIndexBase_t*      idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
-        (const cusparseConstSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase));
+    HIPSPARSE_TRACE(spVecDescr, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
+        (const cusparseConstSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpVecGetIndexBase(const hipsparseSpVecDescr_t spVecDescr,
                                              hipsparseIndexBase_t* idxBase)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
-        (const cusparseSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase));
+    HIPSPARSE_TRACE(spVecDescr, idxBase);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpVecGetIndexBase(
+        (const cusparseSpVecDescr_t)spVecDescr, (cusparseIndexBase_t*)idxBase)));
 }
 #endif
 
 #if(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr, void** values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpVecGetValues((const cusparseSpVecDescr_t)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpVecGetValues((const cusparseSpVecDescr_t)spVecDescr, values)));
 }
 #endif
 
@@ -11388,16 +15628,20 @@ hipsparseStatus_t hipsparseSpVecGetValues(const hipsparseSpVecDescr_t spVecDescr
 hipsparseStatus_t hipsparseConstSpVecGetValues(hipsparseConstSpVecDescr_t spVecDescr,
                                                const void**               values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseConstSpVecGetValues((const cusparseConstSpVecDescr_t)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseConstSpVecGetValues((const cusparseConstSpVecDescr_t)spVecDescr, values)));
 }
 #endif
 
 #if(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpVecSetValues(hipsparseSpVecDescr_t spVecDescr, void* values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpVecSetValues((const cusparseSpVecDescr_t)spVecDescr, values));
+    HIPSPARSE_TRACE(spVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpVecSetValues((const cusparseSpVecDescr_t)spVecDescr, values)));
 }
 #endif
 
@@ -11413,7 +15657,18 @@ hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateCoo((cusparseSpMatDescr_t*)spMatDescr,
                           rows,
                           cols,
@@ -11423,7 +15678,7 @@ hipsparseStatus_t hipsparseCreateCoo(hipsparseSpMatDescr_t* spMatDescr,
                           cooValues,
                           hipsparse::hipIndexTypeToCudaIndexType(cooIdxType),
                           hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                          hipsparse::hipDataTypeToCudaDataType(valueType)));
+                          hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11439,7 +15694,18 @@ hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    cooIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstCoo((cusparseConstSpMatDescr_t*)spMatDescr,
                                rows,
                                cols,
@@ -11449,7 +15715,7 @@ hipsparseStatus_t hipsparseCreateConstCoo(hipsparseConstSpMatDescr_t* spMatDescr
                                cooValues,
                                hipsparse::hipIndexTypeToCudaIndexType(cooIdxType),
                                hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                               hipsparse::hipDataTypeToCudaDataType(valueType)));
+                               hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11464,7 +15730,9 @@ hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
                                         hipsparseIndexBase_t   idxBase,
                                         hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, cooIdxType, idxBase, valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateCooAoS((cusparseSpMatDescr_t*)spMatDescr,
                              rows,
                              cols,
@@ -11473,7 +15741,7 @@ hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
                              cooValues,
                              hipsparse::hipIndexTypeToCudaIndexType(cooIdxType),
                              hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                             hipsparse::hipDataTypeToCudaDataType(valueType)));
+                             hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11490,7 +15758,19 @@ hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateCsr((cusparseSpMatDescr_t*)spMatDescr,
                           rows,
                           cols,
@@ -11501,7 +15781,7 @@ hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
                           hipsparse::hipIndexTypeToCudaIndexType(csrRowOffsetsType),
                           hipsparse::hipIndexTypeToCudaIndexType(csrColIndType),
                           hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                          hipsparse::hipDataTypeToCudaDataType(valueType)));
+                          hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11518,7 +15798,19 @@ hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstCsr((cusparseConstSpMatDescr_t*)spMatDescr,
                                rows,
                                cols,
@@ -11529,7 +15821,7 @@ hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr
                                hipsparse::hipIndexTypeToCudaIndexType(csrRowOffsetsType),
                                hipsparse::hipIndexTypeToCudaIndexType(csrColIndType),
                                hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                               hipsparse::hipDataTypeToCudaDataType(valueType)));
+                               hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11546,7 +15838,19 @@ hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateCsc((cusparseSpMatDescr_t*)spMatDescr,
                           rows,
                           cols,
@@ -11557,7 +15861,7 @@ hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
                           hipsparse::hipIndexTypeToCudaIndexType(cscColOffsetsType),
                           hipsparse::hipIndexTypeToCudaIndexType(cscRowIndType),
                           hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                          hipsparse::hipDataTypeToCudaDataType(valueType)));
+                          hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11574,7 +15878,19 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstCsc((cusparseConstSpMatDescr_t*)spMatDescr,
                                rows,
                                cols,
@@ -11585,7 +15901,7 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
                                hipsparse::hipIndexTypeToCudaIndexType(cscColOffsetsType),
                                hipsparse::hipIndexTypeToCudaIndexType(cscRowIndType),
                                hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                               hipsparse::hipDataTypeToCudaDataType(valueType)));
+                               hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11601,7 +15917,18 @@ hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
                                             hipsparseIndexBase_t   idxBase,
                                             hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateBlockedEll((cusparseSpMatDescr_t*)spMatDescr,
                                  rows,
                                  cols,
@@ -11611,7 +15938,7 @@ hipsparseStatus_t hipsparseCreateBlockedEll(hipsparseSpMatDescr_t* spMatDescr,
                                  ellValue,
                                  hipsparse::hipIndexTypeToCudaIndexType(ellIdxType),
                                  hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                                 hipsparse::hipDataTypeToCudaDataType(valueType)));
+                                 hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -11627,7 +15954,18 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                                  hipsparseIndexBase_t        idxBase,
                                                  hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstBlockedEll((cusparseConstSpMatDescr_t*)spMatDescr,
                                       rows,
                                       cols,
@@ -11637,21 +15975,25 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                       ellValue,
                                       hipsparse::hipIndexTypeToCudaIndexType(ellIdxType),
                                       hipsparse::hipIndexBaseToCudaIndexBase(idxBase),
-                                      hipsparse::hipDataTypeToCudaDataType(valueType)));
+                                      hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroySpMat((cusparseConstSpMatDescr_t)spMatDescr));
+    HIPSPARSE_TRACE(spMatDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroySpMat((cusparseConstSpMatDescr_t)spMatDescr)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseSpMatDescr_t spMatDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroySpMat((cusparseSpMatDescr_t)spMatDescr));
+    HIPSPARSE_TRACE(spMatDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroySpMat((cusparseSpMatDescr_t)spMatDescr)));
 }
 #endif
 
@@ -11667,6 +16009,17 @@ hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    idxType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11686,7 +16039,7 @@ hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11702,6 +16055,17 @@ hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cooRowInd,
+                    cooColInd,
+                    cooValues,
+                    idxType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11721,7 +16085,7 @@ hipsparseStatus_t hipsparseConstCooGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11736,6 +16100,8 @@ hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
                                      hipsparseIndexBase_t*       idxBase,
                                      hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz, cooInd, cooValues, idxType, idxBase, valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11754,7 +16120,7 @@ hipsparseStatus_t hipsparseCooAoSGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase   = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11771,6 +16137,18 @@ hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_row_index_type;
     cusparseIndexType_t cuda_col_index_type;
     cusparseIndexBase_t cuda_index_base;
@@ -11794,7 +16172,7 @@ hipsparseStatus_t hipsparseCsrGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType         = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11811,6 +16189,18 @@ hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    csrRowOffsets,
+                    csrColInd,
+                    csrValues,
+                    csrRowOffsetsType,
+                    csrColIndType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_row_index_type;
     cusparseIndexType_t cuda_col_index_type;
     cusparseIndexBase_t cuda_index_base;
@@ -11834,7 +16224,7 @@ hipsparseStatus_t hipsparseConstCsrGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType         = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11851,6 +16241,18 @@ hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
                                   hipsparseIndexBase_t*       idxBase,
                                   hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_col_index_type;
     cusparseIndexType_t cuda_row_index_type;
     cusparseIndexBase_t cuda_index_base;
@@ -11874,7 +16276,7 @@ hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType         = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11891,6 +16293,18 @@ hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
                                        hipsparseIndexBase_t*      idxBase,
                                        hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    nnz,
+                    cscColOffsets,
+                    cscRowInd,
+                    cscValues,
+                    cscColOffsetsType,
+                    cscRowIndType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_row_index_type;
     cusparseIndexType_t cuda_col_index_type;
     cusparseIndexBase_t cuda_index_base;
@@ -11914,7 +16328,7 @@ hipsparseStatus_t hipsparseConstCscGet(hipsparseConstSpMatDescr_t spMatDescr,
     *idxBase           = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType         = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -11930,6 +16344,17 @@ hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
                                          hipsparseIndexBase_t*       idxBase,
                                          hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
     // As of cusparse 11.4.1, this routine does not actually exist as a symbol in the cusparse
     // library (the documentation indicates that it should exist starting at cusparse 11.2.1).
 #if(CUDART_VERSION >= 11070)
@@ -11953,9 +16378,9 @@ hipsparseStatus_t hipsparseBlockedEllGet(const hipsparseSpMatDescr_t spMatDescr,
     *idxBase    = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType  = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 #else
-    return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
 #endif
 }
 #endif
@@ -11972,6 +16397,17 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
                                               hipsparseIndexBase_t*      idxBase,
                                               hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(spMatDescr,
+                    rows,
+                    cols,
+                    ellBlockSize,
+                    ellCols,
+                    ellColInd,
+                    ellValue,
+                    ellIdxType,
+                    idxBase,
+                    valueType);
+
     cusparseIndexType_t cuda_index_type;
     cusparseIndexBase_t cuda_index_base;
     cudaDataType        cuda_data_type;
@@ -11992,7 +16428,7 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
     *idxBase    = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
     *valueType  = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -12002,8 +16438,10 @@ hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 csrColInd,
                                           void*                 csrValues)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCsrSetPointers(
-        (cusparseSpMatDescr_t)spMatDescr, csrRowOffsets, csrColInd, csrValues));
+    HIPSPARSE_TRACE(spMatDescr, csrRowOffsets, csrColInd, csrValues);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCsrSetPointers(
+        (cusparseSpMatDescr_t)spMatDescr, csrRowOffsets, csrColInd, csrValues)));
 }
 #endif
 
@@ -12013,8 +16451,10 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
                                         int64_t*                   cols,
                                         int64_t*                   nnz)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetSize((cusparseConstSpMatDescr_t)spMatDescr, rows, cols, nnz));
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetSize((cusparseConstSpMatDescr_t)spMatDescr, rows, cols, nnz)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
@@ -12022,8 +16462,10 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
                                         int64_t* cols,
                                         int64_t* nnz)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetSize((cusparseSpMatDescr_t)spMatDescr, rows, cols, nnz));
+    HIPSPARSE_TRACE(spMatDescr, rows, cols, nnz);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetSize((cusparseSpMatDescr_t)spMatDescr, rows, cols, nnz)));
 }
 #endif
 
@@ -12031,6 +16473,8 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseSpMatDescr_t spMatDescr,
 hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
                                           hipsparseFormat_t*         format)
 {
+    HIPSPARSE_TRACE(spMatDescr, format);
+
     cusparseFormat_t cuda_format;
 
     RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetFormat((const cusparseConstSpMatDescr_t)spMatDescr,
@@ -12038,12 +16482,14 @@ hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
 
     *format = hipsparse::CudaFormatToHIPFormat(cuda_format);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr,
                                           hipsparseFormat_t* format)
 {
+    HIPSPARSE_TRACE(spMatDescr, format);
+
     cusparseFormat_t cuda_format;
 
     RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetFormat((const cusparseSpMatDescr_t)spMatDescr,
@@ -12051,7 +16497,7 @@ hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr
 
     *format = hipsparse::CudaFormatToHIPFormat(cuda_format);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -12059,6 +16505,8 @@ hipsparseStatus_t hipsparseSpMatGetFormat(const hipsparseSpMatDescr_t spMatDescr
 hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDescr,
                                              hipsparseIndexBase_t*      idxBase)
 {
+    HIPSPARSE_TRACE(spMatDescr, idxBase);
+
     cusparseIndexBase_t cuda_index_base;
 
     RETURN_IF_CUSPARSE_ERROR(
@@ -12067,12 +16515,14 @@ hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDes
 
     *idxBase = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMatGetIndexBase(const hipsparseSpMatDescr_t spMatDescr,
                                              hipsparseIndexBase_t* idxBase)
 {
+    HIPSPARSE_TRACE(spMatDescr, idxBase);
+
     cusparseIndexBase_t cuda_index_base;
 
     RETURN_IF_CUSPARSE_ERROR(cusparseSpMatGetIndexBase(
@@ -12080,15 +16530,17 @@ hipsparseStatus_t hipsparseSpMatGetIndexBase(const hipsparseSpMatDescr_t spMatDe
 
     *idxBase = hipsparse::CudaIndexBaseToHIPIndexBase(cuda_index_base);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
 #if(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetValues((cusparseSpMatDescr_t)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetValues((cusparseSpMatDescr_t)spMatDescr, values)));
 }
 #endif
 
@@ -12096,16 +16548,20 @@ hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void
 hipsparseStatus_t hipsparseConstSpMatGetValues(hipsparseConstSpMatDescr_t spMatDescr,
                                                const void**               values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseConstSpMatGetValues((cusparseConstSpMatDescr_t)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseConstSpMatGetValues((cusparseConstSpMatDescr_t)spMatDescr, values)));
 }
 #endif
 
 #if(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatSetValues((cusparseSpMatDescr_t)spMatDescr, values));
+    HIPSPARSE_TRACE(spMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatSetValues((cusparseSpMatDescr_t)spMatDescr, values)));
 }
 #endif
 
@@ -12113,22 +16569,28 @@ hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void
 hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseConstSpMatDescr_t spMatDescr,
                                                 int*                       batchCount)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetStridedBatch((cusparseConstSpMatDescr_t)spMatDescr, batchCount));
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetStridedBatch((cusparseConstSpMatDescr_t)spMatDescr, batchCount)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int* batchCount)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatGetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatGetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount)));
 }
 #endif
 
 #if(CUDART_VERSION >= 10010 && CUDART_VERSION < 12000)
 hipsparseStatus_t hipsparseSpMatSetStridedBatch(hipsparseSpMatDescr_t spMatDescr, int batchCount)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpMatSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount));
+    HIPSPARSE_TRACE(spMatDescr, batchCount);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount)));
 }
 #endif
 
@@ -12137,8 +16599,10 @@ hipsparseStatus_t hipsparseCooSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                               int                   batchCount,
                                               int64_t               batchStride)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseCooSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(spMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCooSetStridedBatch((cusparseSpMatDescr_t)spMatDescr, batchCount, batchStride)));
 }
 #endif
 
@@ -12148,11 +16612,13 @@ hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                               int64_t               offsetsBatchStride,
                                               int64_t               columnsValuesBatchStride)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, batchCount, offsetsBatchStride, columnsValuesBatchStride);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCsrSetStridedBatch((cusparseSpMatDescr_t)spMatDescr,
                                    batchCount,
                                    offsetsBatchStride,
-                                   columnsValuesBatchStride));
+                                   columnsValuesBatchStride)));
 }
 #endif
 
@@ -12162,11 +16628,13 @@ hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDes
                                              void*                      data,
                                              size_t                     dataSize)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMatGetAttribute((cusparseConstSpMatDescr_t)spMatDescr,
                                   (cusparseSpMatAttribute_t)attribute,
                                   data,
-                                  dataSize));
+                                  dataSize)));
 }
 #elif(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t spMatDescr,
@@ -12174,8 +16642,10 @@ hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t spMatDescr,
                                              void* data,
                                              size_t dataSize)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpMatGetAttribute(
-        (cusparseSpMatDescr_t)spMatDescr, (cusparseSpMatAttribute_t)attribute, data, dataSize));
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSpMatGetAttribute(
+        (cusparseSpMatDescr_t)spMatDescr, (cusparseSpMatAttribute_t)attribute, data, dataSize)));
 }
 #endif
 
@@ -12185,11 +16655,13 @@ hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDesc
                                              const void*               data,
                                              size_t                    dataSize)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(spMatDescr, attribute, data, dataSize);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMatSetAttribute((cusparseSpMatDescr_t)spMatDescr,
                                   (cusparseSpMatAttribute_t)attribute,
                                   const_cast<void*>(data),
-                                  dataSize));
+                                  dataSize)));
 }
 #endif
 
@@ -12199,11 +16671,13 @@ hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
                                        void*                  values,
                                        hipDataType            valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateDnVec((cusparseDnVecDescr_t*)dnVecDescr,
                             size,
                             values,
-                            hipsparse::hipDataTypeToCudaDataType(valueType)));
+                            hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
@@ -12213,25 +16687,31 @@ hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDes
                                             const void*                 values,
                                             hipDataType                 valueType)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstDnVec((cusparseConstDnVecDescr_t*)dnVecDescr,
                                  size,
                                  values,
-                                 hipsparse::hipDataTypeToCudaDataType(valueType)));
+                                 hipsparse::hipDataTypeToCudaDataType(valueType))));
 }
 #endif
 
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseDestroyDnVec(hipsparseConstDnVecDescr_t dnVecDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyDnVec((cusparseConstDnVecDescr_t)dnVecDescr));
+    HIPSPARSE_TRACE(dnVecDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyDnVec((cusparseConstDnVecDescr_t)dnVecDescr)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseDestroyDnVec(hipsparseDnVecDescr_t dnVecDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyDnVec((cusparseDnVecDescr_t)dnVecDescr));
+    HIPSPARSE_TRACE(dnVecDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyDnVec((cusparseDnVecDescr_t)dnVecDescr)));
 }
 #endif
 
@@ -12241,6 +16721,8 @@ hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
                                     void**                      values,
                                     hipDataType*                valueType)
 {
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
     cudaDataType cuda_data_type;
 
     RETURN_IF_CUSPARSE_ERROR(cusparseDnVecGet((const cusparseDnVecDescr_t)dnVecDescr,
@@ -12250,7 +16732,7 @@ hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
 
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -12260,6 +16742,8 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
                                          const void**               values,
                                          hipDataType*               valueType)
 {
+    HIPSPARSE_TRACE(dnVecDescr, size, values, valueType);
+
     cudaDataType cuda_data_type;
 
     RETURN_IF_CUSPARSE_ERROR(
@@ -12270,15 +16754,17 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
 
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
 #if(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnVecGetValues((const cusparseDnVecDescr_t)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnVecGetValues((const cusparseDnVecDescr_t)dnVecDescr, values)));
 }
 #endif
 
@@ -12286,16 +16772,20 @@ hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr
 hipsparseStatus_t hipsparseConstDnVecGetValues(hipsparseConstDnVecDescr_t dnVecDescr,
                                                const void**               values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseConstDnVecGetValues((const cusparseConstDnVecDescr_t)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseConstDnVecGetValues((const cusparseConstDnVecDescr_t)dnVecDescr, values)));
 }
 #endif
 
 #if(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnVecSetValues((cusparseDnVecDescr_t)dnVecDescr, values));
+    HIPSPARSE_TRACE(dnVecDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnVecSetValues((cusparseDnVecDescr_t)dnVecDescr, values)));
 }
 #endif
 
@@ -12308,14 +16798,16 @@ hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
                                        hipDataType            valueType,
                                        hipsparseOrder_t       order)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateDnMat((cusparseDnMatDescr_t*)dnMatDescr,
                             rows,
                             cols,
                             ld,
                             values,
                             hipsparse::hipDataTypeToCudaDataType(valueType),
-                            hipsparse::hipOrderToCudaOrder(order)));
+                            hipsparse::hipOrderToCudaOrder(order))));
 }
 #endif
 
@@ -12328,28 +16820,34 @@ hipsparseStatus_t hipsparseCreateConstDnMat(hipsparseConstDnMatDescr_t* dnMatDes
                                             hipDataType                 valueType,
                                             hipsparseOrder_t            order)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCreateConstDnMat((cusparseConstDnMatDescr_t*)dnMatDescr,
                                  rows,
                                  cols,
                                  ld,
                                  values,
                                  hipsparse::hipDataTypeToCudaDataType(valueType),
-                                 hipsparse::hipOrderToCudaOrder(order)));
+                                 hipsparse::hipOrderToCudaOrder(order))));
 }
 #endif
 
 #if(CUDART_VERSION >= 12000)
 hipsparseStatus_t hipsparseDestroyDnMat(hipsparseConstDnMatDescr_t dnMatDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyDnMat((cusparseConstDnMatDescr_t)dnMatDescr));
+    HIPSPARSE_TRACE(dnMatDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyDnMat((cusparseConstDnMatDescr_t)dnMatDescr)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseDestroyDnMat(hipsparseDnMatDescr_t dnMatDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDestroyDnMat((cusparseDnMatDescr_t)dnMatDescr));
+    HIPSPARSE_TRACE(dnMatDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDestroyDnMat((cusparseDnMatDescr_t)dnMatDescr)));
 }
 #endif
 
@@ -12362,6 +16860,8 @@ hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
                                     hipDataType*                valueType,
                                     hipsparseOrder_t*           order)
 {
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
     cudaDataType    cuda_data_type;
     cusparseOrder_t cusparse_order;
     RETURN_IF_CUSPARSE_ERROR(cusparseDnMatGet((const cusparseDnMatDescr_t)dnMatDescr,
@@ -12375,7 +16875,7 @@ hipsparseStatus_t hipsparseDnMatGet(const hipsparseDnMatDescr_t dnMatDescr,
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
     *order     = hipsparse::CudaOrderToHIPOrder(cusparse_order);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -12388,6 +16888,8 @@ hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
                                          hipDataType*               valueType,
                                          hipsparseOrder_t*          order)
 {
+    HIPSPARSE_TRACE(dnMatDescr, rows, cols, ld, values, valueType, order);
+
     cudaDataType    cuda_data_type;
     cusparseOrder_t cusparse_order;
     RETURN_IF_CUSPARSE_ERROR(cusparseConstDnMatGet((const cusparseConstDnMatDescr_t)dnMatDescr,
@@ -12401,15 +16903,17 @@ hipsparseStatus_t hipsparseConstDnMatGet(hipsparseConstDnMatDescr_t dnMatDescr,
     *valueType = hipsparse::CudaDataTypeToHIPDataType(cuda_data_type);
     *order     = hipsparse::CudaOrderToHIPOrder(cusparse_order);
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
 #if(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr, void** values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatGetValues((const cusparseDnMatDescr_t)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatGetValues((const cusparseDnMatDescr_t)dnMatDescr, values)));
 }
 #endif
 
@@ -12417,16 +16921,20 @@ hipsparseStatus_t hipsparseDnMatGetValues(const hipsparseDnMatDescr_t dnMatDescr
 hipsparseStatus_t hipsparseConstDnMatGetValues(hipsparseConstDnMatDescr_t dnMatDescr,
                                                const void**               values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseConstDnMatGetValues((const cusparseConstDnMatDescr_t)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseConstDnMatGetValues((const cusparseConstDnMatDescr_t)dnMatDescr, values)));
 }
 #endif
 
 #if(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseDnMatSetValues(hipsparseDnMatDescr_t dnMatDescr, void* values)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatSetValues((cusparseDnMatDescr_t)dnMatDescr, values));
+    HIPSPARSE_TRACE(dnMatDescr, values);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatSetValues((cusparseDnMatDescr_t)dnMatDescr, values)));
 }
 #endif
 
@@ -12435,16 +16943,20 @@ hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseConstDnMatDescr_t dnMat
                                                 int*                       batchCount,
                                                 int64_t*                   batchStride)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDnMatGetStridedBatch(
-        (cusparseConstDnMatDescr_t)dnMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDnMatGetStridedBatch(
+        (cusparseConstDnMatDescr_t)dnMatDescr, batchCount, batchStride)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseDnMatGetStridedBatch(hipsparseDnMatDescr_t dnMatDescr,
                                                 int* batchCount,
                                                 int64_t* batchStride)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatGetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatGetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride)));
 }
 #endif
 
@@ -12453,8 +16965,10 @@ hipsparseStatus_t hipsparseDnMatSetStridedBatch(hipsparseDnMatDescr_t dnMatDescr
                                                 int                   batchCount,
                                                 int64_t               batchStride)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDnMatSetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride));
+    HIPSPARSE_TRACE(dnMatDescr, batchCount, batchStride);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDnMatSetStridedBatch((cusparseDnMatDescr_t)dnMatDescr, batchCount, batchStride)));
 }
 #endif
 
@@ -12465,11 +16979,14 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
                                  const void*                beta,
                                  hipsparseDnVecDescr_t      vecY)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseAxpby((cusparseHandle_t)handle,
-                                                                 alpha,
-                                                                 (cusparseConstSpVecDescr_t)vecX,
-                                                                 beta,
-                                                                 (cusparseDnVecDescr_t)vecY));
+    HIPSPARSE_TRACE(handle, alpha, vecX, beta, vecY);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseAxpby((cusparseHandle_t)handle,
+                      alpha,
+                      (cusparseConstSpVecDescr_t)vecX,
+                      beta,
+                      (cusparseDnVecDescr_t)vecY)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t handle,
@@ -12478,11 +16995,14 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t handle,
                                  const void* beta,
                                  hipsparseDnVecDescr_t vecY)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseAxpby((cusparseHandle_t)handle,
-                                                                 alpha,
-                                                                 (cusparseSpVecDescr_t)vecX,
-                                                                 beta,
-                                                                 (cusparseDnVecDescr_t)vecY));
+    HIPSPARSE_TRACE(handle, alpha, vecX, beta, vecY);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseAxpby((cusparseHandle_t)handle,
+                      alpha,
+                      (cusparseSpVecDescr_t)vecX,
+                      beta,
+                      (cusparseDnVecDescr_t)vecY)));
 }
 #endif
 
@@ -12491,16 +17011,20 @@ hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
                                   hipsparseConstDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t      vecX)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseGather(
-        (cusparseHandle_t)handle, (cusparseConstDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX));
+    HIPSPARSE_TRACE(handle, vecY, vecX);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseGather(
+        (cusparseHandle_t)handle, (cusparseConstDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseGather(hipsparseHandle_t handle,
                                   hipsparseDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t vecX)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseGather(
-        (cusparseHandle_t)handle, (cusparseDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX));
+    HIPSPARSE_TRACE(handle, vecY, vecX);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseGather(
+        (cusparseHandle_t)handle, (cusparseDnVecDescr_t)vecY, (cusparseSpVecDescr_t)vecX)));
 }
 #endif
 
@@ -12509,16 +17033,20 @@ hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
                                    hipsparseConstSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t      vecY)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScatter(
-        (cusparseHandle_t)handle, (cusparseConstSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY));
+    HIPSPARSE_TRACE(handle, vecX, vecY);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScatter(
+        (cusparseHandle_t)handle, (cusparseConstSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseScatter(hipsparseHandle_t handle,
                                    hipsparseSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t vecY)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScatter(
-        (cusparseHandle_t)handle, (cusparseSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY));
+    HIPSPARSE_TRACE(handle, vecX, vecY);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseScatter(
+        (cusparseHandle_t)handle, (cusparseSpVecDescr_t)vecX, (cusparseDnVecDescr_t)vecY)));
 }
 #endif
 
@@ -12529,11 +17057,13 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseRot((cusparseHandle_t)handle,
-                                                               c_coeff,
-                                                               s_coeff,
-                                                               (cusparseSpVecDescr_t)vecX,
-                                                               (cusparseDnVecDescr_t)vecY));
+    HIPSPARSE_TRACE(handle, c_coeff, s_coeff, vecX, vecY);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseRot((cusparseHandle_t)handle,
+                                                                     c_coeff,
+                                                                     s_coeff,
+                                                                     (cusparseSpVecDescr_t)vecX,
+                                                                     (cusparseDnVecDescr_t)vecY)));
 }
 #endif
 
@@ -12544,12 +17074,14 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSparseToDense_bufferSize((cusparseHandle_t)handle,
                                          (cusparseConstSpMatDescr_t)matA,
                                          (cusparseDnMatDescr_t)matB,
                                          hipsparse::hipSpToDnAlgToCudaSpToDnAlg(alg),
-                                         pBufferSizeInBytes));
+                                         pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 11020)
 hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t handle,
@@ -12558,12 +17090,14 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t handle,
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSparseToDense_bufferSize((cusparseHandle_t)handle,
                                          (cusparseSpMatDescr_t)matA,
                                          (cusparseDnMatDescr_t)matB,
                                          hipsparse::hipSpToDnAlgToCudaSpToDnAlg(alg),
-                                         pBufferSizeInBytes));
+                                         pBufferSizeInBytes)));
 }
 #endif
 
@@ -12574,12 +17108,14 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSparseToDense((cusparseHandle_t)handle,
                               (cusparseConstSpMatDescr_t)matA,
                               (cusparseDnMatDescr_t)matB,
                               hipsparse::hipSpToDnAlgToCudaSpToDnAlg(alg),
-                              externalBuffer));
+                              externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11020)
 hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t handle,
@@ -12588,12 +17124,14 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSparseToDense((cusparseHandle_t)handle,
                               (cusparseSpMatDescr_t)matA,
                               (cusparseDnMatDescr_t)matB,
                               hipsparse::hipSpToDnAlgToCudaSpToDnAlg(alg),
-                              externalBuffer));
+                              externalBuffer)));
 }
 #endif
 
@@ -12604,12 +17142,14 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_bufferSize((cusparseHandle_t)handle,
                                          (cusparseConstDnMatDescr_t)matA,
                                          (cusparseSpMatDescr_t)matB,
                                          hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                         pBufferSizeInBytes));
+                                         pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 11020)
 hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t handle,
@@ -12618,12 +17158,14 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t handle,
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_bufferSize((cusparseHandle_t)handle,
                                          (cusparseDnMatDescr_t)matA,
                                          (cusparseSpMatDescr_t)matB,
                                          hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                         pBufferSizeInBytes));
+                                         pBufferSizeInBytes)));
 }
 #endif
 
@@ -12634,12 +17176,14 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           ha
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_analysis((cusparseHandle_t)handle,
                                        (cusparseConstDnMatDescr_t)matA,
                                        (cusparseSpMatDescr_t)matB,
                                        hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                       externalBuffer));
+                                       externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11020)
 hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t handle,
@@ -12648,12 +17192,14 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t handle,
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_analysis((cusparseHandle_t)handle,
                                        (cusparseDnMatDescr_t)matA,
                                        (cusparseSpMatDescr_t)matB,
                                        hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                       externalBuffer));
+                                       externalBuffer)));
 }
 #endif
 
@@ -12664,12 +17210,14 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           han
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_convert((cusparseHandle_t)handle,
                                       (cusparseConstDnMatDescr_t)matA,
                                       (cusparseSpMatDescr_t)matB,
                                       hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                      externalBuffer));
+                                      externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11020)
 hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t handle,
@@ -12678,12 +17226,14 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t handle,
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, matA, matB, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDenseToSparse_convert((cusparseHandle_t)handle,
                                       (cusparseDnMatDescr_t)matA,
                                       (cusparseSpMatDescr_t)matB,
                                       hipsparse::hipDnToSpAlgToCudaDnToSpAlg(alg),
-                                      externalBuffer));
+                                      externalBuffer)));
 }
 #endif
 
@@ -12696,14 +17246,16 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                                            hipDataType                computeType,
                                            size_t*                    pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpVV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opX),
                                 (cusparseConstSpVecDescr_t)vecX,
                                 (cusparseConstDnVecDescr_t)vecY,
                                 result,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t handle,
@@ -12714,14 +17266,16 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t handle,
                                            hipDataType computeType,
                                            size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpVV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opX),
                                 (cusparseSpVecDescr_t)vecX,
                                 (cusparseDnVecDescr_t)vecY,
                                 result,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #endif
 
@@ -12734,14 +17288,16 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
                                 hipDataType                computeType,
                                 void*                      externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpVV((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opX),
                      (cusparseConstSpVecDescr_t)vecX,
                      (cusparseConstDnVecDescr_t)vecY,
                      result,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
-                     externalBuffer));
+                     externalBuffer)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t handle,
@@ -12752,14 +17308,16 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t handle,
                                 hipDataType computeType,
                                 void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpVV((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opX),
                      (cusparseSpVecDescr_t)vecX,
                      (cusparseDnVecDescr_t)vecY,
                      result,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
-                     externalBuffer));
+                     externalBuffer)));
 }
 #endif
 
@@ -12775,7 +17333,18 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 alpha,
@@ -12785,7 +17354,7 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                 (const cusparseDnVecDescr_t)vecY,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMVAlgToCudaSpMVAlg(alg),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t handle,
@@ -12799,7 +17368,18 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t handle,
                                            hipsparseSpMVAlg_t alg,
                                            size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 alpha,
@@ -12809,7 +17389,7 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t handle,
                                 (const cusparseDnVecDescr_t)vecY,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMVAlgToCudaSpMVAlg(alg),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #endif
 
@@ -12825,18 +17405,20 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     if(matA == nullptr || vecX == nullptr || vecY == nullptr || alpha == nullptr || beta == nullptr
        || externalBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t handle,
@@ -12850,18 +17432,20 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t handle,
                                            hipsparseSpMVAlg_t alg,
                                            void* externalBuffer)
 {
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
     if(handle == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
     if(matA == nullptr || vecX == nullptr || vecY == nullptr || alpha == nullptr || beta == nullptr
        || externalBuffer == nullptr)
     {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
     }
 
-    return HIPSPARSE_STATUS_SUCCESS;
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
@@ -12877,7 +17461,9 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseSpMVAlg_t          alg,
                                 void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMV((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opA),
                      alpha,
@@ -12887,7 +17473,7 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                      (const cusparseDnVecDescr_t)vecY,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
                      hipsparse::hipSpMVAlgToCudaSpMVAlg(alg),
-                     externalBuffer));
+                     externalBuffer)));
 }
 #elif(CUDART_VERSION > 10010 || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
 hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t handle,
@@ -12901,7 +17487,9 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t handle,
                                 hipsparseSpMVAlg_t alg,
                                 void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMV((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opA),
                      alpha,
@@ -12911,7 +17499,361 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t handle,
                      (const cusparseDnVecDescr_t)vecY,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
                      hipsparse::hipSpMVAlgToCudaSpMVAlg(alg),
-                     externalBuffer));
+                     externalBuffer)));
+}
+#endif
+
+#if(CUDART_VERSION >= 12000)
+namespace hipsparse
+{
+    // Offsets of the parts of the buffer of a group, the SpMV of each matrix uses its own part
+    // of the buffer, at offsets aligned on 256 bytes. The sizes are queried on the host by
+    // every call, so that the parts always match the descriptors as they are at the call.
+    static hipsparseStatus_t spmvGroupedOffsets(hipsparseHandle_t                 handle,
+                                                hipsparseOperation_t              opA,
+                                                int                               groupCount,
+                                                const void*                       alpha,
+                                                const hipsparseConstSpMatDescr_t* matA,
+                                                const hipsparseConstDnVecDescr_t* vecX,
+                                                const void*                       beta,
+                                                const hipsparseDnVecDescr_t*      vecY,
+                                                hipDataType                       computeType,
+                                                hipsparseSpMVAlg_t                alg,
+                                                std::vector<size_t>&              offsets)
+    {
+        offsets.resize(size_t(groupCount) + 1);
+
+        offsets[0] = 0;
+        for(int i = 0; i < groupCount; ++i)
+        {
+            size_t           size;
+            cusparseStatus_t status
+                = cusparseSpMV_bufferSize((cusparseHandle_t)handle,
+                                          hipOperationToCudaOperation(opA),
+                                          alpha,
+                                          (cusparseConstSpMatDescr_t)matA[i],
+                                          (cusparseConstDnVecDescr_t)vecX[i],
+                                          beta,
+                                          (const cusparseDnVecDescr_t)vecY[i],
+                                          hipDataTypeToCudaDataType(computeType),
+                                          hipSpMVAlgToCudaSpMVAlg(alg),
+                                          &size);
+            if(status != CUSPARSE_STATUS_SUCCESS)
+            {
+                return hipCUSPARSEStatusToHIPStatus(status);
+            }
+
+            offsets[i + 1] = offsets[i] + ((size + 255) / 256) * 256;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Without a buffer, only the parts are sized.
+    static hipsparseStatus_t spmvGrouped(hipsparseHandle_t                 handle,
+                                         hipsparseOperation_t              opA,
+                                         int                               groupCount,
+                                         const void*                       alpha,
+                                         const hipsparseConstSpMatDescr_t* matA,
+                                         const hipsparseConstDnVecDescr_t* vecX,
+                                         const void*                       beta,
+                                         const hipsparseDnVecDescr_t*      vecY,
+                                         hipDataType                       computeType,
+                                         hipsparseSpMVAlg_t                alg,
+                                         size_t*                           bufferSize,
+                                         void*                             buffer)
+    {
+        if(handle == nullptr || groupCount < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(groupCount > 0 && (matA == nullptr || vecX == nullptr || vecY == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        std::vector<size_t>     offsets;
+        const hipsparseStatus_t offsets_status = spmvGroupedOffsets(
+            handle, opA, groupCount, alpha, matA, vecX, beta, vecY, computeType, alg, offsets);
+        if(offsets_status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            return offsets_status;
+        }
+
+        if(buffer != nullptr)
+        {
+            const cusparseOperation_t op       = hipOperationToCudaOperation(opA);
+            const cudaDataType        datatype = hipDataTypeToCudaDataType(computeType);
+            const cusparseSpMVAlg_t   spmv_alg = hipSpMVAlgToCudaSpMVAlg(alg);
+
+            for(int i = 0; i < groupCount; ++i)
+            {
+                cusparseStatus_t status = cusparseSpMV((cusparseHandle_t)handle,
+                                                       op,
+                                                       alpha,
+                                                       (cusparseConstSpMatDescr_t)matA[i],
+                                                       (cusparseConstDnVecDescr_t)vecX[i],
+                                                       beta,
+                                                       (const cusparseDnVecDescr_t)vecY[i],
+                                                       datatype,
+                                                       spmv_alg,
+                                                       static_cast<char*>(buffer) + offsets[i]);
+                if(status != CUSPARSE_STATUS_SUCCESS)
+                {
+                    return hipCUSPARSEStatusToHIPStatus(status);
+                }
+            }
+        }
+
+        if(bufferSize != nullptr)
+        {
+            *bufferSize = offsets[groupCount];
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_bufferSize(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  size_t* pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    if(pBufferSizeInBytes == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spmvGrouped(handle,
+                                        opA,
+                                        groupCount,
+                                        alpha,
+                                        matA,
+                                        vecX,
+                                        beta,
+                                        vecY,
+                                        computeType,
+                                        alg,
+                                        pBufferSizeInBytes,
+                                        nullptr));
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped_preprocess(hipsparseHandle_t                 handle,
+                                                  hipsparseOperation_t              opA,
+                                                  int                               groupCount,
+                                                  const void*                       alpha,
+                                                  const hipsparseConstSpMatDescr_t* matA,
+                                                  const hipsparseConstDnVecDescr_t* vecX,
+                                                  const void*                       beta,
+                                                  const hipsparseDnVecDescr_t*      vecY,
+                                                  hipDataType                       computeType,
+                                                  hipsparseSpMVAlg_t                alg,
+                                                  void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    if(handle == nullptr || groupCount < 0)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    if(groupCount > 0 && (matA == nullptr || vecX == nullptr || vecY == nullptr))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseSpMVGrouped(hipsparseHandle_t                 handle,
+                                       hipsparseOperation_t              opA,
+                                       int                               groupCount,
+                                       const void*                       alpha,
+                                       const hipsparseConstSpMatDescr_t* matA,
+                                       const hipsparseConstDnVecDescr_t* vecX,
+                                       const void*                       beta,
+                                       const hipsparseDnVecDescr_t*      vecY,
+                                       hipDataType                       computeType,
+                                       hipsparseSpMVAlg_t                alg,
+                                       void*                             externalBuffer)
+{
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    groupCount,
+                    alpha,
+                    matA,
+                    vecX,
+                    beta,
+                    vecY,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    if(groupCount > 0 && externalBuffer == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::spmvGrouped(handle,
+                                        opA,
+                                        groupCount,
+                                        alpha,
+                                        matA,
+                                        vecX,
+                                        beta,
+                                        vecY,
+                                        computeType,
+                                        alg,
+                                        nullptr,
+                                        externalBuffer));
+}
+#endif
+
+#if(CUDART_VERSION >= 12000)
+struct hipsparseSpMVPlan
+{
+    cusparseOperation_t  op;
+    cusparseSpMatDescr_t mat;
+    cudaDataType         compute_type;
+    cusparseSpMVAlg_t    alg;
+
+    // Buffer of cusparseSpMV, freed by hipsparseDestroySpMVPlan
+    void* buffer = nullptr;
+};
+
+hipsparseStatus_t hipsparseCreateSpMVPlan(hipsparseSpMVPlan_t*        plan,
+                                          hipsparseHandle_t           handle,
+                                          hipsparseOperation_t        opA,
+                                          const void*                 alpha,
+                                          hipsparseSpMatDescr_t       matA,
+                                          hipsparseConstDnVecDescr_t  vecX,
+                                          const void*                 beta,
+                                          const hipsparseDnVecDescr_t vecY,
+                                          hipDataType                 computeType,
+                                          hipsparseSpMVAlg_t          alg)
+{
+    HIPSPARSE_TRACE(plan, handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg);
+
+    if(plan == nullptr || handle == nullptr || alpha == nullptr || matA == nullptr
+       || vecX == nullptr || beta == nullptr || vecY == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    hipsparseSpMVPlan p;
+    p.op           = hipsparse::hipOperationToCudaOperation(opA);
+    p.mat          = (cusparseSpMatDescr_t)matA;
+    p.compute_type = hipsparse::hipDataTypeToCudaDataType(computeType);
+    p.alg          = hipsparse::hipSpMVAlgToCudaSpMVAlg(alg);
+
+    size_t buffer_size = 0;
+    RETURN_IF_CUSPARSE_ERROR(cusparseSpMV_bufferSize((cusparseHandle_t)handle,
+                                                     p.op,
+                                                     alpha,
+                                                     p.mat,
+                                                     (cusparseConstDnVecDescr_t)vecX,
+                                                     beta,
+                                                     (const cusparseDnVecDescr_t)vecY,
+                                                     p.compute_type,
+                                                     p.alg,
+                                                     &buffer_size));
+
+    // As in hipsparseSpMV_preprocess, the plan has no preprocessing with cuSPARSE
+    if(buffer_size > 0 && cudaMalloc(&p.buffer, buffer_size) != cudaSuccess)
+    {
+        return trace(HIPSPARSE_STATUS_ALLOC_FAILED);
+    }
+
+    *plan = new hipsparseSpMVPlan(p);
+    return trace(HIPSPARSE_STATUS_SUCCESS);
+}
+
+hipsparseStatus_t hipsparseDestroySpMVPlan(hipsparseSpMVPlan_t plan)
+{
+    HIPSPARSE_TRACE(plan);
+
+    if(plan == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // cudaFree waits for the pending work using the buffer
+    const cudaError_t status = cudaFree(plan->buffer);
+    delete plan;
+
+    return trace(status == cudaSuccess ? HIPSPARSE_STATUS_SUCCESS
+                                       : HIPSPARSE_STATUS_INTERNAL_ERROR);
+}
+
+hipsparseStatus_t
+    hipsparseSpMVPlanUpdateValues(hipsparseHandle_t handle, hipsparseSpMVPlan_t plan, void* values)
+{
+    HIPSPARSE_TRACE(handle, plan, values);
+
+    if(handle == nullptr || plan == nullptr || values == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMatSetValues(plan->mat, values)));
+}
+
+hipsparseStatus_t hipsparseSpMVPlanExecute(hipsparseHandle_t           handle,
+                                           hipsparseSpMVPlan_t         plan,
+                                           const void*                 alpha,
+                                           hipsparseConstDnVecDescr_t  vecX,
+                                           const void*                 beta,
+                                           const hipsparseDnVecDescr_t vecY)
+{
+    HIPSPARSE_TRACE(handle, plan, alpha, vecX, beta, vecY);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpMV((cusparseHandle_t)handle,
+                     plan->op,
+                     alpha,
+                     plan->mat,
+                     (cusparseConstDnVecDescr_t)vecX,
+                     beta,
+                     (const cusparseDnVecDescr_t)vecY,
+                     plan->compute_type,
+                     plan->alg,
+                     plan->buffer)));
 }
 #endif
 
@@ -12928,7 +17870,19 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -12939,7 +17893,7 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                 (const cusparseDnMatDescr_t)matC,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t handle,
@@ -12954,7 +17908,19 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t handle,
                                            hipsparseSpMMAlg_t alg,
                                            size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -12965,7 +17931,7 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t handle,
                                 (const cusparseDnMatDescr_t)matC,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #endif
 
@@ -12982,7 +17948,19 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM_preprocess((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -12993,7 +17971,7 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                 (const cusparseDnMatDescr_t)matC,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                                externalBuffer));
+                                externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11021)
 hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t handle,
@@ -13008,7 +17986,19 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t handle,
                                            hipsparseSpMMAlg_t alg,
                                            void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM_preprocess((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -13019,7 +18009,7 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t handle,
                                 (const cusparseDnMatDescr_t)matC,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                                externalBuffer));
+                                externalBuffer)));
 }
 #endif
 
@@ -13036,7 +18026,19 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opA),
                      hipsparse::hipOperationToCudaOperation(opB),
@@ -13047,7 +18049,7 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                      (const cusparseDnMatDescr_t)matC,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
                      hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                     externalBuffer));
+                     externalBuffer)));
 }
 #elif(CUDART_VERSION >= 10010)
 hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t handle,
@@ -13062,7 +18064,19 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t handle,
                                 hipsparseSpMMAlg_t alg,
                                 void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpMM((cusparseHandle_t)handle,
                      hipsparse::hipOperationToCudaOperation(opA),
                      hipsparse::hipOperationToCudaOperation(opB),
@@ -13073,23 +18087,27 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t handle,
                      (const cusparseDnMatDescr_t)matC,
                      hipsparse::hipDataTypeToCudaDataType(computeType),
                      hipsparse::hipSpMMAlgToCudaSpMMAlg(alg),
-                     externalBuffer));
+                     externalBuffer)));
 }
 #endif
 
 #if(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpGEMM_createDescr((cusparseSpGEMMDescr_t*)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpGEMM_createDescr((cusparseSpGEMMDescr_t*)descr)));
 }
 #endif
 
 #if(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpGEMM_destroyDescr((cusparseSpGEMMDescr_t)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpGEMM_destroyDescr((cusparseSpGEMMDescr_t)descr)));
 }
 #endif
 
@@ -13108,7 +18126,21 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                                  size_t*                    bufferSize1,
                                                  void*                      externalBuffer1)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
                                       hipsparse::hipOperationToCudaOperation(opA),
                                       hipsparse::hipOperationToCudaOperation(opB),
@@ -13121,7 +18153,7 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                       hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                       (cusparseSpGEMMDescr_t)spgemmDescr,
                                       bufferSize1,
-                                      externalBuffer1));
+                                      externalBuffer1)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t handle,
@@ -13138,7 +18170,21 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t handle,
                                                  size_t* bufferSize1,
                                                  void* externalBuffer1)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_workEstimation((cusparseHandle_t)handle,
                                       hipsparse::hipOperationToCudaOperation(opA),
                                       hipsparse::hipOperationToCudaOperation(opB),
@@ -13151,7 +18197,7 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t handle,
                                       hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                       (cusparseSpGEMMDescr_t)spgemmDescr,
                                       bufferSize1,
-                                      externalBuffer1));
+                                      externalBuffer1)));
 }
 #endif
 
@@ -13170,7 +18216,21 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                           size_t*                    bufferSize2,
                                           void*                      externalBuffer2)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_compute((cusparseHandle_t)handle,
                                hipsparse::hipOperationToCudaOperation(opA),
                                hipsparse::hipOperationToCudaOperation(opB),
@@ -13183,7 +18243,7 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                (cusparseSpGEMMDescr_t)spgemmDescr,
                                bufferSize2,
-                               externalBuffer2));
+                               externalBuffer2)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t handle,
@@ -13200,7 +18260,21 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t handle,
                                           size_t* bufferSize2,
                                           void* externalBuffer2)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_compute((cusparseHandle_t)handle,
                                hipsparse::hipOperationToCudaOperation(opA),
                                hipsparse::hipOperationToCudaOperation(opB),
@@ -13213,7 +18287,7 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t handle,
                                hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                (cusparseSpGEMMDescr_t)spgemmDescr,
                                bufferSize2,
-                               externalBuffer2));
+                               externalBuffer2)));
 }
 #endif
 
@@ -13230,7 +18304,9 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                                        hipsparseSpGEMMAlg_t       alg,
                                        hipsparseSpGEMMDescr_t     spgemmDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_copy((cusparseHandle_t)handle,
                             hipsparse::hipOperationToCudaOperation(opA),
                             hipsparse::hipOperationToCudaOperation(opB),
@@ -13241,7 +18317,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                             (cusparseSpMatDescr_t)matC,
                             computeType,
                             hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                            (cusparseSpGEMMDescr_t)spgemmDescr));
+                            (cusparseSpGEMMDescr_t)spgemmDescr)));
 }
 #elif(CUDART_VERSION >= 11000)
 hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t handle,
@@ -13256,7 +18332,9 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t handle,
                                        hipsparseSpGEMMAlg_t alg,
                                        hipsparseSpGEMMDescr_t spgemmDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMM_copy((cusparseHandle_t)handle,
                             hipsparse::hipOperationToCudaOperation(opA),
                             hipsparse::hipOperationToCudaOperation(opB),
@@ -13267,7 +18345,7 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t handle,
                             (cusparseSpMatDescr_t)matC,
                             computeType,
                             hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                            (cusparseSpGEMMDescr_t)spgemmDescr));
+                            (cusparseSpGEMMDescr_t)spgemmDescr)));
 }
 #endif
 
@@ -13283,7 +18361,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                                       size_t*                    bufferSize1,
                                                       void*                      externalBuffer1)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_workEstimation((cusparseHandle_t)handle,
                                            hipsparse::hipOperationToCudaOperation(opA),
                                            hipsparse::hipOperationToCudaOperation(opB),
@@ -13293,7 +18382,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                            hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                            (cusparseSpGEMMDescr_t)spgemmDescr,
                                            bufferSize1,
-                                           externalBuffer1));
+                                           externalBuffer1)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t handle,
@@ -13307,7 +18396,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t handle,
                                                       size_t* bufferSize1,
                                                       void* externalBuffer1)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize1,
+                    externalBuffer1);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_workEstimation((cusparseHandle_t)handle,
                                            hipsparse::hipOperationToCudaOperation(opA),
                                            hipsparse::hipOperationToCudaOperation(opB),
@@ -13317,7 +18417,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t handle,
                                            hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                            (cusparseSpGEMMDescr_t)spgemmDescr,
                                            bufferSize1,
-                                           externalBuffer1));
+                                           externalBuffer1)));
 }
 #endif
 
@@ -13337,7 +18437,22 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                            size_t*                    bufferSize4,
                                            void*                      externalBuffer4)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2,
+                    bufferSize3,
+                    externalBuffer3,
+                    bufferSize4,
+                    externalBuffer4);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_nnz((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -13351,7 +18466,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                 bufferSize3,
                                 externalBuffer3,
                                 bufferSize4,
-                                externalBuffer4));
+                                externalBuffer4)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t handle,
@@ -13369,7 +18484,22 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t handle,
                                            size_t* bufferSize4,
                                            void* externalBuffer4)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize2,
+                    externalBuffer2,
+                    bufferSize3,
+                    externalBuffer3,
+                    bufferSize4,
+                    externalBuffer4);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_nnz((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -13383,7 +18513,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t handle,
                                 bufferSize3,
                                 externalBuffer3,
                                 bufferSize4,
-                                externalBuffer4));
+                                externalBuffer4)));
 }
 
 #endif
@@ -13401,7 +18531,9 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                                hipsparseSpGEMMAlg_t       alg,
                                                hipsparseSpGEMMDescr_t     spgemmDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_compute((cusparseHandle_t)handle,
                                     hipsparse::hipOperationToCudaOperation(opA),
                                     hipsparse::hipOperationToCudaOperation(opB),
@@ -13412,7 +18544,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                     (cusparseSpMatDescr_t)matC,
                                     computeType,
                                     hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                    (cusparseSpGEMMDescr_t)spgemmDescr));
+                                    (cusparseSpGEMMDescr_t)spgemmDescr)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t handle,
@@ -13427,7 +18559,9 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t handle,
                                                hipsparseSpGEMMAlg_t alg,
                                                hipsparseSpGEMMDescr_t spgemmDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, spgemmDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_compute((cusparseHandle_t)handle,
                                     hipsparse::hipOperationToCudaOperation(opA),
                                     hipsparse::hipOperationToCudaOperation(opB),
@@ -13438,7 +18572,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t handle,
                                     (cusparseSpMatDescr_t)matC,
                                     computeType,
                                     hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
-                                    (cusparseSpGEMMDescr_t)spgemmDescr));
+                                    (cusparseSpGEMMDescr_t)spgemmDescr)));
 }
 #endif
 
@@ -13454,7 +18588,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                             size_t*                    bufferSize5,
                                             void*                      externalBuffer5)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize5,
+                    externalBuffer5);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_copy((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13464,7 +18609,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                  hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                  (cusparseSpGEMMDescr_t)spgemmDescr,
                                  bufferSize5,
-                                 externalBuffer5));
+                                 externalBuffer5)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t handle,
@@ -13478,7 +18623,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t handle,
                                             size_t* bufferSize5,
                                             void* externalBuffer5)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    matA,
+                    matB,
+                    matC,
+                    alg,
+                    spgemmDescr,
+                    bufferSize5,
+                    externalBuffer5);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpGEMMreuse_copy((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13488,7 +18644,7 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t handle,
                                  hipsparse::hipSpGEMMAlgToCudaSpGEMMAlg(alg),
                                  (cusparseSpGEMMDescr_t)spgemmDescr,
                                  bufferSize5,
-                                 externalBuffer5));
+                                 externalBuffer5)));
 }
 
 #endif
@@ -13506,7 +18662,9 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                                  hipsparseSDDMMAlg_t        alg,
                                  void*                      tempBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM((cusparseHandle_t)handle,
                       hipsparse::hipOperationToCudaOperation(opA),
                       hipsparse::hipOperationToCudaOperation(opB),
@@ -13517,7 +18675,7 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                       (cusparseSpMatDescr_t)matC,
                       hipsparse::hipDataTypeToCudaDataType(computeType),
                       hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                      tempBuffer));
+                      tempBuffer)));
 }
 #elif(CUDART_VERSION >= 11022)
 hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t handle,
@@ -13532,7 +18690,9 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t handle,
                                  hipsparseSDDMMAlg_t alg,
                                  void* tempBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM((cusparseHandle_t)handle,
                       hipsparse::hipOperationToCudaOperation(opA),
                       hipsparse::hipOperationToCudaOperation(opB),
@@ -13543,7 +18703,7 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t handle,
                       (cusparseSpMatDescr_t)matC,
                       hipsparse::hipDataTypeToCudaDataType(computeType),
                       hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                      tempBuffer));
+                      tempBuffer)));
 }
 #endif
 
@@ -13560,7 +18720,19 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             size_t*                    pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM_bufferSize((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13571,7 +18743,7 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                  (cusparseSpMatDescr_t)matC,
                                  hipsparse::hipDataTypeToCudaDataType(computeType),
                                  hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                                 pBufferSizeInBytes));
+                                 pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 11022)
 hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t handle,
@@ -13586,7 +18758,19 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t handle,
                                             hipsparseSDDMMAlg_t alg,
                                             size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    beta,
+                    matC,
+                    computeType,
+                    alg,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM_bufferSize((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13597,7 +18781,7 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t handle,
                                  (cusparseSpMatDescr_t)matC,
                                  hipsparse::hipDataTypeToCudaDataType(computeType),
                                  hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                                 pBufferSizeInBytes));
+                                 pBufferSizeInBytes)));
 }
 #endif
 
@@ -13614,7 +18798,9 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             void*                      tempBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM_preprocess((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13625,7 +18811,7 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                  (cusparseSpMatDescr_t)matC,
                                  hipsparse::hipDataTypeToCudaDataType(computeType),
                                  hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                                 tempBuffer));
+                                 tempBuffer)));
 }
 #elif(CUDART_VERSION >= 11022)
 hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t handle,
@@ -13640,7 +18826,9 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t handle,
                                             hipsparseSDDMMAlg_t alg,
                                             void* tempBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, opB, alpha, matA, matB, beta, matC, computeType, alg, tempBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSDDMM_preprocess((cusparseHandle_t)handle,
                                  hipsparse::hipOperationToCudaOperation(opA),
                                  hipsparse::hipOperationToCudaOperation(opB),
@@ -13651,23 +18839,27 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t handle,
                                  (cusparseSpMatDescr_t)matC,
                                  hipsparse::hipDataTypeToCudaDataType(computeType),
                                  hipsparse::hipSDDMMAlgToCudaSDDMMAlg(alg),
-                                 tempBuffer));
+                                 tempBuffer)));
 }
 #endif
 
 #if(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpSV_createDescr((cusparseSpSVDescr_t*)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSV_createDescr((cusparseSpSVDescr_t*)descr)));
 }
 #endif
 
 #if(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_destroyDescr(hipsparseSpSVDescr_t descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpSV_destroyDescr((cusparseSpSVDescr_t)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSV_destroyDescr((cusparseSpSVDescr_t)descr)));
 }
 #endif
 
@@ -13683,7 +18875,18 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    x,
+                    y,
+                    computeType,
+                    alg,
+                    spsvDescr,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 alpha,
@@ -13693,7 +18896,7 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
                                 (cusparseSpSVDescr_t)spsvDescr,
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t handle,
@@ -13707,7 +18910,18 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t handle,
                                            hipsparseSpSVDescr_t spsvDescr,
                                            size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    alpha,
+                    matA,
+                    x,
+                    y,
+                    computeType,
+                    alg,
+                    spsvDescr,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 alpha,
@@ -13717,7 +18931,7 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t handle,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
                                 (cusparseSpSVDescr_t)spsvDescr,
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #endif
 
@@ -13733,7 +18947,9 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_analysis((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(opA),
                               alpha,
@@ -13743,7 +18959,7 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                               hipsparse::hipDataTypeToCudaDataType(computeType),
                               hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
                               (cusparseSpSVDescr_t)spsvDescr,
-                              externalBuffer));
+                              externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t handle,
@@ -13757,7 +18973,9 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t handle,
                                          hipsparseSpSVDescr_t spsvDescr,
                                          void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr, externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_analysis((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(opA),
                               alpha,
@@ -13767,7 +18985,7 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t handle,
                               hipsparse::hipDataTypeToCudaDataType(computeType),
                               hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
                               (cusparseSpSVDescr_t)spsvDescr,
-                              externalBuffer));
+                              externalBuffer)));
 }
 #endif
 
@@ -13782,7 +19000,9 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVAlg_t          alg,
                                       hipsparseSpSVDescr_t        spsvDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_solve((cusparseHandle_t)handle,
                            hipsparse::hipOperationToCudaOperation(opA),
                            alpha,
@@ -13791,7 +19011,7 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                            (const cusparseDnVecDescr_t)y,
                            hipsparse::hipDataTypeToCudaDataType(computeType),
                            hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
-                           (cusparseSpSVDescr_t)spsvDescr));
+                           (cusparseSpSVDescr_t)spsvDescr)));
 }
 #elif(CUDART_VERSION >= 11030)
 hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t handle,
@@ -13804,7 +19024,9 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t handle,
                                       hipsparseSpSVAlg_t alg,
                                       hipsparseSpSVDescr_t spsvDescr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, x, y, computeType, alg, spsvDescr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSV_solve((cusparseHandle_t)handle,
                            hipsparse::hipOperationToCudaOperation(opA),
                            alpha,
@@ -13813,23 +19035,89 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t handle,
                            (const cusparseDnVecDescr_t)y,
                            hipsparse::hipDataTypeToCudaDataType(computeType),
                            hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
-                           (cusparseSpSVDescr_t)spsvDescr));
+                           (cusparseSpSVDescr_t)spsvDescr)));
+}
+#endif
+
+#if(CUDART_VERSION >= 12000)
+hipsparseStatus_t hipsparseSpSV_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSVDescr_t  spsvDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSVUpdate_t updatePart)
+{
+    HIPSPARSE_TRACE(handle, spsvDescr, newValues, updatePart);
+
+#if(CUDART_VERSION >= 12010)
+    if(updatePart != HIPSPARSE_SPSV_UPDATE_GENERAL && updatePart != HIPSPARSE_SPSV_UPDATE_DIAGONAL)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSV_updateMatrix((cusparseHandle_t)handle,
+                                  (cusparseSpSVDescr_t)spsvDescr,
+                                  newValues,
+                                  hipsparse::hipSpSVUpdateToCudaSpSVUpdate(updatePart))));
+#else
+    // cusparseSpSV_updateMatrix was added in CUDA 12.1
+    return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+#endif
+}
+
+hipsparseStatus_t hipsparseSpSV_solveBatched(hipsparseHandle_t                 handle,
+                                             hipsparseOperation_t              opA,
+                                             const void*                       alpha,
+                                             hipsparseConstSpMatDescr_t        matA,
+                                             int                               batchCount,
+                                             const hipsparseConstDnVecDescr_t* x,
+                                             const hipsparseDnVecDescr_t*      y,
+                                             hipDataType                       computeType,
+                                             hipsparseSpSVAlg_t                alg,
+                                             hipsparseSpSVDescr_t              spsvDescr)
+{
+    HIPSPARSE_TRACE(handle, opA, alpha, matA, batchCount, x, y, computeType, alg, spsvDescr);
+
+    if(batchCount < 0 || (batchCount > 0 && (x == nullptr || y == nullptr)))
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    // Each right-hand side reuses the analysis of spsvDescr
+    for(int i = 0; i < batchCount; ++i)
+    {
+        RETURN_IF_CUSPARSE_ERROR(
+            cusparseSpSV_solve((cusparseHandle_t)handle,
+                               hipsparse::hipOperationToCudaOperation(opA),
+                               alpha,
+                               (cusparseConstSpMatDescr_t)matA,
+                               (cusparseConstDnVecDescr_t)x[i],
+                               (const cusparseDnVecDescr_t)y[i],
+                               hipsparse::hipDataTypeToCudaDataType(computeType),
+                               hipsparse::hipSpSVAlgToCudaSpSVAlg(alg),
+                               (cusparseSpSVDescr_t)spsvDescr));
+    }
+
+    return trace(HIPSPARSE_STATUS_SUCCESS);
 }
 #endif
 
 #if(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpSM_createDescr(hipsparseSpSMDescr_t* descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpSM_createDescr((cusparseSpSMDescr_t*)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSM_createDescr((cusparseSpSMDescr_t*)descr)));
 }
 #endif
 
 #if(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpSM_destroyDescr(hipsparseSpSMDescr_t descr)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSpSM_destroyDescr((cusparseSpSMDescr_t)descr));
+    HIPSPARSE_TRACE(descr);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSM_destroyDescr((cusparseSpSMDescr_t)descr)));
 }
 #endif
 
@@ -13846,7 +19134,19 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -13857,7 +19157,7 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
                                 (cusparseSpSMDescr_t)spsmDescr,
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t handle,
@@ -13872,7 +19172,19 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t handle,
                                            hipsparseSpSMDescr_t spsmDescr,
                                            size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_bufferSize((cusparseHandle_t)handle,
                                 hipsparse::hipOperationToCudaOperation(opA),
                                 hipsparse::hipOperationToCudaOperation(opB),
@@ -13883,7 +19195,7 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t handle,
                                 hipsparse::hipDataTypeToCudaDataType(computeType),
                                 hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
                                 (cusparseSpSMDescr_t)spsmDescr,
-                                pBufferSizeInBytes));
+                                pBufferSizeInBytes)));
 }
 #endif
 
@@ -13900,7 +19212,19 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_analysis((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(opA),
                               hipsparse::hipOperationToCudaOperation(opB),
@@ -13911,7 +19235,7 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                               hipsparse::hipDataTypeToCudaDataType(computeType),
                               hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
                               (cusparseSpSMDescr_t)spsmDescr,
-                              externalBuffer));
+                              externalBuffer)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t handle,
@@ -13926,7 +19250,19 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t handle,
                                          hipsparseSpSMDescr_t spsmDescr,
                                          void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_analysis((cusparseHandle_t)handle,
                               hipsparse::hipOperationToCudaOperation(opA),
                               hipsparse::hipOperationToCudaOperation(opB),
@@ -13937,7 +19273,7 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t handle,
                               hipsparse::hipDataTypeToCudaDataType(computeType),
                               hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
                               (cusparseSpSMDescr_t)spsmDescr,
-                              externalBuffer));
+                              externalBuffer)));
 }
 #endif
 
@@ -13954,7 +19290,19 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_solve((cusparseHandle_t)handle,
                            hipsparse::hipOperationToCudaOperation(opA),
                            hipsparse::hipOperationToCudaOperation(opB),
@@ -13964,7 +19312,7 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                            (const cusparseDnMatDescr_t)matC,
                            hipsparse::hipDataTypeToCudaDataType(computeType),
                            hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
-                           (cusparseSpSMDescr_t)spsmDescr));
+                           (cusparseSpSMDescr_t)spsmDescr)));
 }
 #elif(CUDART_VERSION >= 11031)
 hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t handle,
@@ -13979,7 +19327,19 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t handle,
                                       hipsparseSpSMDescr_t spsmDescr,
                                       void* externalBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    opA,
+                    opB,
+                    alpha,
+                    matA,
+                    matB,
+                    matC,
+                    computeType,
+                    alg,
+                    spsmDescr,
+                    externalBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseSpSM_solve((cusparseHandle_t)handle,
                            hipsparse::hipOperationToCudaOperation(opA),
                            hipsparse::hipOperationToCudaOperation(opB),
@@ -13989,7 +19349,33 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t handle,
                            (const cusparseDnMatDescr_t)matC,
                            hipsparse::hipDataTypeToCudaDataType(computeType),
                            hipsparse::hipSpSMAlgToCudaSpSMAlg(alg),
-                           (cusparseSpSMDescr_t)spsmDescr));
+                           (cusparseSpSMDescr_t)spsmDescr)));
+}
+#endif
+
+#if(CUDART_VERSION >= 12000)
+hipsparseStatus_t hipsparseSpSM_updateMatrix(hipsparseHandle_t     handle,
+                                             hipsparseSpSMDescr_t  spsmDescr,
+                                             void*                 newValues,
+                                             hipsparseSpSMUpdate_t updatePart)
+{
+    HIPSPARSE_TRACE(handle, spsmDescr, newValues, updatePart);
+
+#if(CUDART_VERSION >= 12040)
+    if(updatePart != HIPSPARSE_SPSM_UPDATE_GENERAL && updatePart != HIPSPARSE_SPSM_UPDATE_DIAGONAL)
+    {
+        return trace(HIPSPARSE_STATUS_INVALID_VALUE);
+    }
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSpSM_updateMatrix((cusparseHandle_t)handle,
+                                  (cusparseSpSMDescr_t)spsmDescr,
+                                  newValues,
+                                  hipsparse::hipSpSMUpdateToCudaSpSMUpdate(updatePart))));
+#else
+    // cusparseSpSM_updateMatrix was added in CUDA 12.4
+    return trace(HIPSPARSE_STATUS_NOT_SUPPORTED);
+#endif
 }
 #endif
 
@@ -14003,8 +19389,10 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2StridedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2StridedBatch_bufferSizeExt(
+        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14017,8 +19405,10 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2StridedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2StridedBatch_bufferSizeExt(
+        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14031,7 +19421,9 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsv2StridedBatch_bufferSizeExt((cusparseHandle_t)handle,
                                                  m,
                                                  (const cuComplex*)dl,
@@ -14040,7 +19432,7 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                  (const cuComplex*)x,
                                                  batchCount,
                                                  batchStride,
-                                                 pBufferSizeInBytes));
+                                                 pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -14053,7 +19445,9 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsv2StridedBatch_bufferSizeExt((cusparseHandle_t)handle,
                                                  m,
                                                  (const cuDoubleComplex*)dl,
@@ -14062,7 +19456,7 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                  (const cuDoubleComplex*)x,
                                                  batchCount,
                                                  batchStride,
-                                                 pBufferSizeInBytes));
+                                                 pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -14075,8 +19469,10 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2StridedBatch(
-        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2StridedBatch(
+        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -14090,8 +19486,10 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2StridedBatch(
-        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2StridedBatch(
+        (cusparseHandle_t)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
@@ -14105,7 +19503,9 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsv2StridedBatch((cusparseHandle_t)handle,
                                    m,
                                    (const cuComplex*)dl,
@@ -14114,7 +19514,7 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                    (cuComplex*)x,
                                    batchCount,
                                    batchStride,
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
@@ -14128,7 +19528,9 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsv2StridedBatch((cusparseHandle_t)handle,
                                    m,
                                    (const cuDoubleComplex*)dl,
@@ -14137,7 +19539,7 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                    (cuDoubleComplex*)x,
                                    batchCount,
                                    batchStride,
-                                   pBuffer));
+                                   pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -14150,8 +19552,10 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -14164,8 +19568,10 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
@@ -14178,7 +19584,9 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsv2_bufferSizeExt((cusparseHandle_t)handle,
                                      m,
                                      n,
@@ -14187,7 +19595,7 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                      (const cuComplex*)du,
                                      (const cuComplex*)B,
                                      ldb,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
@@ -14200,7 +19608,9 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsv2_bufferSizeExt((cusparseHandle_t)handle,
                                      m,
                                      n,
@@ -14209,7 +19619,7 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                      (const cuDoubleComplex*)du,
                                      (const cuDoubleComplex*)B,
                                      ldb,
-                                     pBufferSizeInBytes));
+                                     pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
@@ -14222,8 +19632,10 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSgtsv2((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSgtsv2((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
@@ -14237,8 +19649,10 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDgtsv2((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDgtsv2((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
@@ -14252,15 +19666,17 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgtsv2((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cuComplex*)dl,
-                                                                  (const cuComplex*)d,
-                                                                  (const cuComplex*)du,
-                                                                  (cuComplex*)B,
-                                                                  ldb,
-                                                                  pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgtsv2((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        (const cuComplex*)dl,
+                                                                        (const cuComplex*)d,
+                                                                        (const cuComplex*)du,
+                                                                        (cuComplex*)B,
+                                                                        ldb,
+                                                                        pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
@@ -14274,15 +19690,17 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgtsv2((cusparseHandle_t)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (const cuDoubleComplex*)dl,
-                                                                  (const cuDoubleComplex*)d,
-                                                                  (const cuDoubleComplex*)du,
-                                                                  (cuDoubleComplex*)B,
-                                                                  ldb,
-                                                                  pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgtsv2((cusparseHandle_t)handle,
+                                                                        m,
+                                                                        n,
+                                                                        (const cuDoubleComplex*)dl,
+                                                                        (const cuDoubleComplex*)d,
+                                                                        (const cuDoubleComplex*)du,
+                                                                        (cuDoubleComplex*)B,
+                                                                        ldb,
+                                                                        pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -14295,8 +19713,10 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2_nopivot_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsv2_nopivot_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -14309,8 +19729,10 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2_nopivot_bufferSizeExt(
-        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsv2_nopivot_bufferSizeExt(
+        (cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle,
@@ -14323,7 +19745,9 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsv2_nopivot_bufferSizeExt((cusparseHandle_t)handle,
                                              m,
                                              n,
@@ -14332,7 +19756,7 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                              (const cuComplex*)du,
                                              (const cuComplex*)B,
                                              ldb,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t       handle,
@@ -14345,7 +19769,9 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                                         int                     ldb,
                                                         size_t*                 pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsv2_nopivot_bufferSizeExt((cusparseHandle_t)handle,
                                              m,
                                              n,
@@ -14354,7 +19780,7 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                              (const cuDoubleComplex*)du,
                                              (const cuDoubleComplex*)B,
                                              ldb,
-                                             pBufferSizeInBytes));
+                                             pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
@@ -14368,8 +19794,10 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseSgtsv2_nopivot((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSgtsv2_nopivot((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
@@ -14383,8 +19811,10 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
-        cusparseDgtsv2_nopivot((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDgtsv2_nopivot((cusparseHandle_t)handle, m, n, dl, d, du, B, ldb, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
@@ -14398,15 +19828,18 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgtsv2_nopivot((cusparseHandle_t)handle,
-                                                                          m,
-                                                                          n,
-                                                                          (const cuComplex*)dl,
-                                                                          (const cuComplex*)d,
-                                                                          (const cuComplex*)du,
-                                                                          (cuComplex*)B,
-                                                                          ldb,
-                                                                          pBuffer));
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCgtsv2_nopivot((cusparseHandle_t)handle,
+                               m,
+                               n,
+                               (const cuComplex*)dl,
+                               (const cuComplex*)d,
+                               (const cuComplex*)du,
+                               (cuComplex*)B,
+                               ldb,
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
@@ -14420,7 +19853,9 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                           void*                   pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsv2_nopivot((cusparseHandle_t)handle,
                                m,
                                n,
@@ -14429,7 +19864,7 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                (const cuDoubleComplex*)du,
                                (cuDoubleComplex*)B,
                                ldb,
-                               pBuffer));
+                               pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14442,8 +19877,18 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSgtsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14456,8 +19901,18 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDgtsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14470,7 +19925,9 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
                                                     algo,
                                                     m,
@@ -14479,7 +19936,7 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                     (const cuComplex*)du,
                                                     (const cuComplex*)x,
                                                     batchCount,
-                                                    pBufferSizeInBytes));
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -14492,7 +19949,9 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
                                                     algo,
                                                     m,
@@ -14501,7 +19960,7 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                     (const cuDoubleComplex*)du,
                                                     (const cuDoubleComplex*)x,
                                                     batchCount,
-                                                    pBufferSizeInBytes));
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14514,8 +19973,10 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgtsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14529,8 +19990,10 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgtsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, dl, d, du, x, batchCount, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14544,7 +20007,9 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCgtsvInterleavedBatch((cusparseHandle_t)handle,
                                       algo,
                                       m,
@@ -14553,7 +20018,7 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                       (cuComplex*)du,
                                       (cuComplex*)x,
                                       batchCount,
-                                      pBuffer));
+                                      pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14567,7 +20032,9 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZgtsvInterleavedBatch((cusparseHandle_t)handle,
                                       algo,
                                       m,
@@ -14576,7 +20043,7 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                       (cuDoubleComplex*)du,
                                       (cuDoubleComplex*)x,
                                       batchCount,
-                                      pBuffer));
+                                      pBuffer)));
 }
 
 hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14591,8 +20058,20 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgpsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseSgpsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    ds,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    dw,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14607,8 +20086,20 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgpsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseDgpsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    ds,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    dw,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t handle,
@@ -14623,8 +20114,20 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgpsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseCgpsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    ds,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    dw,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t       handle,
@@ -14639,8 +20142,20 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgpsvInterleavedBatch_bufferSizeExt(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
+        cusparseZgpsvInterleavedBatch_bufferSizeExt((cusparseHandle_t)handle,
+                                                    algo,
+                                                    m,
+                                                    ds,
+                                                    dl,
+                                                    d,
+                                                    du,
+                                                    dw,
+                                                    x,
+                                                    batchCount,
+                                                    pBufferSizeInBytes)));
 }
 
 hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14655,8 +20170,10 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgpsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseSgpsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14671,8 +20188,10 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgpsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseDgpsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14687,8 +20206,10 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgpsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseCgpsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer)));
 }
 
 hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
@@ -14703,8 +20224,10 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgpsvInterleavedBatch(
-        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer));
+    HIPSPARSE_TRACE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(cusparseZgpsvInterleavedBatch(
+        (cusparseHandle_t)handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer)));
 }
 
 #if CUDART_VERSION < 13000
@@ -14721,7 +20244,20 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseScsrcolor((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -14733,7 +20269,7 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                           ncolors,
                           coloring,
                           reordering,
-                          (cusparseColorInfo_t)info));
+                          (cusparseColorInfo_t)info)));
 }
 
 hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
@@ -14749,7 +20285,20 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseDcsrcolor((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -14761,7 +20310,7 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                           ncolors,
                           coloring,
                           reordering,
-                          (cusparseColorInfo_t)info));
+                          (cusparseColorInfo_t)info)));
 }
 
 hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
@@ -14777,7 +20326,20 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseCcsrcolor((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -14789,7 +20351,7 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                           ncolors,
                           coloring,
                           reordering,
-                          (cusparseColorInfo_t)info));
+                          (cusparseColorInfo_t)info)));
 }
 
 hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
@@ -14805,7 +20367,20 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
-    return hipsparse::hipCUSPARSEStatusToHIPStatus(
+    HIPSPARSE_TRACE(handle,
+                    m,
+                    nnz,
+                    descrA,
+                    csrValA,
+                    csrRowPtrA,
+                    csrColIndA,
+                    fractionToColor,
+                    ncolors,
+                    coloring,
+                    reordering,
+                    info);
+
+    return trace(hipsparse::hipCUSPARSEStatusToHIPStatus(
         cusparseZcsrcolor((cusparseHandle_t)handle,
                           m,
                           nnz,
@@ -14817,6 +20392,6 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                           ncolors,
                           coloring,
                           reordering,
-                          (cusparseColorInfo_t)info));
+                          (cusparseColorInfo_t)info)));
 }
 #endif
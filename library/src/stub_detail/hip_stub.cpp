@@ -0,0 +1,236 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+// Stub HIP runtime, the routines called by hipSPARSE return hipSuccess without doing any work.
+// Device allocations get distinct addresses that are never dereferenced.
+//
+// Stream capture is emulated in the global capture mode: while a stream is captured, the calls
+// that are not allowed during a capture, i.e. allocations, synchronizations and synchronous
+// copies, invalidate the capture and fail with hipErrorStreamCaptureUnsupported. The stream and
+// capture routines are exported, they are called by hipsparse-overhead --capture.
+
+#include <hip/hip_runtime_api.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+
+#define HIPSPARSE_STUB_EXPORT __attribute__((visibility("default")))
+
+namespace hipsparse
+{
+    namespace stub
+    {
+        static std::atomic<uintptr_t> device_address(0x10000000);
+        static std::atomic<uintptr_t> object_address(0x1000);
+
+        struct captureState
+        {
+            std::mutex                                    mutex;
+            std::map<hipStream_t, hipStreamCaptureStatus> streams;
+        };
+
+        static captureState& getCaptureState()
+        {
+            static captureState state;
+            return state;
+        }
+
+        // Invalidate the captures in progress, if any, for a call not allowed during a capture
+        static hipError_t checkCapture()
+        {
+            captureState&               state = getCaptureState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+
+            hipError_t status = hipSuccess;
+            for(auto& stream : state.streams)
+            {
+                if(stream.second != hipStreamCaptureStatusNone)
+                {
+                    stream.second = hipStreamCaptureStatusInvalidated;
+                    status        = hipErrorStreamCaptureUnsupported;
+                }
+            }
+            return status;
+        }
+    }
+}
+
+hipError_t hipGetDevice(int* deviceId)
+{
+    if(deviceId == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    *deviceId = 0;
+    return hipSuccess;
+}
+
+hipError_t hipMalloc(void** ptr, size_t size)
+{
+    if(ptr == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    hipError_t status = hipsparse::stub::checkCapture();
+    if(status != hipSuccess)
+    {
+        return status;
+    }
+
+    *ptr = reinterpret_cast<void*>(hipsparse::stub::device_address.fetch_add(256));
+    return hipSuccess;
+}
+
+hipError_t hipFree(void* ptr)
+{
+    return hipsparse::stub::checkCapture();
+}
+
+hipError_t hipMemcpy(void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind)
+{
+    return hipsparse::stub::checkCapture();
+}
+
+hipError_t hipMemcpyAsync(
+    void* dst, const void* src, size_t sizeBytes, hipMemcpyKind kind, hipStream_t stream)
+{
+    return hipSuccess;
+}
+
+hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+    return hipsparse::stub::checkCapture();
+}
+
+hipError_t hipDeviceSynchronize(void)
+{
+    return hipsparse::stub::checkCapture();
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipStreamCreate(hipStream_t* stream)
+{
+    if(stream == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    *stream = reinterpret_cast<hipStream_t>(hipsparse::stub::object_address.fetch_add(16));
+
+    hipsparse::stub::captureState& state = hipsparse::stub::getCaptureState();
+    std::lock_guard<std::mutex>    lock(state.mutex);
+    state.streams[*stream] = hipStreamCaptureStatusNone;
+    return hipSuccess;
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipStreamDestroy(hipStream_t stream)
+{
+    hipsparse::stub::captureState& state = hipsparse::stub::getCaptureState();
+    std::lock_guard<std::mutex>    lock(state.mutex);
+    return (state.streams.erase(stream) == 1) ? hipSuccess : hipErrorInvalidResourceHandle;
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipStreamBeginCapture(hipStream_t          stream,
+                                                       hipStreamCaptureMode mode)
+{
+    hipsparse::stub::captureState& state = hipsparse::stub::getCaptureState();
+    std::lock_guard<std::mutex>    lock(state.mutex);
+
+    // The null stream cannot be captured
+    auto it = state.streams.find(stream);
+    if(it == state.streams.end())
+    {
+        return hipErrorInvalidResourceHandle;
+    }
+    if(it->second != hipStreamCaptureStatusNone)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    it->second = hipStreamCaptureStatusActive;
+    return hipSuccess;
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipStreamEndCapture(hipStream_t stream, hipGraph_t* graph)
+{
+    if(graph == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    hipsparse::stub::captureState& state = hipsparse::stub::getCaptureState();
+    std::lock_guard<std::mutex>    lock(state.mutex);
+
+    *graph  = nullptr;
+    auto it = state.streams.find(stream);
+    if(it == state.streams.end() || it->second == hipStreamCaptureStatusNone)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const hipStreamCaptureStatus status = it->second;
+    it->second                          = hipStreamCaptureStatusNone;
+    if(status == hipStreamCaptureStatusInvalidated)
+    {
+        return hipErrorStreamCaptureInvalidated;
+    }
+
+    *graph = reinterpret_cast<hipGraph_t>(hipsparse::stub::object_address.fetch_add(16));
+    return hipSuccess;
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipStreamIsCapturing(hipStream_t             stream,
+                                                      hipStreamCaptureStatus* status)
+{
+    if(status == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    hipsparse::stub::captureState& state = hipsparse::stub::getCaptureState();
+    std::lock_guard<std::mutex>    lock(state.mutex);
+
+    auto it = state.streams.find(stream);
+    *status = (it != state.streams.end()) ? it->second : hipStreamCaptureStatusNone;
+    return hipSuccess;
+}
+
+HIPSPARSE_STUB_EXPORT hipError_t hipGraphDestroy(hipGraph_t graph)
+{
+    return (graph != nullptr) ? hipSuccess : hipErrorInvalidValue;
+}
+
+hipError_t hipGetLastError(void)
+{
+    return hipSuccess;
+}
+
+// Every pointer is reported as unregistered host memory
+hipError_t hipPointerGetAttributes(hipPointerAttribute_t* attributes, const void* ptr)
+{
+    return hipErrorInvalidValue;
+}
@@ -0,0 +1,178 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+// Stub rocSPARSE, every routine returns rocsparse_status_success without doing any work.
+//
+// The routines are defined with their prototypes in the rocSPARSE headers, see CMakeLists.txt.
+// The getters and the buffer size routines zero their outputs, the pointers to non constant
+// scalars, as the backend reads them back.
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include <type_traits>
+
+namespace hipsparse
+{
+    namespace stub
+    {
+        // Handle or descriptor, only the state of the handle is kept
+        struct object
+        {
+            hipStream_t            stream       = nullptr;
+            rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+        };
+
+        template <typename P>
+        struct isOutput
+            : std::integral_constant<
+                  bool,
+                  std::is_pointer<P>::value
+                      && std::is_scalar<typename std::remove_pointer<P>::type>::value
+                      && !std::is_const<typename std::remove_pointer<P>::type>::value>
+        {
+        };
+
+        template <typename P>
+        inline typename std::enable_if<isOutput<P>::value>::type zeroOutput(P output)
+        {
+            if(output != nullptr)
+            {
+                *output = typename std::remove_pointer<P>::type();
+            }
+        }
+
+        template <typename P>
+        inline typename std::enable_if<!isOutput<P>::value>::type zeroOutput(P input)
+        {
+        }
+
+        template <typename... P>
+        inline void zeroOutputs(P... params)
+        {
+            int expand[] = {0, (zeroOutput(params), 0)...};
+            (void)expand;
+        }
+
+        template <typename T, typename... P>
+        inline void create(T** created, P...)
+        {
+            *created = reinterpret_cast<T*>(new object);
+        }
+
+        template <typename T, typename... P>
+        inline void destroy(T* destroyed, P...)
+        {
+            delete reinterpret_cast<object*>(
+                const_cast<typename std::remove_const<T>::type*>(destroyed));
+        }
+
+        inline object* get(rocsparse_handle handle)
+        {
+            return reinterpret_cast<object*>(handle);
+        }
+    }
+}
+
+#define HIPSPARSE_STUB_ROUTINE(TYPE, NAME, PARAMS, ARGS) \
+    extern "C" TYPE NAME PARAMS                           \
+    {                                                     \
+        return static_cast<TYPE>(0);                      \
+    }
+
+#define HIPSPARSE_STUB_GET(TYPE, NAME, PARAMS, ARGS) \
+    extern "C" TYPE NAME PARAMS                       \
+    {                                                 \
+        hipsparse::stub::zeroOutputs ARGS;            \
+        return static_cast<TYPE>(0);                  \
+    }
+
+#define HIPSPARSE_STUB_CREATE(TYPE, NAME, PARAMS, ARGS) \
+    extern "C" TYPE NAME PARAMS                          \
+    {                                                    \
+        hipsparse::stub::create ARGS;                    \
+        return static_cast<TYPE>(0);                     \
+    }
+
+#define HIPSPARSE_STUB_DESTROY(TYPE, NAME, PARAMS, ARGS) \
+    extern "C" TYPE NAME PARAMS                           \
+    {                                                     \
+        hipsparse::stub::destroy ARGS;                    \
+        return static_cast<TYPE>(0);                      \
+    }
+
+#include "rocsparse_stub_routines.hpp"
+
+extern "C" rocsparse_status rocsparse_set_stream(rocsparse_handle handle, hipStream_t stream)
+{
+    hipsparse::stub::get(handle)->stream = stream;
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_get_stream(rocsparse_handle handle, hipStream_t* stream)
+{
+    *stream = hipsparse::stub::get(handle)->stream;
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_set_pointer_mode(rocsparse_handle       handle,
+                                                       rocsparse_pointer_mode pointer_mode)
+{
+    hipsparse::stub::get(handle)->pointer_mode = pointer_mode;
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
+                                                       rocsparse_pointer_mode* pointer_mode)
+{
+    *pointer_mode = hipsparse::stub::get(handle)->pointer_mode;
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_get_version(rocsparse_handle handle, rocsparse_int* version)
+{
+    *version = 0;
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_get_git_rev(rocsparse_handle handle, char* rev)
+{
+    // rocSPARSE writes at most 64 characters
+    rev[0] = 's';
+    rev[1] = 't';
+    rev[2] = 'u';
+    rev[3] = 'b';
+    rev[4] = '\0';
+    return rocsparse_status_success;
+}
+
+extern "C" const char* rocsparse_get_status_name(rocsparse_status status)
+{
+    return "rocsparse_status_stub";
+}
+
+extern "C" const char* rocsparse_get_status_description(rocsparse_status status)
+{
+    return "stub rocSPARSE status";
+}
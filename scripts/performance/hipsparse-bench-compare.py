@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+# ########################################################################
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+
+#
+#
+# This script compares two result files written by hipsparse-bench (--bench-o).
+#
+# Cases are aligned by command line (without the program name) and matrix.
+# A case is a regression when its median time grows by more than the threshold
+# and the Mann-Whitney U test rejects equal timing distributions.
+# Result files without 'time_samples' fall back to the confidence intervals:
+# the intervals must not overlap.
+#
+# The exit code is 1 if any regression is found, 0 otherwise.
+#
+
+def load_results(filename):
+    with open(filename, 'r') as f:
+        data = json.load(f)
+    cases = {}
+    for result in data.get('results', []):
+        args = result['cmdline'].split()[1:]
+        matrix = result.get('matrix', '')
+        if matrix == '' and '--file' in args:
+            matrix = args[args.index('--file') + 1]
+        if matrix != '':
+            matrix = os.path.basename(matrix)
+            # Matrix paths differ between machines, keep the file name only.
+            args = [os.path.basename(a) if i > 0 and args[i - 1] == '--file' else a for i, a in enumerate(args)]
+        timing = result['timing']
+        time = [float(t) for t in timing['time']]
+        samples = [float(t) for t in timing.get('time_samples', [])]
+        key = ' '.join(args)
+        cases[key] = {'cmdline': key,
+                      'matrix': matrix,
+                      'median': time[0],
+                      'interval': time[1:3],
+                      'samples': samples}
+    return cases
+
+#
+# Two-sided Mann-Whitney U test with the normal approximation and tie correction.
+#
+def mann_whitney_pvalue(x, y):
+    n1 = len(x)
+    n2 = len(y)
+    if n1 == 0 or n2 == 0:
+        return None
+    values = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+    n = n1 + n2
+    ranks = [0.0] * n
+    ties = 0.0
+    i = 0
+    while i < n:
+        j = i
+        while j + 1 < n and values[j + 1][0] == values[i][0]:
+            j += 1
+        rank = 0.5 * (i + j) + 1.0
+        for k in range(i, j + 1):
+            ranks[k] = rank
+        t = j - i + 1
+        ties += t * t * t - t
+        i = j + 1
+    r1 = sum(ranks[k] for k in range(n) if values[k][1] == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    mu = n1 * n2 / 2.0
+    sigma2 = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1))) if n > 1 else 0.0
+    if sigma2 <= 0.0:
+        return 1.0
+    z = (abs(u1 - mu) - 0.5) / math.sqrt(sigma2)
+    return math.erfc(max(z, 0.0) / math.sqrt(2.0))
+
+def compare(base, head, threshold, alpha, function_filter):
+    rows = []
+    for key in sorted(set(base.keys()) | set(head.keys())):
+        if function_filter is not None and not function_filter.search(key):
+            continue
+        a = base.get(key)
+        b = head.get(key)
+        if a is None or b is None:
+            rows.append({'cmdline': key,
+                         'matrix': (a or b)['matrix'],
+                         'status': 'missing_in_base' if a is None else 'missing_in_head'})
+            continue
+
+        ratio = b['median'] / a['median'] if a['median'] > 0.0 else float('inf')
+        pvalue = mann_whitney_pvalue(a['samples'], b['samples'])
+        if pvalue is not None:
+            significant = pvalue < alpha
+            test = 'mann-whitney'
+        else:
+            significant = b['interval'][0] > a['interval'][1] or b['interval'][1] < a['interval'][0]
+            test = 'interval'
+
+        status = 'unchanged'
+        if significant and ratio > 1.0 + threshold:
+            status = 'regression'
+        elif significant and ratio < 1.0 / (1.0 + threshold):
+            status = 'improvement'
+
+        rows.append({'cmdline': key,
+                     'matrix': a['matrix'],
+                     'base_msec': a['median'],
+                     'head_msec': b['median'],
+                     'ratio': ratio,
+                     'pvalue': pvalue,
+                     'test': test,
+                     'status': status})
+    return rows
+
+def write_markdown(out, rows, threshold, alpha):
+    out.write('| Status | Case | Matrix | Base (ms) | Head (ms) | Ratio | p-value |\n')
+    out.write('|---|---|---|---:|---:|---:|---:|\n')
+    for r in rows:
+        if 'ratio' not in r:
+            out.write('| %s | `%s` | %s | | | | |\n' % (r['status'], r['cmdline'], r['matrix']))
+            continue
+        pvalue = '%.3g' % r['pvalue'] if r['pvalue'] is not None else 'n/a'
+        out.write('| %s | `%s` | %s | %.4g | %.4g | %.3f | %s |\n' % (r['status'], r['cmdline'], r['matrix'],
+                                                                    r['base_msec'], r['head_msec'],
+                                                                    r['ratio'], pvalue))
+    nregressions = sum(1 for r in rows if r['status'] == 'regression')
+    out.write('\n%d regression(s), threshold %.1f%%, alpha %g.\n' % (nregressions, threshold * 100.0, alpha))
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Compare two hipsparse-bench result files.')
+    parser.add_argument('base', help = 'reference result file.')
+    parser.add_argument('head', help = 'result file to check.')
+    parser.add_argument('-t', '--threshold', required=False, type=float, default = 0.05,
+                        help = 'relative slowdown of the median time to flag, default 0.05.')
+    parser.add_argument('-a', '--alpha', required=False, type=float, default = 0.05,
+                        help = 'significance level of the statistical test, default 0.05.')
+    parser.add_argument('-f', '--filter', required=False, default = '',
+                        help = 'Regular expression, only compare cases whose command line matches, e.g. "csrmv|spmv|spgemm".')
+    parser.add_argument('-o', '--ofilename', required=False, default = '',
+                        help = 'output file name of the machine readable verdict (.json).')
+    parser.add_argument('-m', '--markdown', required=False, default = '',
+                        help = 'output file name of the Markdown table, standard output by default.')
+    parser.add_argument('--allow-missing', required=False, default = False, action = 'store_true',
+                        help = 'do not fail when a case is missing in one of the files.')
+
+    user_args = parser.parse_args()
+    function_filter = re.compile(user_args.filter) if user_args.filter != '' else None
+
+    base = load_results(user_args.base)
+    head = load_results(user_args.head)
+    rows = compare(base, head, user_args.threshold, user_args.alpha, function_filter)
+
+    nregressions = sum(1 for r in rows if r['status'] == 'regression')
+    nmissing = sum(1 for r in rows if r['status'].startswith('missing'))
+    failed = nregressions > 0 or (nmissing > 0 and not user_args.allow_missing)
+
+    if user_args.markdown != '':
+        with open(user_args.markdown, 'w') as out:
+            write_markdown(out, rows, user_args.threshold, user_args.alpha)
+    else:
+        write_markdown(sys.stdout, rows, user_args.threshold, user_args.alpha)
+
+    if user_args.ofilename != '':
+        verdict = {'verdict': 'fail' if failed else 'pass',
+                   'base': user_args.base,
+                   'head': user_args.head,
+                   'threshold': user_args.threshold,
+                   'alpha': user_args.alpha,
+                   'regressions': nregressions,
+                   'improvements': sum(1 for r in rows if r['status'] == 'improvement'),
+                   'missing': nmissing,
+                   'cases': rows}
+        with open(user_args.ofilename, 'w') as out:
+            json.dump(verdict, out, indent = 2)
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())